@@ -101,6 +101,7 @@ class BaseCppFile(BaseFile.BaseFile):
 
         self.num_non_std_children = 0
         self.class_attributes = []
+        self.lo_id_index = False
 
     ########################################################################
 
@@ -203,6 +204,16 @@ class BaseCppFile(BaseFile.BaseFile):
 
         self.class_attributes = query.separate_attributes(self.attributes)
 
+        # Identifier index maintained by the listOf class:
+        if 'lo_id_index' in class_object:
+            self.lo_id_index = class_object['lo_id_index']
+
+        # Array text kept unparsed until the array is first used:
+        self.lazy_array = False
+        if 'lazyArray' in class_object:
+            self.lazy_array = class_object['lazyArray'] \
+                and query.has_array(self.class_attributes)
+
         # Document class for other libraries:
         self.document = False
         if 'document' in class_object:
@@ -217,6 +228,7 @@ class BaseCppFile(BaseFile.BaseFile):
                     'concretes': self.concretes,
                     'has_array': query.has_array(self.class_attributes),
                     'has_vector': query.has_vector(self.class_attributes),
+                    'lazy_array': self.lazy_array,
                     'has_math': self.has_math,
                     'has_children': self.has_children,
                     'has_only_math': self.has_only_math,
@@ -1246,6 +1258,8 @@ class BaseCppFile(BaseFile.BaseFile):
             self.write_block('while', code, True)
         elif code_type == 'try':
             self.write_try_block(code)
+        elif code_type == 'switch':
+            self.write_switch_block(code)
 
     def write_nested_implementation(self, implementation):
         """
@@ -1309,6 +1323,24 @@ class BaseCppFile(BaseFile.BaseFile):
         self.write_block('if', if_code, True)
         self.write_block('else', code[i + 1: num], False)
 
+    def write_switch_block(self, code):
+        """
+        Write a C/C++ switch block
+
+        :param code: list whose first entry is the expression switched on;
+            it is followed by case labels ('case X' or 'default'), each of
+            which may be followed by a list of code fragments for that case
+        :returns: nothing
+        """
+        self.write_line('switch ({0})'.format(code[0]))
+        self.write_line('{')
+        for fragment in code[1:]:
+            if isinstance(fragment, list):
+                self.write_nested_implementation(fragment)
+            else:
+                self.write_line('{0}:'.format(fragment))
+        self.write_line('}')
+
     def write_else_if_block(self, code):
         """
         Write a C/C++ "else if" block
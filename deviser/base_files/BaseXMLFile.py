@@ -53,6 +53,12 @@ from ..util import strFunctions, query
 class BaseXMLFile(BaseFile.BaseFile):
     """Common base class for all interface files"""
 
+    # core listOfs that are not written for the plugins on their children
+    unwritten_list_ofs = ['listOfReactions', 'listOfSimpleSpeciesReferences',
+                          'listOfSpeciesReferences',
+                          'listOfInSpeciesTypeBonds',
+                          'listOfOutwardBindingSites']
+
     def __init__(self, name, package, reqd, ext='xml'):
         """
         Constructor
@@ -199,9 +205,7 @@ class BaseXMLFile(BaseFile.BaseFile):
         :return:
         """
         name = strFunctions.lower_list_of_name_no_prefix(tree['base'])
-        if name in ['listOfReactions', 'listOfSimpleSpeciesReferences',
-                    'listOfSpeciesReferences', 'listOfInSpeciesTypeBonds',
-                    'listOfOutwardBindingSites']:
+        if name in self.unwritten_list_ofs:
             return None
         lo_element = self.doc.createElement('{0}'.format(name))
         element = self.create_object(tree)
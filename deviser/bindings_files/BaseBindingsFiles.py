@@ -43,7 +43,7 @@ import os
 from ..base_files import BaseInterfaceFile, BaseFile, BaseCMakeFile, BaseTemplateFile
 from ..code_files import CppHeaderFile
 from ..code_files import CppCodeFile
-from ..util import strFunctions, global_variables
+from ..util import strFunctions, global_variables, query
 
 
 class BaseBindingsFiles(BaseTemplateFile.BaseTemplateFile):
@@ -187,11 +187,28 @@ class BaseBindingsFiles(BaseTemplateFile.BaseTemplateFile):
                 if element['hasListOf']: 
                     loname = strFunctions.prefix_name(
                         strFunctions.list_of_name(element['name']))
+                    self.print_columns(fileout, element, loname)
                     fileout.copy_line_verbatim('%include <{0}/{1}.h>\n'
                                                ''.format(global_variables.language,
                                                          loname))
 
 
+    # the Columns of a listOf are wrapped as a nested class; the vectors of
+    # builtin types are wrapped with the library and those of enumerations
+    # here
+    def print_columns(self, fileout, element, loname):
+        column_types = query.get_column_types(element['attribs'])
+        if len(column_types) == 0:
+            return
+        for column_type in column_types:
+            if column_type.endswith('_t'):
+                fileout.copy_line_verbatim('%template({0}StdVector) '
+                                           'std::vector<{1}>;\n'
+                                           ''.format(column_type[0:-2],
+                                                     column_type))
+        fileout.copy_line_verbatim('%rename({0}Columns) {0}::Columns;\n'
+                                   ''.format(loname))
+
     def print_derived_types(self, fileout):
         libname = global_variables.library_name.lower()
         if self.binding == 'java' or self.binding == 'csharp':
@@ -91,12 +91,9 @@ class DowncastPackagesFile():
         self.fileout.up_indent()
         self.fileout.write_line('case {0}_LIST_OF:'.format(self.cap_language))
         self.fileout.up_indent()
-        self.fileout.write_line('name = sb->getElementName();')
-        code = self.create_list_of_block()
-        self.fileout.write_implementation_block(code['code_type'], code['code'])
-        self.fileout.skip_line()
-        self.fileout.write_line('return SWIGTYPE_p_ListOf;')
-        self.fileout.skip_line()
+        self.write_list_of_types('static_cast<ListOf*>(sb)->getItemTypeCode()',
+                                 '',
+                                 'return SWIGTYPE_p_{0};')
         self.fileout.down_indent()
         self.write_element_types()
         self.fileout.write_line('default:')
@@ -204,7 +201,6 @@ class DowncastPackagesFile():
         self.fileout.write_line('}')
 
     def write_element_downcast(self, public, args, equals):
-        string = 'string' if self.binding == 'csharp' else 'String'
         self.fileout.write_line('{0} {1} Downcast{1}({2})'.format(public,
                                                                   self.base,
                                                                   args))
@@ -212,21 +208,18 @@ class DowncastPackagesFile():
         self.fileout.up_indent()
         self.fileout.write_line('if (cPtr{0}) return null;'.format(equals))
         self.fileout.skip_line()
-        self.fileout.write_line('{0} sb = new {0}(cPtr, '
-                                'false);'.format(self.base))
-        self.fileout.write_line('switch ( sb.getTypeCode() )')
+        self.fileout.write_line('switch ( {0} )'.format(
+            self.get_native_call(self.base, 'getTypeCode')))
         self.fileout.write_line('{')
         self.fileout.up_indent()
         self.fileout.write_line('case (int) lib{0}.{1}_'
                                 'LIST_OF:'.format(self.language,
                                                   self.cap_language))
         self.fileout.up_indent()
-        self.fileout.write_line('{0} name = sb.getElementName();'.format(string))
-        code = self.create_list_of_block(self.binding)
-        self.fileout.write_implementation_block(code['code_type'], code['code'])
-        self.fileout.skip_line()
-        self.fileout.write_line('return new ListOf(cPtr, owner);')
-        self.fileout.skip_line()
+        self.write_list_of_types(self.get_native_call('ListOf',
+                                                      'getItemTypeCode'),
+                                 '(int) lib{0}.'.format(self.language),
+                                 'return new {0}(cPtr, owner);')
         self.fileout.down_indent()
         for element in self.elements:
             self.fileout.write_line('case (int) lib{0}.'
@@ -331,31 +324,42 @@ class DowncastPackagesFile():
             self.fileout.down_indent()
             self.fileout.skip_line()
 
-    def create_list_of_block(self, b_type=''):
-        line = []
-        count = 0
-        for element in self.elements:
-            if element['hasListOf']:
-                count += 1
-                up_loname = strFunctions.list_of_name(element['name'])
-                loname = strFunctions.lower_first(up_loname)
-                if len(line) > 0:
-                    line.append('else if')
-                if b_type == 'java':
-                    line.append('name.equals(\"{0}\")'.format(loname))
-                else:
-                    line.append('name == \"{0}\"'.format(loname))
-                if b_type == 'java' or b_type == 'csharp':
-                    line.append('return new {0}(cPtr, owner)'.format(up_loname))
-                else:
-                    line.append('return SWIGTYPE_p_{0}'.format(up_loname))
-        if count == 0:
-            code = self.create_code_block('blank', [])
-        elif count == 1:
-            code = self.create_code_block('if', line)
+    # the type codes are read through the native wrapper functions
+    # rather than by creating a throw-away proxy object for each downcast
+    def get_native_call(self, class_name, function):
+        if self.binding == 'csharp':
+            return '$modulePINVOKE.{0}_{1}(new HandleRef(null, ' \
+                   'cPtr))'.format(class_name, function)
         else:
-            code = self.create_code_block('else_if', line)
-        return code
+            return '$moduleJNI.{0}_{1}(cPtr, null)'.format(class_name,
+                                                           function)
+
+    # a listOf is matched on the type code of its items rather than
+    # by comparing its element name with each listOf name in turn
+    def write_list_of_types(self, item_type, prefix, ret):
+        lists = [element for element in self.elements if element['hasListOf']]
+        if len(lists) == 0:
+            self.fileout.write_line(ret.format('ListOf'))
+            self.fileout.skip_line()
+            return
+        self.fileout.write_line('switch ( {0} )'.format(item_type))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        for element in lists:
+            self.fileout.write_line('case {0}{1}:'.format(prefix,
+                                                          element['typecode']))
+            self.fileout.up_indent()
+            self.fileout.write_line(ret.format(
+                strFunctions.list_of_name(element['name'])))
+            self.fileout.down_indent()
+            self.fileout.skip_line()
+        self.fileout.write_line('default:')
+        self.fileout.up_indent()
+        self.fileout.write_line(ret.format('ListOf'))
+        self.fileout.down_indent()
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
 
     ########################################################################
 
@@ -38,7 +38,7 @@
 # ------------------------------------------------------------------------ -->
 
 from ..base_files import BaseCppFile
-from ..util import strFunctions, global_variables
+from ..util import strFunctions, global_variables, query
 
 
 class NativeSwigFile():
@@ -94,8 +94,10 @@ class NativeSwigFile():
                                 'Extension>;'.format(self.up_package,
                                                      self.cap_language))
         self.fileout.skip_line()
+        self.write_columns()
         self.write_includes('%')
         self.fileout.skip_line()
+        self.write_array_buffers()
         self.fileout.write_line('#endif /* USE_{0} */'.format(self.cap_package))
         self.fileout.skip_line()
 
@@ -160,6 +162,277 @@ class NativeSwigFile():
                 self.fileout.write_line('%newobject '
                                         'remove{0};'.format(element['name']))
 
+    # the Columns of the listOf classes are wrapped as nested classes and
+    # their vectors as the std::vector templates; the vector of double is
+    # already wrapped as DoubleStdVector by the core library
+    def write_columns(self):
+        column_types = []
+        renames = []
+        for element in self.elements:
+            if not element['hasListOf']:
+                continue
+            types = query.get_column_types(element['attribs'])
+            if len(types) == 0:
+                continue
+            for column_type in types:
+                if column_type not in column_types:
+                    column_types.append(column_type)
+            lo_name = strFunctions.list_of_name(element['name'])
+            renames.append('%rename({0}Columns) {0}::Columns;'
+                           ''.format(lo_name))
+        if len(column_types) == 0:
+            return
+        self.fileout.write_line('%include \"std_vector.i\"')
+        for column_type in column_types:
+            if column_type == 'double':
+                continue
+            self.fileout.write_line('%template({0}) std::vector<{1}>;'
+                                    ''.format(self.get_vector_name(column_type),
+                                              column_type))
+        for rename in renames:
+            self.fileout.write_line(rename)
+        self.fileout.skip_line()
+
+    # the enumerations are unique to the package, but the vectors of
+    # builtin types are named for the package as other packages may also
+    # wrap them
+    def get_vector_name(self, column_type):
+        if column_type.endswith('_t'):
+            return '{0}StdVector'.format(column_type[0:-2])
+        names = {'std::string': 'String', 'bool': 'Bool', 'int': 'Int',
+                 'unsigned int': 'UnsignedInt'}
+        return '{0}{1}StdVector'.format(self.up_package, names[column_type])
+
+    # python gets views of array attributes that share the memory of the
+    # object and can set them from any contiguous buffer with one copy
+    def write_array_buffers(self):
+        arrays = []
+        for element in self.elements:
+            for attrib in element['attribs']:
+                if attrib['type'] == 'array' \
+                        and self.get_buffer_format(attrib) is not None:
+                    arrays.append([element['name'], attrib])
+        if len(arrays) == 0:
+            return
+        self.fileout.write_line('#ifdef SWIGPYTHON')
+        self.fileout.skip_line()
+        self.write_array_owner()
+        for [name, attrib] in arrays:
+            self.write_array_buffer(name, attrib)
+        self.fileout.write_line('#endif /* SWIGPYTHON */')
+        self.fileout.skip_line()
+
+    # a memoryview of an array must keep the proxy owning the array alive;
+    # PyMemoryView_FromBuffer drops the object of the buffer it is given,
+    # so the view is taken from a small exporter that holds the proxy
+    def write_array_owner(self):
+        owner = '{0}ArrayOwner'.format(self.up_package)
+        self.fileout.write_line('%{')
+        self.fileout.write_line('/* keeps the object owning an array alive '
+                                'for as long as a view of it */')
+        self.fileout.write_line('struct {0}'.format(owner))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('PyObject_HEAD')
+        self.fileout.write_line('PyObject* owner;')
+        self.fileout.write_line('void* data;')
+        self.fileout.write_line('Py_ssize_t length;')
+        self.fileout.down_indent()
+        self.fileout.write_line('};')
+        self.fileout.skip_line()
+        self.fileout.write_line('static int')
+        self.fileout.write_line('{0}_getbuffer(PyObject* self, Py_buffer* '
+                                'view, int flags)'.format(owner))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('{0}* exporter = ({0}*)(self);'.format(owner))
+        self.fileout.write_line('return PyBuffer_FillInfo(view, self, '
+                                'exporter->data, exporter->length, 1,')
+        self.fileout.write_line('                         flags);')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('static void')
+        self.fileout.write_line('{0}_dealloc(PyObject* self)'.format(owner))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('Py_XDECREF((({0}*)(self))->owner);'
+                                ''.format(owner))
+        self.fileout.write_line('PyObject_Del(self);')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('static PyBufferProcs {0}_buffer;'
+                                ''.format(owner))
+        self.fileout.write_line('static PyTypeObject {0}_type ='
+                                ''.format(owner))
+        self.fileout.write_line_verbatim('  { PyVarObject_HEAD_INIT(NULL, '
+                                         '0) };')
+        self.fileout.skip_line()
+        self.fileout.write_line('static PyObject*')
+        self.fileout.write_line('new{0}ArrayView(PyObject* owner, const void* '
+                                'data, Py_ssize_t length,'
+                                ''.format(self.up_package))
+        self.fileout.write_line_verbatim('{0}const char* format)'
+                                         ''.format(' ' * (len(self.up_package)
+                                                          + 13)))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('if ({0}_type.tp_name == NULL)'.format(owner))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('{0}_buffer.bf_getbuffer = {0}_getbuffer;'
+                                ''.format(owner))
+        self.fileout.write_line('{0}_type.tp_name = \"{0}\";'.format(owner))
+        self.fileout.write_line('{0}_type.tp_basicsize = sizeof({0});'
+                                ''.format(owner))
+        self.fileout.write_line('{0}_type.tp_dealloc = {0}_dealloc;'
+                                ''.format(owner))
+        self.fileout.write_line('{0}_type.tp_flags = Py_TPFLAGS_DEFAULT;'
+                                ''.format(owner))
+        self.fileout.write_line('{0}_type.tp_as_buffer = &{0}_buffer;'
+                                ''.format(owner))
+        self.fileout.write_line('if (PyType_Ready(&{0}_type) != 0)'
+                                ''.format(owner))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('{0}_type.tp_name = NULL;'.format(owner))
+        self.fileout.write_line('return NULL;')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('{0}* exporter ='.format(owner))
+        self.fileout.write_line_verbatim('  PyObject_New({0}, &{0}_type);'
+                                         ''.format(owner))
+        self.write_if('exporter == NULL', 'return NULL;')
+        self.fileout.write_line('Py_INCREF(owner);')
+        self.fileout.write_line('exporter->owner = owner;')
+        self.fileout.write_line('exporter->data = const_cast<void*>(data);')
+        self.fileout.write_line('exporter->length = length;')
+        self.fileout.write_line('PyObject* raw = PyMemoryView_FromObject('
+                                '(PyObject*)(exporter));')
+        self.fileout.write_line('Py_DECREF(exporter);')
+        self.write_if('raw == NULL', 'return NULL;')
+        self.fileout.write_line('PyObject* view = PyObject_CallMethod(raw, '
+                                '(char*)\"cast\", (char*)\"s\", format);')
+        self.fileout.write_line('Py_DECREF(raw);')
+        self.fileout.write_line('return view;')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.write_line('%}')
+        self.fileout.skip_line()
+
+    def write_array_buffer(self, name, attrib):
+        [c_type, formats] = self.get_buffer_format(attrib)
+        cap_name = strFunctions.upper_first(attrib['name'])
+        invalid = global_variables.ret_invalid_att
+        self.fileout.write_line('/**')
+        self.fileout.write_line_verbatim(' * Buffer protocol access to the '
+                                         '\"{0}\" array of {1}.'
+                                         ''.format(attrib['name'], name))
+        self.fileout.write_line_verbatim(' * The view returned by get{0}'
+                                         'Buffer() is read only, keeps the '
+                                         'object alive'.format(cap_name))
+        self.fileout.write_line_verbatim(' * and is valid until the array '
+                                         'is changed.')
+        self.fileout.write_line(' */')
+        self.fileout.write_line('%extend {0}'.format(name))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('PyObject* get{0}BufferFor(PyObject* owner) '
+                                'const'.format(cap_name))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('const {0}* data = $self->get{1}Pointer();'
+                                ''.format(c_type, cap_name))
+        self.fileout.write_line('// the view covers the values actually held, '
+                                'whatever the length')
+        self.fileout.write_line('// attribute says')
+        self.fileout.write_line('int count = $self->get{0}Count();'
+                                ''.format(cap_name))
+        self.write_if('data == NULL || count <= 0', 'Py_RETURN_NONE;')
+        self.fileout.write_line('Py_ssize_t length = sizeof({0}) * '
+                                '(Py_ssize_t)(count);'.format(c_type))
+        self.fileout.write_line('return new{0}ArrayView(owner, data, length, '
+                                '\"{1}\");'.format(self.up_package,
+                                                    formats[0]))
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('%pythoncode')
+        self.fileout.write_line('%{')
+        self.fileout.write_line_verbatim('  def get{0}Buffer(self):'
+                                         ''.format(cap_name))
+        self.fileout.write_line_verbatim('    return self.get{0}BufferFor'
+                                         '(self)'.format(cap_name))
+        self.fileout.write_line('%}')
+        self.fileout.skip_line()
+        self.fileout.write_line('int set{0}FromBuffer(PyObject* buffer)'
+                                ''.format(cap_name))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('Py_buffer view;')
+        self.fileout.write_line('int flags = PyBUF_C_CONTIGUOUS | '
+                                'PyBUF_FORMAT;')
+        self.fileout.write_line('if (PyObject_GetBuffer(buffer, &view, '
+                                'flags) != 0)')
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('PyErr_Clear();')
+        self.fileout.write_line('return {0};'.format(invalid))
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('const char* format = view.format + '
+                                'strspn(view.format, \"@=\");')
+        self.fileout.write_line('int result = {0};'.format(invalid))
+        self.fileout.write_line('bool matches = view.itemsize == '
+                                'sizeof({0}) && *format != \'\\0\';'
+                                ''.format(c_type))
+        self.fileout.write_line('if (matches && strchr(\"{0}\", *format) != '
+                                'NULL)'.format(formats))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line('int length = (int)(view.len / '
+                                'sizeof({0}));'.format(c_type))
+        self.fileout.write_line('result = $self->set{0}(({1}*)(view.buf), '
+                                'length);'.format(cap_name, c_type))
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+        self.fileout.write_line('PyBuffer_Release(&view);')
+        self.fileout.write_line('return result;')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+
+    def write_if(self, condition, line):
+        self.fileout.write_line('if ({0})'.format(condition))
+        self.fileout.write_line('{')
+        self.fileout.up_indent()
+        self.fileout.write_line(line)
+        self.fileout.down_indent()
+        self.fileout.write_line('}')
+        self.fileout.skip_line()
+
+    # the C type of the array and the buffer format characters that match it
+    @staticmethod
+    def get_buffer_format(attrib):
+        element = attrib['element']
+        if element in ['Integer', 'integer', 'int']:
+            return ['int', 'il']
+        elif element in ['Double', 'double']:
+            return ['double', 'd']
+        elif element in ['Float', 'float']:
+            return ['float', 'f']
+        elif element in ['UnsignedInteger', 'uint', 'unsigned int']:
+            return ['unsigned int', 'IL']
+        return None
+
     def write_include_line(self, sep, ctype, my_dir):
         self.fileout.write_line_verbatim('{0}include <{1}{2}.h>'.format(sep,
                                                                      my_dir,
@@ -0,0 +1,78 @@
+#!/usr/bin/env python
+"""
+Times how long the Python bindings take to hand package objects over.
+
+Reads a document that uses a package, such as one of the validation
+examples in the deviser test suite, and grows the first non-empty listOf
+of the package to the given number of items. It then reports the time
+taken to fetch every item of the listOf, each of which is downcast to its
+class, and to fetch the listOf back from each item, which is downcast on
+the type code of its items.
+
+usage: python downcast_benchmark.py filename [count]
+"""
+
+import sys
+import time
+
+import libsbml
+
+
+def find_package_list_of(doc):
+    """
+    Return the first listOf of a package in the document that has items,
+    or None.
+    """
+    elements = doc.getListOfAllElements()
+    for i in range(elements.getSize()):
+        element = elements.get(i)
+        if element.getTypeCode() == libsbml.SBML_LIST_OF \
+                and element.getPackageName() != 'core' \
+                and element.size() > 0:
+            return element
+    return None
+
+
+def report(step, count, start):
+    seconds = time.perf_counter() - start
+    print('{0}: {1:.3f}s, {2:.3f}us per object'.format(
+        step, seconds, seconds * 1000000 / count))
+
+
+def main(args):
+    if len(args) < 2 or len(args) > 3:
+        print('usage: python downcast_benchmark.py filename [count]')
+        return 2
+    count = int(args[2]) if len(args) > 2 else 100000
+
+    doc = libsbml.readSBMLFromFile(args[1])
+    if doc.getNumErrors(libsbml.LIBSBML_SEV_FATAL) > 0:
+        print('could not read {0}'.format(args[1]))
+        return 1
+
+    list_of = find_package_list_of(doc)
+    if list_of is None:
+        print('{0} has no listOf of a package with items'.format(args[1]))
+        return 1
+
+    item = list_of.get(0)
+    while list_of.size() < count:
+        list_of.append(item)
+    print('{0} with {1} {2} items'.format(type(list_of).__name__,
+                                          list_of.size(),
+                                          type(item).__name__))
+
+    start = time.perf_counter()
+    for i in range(count):
+        list_of.get(i)
+    report('items', count, start)
+
+    start = time.perf_counter()
+    for i in range(count):
+        item.getParentSBMLObject()
+    report('listOf', count, start)
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main(sys.argv))
@@ -295,6 +295,14 @@ typedef std::vector<double> DoubleStdVector;
 typedef std::vector<XMLError*> XmlErrorStdVector;
 %template(SBMLErrorStdVector) std::vector<SBMLError>;
 typedef std::vector<SBMLError> SBMLErrorStdVector;
+%template(StringStdVector) std::vector<std::string>;
+typedef std::vector<std::string> StringStdVector;
+%template(BoolStdVector) std::vector<bool>;
+typedef std::vector<bool> BoolStdVector;
+%template(IntStdVector) std::vector<int>;
+typedef std::vector<int> IntStdVector;
+%template(UnsignedIntStdVector) std::vector<unsigned int>;
+typedef std::vector<unsigned int> UnsignedIntStdVector;
 
 %include common/libsbml-version.h
 %include common/SBMLOperationReturnValues.h
@@ -69,6 +69,8 @@ class BaseCMakeFiles(BaseTemplateFile.BaseTemplateFile):
         os.chdir(src_dir)
         os.chdir('{0}'.format(gv.language))
         self.write_file_for_dir('code')
+        os.chdir('test')
+        self.write_file_for_dir('test')
         os.chdir(current_dir)
 
     def write_file_for_dir(self, this_dir):
@@ -127,16 +127,30 @@ class CMakeFiles():
         ex.write_file()
         ex.close_file()
 
+    def write_validator_test_files(self):
+        """
+        Write the CMakeLists.txt file building the validator benchmark.
+        """
+        txt = CMakeListsFile.CMakeListsFile('CMakeLists', self.package, True)
+        if self.verbose:
+            print('Writing file {0}'.format(txt.fileout.filename))
+        txt.write_file()
+        txt.close_file()
+
     ########################################################################
 
     def write_files(self):
         """
-        Write 'package' and 'register' files.
+        Write 'package', 'register' and validator test files.
         """
         self.write_package_files()
         os.chdir('src/{0}/packages'.format(self.language))
         self.write_register_files()
         os.chdir(self.this_dir)
+        os.chdir('src/{0}/packages/{1}/validator/test'.format(self.language,
+                                                             self.package))
+        self.write_validator_test_files()
+        os.chdir(self.this_dir)
 
     def write_other_library_files(self):
         """
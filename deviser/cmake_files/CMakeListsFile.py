@@ -45,13 +45,18 @@ from ..util import strFunctions, global_variables
 class CMakeListsFile():
     """Class for CMake package files"""
 
-    def __init__(self, name, package):
+    def __init__(self, name, package, benchmark=False):
 
         self.package = package.lower()
+        self.benchmark = benchmark
         self.fileout = BaseTxtFile.BaseTxtFile(name)
 
-        self.fileout.brief_description = \
-            'CMake build scripts for example programs'
+        if benchmark:
+            self.fileout.brief_description = \
+                'CMake build script for the validator benchmark'
+        else:
+            self.fileout.brief_description = \
+                'CMake build scripts for example programs'
 
         self.cap_package = self.package.upper()
         self.up_package = strFunctions.upper_first(self.package)
@@ -170,13 +175,55 @@ class CMakeListsFile():
                                         self.package))
         fout.skip_line()
 
+    def write_benchmark(self):
+        fout = self.fileout
+        program = '{0}ValidatorBenchmark'.format(self.up_package)
+
+        fout.skip_line()
+        fout.write_line('add_executable({0} {0}.cpp)'.format(program))
+        fout.write_line_verbatim('target_link_libraries({0} ${1}LIBSBML_'
+                                 'LIBRARY{2}-static)'.format(program,
+                                                             self.open_br,
+                                                             self.close_br))
+        fout.skip_line()
+        fout.write_line('if (WIN32 AND NOT CYGWIN)')
+        fout.up_indent()
+        fout.write_line_verbatim('set_target_properties({0} PROPERTIES '
+                                 'COMPILE_DEFINITIONS '
+                                 '\"LIBSBML_STATIC=1\")'.format(program))
+        fout.down_indent()
+        fout.write_line('endif(WIN32 AND NOT CYGWIN)')
+        fout.skip_line()
+        fout.write_line('# a directory of documents, such as the validation '
+                        'examples of the')
+        fout.write_line('# package in the deviser test suite, runs the '
+                        'benchmark as a test')
+        fout.write_line_verbatim('set({0}_BENCHMARK_DIR \"\" CACHE PATH '
+                                 '\"Directory of documents validated by the '
+                                 '{1} validator benchmark\")'
+                                 ''.format(self.cap_package, self.package))
+        fout.skip_line()
+        fout.write_line('if ({0}_BENCHMARK_DIR)'.format(self.cap_package))
+        fout.up_indent()
+        fout.write_line_verbatim('add_test(NAME test_{0}_validator_benchmark '
+                                 'COMMAND {1} ${2}{3}_BENCHMARK_DIR{4})'
+                                 ''.format(self.package, program,
+                                           self.open_br, self.cap_package,
+                                           self.close_br))
+        fout.down_indent()
+        fout.write_line('endif({0}_BENCHMARK_DIR)'.format(self.cap_package))
+        fout.skip_line()
+
     ########################################################################
 
     # Write file
 
     def write_file(self):
         self.fileout.write_file()
-        self.write_examples()
+        if self.benchmark:
+            self.write_benchmark()
+        else:
+            self.write_examples()
 
     def close_file(self):
         self.fileout.close_file()
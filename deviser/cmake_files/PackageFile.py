@@ -220,7 +220,10 @@ class PackageFile():
         fout.write_comment_line('add test scripts')
         fout.close_comment()
         fout.write_line('if (WITH_CHECK)')
-        fout.skip_line(2)
+        fout.up_indent()
+        fout.write_line('add_subdirectory({0}/packages/{1}/validator/'
+                        'test)'.format(self.language, self.package))
+        fout.down_indent()
         fout.write_line('endif()')
         fout.skip_line()
         fout.write_line('endif()')
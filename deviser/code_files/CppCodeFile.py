@@ -75,6 +75,7 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         self.write_functions_to_retrieve()
         if self.document:
             self.write_document_error_log_functions()
+            self.write_document_id_index_functions()
         self.write_protected_functions()
         if self.add_impl is not None and not self.is_list_of:
             self.copy_additional_file(self.add_impl)
@@ -212,6 +213,22 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         if write_math:
             self.write_line_verbatim('#include <sbml/math/MathML.h>')
 
+        # array values are formatted with sprintf and parsed with streams
+        if self.class_object['has_array'] and self.is_cpp_api \
+                and not self.is_list_of:
+            self.write_line_verbatim('#include <clocale>')
+            self.write_line_verbatim('#include <cstdio>')
+            self.write_line_verbatim('#include <cstdlib>')
+            self.write_line_verbatim('#include <cstring>')
+            self.write_line_verbatim('#include <limits>')
+            self.write_line_verbatim('#include <locale>')
+            self.write_line_verbatim('#include <sstream>')
+
+        # the pool counts the unused blocks of each chunk when trimmed
+        if 'pooled' in self.class_object and self.class_object['pooled'] \
+                and self.is_cpp_api and not self.is_list_of:
+            self.write_line_verbatim('#include <map>')
+
         if len(concrete_classes) > 0:
             self.skip_line()
         for element in concrete_classes:
@@ -224,6 +241,8 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
                 self.write_line_verbatim('#include <{0}/{1}.h>'
                                          ''.format(self.language, element))
         self.skip_line(2)
+        if self.lazy_array and self.is_cpp_api and not self.is_list_of:
+            self.write_array_text_state()
         self.write_line('using namespace std;')
         self.skip_line()
 
@@ -281,6 +300,30 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = constructor.write_destructor()
         self.write_function_implementation(code)
 
+        code = constructor.write_operator_new(False)
+        self.write_function_implementation(code)
+
+        code = constructor.write_operator_delete(False)
+        self.write_function_implementation(code)
+
+        code = constructor.write_trim_pool(False)
+        self.write_function_implementation(code)
+
+    # the callback getAllElements() passes to forEachElement()
+    def write_add_element_to_list(self):
+        self.write_brief_header('Used by getAllElements() to collect the '
+                                'elements it is passed.')
+        self.write_line('static bool')
+        self.write_line('addElementToList({0}* element, void* '
+                        'userData)'.format(self.std_base))
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('static_cast<List*>(userData)->add(element);')
+        self.write_line('return true;')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line(2)
+
     ########################################################################
 
     # Functions for writing the attribute manipulation functions
@@ -301,6 +344,12 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_get_string_for_enum(True, i)
             self.write_function_implementation(code)
 
+            code = attrib_functions.write_get_array_pointer(True, i)
+            self.write_function_implementation(code)
+
+            code = attrib_functions.write_get_array_count(True, i)
+            self.write_function_implementation(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_is_set(True, i)
             self.write_function_implementation(code)
@@ -318,6 +367,12 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_add_element_for_vector(True, i)
             self.write_function_implementation(code)
 
+            code = attrib_functions.write_adopt_array(True, i)
+            self.write_function_implementation(code)
+
+            code = attrib_functions.write_release_array(True, i)
+            self.write_function_implementation(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_unset(True, i)
             self.write_function_implementation(code)
@@ -436,6 +491,45 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = attrib_functions.write_unset(query.get_unique_attributes(self.class_attributes))
         self.write_function_implementation(code, exclude=True)
 
+        code = attrib_functions.write_lookup_attribute()
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(bool_atts, 'bool')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(int_atts, 'int')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(double_atts, 'double')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(uint_atts, 'unsigned int')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(string_atts, 'std::string')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_is_set_by_id(query.get_unique_attributes(self.class_attributes))
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(bool_atts, 'bool')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(int_atts, 'int')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(double_atts, 'double')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(uint_atts, 'unsigned int')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(string_atts, 'const std::string&')
+        self.write_function_implementation(code, exclude=True)
+
+        code = attrib_functions.write_unset_by_id(query.get_unique_attributes(self.class_attributes))
+        self.write_function_implementation(code, exclude=True)
+
         code = attrib_functions.write_create_object()
         self.write_function_implementation(code, exclude=True)
 
@@ -525,14 +619,16 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
     # Retrieve element functions
 
     def write_functions_to_retrieve(self):
-        if not query.has_child_elements(self.attributes):
-            return
-
         gen_functions = \
             GlobalQueryFunctions.GlobalQueryFunctions(self.language,
                                                       self.is_cpp_api,
                                                       self.is_list_of,
                                                       self.class_object)
+        if not query.has_child_elements(self.attributes):
+            code = gen_functions.write_for_each_element()
+            self.write_function_implementation(code)
+            return
+
         code = gen_functions.write_get_by_sid()
         self.write_function_implementation(code)
 
@@ -540,6 +636,11 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         self.write_function_implementation(code)
 
         code = gen_functions.write_get_all_elements()
+        if code is not None:
+            self.write_add_element_to_list()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_for_each_element()
         self.write_function_implementation(code)
 
         if self.is_plugin:
@@ -618,6 +719,29 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = lo_functions.write_get_num_element_function(parameter)
         self.write_function_implementation(code)
 
+    # function to write the identifier index functions on a document for
+    # another library
+    def write_document_id_index_functions(self):
+        gen_functions = \
+            GlobalQueryFunctions.GlobalQueryFunctions(self.language,
+                                                      self.is_cpp_api,
+                                                      self.is_list_of,
+                                                      self.class_object)
+        code = gen_functions.write_enable_id_index()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_is_id_index_enabled()
+        self.write_function_implementation(code)
+
+        code = gen_functions.write_invalidate_id_index()
+        self.write_function_implementation(code, exclude=True)
+
+        code = gen_functions.write_update_id_index()
+        self.write_function_implementation(code, exclude=True)
+
+        code = gen_functions.write_update_id_index(is_metaid=True)
+        self.write_function_implementation(code, exclude=True)
+
     ########################################################################
 
     # concrete class functions
@@ -678,6 +802,81 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_set_element_text()
         self.write_function_implementation(code, exclude)
 
+        code = protect_functions.write_parse_array_text()
+        self.write_function_implementation(code, exclude)
+
+        code = protect_functions.write_do_parse_array_text()
+        self.write_function_implementation(code, exclude)
+
+        if self.document:
+            gen_functions = GlobalQueryFunctions\
+                .GlobalQueryFunctions(self.language, self.is_cpp_api,
+                                      self.is_list_of, self.class_object)
+            code = gen_functions.write_rebuild_id_index()
+            self.write_function_implementation(code, exclude)
+
+        if self.is_list_of and self.lo_id_index:
+            lo_functions = ListOfQueryFunctions\
+                .ListOfQueryFunctions(self.language, self.is_cpp_api,
+                                      self.is_list_of,
+                                      self.class_object)
+            code = lo_functions.write_find_index_by_id()
+            self.write_function_implementation(code, exclude)
+
+            code = lo_functions.write_rebuild_id_index()
+            self.write_function_implementation(code, exclude)
+
+        constructor = Constructors.Constructors(self.language,
+                                                self.is_cpp_api,
+                                                self.class_object)
+        if constructor.pooled:
+            self.write_pool_thread_local()
+        code = constructor.write_get_pool_free_list(False)
+        self.write_function_implementation(code, exclude)
+
+        code = constructor.write_get_pool_chunk_list(False)
+        self.write_function_implementation(code, exclude)
+
+    # each thread has its own free list so independent documents
+    # can be read and freed concurrently without locking
+    def write_pool_thread_local(self):
+        self.write_line_verbatim('#ifndef POOL_THREAD_LOCAL')
+        self.write_line_verbatim('#if defined(_MSC_VER)')
+        self.write_line_verbatim('#define POOL_THREAD_LOCAL __declspec(thread)')
+        self.write_line_verbatim('#else')
+        self.write_line_verbatim('#define POOL_THREAD_LOCAL __thread')
+        self.write_line_verbatim('#endif')
+        self.write_line_verbatim('#endif')
+        self.skip_line()
+
+    # the kept array text is parsed once under an atomic state so the
+    # const getters of one object can be called from several threads
+    def write_array_text_state(self):
+        self.write_line_verbatim('#define ARRAY_TEXT_NONE 0')
+        self.write_line_verbatim('#define ARRAY_TEXT_KEPT 1')
+        self.write_line_verbatim('#define ARRAY_TEXT_PARSING 2')
+        self.skip_line()
+        self.write_line_verbatim('#ifndef ARRAY_TEXT_STATE_LOAD')
+        self.write_line_verbatim('#if defined(_MSC_VER)')
+        self.write_line_verbatim('#include <intrin.h>')
+        self.write_line_verbatim('#define ARRAY_TEXT_STATE_LOAD(state) '
+                                 '(state)')
+        self.write_line_verbatim('#define ARRAY_TEXT_STATE_SWAP(state, from, '
+                                 'to) \\')
+        self.write_line_verbatim('  (_InterlockedCompareExchange(&(state), '
+                                 '(to), (from)) == (from))')
+        self.write_line_verbatim('#else')
+        self.write_line_verbatim('#define ARRAY_TEXT_STATE_LOAD(state) \\')
+        self.write_line_verbatim('  __atomic_load_n(&(state), '
+                                 '__ATOMIC_ACQUIRE)')
+        self.write_line_verbatim('#define ARRAY_TEXT_STATE_SWAP(state, from, '
+                                 'to) \\')
+        self.write_line_verbatim('  __sync_bool_compare_and_swap(&(state), '
+                                 '(from), (to))')
+        self.write_line_verbatim('#endif')
+        self.write_line_verbatim('#endif')
+        self.skip_line()
+
     ########################################################################
 
     # Functions for writing functions for the main ListOf class
@@ -710,6 +909,9 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
         self.write_function_implementation(code)
 
         if self.is_cpp_api:
+            code = lo_functions.write_invalidate_id_index()
+            self.write_function_implementation(code)
+
             code = lo_functions.write_add_element_function()
             self.write_function_implementation(code)
 
@@ -734,6 +936,12 @@ class CppCodeFile(BaseCppFile.BaseCppFile):
                                                              const=False)
                 self.write_function_implementation(code)
 
+            code = lo_functions.write_export_columns()
+            self.write_function_implementation(code)
+
+            code = lo_functions.write_import_columns()
+            self.write_function_implementation(code)
+
     # main function to write the functions dealing with a child listOf element
     def write_child_lo_element_functions(self):
         num_elements = len(self.child_lo_elements)
@@ -54,6 +54,10 @@ class CppFiles():
             query.get_sid_refs(class_object['attribs'])
         self.class_object['unit_sid_refs'] = \
             query.get_sid_refs(class_object['attribs'], unit=True)
+        # an id index on the listOf is only meaningful if the child has an id
+        self.class_object['lo_id_index'] = \
+            'lo_id_index' in class_object and class_object['lo_id_index'] \
+            and query.has_attribute(class_object, 'id')
 
         self.verbose = verbose
 
@@ -97,6 +101,8 @@ class CppFiles():
             descrip['baseClass'] = strFunctions.prefix_name('ListOf')
         descrip['list_of_name'] = lo_name
         descrip['lo_child'] = self.class_object['name']
+        descrip['lo_child_attributes'] = \
+            self.class_object.get('class_attributes', [])
         descrip['name'] = lo_name
         return descrip
 
@@ -97,7 +97,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
                             .format(self.library_name.upper(),
                                     class_name))
         self.write_line('{')
-        if len(attributes) > 0 or self.overwrites_children:
+        if len(attributes) > 0 or self.overwrites_children \
+                or (self.is_list_of and self.lo_id_index) \
+                or (self.is_list_of and global_variables.is_package):
             self.write_line('protected:')
             self.up_indent()
             self.write_doxygen_start()
@@ -120,6 +122,7 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         self.write_functions_to_retrieve()
         if self.document:
             self.write_document_error_log_functions()
+            self.write_document_id_index_functions()
         self.down_indent()
         self.write_line('protected:')
         self.skip_line()
@@ -179,6 +182,15 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
                                          ''.format(self.language,
                                                    strFunctions.upper_first(self.language)))
 
+    # listOf classes that move the attributes of their children in columns
+    # declare vectors
+    def has_columns(self):
+        if not self.is_list_of or not self.is_cpp_api \
+                or 'lo_child_attributes' not in self.class_object:
+            return False
+        attributes = self.class_object['lo_child_attributes']
+        return len(query.get_column_types(attributes)) > 0
+
     def write_general_includes(self):
         pkg = self.package.lower()
         include_lines = []
@@ -186,9 +198,12 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         if not self.is_plugin:
             self.write_line_verbatim('#include <string>')
             skip = True
-        if self.class_object['has_vector']:
+        if self.class_object['has_vector'] or self.has_columns():
             self.write_line_verbatim('#include <vector>')
             skip = True
+        if (self.is_list_of and self.lo_id_index) or self.document:
+            self.write_line_verbatim('#include <map>')
+            skip = True
         if skip:
             self.skip_line(2)
 
@@ -307,6 +322,13 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
                     self.write_line('{0} {1};'.format(return_type, name))
                 else:
                     self.write_line('std::string {0};'.format(name))
+                if attributes[i]['isArray']:
+                    self.write_line('int {0}Count;'.format(name))
+                if attributes[i]['isArray'] and self.lazy_array:
+                    self.write_line('mutable std::string {0}Text;'
+                                    ''.format(name))
+                    self.write_line('mutable volatile long {0}TextState;'
+                                    ''.format(name))
                 if attributes[i]['isNumber'] is True \
                         or attributes[i]['attType'] == 'boolean':
                     self.write_line('bool mIsSet{0};'
@@ -316,6 +338,20 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             self.write_line('std::string mElementName;')
         if self.document:
             self.write_line('{0}ErrorLog mErrorLog;'.format(global_variables.prefix))
+            self.write_line('std::multimap<std::string, {0}*> '
+                            'mSIdIndex;'.format(global_variables.baseClass))
+            self.write_line('std::multimap<std::string, {0}*> '
+                            'mMetaIdIndex;'.format(global_variables.baseClass))
+            self.write_line('bool mIdIndexEnabled;')
+            self.write_line('bool mIdIndexValid;')
+        if self.is_list_of and global_variables.is_package:
+            self.write_line('{0}PkgNamespaces* mChildNamespaces;'
+                            ''.format(self.package))
+        if self.is_list_of and self.lo_id_index:
+            self.write_line('mutable std::map<std::string, unsigned int> '
+                            'mIdIndex;')
+            self.write_line('mutable unsigned int mIdIndexSize;')
+            self.write_line('mutable bool mIdIndexValid;')
 
     ########################################################################
 
@@ -353,6 +389,18 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = constructor.write_destructor()
         self.write_function_declaration(code)
 
+        if constructor.pooled:
+            self.write_swig_begin()
+            code = constructor.write_operator_new()
+            self.write_function_declaration(code, True)
+
+            code = constructor.write_operator_delete()
+            self.write_function_declaration(code, True)
+            self.write_swig_end()
+
+            code = constructor.write_trim_pool()
+            self.write_function_declaration(code)
+
     ########################################################################
 
     # Functions for writing the attribute manipulation functions
@@ -375,6 +423,12 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_get_string_for_enum(True, i)
             self.write_function_declaration(code)
 
+            code = attrib_functions.write_get_array_pointer(True, i)
+            self.write_function_declaration(code)
+
+            code = attrib_functions.write_get_array_count(True, i)
+            self.write_function_declaration(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_is_set(True, i)
             self.write_function_declaration(code)
@@ -392,6 +446,12 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_add_element_for_vector(True, i)
             self.write_function_declaration(code)
 
+            code = attrib_functions.write_adopt_array(True, i)
+            self.write_function_declaration(code)
+
+            code = attrib_functions.write_release_array(True, i)
+            self.write_function_declaration(code)
+
         for i in range(0, num_attributes):
             code = attrib_functions.write_unset(True, i)
             self.write_function_declaration(code)
@@ -467,6 +527,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         string_atts = attributes['string_atts']
 
         self.write_swig_begin()
+        if self.is_cpp_api and not self.is_list_of:
+            self.write_attribute_id_enum(attrib_functions)
+
         code = attrib_functions.write_get(bool_atts, 'bool')
         self.write_function_declaration(code, exclude=True)
 
@@ -509,6 +572,45 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = attrib_functions.write_unset(query.get_unique_attributes(self.class_attributes))
         self.write_function_declaration(code, exclude=True)
 
+        code = attrib_functions.write_lookup_attribute()
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(bool_atts, 'bool')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(int_atts, 'int')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(double_atts, 'double')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(uint_atts, 'unsigned int')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_get_by_id(string_atts, 'std::string')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_is_set_by_id(query.get_unique_attributes(self.class_attributes))
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(bool_atts, 'bool')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(int_atts, 'int')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(double_atts, 'double')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(uint_atts, 'unsigned int')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_set_by_id(string_atts, 'const std::string&')
+        self.write_function_declaration(code, exclude=True)
+
+        code = attrib_functions.write_unset_by_id(query.get_unique_attributes(self.class_attributes))
+        self.write_function_declaration(code, exclude=True)
+
         code = attrib_functions.write_create_object()
         self.write_function_declaration(code, exclude=True)
 
@@ -526,6 +628,32 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
 
         self.write_swig_end()
 
+    # function to write the enumeration of attribute identifiers
+    def write_attribute_id_enum(self, attrib_functions):
+        ids = attrib_functions.get_attribute_ids()
+        self.write_doxygen_start()
+        self.open_comment()
+        self.write_comment_line('Identifiers for the attributes of this {0}, '
+                                'as returned by lookupAttribute().'
+                                ''.format(self.class_name))
+        self.close_comment()
+        self.write_line('enum AttributeId')
+        self.write_line('{')
+        self.up_indent()
+        first = attrib_functions.get_attribute_id_first()
+        for i in range(0, len(ids)):
+            if i == 0:
+                self.write_line('{0} = {1},'.format(ids[i][0], first))
+            else:
+                self.write_line('{0},'.format(ids[i][0]))
+        if len(ids) == 0:
+            self.write_line('ATTR_COUNT = {0}'.format(first))
+        else:
+            self.write_line('ATTR_COUNT')
+        self.down_indent()
+        self.write_line('};')
+        self.write_doxygen_end()
+
     ########################################################################
 
     # Functions for writing general functions
@@ -602,14 +730,16 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
     # Retrieve element functions
 
     def write_functions_to_retrieve(self):
-        if not query.has_child_elements(self.attributes):
-            return
-
         gen_functions = \
             GlobalQueryFunctions.GlobalQueryFunctions(self.language,
                                                       self.is_cpp_api,
                                                       self.is_list_of,
                                                       self.class_object)
+        if not query.has_child_elements(self.attributes):
+            code = gen_functions.write_for_each_element()
+            self.write_function_declaration(code)
+            return
+
         code = gen_functions.write_get_by_sid()
         self.write_function_declaration(code)
 
@@ -619,6 +749,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = gen_functions.write_get_all_elements()
         self.write_function_declaration(code)
 
+        code = gen_functions.write_for_each_element()
+        self.write_function_declaration(code)
+
         if self.is_plugin:
             code = gen_functions.write_append_from()
             self.write_function_declaration(code, True)
@@ -696,6 +829,29 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = lo_functions.write_get_num_element_function(parameter)
         self.write_function_declaration(code)
 
+    # function to write the identifier index functions on a document for
+    # another library
+    def write_document_id_index_functions(self):
+        gen_functions = \
+            GlobalQueryFunctions.GlobalQueryFunctions(self.language,
+                                                      self.is_cpp_api,
+                                                      self.is_list_of,
+                                                      self.class_object)
+        code = gen_functions.write_enable_id_index()
+        self.write_function_declaration(code)
+
+        code = gen_functions.write_is_id_index_enabled()
+        self.write_function_declaration(code)
+
+        code = gen_functions.write_invalidate_id_index()
+        self.write_function_declaration(code, exclude=True)
+
+        code = gen_functions.write_update_id_index()
+        self.write_function_declaration(code, exclude=True)
+
+        code = gen_functions.write_update_id_index(is_metaid=True)
+        self.write_function_declaration(code, exclude=True)
+
     ########################################################################
 
     # concrete class functions
@@ -765,6 +921,39 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         code = protect_functions.write_set_element_text()
         self.write_function_declaration(code, exclude)
 
+        code = protect_functions.write_parse_array_text()
+        self.write_function_declaration(code, exclude)
+
+        code = protect_functions.write_do_parse_array_text()
+        self.write_function_declaration(code, exclude)
+
+        if self.document:
+            gen_functions = GlobalQueryFunctions\
+                .GlobalQueryFunctions(self.language, self.is_cpp_api,
+                                      self.is_list_of, self.class_object)
+            code = gen_functions.write_rebuild_id_index()
+            self.write_function_declaration(code, exclude)
+
+        if self.is_list_of and self.lo_id_index:
+            lo_functions = ListOfQueryFunctions\
+                .ListOfQueryFunctions(self.language, self.is_cpp_api,
+                                      self.is_list_of,
+                                      self.class_object)
+            code = lo_functions.write_find_index_by_id()
+            self.write_function_declaration(code, exclude)
+
+            code = lo_functions.write_rebuild_id_index()
+            self.write_function_declaration(code, exclude)
+
+        constructor = Constructors.Constructors(self.language,
+                                                self.is_cpp_api,
+                                                self.class_object)
+        code = constructor.write_get_pool_free_list()
+        self.write_function_declaration(code, exclude)
+
+        code = constructor.write_get_pool_chunk_list()
+        self.write_function_declaration(code, exclude)
+
     ########################################################################
 
     # Functions for writing functions for the main ListOf class
@@ -797,6 +986,9 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
         self.write_function_declaration(code)
 
         if self.is_cpp_api:
+            code = lo_functions.write_invalidate_id_index()
+            self.write_function_declaration(code)
+
             code = lo_functions.write_add_element_function()
             self.write_function_declaration(code)
 
@@ -818,6 +1010,34 @@ class CppHeaderFile(BaseCppFile.BaseCppFile):
                                                              const=False)
                 self.write_function_declaration(code)
 
+            self.write_columns_functions(lo_functions)
+
+    # function to write the struct and functions moving children in columns
+    def write_columns_functions(self, lo_functions):
+        lines = lo_functions.get_columns_struct()
+        if lines is None:
+            return
+        self.write_line('/**')
+        self.write_comment_line('The attributes of the {0} objects in a {1}, '
+                                'with one column for each attribute and one '
+                                'saying whether it is set.'
+                                ''.format(self.list_of_child, self.class_name))
+        self.write_line(' */')
+        self.write_line('struct Columns')
+        self.write_line('{')
+        self.up_indent()
+        for line in lines:
+            self.write_line(line)
+        self.down_indent()
+        self.write_line('};')
+        self.skip_line(2)
+
+        code = lo_functions.write_export_columns()
+        self.write_function_declaration(code)
+
+        code = lo_functions.write_import_columns()
+        self.write_function_declaration(code)
+
     # main function to write the functions dealing with a child listOf element
     def write_child_lo_element_functions(self):
         num_elements = len(self.child_lo_elements)
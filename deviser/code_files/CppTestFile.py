@@ -61,6 +61,8 @@ class CppTestFile(BaseCppFile.BaseCppFile):
     def write_includes(self):
         self.skip_line()
         self.write_line_verbatim('#include <iostream>')
+        self.write_line_verbatim('#include <sstream>')
+        self.write_line_verbatim('#include <ctime>')
         self.skip_line()
         self.write_line_verbatim('#include \"sbml/SBMLTypes.h\"')
         self.write_line_verbatim('#include \"sbml/packages/{0}/common/'
@@ -102,9 +104,50 @@ class CppTestFile(BaseCppFile.BaseCppFile):
             code = attrib_functions.write_test(string_atts, 'std::string')
             self.write_function_implementation(code, exclude=False, test=True)
 
+        for attrib in expand_attributes:
+            if attrib['isArray']:
+                reader = self.write_text_reader(class_object['name'])
+                code = attrib_functions.write_array_text_test(attrib, reader)
+                self.write_function_implementation(code, exclude=False,
+                                                   test=True)
+
+        if self.defines_compression(class_object):
+            dimension = None
+            for attrib in expand_attributes:
+                if attrib['isArray']:
+                    array = attrib
+                elif dimension is None and attrib['name'].startswith('num'):
+                    dimension = attrib
+            code = attrib_functions.write_compression_test(array, dimension)
+            self.write_function_implementation(code, exclude=False, test=True)
+
         for t in attrib_functions.tests:
             self.tests.append(t)
 
+    @staticmethod
+    def defines_compression(class_object):
+        # compress/uncompress come from the additional code of the class
+        if 'addDefs' not in class_object or class_object['addDefs'] is None:
+            return False
+        defs = open(class_object['addDefs']).read()
+        return '{0}::compress('.format(class_object['name']) in defs \
+            and '{0}::uncompress('.format(class_object['name']) in defs
+
+    def write_text_reader(self, class_name):
+        # setElementText is protected so expose it for the array tests
+        reader = '{0}TextReader'.format(class_name)
+        self.write_line('class {0} : public {1}'.format(reader, class_name))
+        self.write_line('{')
+        self.write_line('public:')
+        self.up_indent()
+        self.write_line('{0}() : {1}(3, 1) {{}}'.format(reader, class_name))
+        self.write_line('void readText(const std::string& text) '
+                        '{ setElementText(text); }')
+        self.down_indent()
+        self.write_line('};')
+        self.skip_line(2)
+        return reader
+
     ########################################################################
 
     # Write file
@@ -106,6 +106,8 @@ class ExtensionCodeFile(BaseCppFile.BaseCppFile):
 
     def write_general_includes(self):
 
+        if len(self.enums) > 0:
+            self.write_line_verbatim('#include <cstring>')
         self.write_line_verbatim('#include <{0}/extension/{1}'
                                  'ExtensionRegister.h>'
                                  ''.format(self.language,
@@ -324,6 +326,9 @@ class ExtensionCodeFile(BaseCppFile.BaseCppFile):
             code = init_functions.write_enum_from_string_function(i, values[0],
                                                                   name)
             self.write_function_implementation(code)
+            code = init_functions.\
+                write_enum_from_string_with_length_function(i, values[0])
+            self.write_function_implementation(code)
             code = init_functions.write_is_valid_enum_function(i, values[0])
             self.write_function_implementation(code)
             code = init_functions.write_is_valid_enum_string_function(i, values[0])
@@ -347,6 +352,7 @@ class ExtensionCodeFile(BaseCppFile.BaseCppFile):
     # Write the extension types file
     def write_ext_enum_code(self):
         BaseCppFile.BaseCppFile.write_file(self)
+        self.write_line_verbatim('#include <cstring>')
         self.write_line_verbatim('#include <string>')
         self.write_line_verbatim('#include <{0}/common/{1}.h>'
                                  ''.format(self.language,
@@ -328,6 +328,9 @@ class ExtensionHeaderFile(BaseCppFile.BaseCppFile):
             self.write_function_declaration(code)
             code = init_functions.write_enum_from_string_function(i, values[0])
             self.write_function_declaration(code)
+            code = init_functions.\
+                write_enum_from_string_with_length_function(i, values[0])
+            self.write_function_declaration(code)
             code = init_functions.write_is_valid_enum_function(i, values[0])
             self.write_function_declaration(code)
             code = init_functions.write_is_valid_enum_string_function(i, values[0])
@@ -101,6 +101,36 @@ class OtherLibraryFiles(BaseTemplateFile.BaseTemplateFile):
         self.write_cmake('lib-namespace.h')
         self.write_all_files('OperationReturnValues')
 
+    def write_test_files(self):
+        """
+        Write the programs that test the library; these go in its test
+        directory.
+        """
+        self.write_program('Benchmark', 'Program reporting the time and '
+                                        'memory used to read, write and copy '
+                                        'a document.')
+        self.write_program('StressTest', 'Program reading, copying and '
+                                         'deleting documents on many threads '
+                                         'at once.')
+
+    def write_program(self, name, description):
+        """
+        Write a program (.cpp file with a main function)
+
+        :param name: e.g. "Hello" will create file Hello.cpp
+        :param description: the brief description of the program.
+        """
+        base_descrip = self.create_base_description(name)
+        fileout = CppCodeFile.CppCodeFile(base_descrip, False)
+        fileout.brief_description = description
+        filein = '{0}.cpp'.format(name)
+        if self.verbose:
+            print('Writing file {0}'.format(fileout.filename))
+        fileout.add_file_header()
+        fileout.skip_line(2)
+        self.copy_file_contents(fileout, filein)
+        fileout.close_file()
+
     def write_all_files(self, name):
         """
         Write both the .h file and the .cpp file
@@ -37,6 +37,9 @@
 # written permission.
 # ------------------------------------------------------------------------ -->
 
+import os
+
+from . import CppCodeFile
 from . import CppHeaderFile
 from ..base_files import BaseCppFile, BaseTexFile
 from ..util import strFunctions, global_variables
@@ -164,11 +167,39 @@ class ValidationFiles():
         self.write_validator_files()
         self.write_validator_files('identifier')
 
+    def write_benchmark_file(self):
+        """
+        Write the program timing the validators of the package over a set
+        of documents; this goes in the validator test directory.
+        """
+        class_desc = ({})
+        class_desc['name'] = '{0}ValidatorBenchmark'.format(self.up_package)
+        class_desc['attribs'] = None
+        fileout = CppCodeFile.CppCodeFile(class_desc, False)
+        fileout.brief_description = 'Program reporting the time the ' \
+                                    '{0} validators take to validate a set ' \
+                                    'of documents.'.format(self.package)
+        if self.verbose:
+            print('Writing file {0}'.format(fileout.filename))
+        fileout.add_file_header()
+        fileout.skip_line(2)
+        filename = '{0}{1}templates{1}ValidatorBenchmark.cpp'.format(
+            os.path.dirname(__file__), os.sep)
+        infile = open(filename, 'r')
+        for line in infile.readlines():
+            line = line.replace('Pkg', self.up_package)
+            line = line.replace('pkg', self.package)
+            fileout.copy_line_verbatim(line)
+        infile.close()
+        fileout.close_file()
+
     def write_constraints(self, valid_type=''):
         fileout = ValidatorCodeFile.ValidatorCodeFile(self.language,
                                                       self.package,
                                                       'constraints',
-                                                      valid_type)
+                                                      valid_type,
+                                                      self.sbml_classes,
+                                                      self.class_rules)
         if self.verbose:
             print('Writing file {0}'.format(fileout.filename))
         fileout.write_constraints_file()
@@ -176,7 +207,9 @@ class ValidationFiles():
         fileout = ValidatorCodeFile.ValidatorCodeFile(self.language,
                                                       self.package,
                                                       'declared',
-                                                      valid_type)
+                                                      valid_type,
+                                                      self.sbml_classes,
+                                                      self.class_rules)
         if self.verbose:
             print('Writing file {0}'.format(fileout.filename))
         fileout.write_constraints_file('declared')
@@ -188,7 +221,8 @@ class ValidationFiles():
             fileout = ValidatorHeaderFile.ValidatorHeaderFile(self.language,
                                                               self.package,
                                                               'main',
-                                                              valid_type)
+                                                              valid_type,
+                                                              self.sbml_classes)
             if self.verbose:
                 print('Writing file {0}'.format(fileout.filename))
             fileout.write_main_file()
@@ -269,7 +303,7 @@ class ValidationFiles():
                                    '='.format(self.package.lower()))
         self.error_file.write_line('{')
         done = []
-        for rule in self.class_rules:
+        for rule in self.sorted_rules():
             if rule['typecode'] not in done:
                 self.write_table_entry(rule)
                 done.append(rule['typecode'])
@@ -311,7 +345,7 @@ class ValidationFiles():
                                    '='.format(global_variables.language.lower()))
         self.error_file.write_line('{')
         done = []
-        for rule in self.class_rules:
+        for rule in self.sorted_rules():
             if rule['typecode'] not in done:
                 self.write_table_entry(rule)
                 done.append(rule['typecode'])
@@ -320,6 +354,10 @@ class ValidationFiles():
         self.error_file.write_cppns_end()
         self.error_file.write_defn_end()
 
+    def sorted_rules(self):
+        # lookups bisect the table so it must be in order of error code
+        return sorted(self.class_rules, key=lambda rule: rule['number'])
+
     def write_table_entry(self, rule):
         format_rule = self.format_text(rule['text'])
         self.error_file.up_indent()
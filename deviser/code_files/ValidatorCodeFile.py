@@ -46,7 +46,7 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
     """Class for all Validator Header files"""
 
     def __init__(self, language, package, filetype='', valid_type='',
-                 elements=None):
+                 elements=None, rules=None):
         self.up_package = strFunctions.upper_first(package)
         self.valid_type = strFunctions.upper_first(valid_type)
         self.file_type = filetype
@@ -77,6 +77,8 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         if filetype == 'consistency':
             self.baseClass = '{0}Validator'.format(self.up_package)
         self.elements = elements
+        self.rules = rules
+        self.sid_ref_rules = self.get_sid_ref_rules()
 
     ########################################################################
 
@@ -84,6 +86,13 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
     def write_class(self):
         if self.file_type == 'consistency':
             self.write_init_function()
+            functions = \
+                ValidatorClassFunctions.ValidatorClassFunctions(self.language,
+                                                                self.name,
+                                                                False, None,
+                                                                self.package)
+            code = functions.write_create_worker_function(True)
+            self.write_function_implementation(code, True)
         elif self.file_type == 'main':
             self.write_validator_class()
 
@@ -152,6 +161,15 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
                                  '.h>'.format(self.language, self.package,
                                               self.up_package,
                                               self.cap_language))
+        if len(self.sid_ref_rules) > 0:
+            self.write_line_verbatim('#include <{0}/packages/{1}/common/{2}'
+                                     'ExtensionTypes'
+                                     '.h>'.format(self.language, self.package,
+                                                  self.up_package))
+            self.write_line_verbatim('#include <{0}/packages/{1}/validator/{2}'
+                                     'Validator'
+                                     '.h>'.format(self.language, self.package,
+                                                  self.up_package))
         self.skip_line()
         self.write_line_verbatim('#endif /* AddingConstraintsToValidator */')
         self.skip_line()
@@ -160,10 +178,167 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         self.skip_line()
         self.write_line_verbatim('using namespace std;')
         self.skip_line()
-        self.open_comment()
-        self.write_comment_line('PUT CONSTRAINTS HERE')
-        self.close_comment()
+        if len(self.sid_ref_rules) == 0:
+            self.open_comment()
+            self.write_comment_line('PUT CONSTRAINTS HERE')
+            self.close_comment()
+            self.skip_line()
+        for rule in self.sid_ref_rules:
+            self.write_sid_ref_constraint(rule)
+
+    def write_declared_constraints(self):
+        # the validator only indexes the model for constraints that need it
+        if len(self.sid_ref_rules) > 0:
+            self.write_line_verbatim('mUsesIdIndex = true;')
+        for rule in self.sid_ref_rules:
+            self.write_line_verbatim('addConstraint(new VConstraint{0}{1}'
+                                     '(*this));'.format(rule['object'],
+                                                        rule['typecode']))
+        if len(self.sid_ref_rules) > 0:
+            self.skip_line()
+
+    ########################################################################
+
+    # SIdRef constraints
+
+    # the SIdRef rules of the package classes; these are the rules that
+    # need the model to check so are not already logged when reading
+    def get_sid_ref_rules(self):
+        sid_ref_rules = []
+        if self.file_type not in ['constraints', 'declared'] \
+                or self.valid_type != '' or not self.rules \
+                or not self.elements or not global_variables.is_package:
+            return sid_ref_rules
+        names = []
+        for element in self.elements:
+            names.append(strFunctions.remove_prefix(element['name'], True))
+        for rule in self.rules:
+            if rule.get('attrib_type') != 'SIdRef' \
+                    or rule.get('attrib_element', '') == '' \
+                    or rule['object'] not in names:
+                continue
+            sid_ref_rules.append(rule)
+        return sid_ref_rules
+
+    # the typecodes of the given package class and any class derived from it
+    def get_ref_typecodes(self, name):
+        typecodes = []
+        for element in self.elements:
+            if element['name'] == name and not element['abstract']:
+                typecodes.append(element['typecode'])
+        for element in self.elements:
+            if element['baseClass'] == name and element['name'] != name:
+                for typecode in self.get_ref_typecodes(element['name']):
+                    if typecode not in typecodes:
+                        typecodes.append(typecode)
+        return typecodes
+
+    def is_package_class(self, name):
+        for element in self.elements:
+            if element['name'] == name:
+                return True
+        return False
+
+    # the referenced id is looked up in the index the validator builds once
+    # for each validation rather than by searching the model each time
+    def write_sid_ref_constraint(self, rule):
+        class_name = rule['object']
+        att_name = rule['attrib']
+        obj = strFunctions.abbrev_name(class_name)
+        if obj in ['m', 'ref', 'validator']:
+            obj = strFunctions.lower_first(class_name)
+        targets = []
+        for target in rule['attrib_element'].split(','):
+            targets.append(strFunctions.upper_first(target.strip()))
+        [ref_name, __] = strFunctions.get_sid_refs(rule['attrib_element'])
+        ref_name = ref_name.replace('\\', '')
+        validator = '{0}Validator'.format(self.up_package)
+
+        self.write_line('// {0}'.format(rule['number']))
+        self.write_line_verbatim('START_CONSTRAINT ({0}, {1}, {2})'
+                                 .format(rule['typecode'], class_name, obj))
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('pre ({0}.isSet{1}());'.format(obj, att_name))
+        self.skip_line()
+        self.write_line('const {0}& validator ='.format(validator))
+        self.up_indent()
+        self.write_line('static_cast<const {0}&>'
+                        '(mValidator);'.format(validator))
+        self.down_indent()
+        self.write_line('const SBase* ref = validator.getIndexedElement'
+                        '({0}.get{1}());'.format(obj, att_name))
         self.skip_line()
+        if 'SBase' in targets:
+            self.write_line('bool fail = (ref == NULL);')
+        else:
+            self.write_line('bool fail = true;')
+            self.write_sid_ref_checks(targets)
+        self.skip_line()
+        self.write_line('msg = "The attribute \'{0}\' is set to '
+                        '\'";'.format(strFunctions.lower_first(att_name)))
+        self.write_line('msg += {0}.get{1}();'.format(obj, att_name))
+        self.write_line('msg += "\', which is not the id of ";')
+        self.write_line('msg += "{0} {1} in the model.";'
+                        .format(strFunctions.get_indefinite(ref_name),
+                                ref_name))
+        self.skip_line()
+        self.write_line('inv (fail == false);')
+        self.down_indent()
+        self.write_line('}')
+        self.write_line('END_CONSTRAINT')
+        self.skip_line(2)
+
+    def write_sid_ref_checks(self, targets):
+        typecodes = []
+        others = []
+        for target in targets:
+            if self.is_package_class(target):
+                for typecode in self.get_ref_typecodes(target):
+                    if typecode not in typecodes:
+                        typecodes.append(typecode)
+            else:
+                others.append(target)
+        if len(typecodes) == 1:
+            self.skip_line()
+            self.write_line('if (ref != NULL && ref->getPackageName() == '
+                            '"{0}")'.format(self.package))
+            self.write_line('{')
+            self.up_indent()
+            self.write_line('fail = (ref->getTypeCode() != '
+                            '{0});'.format(typecodes[0]))
+            self.down_indent()
+            self.write_line('}')
+        elif len(typecodes) > 1:
+            self.skip_line()
+            self.write_line('if (ref != NULL && ref->getPackageName() == '
+                            '"{0}")'.format(self.package))
+            self.write_line('{')
+            self.up_indent()
+            self.write_line('switch (ref->getTypeCode())')
+            self.write_line('{')
+            for typecode in typecodes:
+                self.write_line('case {0}:'.format(typecode))
+            self.up_indent()
+            self.write_line('fail = false;')
+            self.write_line('break;')
+            self.down_indent()
+            self.write_line('default:')
+            self.up_indent()
+            self.write_line('break;')
+            self.down_indent()
+            self.write_line('}')
+            self.down_indent()
+            self.write_line('}')
+        for target in others:
+            self.skip_line()
+            self.write_line('if (fail && ref != NULL)')
+            self.write_line('{')
+            self.up_indent()
+            self.write_line('fail = (ref->getElementName() != '
+                            '"{0}");'.format(strFunctions.lower_first(target)))
+            self.down_indent()
+            self.write_line('}')
     ########################################################################
 
     # Write the validator class
@@ -187,12 +362,136 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         code = constructor.write_add_constraint_function()
         self.write_function_implementation(code)
 
+        for name in self.get_constrained_classes():
+            code = constructor.write_typed_add_constraint_function(name)
+            self.write_function_implementation(code, True)
+
         code = constructor.write_validate_function('doc')
         self.write_function_implementation(code)
 
         code = constructor.write_validate_function('file')
         self.write_function_implementation(code)
 
+        code = constructor.write_set_num_threads_function()
+        self.write_function_implementation(code)
+
+        code = constructor.write_get_num_threads_function()
+        self.write_function_implementation(code)
+
+        code = constructor.write_get_indexed_element_function()
+        self.write_function_implementation(code, True)
+
+        code = constructor.write_share_id_index_function()
+        self.write_function_implementation(code, True)
+
+        code = constructor.write_create_worker_function()
+        self.write_function_implementation(code, True)
+
+        self.write_doxygen_start()
+        code = constructor.write_validate_elements_function()
+        self.write_validate_elements(code)
+        self.write_doxygen_end()
+
+        code = constructor.write_index_ids_function()
+        self.write_function_implementation(code, True)
+
+    # the OpenMP pragmas do not fit the standard writing function
+    # so do line by line
+    def write_validate_elements(self, code):
+        visitor = '{0}ValidatingVisitor'.format(self.up_package)
+        self.write_brief_header(code['title_line'])
+        self.write_class_function_header('{0}::{1}'.format(self.name,
+                                                           code['function']),
+                                         code['arguments'],
+                                         code['return_type'], False)
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('unsigned int numElements = '
+                        '(unsigned int)(elements.size());')
+        self.write_line('unsigned int numWorkers = (mNumThreads < numElements)'
+                        ' ? mNumThreads : numElements;')
+        self.write_line('std::vector<{0}Validator*> '
+                        'workers;'.format(self.up_package))
+        self.skip_line()
+        self.write_line('for (unsigned int k = 0; k < numWorkers; k++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('{0}Validator* worker = '
+                        'createWorker();'.format(self.up_package))
+        self.write_line('if (worker == NULL) break;')
+        self.write_line('worker->mIdIndex = mIdIndex;')
+        self.write_line('workers.push_back(worker);')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+        self.write_line('// without a full set of workers validate here in '
+                        'turn')
+        self.write_line('if (workers.size() < numWorkers || numWorkers < 2)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('for (unsigned int k = 0; k < workers.size(); k++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('delete workers[k];')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+        self.write_line('{0} vv(*this, m);'.format(visitor))
+        self.write_line('for (unsigned int i = 0; i < numElements; i++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('vv.visit(*elements[i]);')
+        self.down_indent()
+        self.write_line('}')
+        self.write_line('return;')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+        self.write_line('// each worker takes a contiguous run of elements')
+        self.write_line('int count = (int)(numWorkers);')
+        self.write_line_verbatim('#ifdef _OPENMP')
+        self.write_line_verbatim('#pragma omp parallel for '
+                                 'num_threads(count) schedule(static, 1)')
+        self.write_line_verbatim('#endif')
+        self.write_line('for (int k = 0; k < count; k++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('size_t first = (size_t)(numElements) * k / count;')
+        self.write_line('size_t last = (size_t)(numElements) * (k + 1) / '
+                        'count;')
+        self.write_line('{0} vv(*workers[k], m);'.format(visitor))
+        self.write_line('for (size_t i = first; i < last; i++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('vv.visit(*elements[i]);')
+        self.down_indent()
+        self.write_line('}')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+        self.write_line('// the runs are merged in order so the failures '
+                        'match a serial run')
+        self.write_line('for (int k = 0; k < count; k++)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('const std::list<{0}Error>& failures = '
+                        'workers[k]->getFailures();'.format(self.cap_language))
+        self.write_line('std::list<{0}Error>::const_iterator it;'
+                        ''.format(self.cap_language))
+        self.write_line('for (it = failures.begin(); it != failures.end(); '
+                        '++it)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('logFailure(*it);')
+        self.down_indent()
+        self.write_line('}')
+        self.write_line('delete workers[k];')
+        self.down_indent()
+        self.write_line('}')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+
     ########################################################################
 
     # Write the validator class
@@ -288,12 +587,8 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         self.write_line('{')
         self.up_indent()
         self.skip_line()
-        self.write_constraint_set_member(
-            '{0}'.format(global_variables.document_class))
-        self.write_constraint_set_member('Model')
-        if self.elements:
-            for element in self.elements:
-                self.write_constraint_set_member(element['name'])
+        for name in self.get_constrained_classes():
+            self.write_constraint_set_member(name)
         self.skip_line()
         self.write_line('map<VConstraint*, bool> ptrMap;')
         self.skip_line()
@@ -301,6 +596,17 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         self.skip_line()
         self.write_line('void add(VConstraint* c);')
         self.skip_line()
+        self.write_line('template <typename T>')
+        self.write_line('void add(ConstraintSet<T>& set, TConstraint<T>* c)')
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('if (c == NULL) return;')
+        self.skip_line()
+        self.write_line('ptrMap.insert(pair<VConstraint*, bool>(c, true));')
+        self.write_line('set.add(c);')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
         self.down_indent()
         self.write_line('};')
         self.skip_line(2)
@@ -309,6 +615,14 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         code = constructor.write_v_constraint_add_function()
         self.write_function_implementation(code)
 
+    # the classes that have a ConstraintSet of their own
+    def get_constrained_classes(self):
+        names = [global_variables.document_class, 'Model']
+        if self.elements:
+            for element in self.elements:
+                names.append(element['name'])
+        return names
+
     # function to write spaced sets of data
     def write_constraint_set_member(self, class_name):
         constraint = 'ConstraintSet<{0}>'.format(class_name)
@@ -357,6 +671,53 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         self.down_indent()
         self.write_line('};')
         self.skip_line(2)
+        self.write_element_collector_class()
+
+    ########################################################################
+
+    # Write the visitor that lists the elements for parallel validation
+
+    def write_element_collector_class(self):
+        name = '{0}ElementCollector'.format(self.up_package)
+        base = self.std_base if self.std_base else 'SBase'
+        self.write_comments(['-------------------------------------------',
+                             'ElementCollector',
+                             '-------------------------------------------'])
+        self.open_comment()
+        self.write_comment_line('Lists the {0} elements of a document in the '
+                                'order the ValidatingVisitor would visit '
+                                'them.'.format(self.package))
+        self.close_comment()
+        self.skip_line()
+        self.write_line('class {0}: public {1}Visitor'
+                        ''.format(name, self.cap_language))
+        self.write_line('{')
+        self.write_line('public:')
+        self.up_indent()
+        self.skip_line()
+        self.write_line('using {0}Visitor::visit;'.format(self.cap_language))
+        self.skip_line()
+        self.write_line('virtual bool')
+        self.write_line('visit(const {0}& x)'.format(base))
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('if (x.getPackageName() == \"{0}\" && '
+                        'x.getTypeCode() != {1}_LIST_OF)'
+                        ''.format(self.package, self.cap_language))
+        self.write_line('{')
+        self.up_indent()
+        self.write_line('elements.push_back(&x);')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line()
+        self.write_line('return true;')
+        self.down_indent()
+        self.write_line('}')
+        self.skip_line(2)
+        self.write_line('std::vector<const {0}*> elements;'.format(base))
+        self.down_indent()
+        self.write_line('};')
+        self.skip_line(2)
 
     ########################################################################
 
@@ -393,6 +754,8 @@ class ValidatorCodeFile(BaseCppFile.BaseCppFile):
         BaseCppFile.BaseCppFile.write_file(self)
         if not valid_type == 'declared':
             self.write_constraint_header()
+        else:
+            self.write_declared_constraints()
         self.write_doxygen_end()
 
     # Write the main validator file
@@ -45,8 +45,10 @@ from . cpp_functions import *
 class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
     """Class for all Validator Header files"""
 
-    def __init__(self, language, package, filetype='', valid_type=''):
+    def __init__(self, language, package, filetype='', valid_type='',
+                 elements=None):
         self.language = language
+        self.elements = elements
         self.cap_language = language.upper()
 
         self.up_package = strFunctions.upper_first(package)
@@ -87,6 +89,19 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         if self.file_type == 'consistency':
             self.write_constructors()
             self.write_init_function()
+            self.down_indent()
+            self.write_line('protected:')
+            self.up_indent()
+            self.write_doxygen_start()
+            functions = \
+                ValidatorClassFunctions.ValidatorClassFunctions(self.language,
+                                                                self.name,
+                                                                True,
+                                                                None,
+                                                                self.package)
+            code = functions.write_create_worker_function(True)
+            self.write_function_declaration(code)
+            self.write_doxygen_end()
         elif self.file_type == 'main':
             self.write_validator_class()
             self.down_indent()
@@ -120,10 +135,38 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
                                  'Constraints;'.format(self.up_package))
         self.write_line_verbatim('class {0}'
                                  ';'.format(global_variables.document_class))
+        if self.elements:
+            self.write_line_verbatim('class SBase;')
+            self.write_line_verbatim('class Model;')
+            for element in self.elements:
+                self.write_line_verbatim('class {0};'.format(element['name']))
+            self.skip_line()
+            self.write_line_verbatim('template <typename T> class TConstraint;')
 
     def write_members(self):
+        if self.elements:
+            functions = \
+                ValidatorClassFunctions.ValidatorClassFunctions(self.language,
+                                                                self.name,
+                                                                True,
+                                                                None,
+                                                                self.package)
+            code = functions.write_create_worker_function()
+            self.write_function_declaration(code)
+
+            code = functions.write_validate_elements_function()
+            self.write_function_declaration(code)
+
+            code = functions.write_index_ids_function()
+            self.write_function_declaration(code)
+
         self.write_line('{0}ValidatorConstraints* m{0}'
                         'Constraints;'.format(self.up_package))
+        if self.elements:
+            self.write_line('unsigned int mNumThreads;')
+            self.write_line('bool mUsesIdIndex;')
+            self.write_line('const std::map<std::string, const SBase*>* '
+                            'mIdIndex;')
         self.skip_line()
         self.write_line('friend class {0}Validating'
                         'Visitor;'.format(self.up_package))
@@ -182,12 +225,33 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         code = constructor.write_add_constraint_function()
         self.write_function_declaration(code)
 
+        if self.elements:
+            names = [global_variables.document_class, 'Model']
+            for element in self.elements:
+                names.append(element['name'])
+            for name in names:
+                code = constructor.write_typed_add_constraint_function(name)
+                self.write_function_declaration(code, True)
+
         code = constructor.write_validate_function('doc')
         self.write_function_declaration(code)
 
         code = constructor.write_validate_function('file')
         self.write_function_declaration(code)
 
+        if self.elements:
+            code = constructor.write_set_num_threads_function()
+            self.write_function_declaration(code)
+
+            code = constructor.write_get_num_threads_function()
+            self.write_function_declaration(code)
+
+            code = constructor.write_get_indexed_element_function()
+            self.write_function_declaration(code, True)
+
+            code = constructor.write_share_id_index_function()
+            self.write_function_declaration(code, True)
+
     ########################################################################
 
     # Functions for writing definition declaration
@@ -229,7 +293,11 @@ class ValidatorHeaderFile(BaseCppFile.BaseCppFile):
         self.write_cpp_begin()
         self.write_doxygen_start()
         self.write_line_verbatim('#include <list>')
+        if self.elements:
+            self.write_line_verbatim('#include <map>')
         self.write_line_verbatim('#include <string>')
+        if self.elements:
+            self.write_line_verbatim('#include <vector>')
         self.write_doxygen_end()
         self.write_includes()
         self.write_cppns_begin()
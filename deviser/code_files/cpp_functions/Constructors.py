@@ -83,6 +83,17 @@ class Constructors():
         self.document = False
         if 'document' in class_object:
             self.document = class_object['document']
+        self.id_index = False
+        if self.is_list_of and 'lo_id_index' in class_object:
+            self.id_index = class_object['lo_id_index']
+        self.child_ns = is_cpp_api and self.is_list_of \
+            and global_variables.is_package
+        self.pooled = is_cpp_api and not self.is_plugin \
+            and 'pooled' in class_object and class_object['pooled'] \
+            and not ('is_list_of' in class_object
+                     and class_object['is_list_of'])
+        self.lazy_array = is_cpp_api and 'lazy_array' in class_object \
+            and class_object['lazy_array']
         # we do overwrite if we have concrete
         if not self.overwrites_children and 'concretes' in class_object:
             if len(class_object['concretes']) > 0:
@@ -202,9 +213,9 @@ class Constructors():
                                   'pkgVersion)'.format(name)]
         else:
             if self.is_cpp_api:
-                implementation = ['set{0}NamespacesAndOwn(new {0}Namespaces('
-                                  'level, '
-                                  'version))'.format(global_variables.prefix)]
+                # the base class shares the interned namespaces for the
+                # level and version so there is nothing to allocate here
+                implementation = []
                 if self.document:
                     for attrib in self.attributes:
                         if attrib['name'] == 'level':
@@ -717,6 +728,10 @@ class Constructors():
         if self.is_cpp_api:
             implementation = []
             code = []
+            # elements destroyed with the document need not update its index
+            if self.document and not global_variables.is_sbml:
+                code.append(self.create_code_block(
+                    'line', ['mHasBeenDeleted = true']))
             for attrib in self.attributes:
                 if attrib['isArray']:
                     member = attrib['memberName']
@@ -735,6 +750,9 @@ class Constructors():
                     member = element['memberName']
                     implementation.append('delete {0}'.format(member))
                     implementation.append('{0} = NULL'.format(member))
+            if self.child_ns:
+                implementation.append('delete mChildNamespaces')
+                implementation.append('mChildNamespaces = NULL')
             if len(implementation) > 0:
                 code.append(self.create_code_block('line', implementation))
         else:
@@ -756,6 +774,255 @@ class Constructors():
 
     ########################################################################
 
+    # Functions for writing the pooled allocation functions
+
+    # function to write operator new for a pooled class
+    def write_operator_new(self, static=True):
+        if not self.pooled:
+            return
+        # create doc string header
+        title_line = 'Allocates memory for a {0} from the pool kept ' \
+                     'for the class.'.format(self.object_name)
+        params = ['@param size the number of bytes required.']
+        return_lines = ['@return a pointer to the memory allocated.']
+        additional = ['Objects of a derived class that is larger than '
+                      'this one are allocated with the global operator '
+                      'new. The memory is kept by the pool of the calling '
+                      'thread until trimPool() frees it.']
+        function = 'operator new'
+        return_type = 'static void*' if static else 'void*'
+        arguments = ['size_t size']
+        # create the function implementation
+        chunk = 'char* chunk = ' \
+                'static_cast<char*>(::operator new(257 * size))'
+        fill = self.create_code_block(
+            'for', ['unsigned int i = 1; i < 257; i++',
+                    'void* block = chunk + i * size',
+                    '*static_cast<void**>(block) = freeList',
+                    'freeList = block'])
+        code = [self.create_code_block(
+                    'if', ['size != sizeof({0})'.format(self.class_name),
+                           'return ::operator new(size)']),
+                self.create_code_block(
+                    'line', ['void*& freeList = getPoolFreeList()']),
+                dict({'code_type': 'if',
+                      'code': ['freeList == NULL',
+                               self.create_code_block(
+                                   'comment', ['carve a new chunk of 256 '
+                                               'blocks into the list',
+                                               'its first block links the '
+                                               'chunks so trimPool() can '
+                                               'free them']),
+                               self.create_code_block(
+                                   'line', [chunk,
+                                            'void*& chunkList = '
+                                            'getPoolChunkList()',
+                                            '*reinterpret_cast<void**>'
+                                            '(chunk) = chunkList',
+                                            'chunkList = chunk']),
+                               fill]}),
+                self.create_code_block(
+                    'line', ['void* block = freeList',
+                             'freeList = *static_cast<void**>(block)',
+                             'return block'])]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code})
+
+    # function to write operator delete for a pooled class
+    def write_operator_delete(self, static=True):
+        if not self.pooled:
+            return
+        # create doc string header
+        title_line = 'Returns the memory used by a {0} to the pool kept ' \
+                     'for the class.'.format(self.object_name)
+        params = ['@param ptr the memory to be freed.',
+                  '@param size the size of the object being deleted.']
+        return_lines = []
+        additional = []
+        function = 'operator delete'
+        return_type = 'static void' if static else 'void'
+        arguments = ['void* ptr', 'size_t size']
+        # create the function implementation
+        code = [self.create_code_block('if', ['ptr == NULL', 'return']),
+                self.create_code_block(
+                    'if', ['size != sizeof({0})'.format(self.class_name),
+                           '::operator delete(ptr)', 'return']),
+                self.create_code_block(
+                    'line', ['void*& freeList = getPoolFreeList()',
+                             '*static_cast<void**>(ptr) = freeList',
+                             'freeList = ptr'])]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code})
+
+    # function to write trimPool for a pooled class
+    def write_trim_pool(self, static=True):
+        if not self.pooled:
+            return
+        # create doc string header
+        title_line = 'Frees the chunks of the calling thread\'s {0} pool ' \
+                     'that hold no live objects.'.format(self.object_name)
+        params = []
+        return_lines = ['@return the number of chunks freed.']
+        additional = ['The pool never frees memory by itself: deleting a '
+                      '{0} puts its block back in the pool, so the pool '
+                      'holds as much memory as the most {0} objects that '
+                      'were ever alive at once. Call this function after '
+                      'deleting a large document to give that memory '
+                      'back.'.format(self.object_name),
+                      ' ',
+                      'Each thread has its own pool. A {0} deleted on a '
+                      'thread other than the one that created it joins the '
+                      'pool of the deleting thread, and the chunk it came '
+                      'from then cannot be freed by this function on '
+                      'either thread.'.format(self.object_name)]
+        function = 'trimPool'
+        return_type = 'static unsigned int' if static else 'unsigned int'
+        arguments = []
+        # create the function implementation
+        block_size = 'size_t chunkSize = 257 * sizeof({0})' \
+                     ''.format(self.class_name)
+        find = 'std::map<char*, unsigned int>::iterator it = ' \
+               'unused.upper_bound(block)'
+        in_chunk = 'it != unused.begin() && block < (--it)->first + ' \
+                   'chunkSize'
+        code = [self.create_code_block(
+                    'line', ['void*& freeList = getPoolFreeList()',
+                             'void*& chunkList = getPoolChunkList()',
+                             block_size]),
+                self.create_code_block(
+                    'comment', ['count the unused blocks of each chunk of '
+                                'this thread']),
+                self.create_code_block(
+                    'line', ['std::map<char*, unsigned int> unused',
+                             'void* chunk = chunkList']),
+                self.create_code_block(
+                    'while', ['chunk != NULL',
+                              'unused[static_cast<char*>(chunk)] = 0',
+                              'chunk = *static_cast<void**>(chunk)']),
+                self.create_code_block(
+                    'for', ['void* next = freeList; next != NULL; '
+                            'next = *static_cast<void**>(next)',
+                            'char* block = static_cast<char*>(next)',
+                            find,
+                            self.create_code_block(
+                                'if', [in_chunk, 'it->second++'])]),
+                self.create_code_block(
+                    'comment', ['keep the blocks of chunks that are still '
+                                'in use and those of other threads']),
+                self.create_code_block('line', ['void* kept = NULL']),
+                self.create_code_block(
+                    'while', ['freeList != NULL',
+                              'char* block = static_cast<char*>(freeList)',
+                              'freeList = *static_cast<void**>(freeList)',
+                              find,
+                              self.create_code_block(
+                                  'if', [in_chunk,
+                                         self.create_code_block(
+                                             'if', ['it->second == 256',
+                                                    'continue'])]),
+                              self.create_code_block(
+                                  'line',
+                                  ['*reinterpret_cast<void**>(block) = kept',
+                                   'kept = block'])]),
+                self.create_code_block('line', ['freeList = kept']),
+                self.create_code_block(
+                    'comment', ['free the chunks none of whose blocks are '
+                                'in use']),
+                self.create_code_block(
+                    'line', ['unsigned int freed = 0',
+                             'void* keptChunks = NULL',
+                             'std::map<char*, unsigned int>::iterator it']),
+                self.create_code_block(
+                    'for', ['it = unused.begin(); it != unused.end(); ++it',
+                            self.create_code_block(
+                                'if_else',
+                                ['it->second == 256',
+                                 '::operator delete(it->first)', 'freed++',
+                                 'else',
+                                 '*reinterpret_cast<void**>(it->first) = '
+                                 'keptChunks',
+                                 'keptChunks = it->first'])]),
+                self.create_code_block(
+                    'line', ['chunkList = keptChunks', 'return freed'])]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code})
+
+    # function to write the accessor for the free list of a pooled class
+    def write_get_pool_free_list(self, static=True):
+        title_line = 'Returns the calling thread\'s list of unused {0} ' \
+                     'blocks; each block holds a pointer to the ' \
+                     'next.'.format(self.object_name)
+        return self.write_get_pool_list(static, 'getPoolFreeList',
+                                        'freeList', title_line)
+
+    # function to write the accessor for the chunks of a pooled class
+    def write_get_pool_chunk_list(self, static=True):
+        title_line = 'Returns the calling thread\'s list of the chunks its ' \
+                     '{0} blocks are carved from; the first block of each ' \
+                     'chunk holds a pointer to the next.' \
+                     ''.format(self.object_name)
+        return self.write_get_pool_list(static, 'getPoolChunkList',
+                                        'chunkList', title_line)
+
+    def write_get_pool_list(self, static, function, variable, title_line):
+        if not self.pooled:
+            return
+        # create doc string header
+        params = []
+        return_lines = []
+        additional = []
+        return_type = 'static void*&' if static else 'void*&'
+        arguments = []
+        # create the function implementation
+        code = [self.create_code_block(
+            'line', ['static POOL_THREAD_LOCAL void* {0} = NULL'
+                     ''.format(variable),
+                     'return {0}'.format(variable)])]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.object_name,
+                     'implementation': code})
+
+    ########################################################################
+
     # HELPER FUNCTIONS
 
     def write_constructor_args(self, ns):
@@ -815,12 +1082,26 @@ class Constructors():
                                         '({2})'.format(sep, attrib['memberName'],
                                                       attrib['default']))
                 sep = ','
+            if attrib['isArray']:
+                constructor_args.append(', {0}Count (0)'
+                                        ''.format(attrib['memberName']))
+            if attrib['isArray'] and self.lazy_array:
+                constructor_args.append(', {0}TextState (ARRAY_TEXT_NONE)'
+                                        ''.format(attrib['memberName']))
             if attrib['isNumber'] or attrib['attType'] == 'boolean':
                 constructor_args.append(', mIsSet{0} (false)'
                                         .format(attrib['capAttName']))
         if self.overwrites_children:
             constructor_args.append('{0} mElementName(\"'
                                     '{1}\")'.format(sep, self.xml_name))
+            sep = ','
+        if self.child_ns:
+            constructor_args.append('{0} mChildNamespaces (NULL)'.format(sep))
+            sep = ','
+        if self.id_index:
+            constructor_args += self.write_id_index_args(sep)
+        if self.document:
+            constructor_args += self.write_doc_id_index_args(sep, 'true')
         return constructor_args
 
     @staticmethod
@@ -846,6 +1127,13 @@ class Constructors():
                 constructor_args.append('{0} {1} ( NULL )'
                                         .format(sep, attrib['memberName']))
                 sep = ','
+                constructor_args.append('{0} {1}Count ( 0 )'
+                                        .format(sep, attrib['memberName']))
+                # the copy parses any text kept by the original first
+                if self.lazy_array:
+                    constructor_args.append('{0} {1}TextState '
+                                            '( ARRAY_TEXT_NONE )'
+                                            .format(sep, attrib['memberName']))
             elif not use_null:
                 constructor_args.append('{1} {0} ( orig.{0} )'
                                         .format(attrib['memberName'], sep))
@@ -861,6 +1149,18 @@ class Constructors():
         if self.overwrites_children:
             constructor_args.append('{0} mElementName '
                                     '( orig.mElementName )'.format(sep))
+            sep = ','
+        # the namespaces used to create children are not shared
+        if self.child_ns:
+            constructor_args.append('{0} mChildNamespaces ( NULL )'
+                                    ''.format(sep))
+            sep = ','
+        # the identifier index is not copied but rebuilt when first used
+        if self.id_index:
+            constructor_args += self.write_id_index_args(sep)
+        if self.document:
+            constructor_args += \
+                self.write_doc_id_index_args(sep, 'orig.mIdIndexEnabled')
 
         return constructor_args
 
@@ -878,9 +1178,12 @@ class Constructors():
             elif attrib['isArray']:
                 member = attrib['memberName']
                 length = strFunctions.upper_first(attrib['name'])
-                constructor_args.append('{0} = NULL'.format(member))
+                if self.lazy_array:
+                    constructor_args.append('rhs.parse{0}Text()'
+                                            ''.format(length))
+                constructor_args.append('unset{0}()'.format(length))
                 constructor_args.append('set{0}(rhs.{1}, '
-                                        'rhs.{1}Length)'.format(length, member))
+                                        'rhs.{1}Count)'.format(length, member))
             # straight forward assign to rhs value list ofs that are not recursive
             elif self.assign_direct(attrib):  ## attrib['type'] != 'element':
                 constructor_args.append('{0} = rhs.{0}'
@@ -890,8 +1193,30 @@ class Constructors():
                                             .format(attrib['capAttName']))
         if self.overwrites_children:
             constructor_args.append('mElementName = rhs.mElementName')
+        if self.child_ns:
+            constructor_args.append('delete mChildNamespaces')
+            constructor_args.append('mChildNamespaces = NULL')
+        if self.id_index:
+            constructor_args.append('invalidateIdIndex()')
+        if self.document:
+            constructor_args.append('mIdIndexEnabled = rhs.mIdIndexEnabled')
+            constructor_args.append('invalidateIdIndex()')
         return constructor_args
 
+    @staticmethod
+    def write_id_index_args(sep):
+        return ['{0} mIdIndex ()'.format(sep),
+                ', mIdIndexSize (0)',
+                ', mIdIndexValid (false)']
+
+    # the document identifier index is always rebuilt when first used
+    @staticmethod
+    def write_doc_id_index_args(sep, enabled):
+        return ['{0} mSIdIndex ()'.format(sep),
+                ', mMetaIdIndex ()',
+                ', mIdIndexEnabled ({0})'.format(enabled),
+                ', mIdIndexValid (false)']
+
     def assign_direct(self, attrib):
         if attrib['type'] == 'lo_element' or attrib['type'] == 'inline_lo_element':
             if 'recursive_child' in attrib and attrib['recursive_child']:
@@ -908,7 +1233,14 @@ class Constructors():
         name = self.attributes[index]['capAttName']
         member = self.attributes[index]['memberName']
         length = member + 'Length'
-        line = ['set{0}(orig.{1}, orig.{2})'.format(name, member, length)]
+        is_set = 'mIsSet' + strFunctions.upper_first(
+            self.attributes[index]['name']) + 'Length'
+        # the set overwrites the length attribute copied by the arguments
+        line = ['set{0}(orig.{1}, orig.{1}Count)'.format(name, member),
+                '{0} = orig.{0}'.format(length),
+                '{0} = orig.{0}'.format(is_set)]
+        if self.lazy_array:
+            line.insert(0, 'orig.parse{0}Text()'.format(name))
         return line
 
     @staticmethod
@@ -139,7 +139,7 @@ class ExtensionFunctions():
             middle_if = self.create_code_block('if', ['{0} == {1}'.format(vers, version), bottom_if])
 
             code.append(self.create_code_block('if', ['{0} == {1}'.format(level, level_val), middle_if]))
-        implementation = ['static std::string empty = \"\"', 'return empty']
+        implementation = ['static const std::string empty = \"\"', 'return empty']
         code.append(self.create_code_block('line', implementation))
         # return the parts
         return dict({'title_line': title_line,
@@ -375,17 +375,31 @@ class ExtensionFunctions():
         return_type = 'unsigned int'
 
         # create the function implementation
-        implementation = ['unsigned int tableSize = sizeof({0}ErrorTable)/'
-                          'sizeof({0}ErrorTable[0])'.format(self.package),
-                          'unsigned int index = 0']
-        code = [dict({'code_type': 'line', 'code': implementation})]
-        if_code = self.create_code_block('if', ['errorId == {0}ErrorTable[i]'
-                                                '.code'.format(self.package),
-                                                'index = i', 'break'])
-        code.append(self.create_code_block('for', ['unsigned int i = 0; '
-                                                   'i < tableSize; i++',
-                                                   if_code]))
-        code.append(self.create_code_block('line', ['return index']))
+        table = '{0}ErrorTable'.format(self.package)
+        implementation = ['unsigned int tableSize = sizeof({0})/'
+                          'sizeof({0}[0])'.format(table),
+                          'unsigned int low = 0',
+                          'unsigned int high = tableSize']
+        code = [dict({'code_type': 'line', 'code': implementation}),
+                self.create_code_block('comment',
+                                       ['the table is written in order of '
+                                        'error code'])]
+        if_code = self.create_code_block('if_else',
+                                         ['{0}[mid].code < errorId'.format(table),
+                                          'low = mid + 1', 'else',
+                                          'high = mid'])
+        code.append(self.create_code_block('while', ['low < high',
+                                                     self.create_code_block(
+                                                         'line',
+                                                         ['unsigned int mid = '
+                                                          'low + (high - low) '
+                                                          '/ 2']),
+                                                     if_code]))
+        code.append(self.create_code_block('if',
+                                           ['low < tableSize && {0}[low].code '
+                                            '== errorId'.format(table),
+                                            'return low']))
+        code.append(self.create_code_block('line', ['return 0']))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -246,18 +246,89 @@ class ExtensionInitFunctions():
 
         # create the function implementation
         if values:
-            implementation = ['static int size = sizeof({0})/sizeof'
-                              '({0}[0])'.format(str_name),
-                              'std::string type(code)']
-            code = [dict({'code_type': 'line', 'code': implementation})]
-            if_code = self.create_code_block('if', ['type == {0}'
-                                                    '[i]'.format(str_name),
-                                                    'return ({0}_t)'
-                                                    '(i)'.format(name)])
-            code.append(self.create_code_block('for', ['int i = 0; i < size; '
-                                                       'i++', if_code]))
-            code.append(self.create_code_block
-                        ('line', ['return {0}'.format(values[-1])]))
+            code = [self.create_code_block('if', ['code == NULL',
+                                                  'return {0}'
+                                                  ''.format(values[-1])]),
+                    self.create_code_block('line',
+                                           ['return {0}_fromStringWithLength'
+                                            '(code, strlen(code))'
+                                            ''.format(name)])]
+        else:
+            code = []
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': name,
+                     'implementation': code})
+
+    def write_enum_from_string_with_length_function(self, index,
+                                                    values=None):
+        enum = self.enums[index]
+        name = enum['name']
+        classname = self.get_class_name(enum['values'][0]['name'])
+        # create comment parts
+        title_line = 'Returns the #{2}_t enumeration corresponding to the ' \
+                     'first @p length characters of the given string or ' \
+                     '@sbmlconstant{0}{1}, {2}_t{3} if there is no such ' \
+                     'match.'.format(self.open_br, values[-1], name,
+                                     self.close_br)
+        params = ['@param code the string to convert to a #{0}_t; it need '
+                  'not be null-terminated.'.format(name),
+                  '@param length the number of characters in @p code.']
+        return_lines = ['@return the corresponding #{2}_t or @sbmlconstant{0}'
+                        '{1}, {2}_t{3} if no match is found.'
+                        ''.format(self.open_br, values[-1], name,
+                                  self.close_br)]
+        additional = ['This is the form used when reading, as it neither '
+                      'copies the string nor measures it.', ' ',
+                      '@if conly', '@memberof {0}_t'.format(classname),
+                      '@endif']
+
+        # create the function declaration
+        arguments = ['const char* code', 'size_t length']
+        function = '{0}_fromStringWithLength'.format(name)
+        return_type = '{0}_t'.format(name)
+
+        # create the function implementation
+        if values:
+            # group the strings by length so that only strings of the
+            # right length are compared; the invalid value is the fallback
+            buckets = dict()
+            for i in range(0, len(enum['values'])):
+                if enum['values'][i]['name'] == values[-1]:
+                    continue
+                value = enum['values'][i]['value']
+                if value not in buckets.get(len(value), []):
+                    buckets.setdefault(len(value), []).append(value)
+            cases = ['length']
+            for length in sorted(buckets):
+                cases.append('case {0}'.format(length))
+                lines = []
+                for value in buckets[length]:
+                    enum_value = enum['values'][
+                        [v['value'] for v in enum['values']].index(value)]
+                    lines.append(self.create_code_block(
+                        'if', ['memcmp(code, \"{0}\", {1}) == 0'
+                               ''.format(value, length),
+                               'return {0}'.format(enum_value['name'])]))
+                lines.append('break')
+                cases.append(lines)
+            cases.append('default')
+            cases.append(['break'])
+            code = [self.create_code_block('if', ['code == NULL',
+                                                  'return {0}'
+                                                  ''.format(values[-1])]),
+                    self.create_code_block('switch', cases),
+                    self.create_code_block('line',
+                                           ['return {0}'.format(values[-1])])]
         else:
             code = []
 
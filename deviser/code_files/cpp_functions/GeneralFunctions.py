@@ -940,11 +940,88 @@ class GeneralFunctions():
                                        ['stream.startElement(getElementName(), '
                                         'getPrefix())',
                                         'writeAttributes(stream)'])]
-        nested_for = self.create_code_block(
-            'for', ['int i = 0; i < m{0}Length; ++i'.format(name),
-                    'stream << ({0}){1}[i] << \" \"'
-                    ''.format(array_type, member)])
-        implementation = ['isSet{0}()'.format(name), nested_for]
+        if array_type == 'double' or array_type == 'float':
+            # shortest of 15 or 17 significant digits that reads back
+            # exactly; sprintf and strtod share the C locale so only the
+            # decimal point written needs replacing
+            point = self.create_code_block(
+                'if', ['point != \'.\'',
+                       self.create_code_block(
+                           'for', ['int j = 0; j < n; ++j',
+                                   self.create_code_block(
+                                       'if', ['chunk[used + j] == point',
+                                              'chunk[used + j] = \'.\''])])])
+            format_value = [self.create_code_block(
+                'else_if',
+                ['val != val',
+                 'memcpy(chunk + used, \"NaN \", 4)', 'used += 4',
+                 'else if', 'val - val != 0 && val > 0',
+                 'memcpy(chunk + used, \"INF \", 4)', 'used += 4',
+                 'else if', 'val - val != 0',
+                 'memcpy(chunk + used, \"-INF \", 5)', 'used += 5',
+                 'else',
+                 self.create_code_block(
+                     'line', ['int n = sprintf(chunk + used, \"%.15g\", val)']),
+                 self.create_code_block(
+                     'if', ['strtod(chunk + used, NULL) != val',
+                            'n = sprintf(chunk + used, \"%.17g\", val)']),
+                 point,
+                 self.create_code_block('line', ['used += n',
+                                                 'chunk[used++] = \' \''])])]
+            value = [self.create_code_block(
+                'line', ['double val = (double){0}[i]'.format(member)])]
+            setup = ['char point = *localeconv()->decimal_point']
+        else:
+            # integers are written by hand, lowest digit first
+            unsigned = array_type.startswith('unsigned')
+            digits = self.create_code_block(
+                'while', ['n == 0 || magnitude != 0',
+                          self.create_code_block(
+                              'line',
+                              ['digits[n++] = (char)(\'0\' + magnitude % 10)',
+                               'magnitude /= 10'])])
+            if unsigned:
+                value = [self.create_code_block(
+                    'line', ['unsigned long magnitude = (unsigned long)'
+                             '({0}[i])'.format(member),
+                             'char digits[24]', 'int n = 0'])]
+            else:
+                value = [self.create_code_block(
+                            'line', ['{0} val = ({0}){1}[i]'.format(array_type,
+                                                                     member),
+                                     'unsigned long magnitude = '
+                                     '(unsigned long)(val)',
+                                     'char digits[24]', 'int n = 0']),
+                         self.create_code_block(
+                             'if', ['val < 0', 'chunk[used++] = \'-\'',
+                                    'magnitude = 0UL - magnitude'])]
+            value.append(digits)
+            format_value = [self.create_code_block(
+                                'while', ['n > 0',
+                                          'chunk[used++] = digits[--n]']),
+                            self.create_code_block(
+                                'line', ['chunk[used++] = \' \''])]
+            setup = []
+        flush = self.create_code_block('if',
+                                       ['used >= 65536',
+                                        'stream << std::string(chunk, used)',
+                                        'used = 0'])
+        loop = ['int i = 0; i < m{0}Count; ++i'.format(name)]
+        loop += value + format_value + [flush]
+        implementation = ['isSet{0}()'.format(name),
+                          self.create_code_block(
+                              'comment',
+                              ['values are formatted straight into a chunk '
+                               'that is written',
+                               'when full, without a stream for each '
+                               'value']),
+                          self.create_code_block('line',
+                                                 ['char chunk[65536 + 32]',
+                                                  'size_t used = 0']
+                                                 + setup),
+                          self.create_code_block('for', loop),
+                          self.create_code_block(
+                              'line', ['stream << std::string(chunk, used)'])]
         code.append(self.create_code_block('if', implementation))
         code.append(self.create_code_block(
             'line', ['stream.endElement(getElementName(), getPrefix())']))
@@ -1315,6 +1392,13 @@ class GeneralFunctions():
                           '{0}ConsistencyValidator '
                           'core_validator'.format(self.package)]
         code.append(self.create_code_block('line', implementation))
+        code.append(self.create_code_block('comment',
+                                           ['the validators that resolve '
+                                            'references share one index of '
+                                            'the model']))
+        code.append(self.create_code_block('line',
+                                           ['std::map<std::string, const '
+                                            'SBase*> idIndex']))
         implementation = self.get_validator_block('id')
         code.append(self.create_code_block('if', implementation))
         implementation = self.get_validator_block('core')
@@ -1433,8 +1517,13 @@ class GeneralFunctions():
                                             'log->add({0}_validator.get'
                                             'Failures())'.format(valid_id),
                                             bail_if])
+        share_if = self.create_code_block('if',
+                                          ['doc->getModel() != NULL',
+                                           '{0}_validator.shareIdIndex(idIndex, '
+                                           '*doc->getModel())'.format(valid_id)])
         code_block = ['{0}'.format(valid_id),
                       '{0}_validator.init()'.format(valid_id),
+                      share_if,
                       'nerrors = {0}_validator.validate(*doc)'.format(valid_id),
                       'total_errors += nerrors', errors_if]
         return code_block
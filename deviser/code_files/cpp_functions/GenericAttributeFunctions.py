@@ -51,6 +51,8 @@ class GenericAttributeFunctions():
         else:
             self.class_name = class_object['name']
         self.base_class = class_object['baseClass']
+        self.lazy_array = 'lazyArray' in class_object \
+            and class_object['lazyArray']
         if not writing_test:
             self.language = language
             self.cap_language = language.upper()
@@ -108,6 +110,14 @@ class GenericAttributeFunctions():
             self.is_plugin = False
             if 'is_plugin' in class_object:
                 self.is_plugin = class_object['is_plugin']
+            # a generated base class has attribute identifiers of its own
+            # which those of this class follow on from
+            self.id_base = None
+            if not self.is_plugin and self.base_class \
+                    and self.base_class != global_variables.baseClass \
+                    and query.get_class(self.base_class,
+                                        self.classroot) is not None:
+                self.id_base = self.base_class
 
         self.open_br = '{'
         self.close_br = '}'
@@ -152,47 +162,31 @@ class GenericAttributeFunctions():
 
 
         arg1 = '{0}& value'.format(att_type)
-        end_get = '()'
         if att_type == 'const char*':
             arg1 = '{0} value'.format(att_type)
-            end_get = '().c_str()'
         arguments = ['const std::string& attributeName', arg1]
 
         # create the function implementation
         first_line = ['int return_value = {0}::getAttribute(attributeName, value)'.format(self.base_class)]
         first_if = ['return_value == {0}'.format(global_variables.ret_success), 'return return_value']
         last_line = ['return return_value']
-        first = True
-        block = []
-        for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
-            if attrib['attType'] == 'enum':
-                lines = ['value = get{0}AsString{1}'.format(attrib['capAttName'],end_get),
-                         'return_value = {0}'.format(global_variables.ret_success)]
-            else:
-                lines = ['value = get{0}{1}'.format(attrib['capAttName'],end_get),
-                         'return_value = {0}'.format(global_variables.ret_success)]
-            block.append(self.create_code_block('line', lines))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+        lookup_code = self.write_lookup_block('return_value = '
+                                              'getAttribute(attributeId, '
+                                              'value)')
         code = []
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
                     self.create_code_block('line', last_line)]
+        elif self.id_base:
+            code = self.write_dispatch_once('getAttribute(attributeId, '
+                                            'value)',
+                                            'getAttribute(attributeName, '
+                                            'value)')
         else:
             code = [self.create_code_block('line', first_line),
-                    self.create_code_block('if', first_if),
-                    if_block,
-                    self.create_code_block('line', last_line)]
+                    self.create_code_block('if', first_if)] + \
+                lookup_code + \
+                [self.create_code_block('line', last_line)]
 
         # return the parts
         return dict({'title_line': title_line,
@@ -240,33 +234,19 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['bool value = {0}::isSetAttribute(attributeName)'.format(self.base_class)]
         last_line = ['return value']
-        first = True
-        block = []
-        for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
-            if 'isVector' in attrib and attrib['isVector']:
-                block.append('value = has{0}()'.format(strFunctions.upper_first(attrib['pluralName'])))
-            else:
-                block.append('value = isSet{0}()'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+        lookup_code = self.write_lookup_block('value = '
+                                              'isSetAttribute(attributeId)')
         code = []
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
                     self.create_code_block('line', last_line)]
+        elif self.id_base:
+            code = self.write_dispatch_once('isSetAttribute(attributeId)',
+                                            'isSetAttribute(attributeName)')
         else:
-            code = [self.create_code_block('line', first_line),
-                    if_block,
-                    self.create_code_block('line', last_line)]
+            code = [self.create_code_block('line', first_line)] + \
+                lookup_code + \
+                [self.create_code_block('line', last_line)]
 
         # return the parts
         return dict({'title_line': title_line,
@@ -320,29 +300,21 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['int return_value = {0}::setAttribute(attributeName, value)'.format(self.base_class)]
         last_line = ['return return_value']
-        first = True
-        block = []
-        for attrib in attributes:
-            name = attrib['name']
-            if 'xml_name' in attrib and attrib['xml_name'] != '':
-                name = attrib['xml_name']
-            if not first:
-                block.append('else if')
-            else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
-            block.append('return_value = set{0}(value)'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
-            else:
-                if_block = self.create_code_block('if', block)
+        lookup_code = self.write_lookup_block('return_value = '
+                                              'setAttribute(attributeId, '
+                                              'value)')
         if len(attributes) == 0:
             code = [self.create_code_block('line', first_line),
                     self.create_code_block('line', last_line)]
+        elif self.id_base:
+            code = self.write_dispatch_once('setAttribute(attributeId, '
+                                            'value)',
+                                            'setAttribute(attributeName, '
+                                            'value)')
         else:
-            code = [self.create_code_block('line', first_line),
-                    if_block,
-                    self.create_code_block('line', last_line)]
+            code = [self.create_code_block('line', first_line)] + \
+                lookup_code + \
+                [self.create_code_block('line', last_line)]
 
         # return the parts
         return dict({'title_line': title_line,
@@ -395,33 +367,344 @@ class GenericAttributeFunctions():
         # create the function implementation
         first_line = ['int value = {0}::unsetAttribute(attributeName)'.format(self.base_class)]
         last_line = ['return value']
-        first = True
-        block = []
-        for attrib in attributes:
+        lookup_code = self.write_lookup_block('value = '
+                                              'unsetAttribute(attributeId)')
+        code = []
+        if len(attributes) == 0:
+            code = [self.create_code_block('line', first_line),
+                    self.create_code_block('line', last_line)]
+        elif self.id_base:
+            code = self.write_dispatch_once('unsetAttribute(attributeId)',
+                                            'unsetAttribute(attributeName)')
+        else:
+            code = [self.create_code_block('line', first_line)] + \
+                lookup_code + \
+                [self.create_code_block('line', last_line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    ########################################################################
+
+    # Functions for writing the integer attribute identifiers
+
+    def get_attribute_ids(self):
+        """
+        Return the identifiers of the attributes of this class, in the order
+        they are numbered, as [enumerator, xml name] pairs.
+        """
+        ids = []
+        for attrib in query.get_unique_attributes(self.attributes):
             name = attrib['name']
             if 'xml_name' in attrib and attrib['xml_name'] != '':
                 name = attrib['xml_name']
-            if not first:
-                block.append('else if')
+            ids.append(['ATTR_{0}'.format(strFunctions.upper_snake(
+                attrib['name'])), name])
+        return ids
+
+    def get_attribute_id_first(self):
+        if self.id_base:
+            return '{0}::ATTR_COUNT'.format(self.id_base)
+        else:
+            return '0'
+
+    def write_lookup_block(self, line):
+        return [self.create_code_block('line', ['int attributeId = '
+                                                'lookupAttribute'
+                                                '(attributeName)']),
+                self.create_code_block('if', ['attributeId != -1', line])]
+
+    # the identifiers of a derived class include those of its base class,
+    # so an attribute is looked up and handled once here and only names
+    # with no identifier go to the base class
+    def write_dispatch_once(self, id_call, base_call):
+        return self.write_lookup_block('return {0}'.format(id_call)) + \
+            [self.create_code_block('line',
+                                    ['return {0}::{1}'.format(self.id_base,
+                                                              base_call)])]
+
+    def write_id_switch(self, cases, base_call, default_return):
+        code = []
+        if len(cases) > 0:
+            code.append(self.create_code_block('switch',
+                                               ['attributeId'] + cases +
+                                               ['default', ['break']]))
+        if self.id_base:
+            code.append(self.create_code_block('line', ['return {0}::{1}'
+                                                        ''.format(self.id_base,
+                                                                  base_call)]))
+        else:
+            code.append(self.create_code_block('line', ['return {0}'
+                                                        ''.format(default_return)]))
+        return code
+
+    def get_attribute_id(self, attrib):
+        return 'ATTR_{0}'.format(strFunctions.upper_snake(attrib['name']))
+
+    # function to write lookupAttribute
+    def write_lookup_attribute(self):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        # create comment parts
+        title_line = 'Returns the identifier of the "attributeName" ' \
+                     'attribute of this {0}.'.format(self.class_name)
+        params = ['@param attributeName, the name of the attribute.']
+        return_lines = ['@return the identifier to use with the integer '
+                        'forms of getAttribute(), isSetAttribute(), '
+                        'setAttribute() and unsetAttribute(), or @c -1 if '
+                        'there is no such attribute.']
+        additional = []
+
+        # create the function declaration
+        function = 'lookupAttribute'
+        if self.is_header:
+            return_type = 'static int'
+        else:
+            return_type = 'int'
+        arguments = ['const std::string& attributeName']
+
+        # create the function implementation
+        ids = self.get_attribute_ids()
+        code = []
+        if len(ids) > 0:
+            names = ', '.join('\"{0}\"'.format(i[1]) for i in ids)
+            code.append(self.create_code_block(
+                'line', ['static const char* const names[] = {{ {0} }}'
+                         ''.format(names)]))
+            match = self.create_code_block(
+                'if', ['attributeName == names[i - {0}]'.format(ids[0][0]),
+                       'return i'])
+            code.append(self.create_code_block(
+                'for', ['int i = {0}; i < ATTR_COUNT; i++'.format(ids[0][0]),
+                        match]))
+        if self.id_base:
+            code.append(self.create_code_block(
+                'line', ['return {0}::lookupAttribute(attributeName)'
+                         ''.format(self.id_base)]))
+        else:
+            code.append(self.create_code_block('line', ['return -1']))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write getAttribute taking an identifier
+    def write_get_by_id(self, attributes, att_type):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        # create comment parts
+        title_line = 'Gets the value of the attribute with the given ' \
+                     'identifier of this {0}.'.format(self.class_name)
+        params = ['@param attributeId, the identifier of the attribute, '
+                  'as returned by lookupAttribute().',
+                  '@param value, the address of the value to record.']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, '
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.success, self.close_br),
+                        '@li @{0}constant{1}{2},'
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.failed, self.close_br)]
+        additional = []
+
+        # create the function declaration
+        function = 'getAttribute'
+        return_type = 'int'
+        arguments = ['int attributeId', '{0}& value'.format(att_type)]
+
+        # create the function implementation
+        cases = []
+        for attrib in attributes:
+            if attrib['attType'] == 'enum':
+                line = 'value = get{0}AsString()'.format(attrib['capAttName'])
             else:
-                first = False
-            block.append('attributeName == \"{0}\"'.format(name))
-            if attrib['attType'] == 'vector':
-                block.append('value = clear{0}()'.format(strFunctions.upper_first(attrib['pluralName'])))
+                line = 'value = get{0}()'.format(attrib['capAttName'])
+            cases += ['case {0}'.format(self.get_attribute_id(attrib)),
+                      [line, 'return {0}'.format(self.success)]]
+        code = self.write_id_switch(cases,
+                                    'getAttribute(attributeId, value)',
+                                    self.failed)
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write isSetAttribute taking an identifier
+    def write_is_set_by_id(self, attributes):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        # create comment parts
+        title_line = 'Predicate returning {0} if the attribute with the ' \
+                     'given identifier of this {1} is set.' \
+            .format(self.true, self.class_name)
+        params = ['@param attributeId, the identifier of the attribute, '
+                  'as returned by lookupAttribute().']
+        return_lines = ['@return {0} if the attribute has been set, '
+                        'otherwise {1} is returned.'.format(self.true,
+                                                            self.false)]
+        additional = []
+
+        # create the function declaration
+        function = 'isSetAttribute'
+        return_type = 'bool'
+        arguments = ['int attributeId']
+
+        # create the function implementation
+        cases = []
+        for attrib in attributes:
+            if 'isVector' in attrib and attrib['isVector']:
+                line = 'return has{0}()'.format(
+                    strFunctions.upper_first(attrib['pluralName']))
             else:
-                block.append('value = unset{0}()'.format(attrib['capAttName']))
-            if len(block) > 2:
-                if_block = self.create_code_block('else_if', block)
+                line = 'return isSet{0}()'.format(attrib['capAttName'])
+            cases += ['case {0}'.format(self.get_attribute_id(attrib)),
+                      [line]]
+        code = self.write_id_switch(cases, 'isSetAttribute(attributeId)',
+                                    'false')
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write setAttribute taking an identifier
+    def write_set_by_id(self, attributes, att_type):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        # create comment parts
+        title_line = 'Sets the value of the attribute with the given ' \
+                     'identifier of this {0}.'.format(self.class_name)
+        params = ['@param attributeId, the identifier of the attribute, '
+                  'as returned by lookupAttribute().',
+                  '@param value, the value of the attribute to set.']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, '
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.success, self.close_br),
+                        '@li @{0}constant{1}{2},'
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.failed, self.close_br)]
+        additional = []
+
+        # create the function declaration
+        function = 'setAttribute'
+        return_type = 'int'
+        arguments = ['int attributeId', '{0} value'.format(att_type)]
+
+        # create the function implementation
+        cases = []
+        for attrib in attributes:
+            cases += ['case {0}'.format(self.get_attribute_id(attrib)),
+                      ['return set{0}(value)'.format(attrib['capAttName'])]]
+        code = self.write_id_switch(cases,
+                                    'setAttribute(attributeId, value)',
+                                    self.failed)
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write unsetAttribute taking an identifier
+    def write_unset_by_id(self, attributes):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        # create comment parts
+        title_line = 'Unsets the value of the attribute with the given ' \
+                     'identifier of this {0}.'.format(self.class_name)
+        params = ['@param attributeId, the identifier of the attribute, '
+                  'as returned by lookupAttribute().']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, '
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.success, self.close_br),
+                        '@li @{0}constant{1}{2},'
+                        ' OperationReturnValues_'
+                        't{3}'.format(self.language, self.open_br,
+                                      self.failed, self.close_br)]
+        additional = []
+
+        # create the function declaration
+        function = 'unsetAttribute'
+        return_type = 'int'
+        arguments = ['int attributeId']
+
+        # create the function implementation
+        cases = []
+        for attrib in attributes:
+            if attrib['attType'] == 'vector':
+                line = 'return clear{0}()'.format(
+                    strFunctions.upper_first(attrib['pluralName']))
             else:
-                if_block = self.create_code_block('if', block)
-        code = []
-        if len(attributes) == 0:
-            code = [self.create_code_block('line', first_line),
-                    self.create_code_block('line', last_line)]
-        else:
-            code = [self.create_code_block('line', first_line),
-                    if_block,
-                    self.create_code_block('line', last_line)]
+                line = 'return unset{0}()'.format(attrib['capAttName'])
+            cases += ['case {0}'.format(self.get_attribute_id(attrib)),
+                      [line]]
+        code = self.write_id_switch(cases, 'unsetAttribute(attributeId)',
+                                    self.failed)
 
         # return the parts
         return dict({'title_line': title_line,
@@ -1016,6 +1299,184 @@ class GenericAttributeFunctions():
                      'object_name': self.class_name,
                      'implementation': code})
 
+    # round trip the text of an array attribute; the time the parse takes
+    # is reported by the Benchmark program
+    def write_array_text_test(self, attrib, reader):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        name = attrib['name']
+        array_type = attrib['element']
+        if array_type == 'double' or array_type == 'float':
+            expected = '({0})(i % 1024) * 0.25'.format(array_type)
+            equals = 'util_isEqual(values[i], expected)'
+        else:
+            expected = '({0})(i % 1024)'.format(array_type)
+            equals = 'values[i] == expected'
+
+        # create comment parts
+        params = []
+        return_lines = []
+        additional = []
+        title_line = ''
+
+        # create the function declaration
+        function = ''
+        return_type = ''
+
+        test_function = 'test_ArrayText_{0}_{1}'.format(self.class_name, name)
+        arguments = [test_function]
+        self.tests.append(test_function)
+
+        # create the function implementation
+        implementation = ['{0} *obj = new {0}()'.format(reader),
+                          'const int numValues = 10000',
+                          'std::ostringstream text']
+        write_text = self.create_code_block('for',
+                                            ['int i = 0; i < numValues; i++',
+                                             'text << {0} << " "'
+                                             ''.format(expected)])
+        read = ['obj->readText(text.str())']
+        # the text is only kept by the read so the first query parses it
+        if self.lazy_array:
+            read.append('fail_unless(obj->isSet{0}() == true)'
+                        ''.format(attrib['capAttName']))
+        check = ['fail_unless(obj->get{0}Length() == '
+                 'numValues)'.format(attrib['capAttName']),
+                 '{0}* values = new {0}[numValues]'.format(array_type),
+                 'obj->get{0}(values)'.format(attrib['capAttName'])]
+        check_values = self.create_code_block('for',
+                                              ['int i = 0; i < numValues; i++',
+                                               '{0} expected = {1}'
+                                               ''.format(array_type, expected),
+                                               'fail_unless({0})'
+                                               ''.format(equals)])
+        code = [self.create_code_block('line', implementation),
+                write_text,
+                self.create_code_block('line', read),
+                self.create_code_block('line', check),
+                check_values,
+                self.create_code_block('line', ['delete[] values',
+                                                'delete obj'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    # deflate and inflate an array attribute timing both directions
+    def write_compression_test(self, attrib, dimension=None):
+        if not self.is_cpp_api:
+            return
+        elif self.is_list_of:
+            return
+
+        name = attrib['name']
+        cap_name = attrib['capAttName']
+        array_type = attrib['element']
+        # zlib works on bytes so keep the values in range and compressible
+        expected = '({0})((i / 64) % 256)'.format(array_type)
+
+        # create comment parts
+        params = []
+        return_lines = []
+        additional = []
+        title_line = ''
+
+        # create the function declaration
+        function = ''
+        return_type = ''
+
+        test_function = 'test_Compression_{0}_{1}'.format(self.class_name,
+                                                          name)
+        arguments = [test_function]
+        self.tests.append(test_function)
+
+        # create the function implementation
+        implementation = ['{0} *obj = new {0}(3, 1)'.format(self.class_name),
+                          'const int numValues = 4000000',
+                          '{0}* data = new {0}[numValues]'.format(array_type)]
+        write_data = self.create_code_block('for',
+                                            ['int i = 0; i < numValues; i++',
+                                             'data[i] = {0}'.format(expected)])
+        setup = ['obj->adopt{0}(data, numValues)'.format(cap_name)]
+        # with the dimensions set the inflate writes into a pre-sized result
+        if dimension is not None:
+            setup.insert(0, 'obj->set{0}(numValues)'
+                            ''.format(dimension['capAttName']))
+        deflate = ['clock_t start = clock()',
+                   'int result = obj->compress()',
+                   'double deflated = (double)(clock() - start) / '
+                   'CLOCKS_PER_SEC']
+        no_zlib = self.create_code_block('if',
+                                         ['result == LIBSBML_OPERATION_FAILED',
+                                          'std::cout << "{0} {1}: libSBML is '
+                                          'built without zlib" << std::endl'
+                                          ''.format(self.class_name, name),
+                                          'delete obj',
+                                          'return'])
+        inflate = ['int compressedLength = obj->get{0}Length()'
+                   ''.format(cap_name),
+                   'start = clock()',
+                   'obj->uncompress()',
+                   'double inflated = (double)(clock() - start) / '
+                   'CLOCKS_PER_SEC',
+                   'std::cout << "{0} {1}: deflated " << numValues << " '
+                   'values to " << compressedLength << " in " << deflated '
+                   '<< "s, inflated in " << inflated << "s" << std::endl'
+                   ''.format(self.class_name, name)]
+        check = ['fail_unless(obj->getUncompressedLength() == '
+                 '(unsigned int)numValues)',
+                 '{0}* values = new {0}[numValues]'.format(array_type),
+                 'obj->getUncompressed(values)']
+        check_values = self.create_code_block('for',
+                                              ['int i = 0; i < numValues; i++',
+                                               'fail_unless(values[i] == '
+                                               '{0})'.format(expected)])
+        wide = ['{0} wideData[2] = {{ 0, 256 }}'.format(array_type),
+                '{0} *wide = new {0}(3, 1)'.format(self.class_name),
+                'wide->set{0}(wideData, 2)'.format(cap_name),
+                'fail_unless(wide->compress() == '
+                'LIBSBML_INVALID_ATTRIBUTE_VALUE)',
+                'delete wide']
+        code = [self.create_code_block('line', implementation),
+                write_data,
+                self.create_code_block('line', setup),
+                self.create_code_block('line', deflate),
+                no_zlib,
+                self.create_code_block('line', inflate),
+                self.create_code_block('line', check),
+                check_values,
+                self.create_code_block('comment',
+                                       ['values that do not fit in a byte '
+                                        'cannot be deflated']),
+                self.create_code_block('line', wide),
+                self.create_code_block('line', ['delete[] values',
+                                                'delete obj'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
     @staticmethod
     def create_code_block(code_type, lines):
         code = dict({'code_type': code_type, 'code': lines})
@@ -77,6 +77,14 @@ class GlobalQueryFunctions():
         else:
             self.std_base = class_object['std_base']
 
+        self.document = False
+        if 'document' in class_object:
+            self.document = class_object['document']
+
+        self.root = None
+        if 'root' in class_object:
+            self.root = class_object['root']
+
         self.has_only_math = class_object['has_only_math']
         self.num_children = class_object['num_children']
         self.num_non_std_children = class_object['num_non_std_children']
@@ -124,10 +132,12 @@ class GlobalQueryFunctions():
         code = []
         if not self.is_header:
             implementation = ['id.empty()', 'return NULL']
-            code = [self.create_code_block('if', implementation),
-                    self.create_code_block('line',
-                                           ['{0}* obj = '
-                                            'NULL'.format(self.std_base)])]
+            code = [self.create_code_block('if', implementation)]
+            if self.document:
+                code.append(self.write_id_index_lookup('mSIdIndex', 'id'))
+            code.append(self.create_code_block('line',
+                                               ['{0}* obj = '
+                                                'NULL'.format(self.std_base)]))
 
             if_block = ['obj != NULL', 'return obj']
             if_code = self.create_code_block('if', if_block)
@@ -184,7 +194,7 @@ class GlobalQueryFunctions():
 
     # function to write get by metaid
     def write_get_by_metaid(self):
-        if not global_variables.is_package:
+        if not global_variables.is_package and not self.document:
             return
         # only write for elements with  base derived children in cpp
         if not self.is_cpp_api or self.num_children == 0:
@@ -210,9 +220,12 @@ class GlobalQueryFunctions():
         code = []
         if not self.is_header:
             code = [self.create_code_block('if',
-                                           ['metaid.empty()', 'return NULL']),
-                    self.create_code_block('line', ['{0}* obj = NUL'
-                                                    'L'.format(self.std_base)])]
+                                           ['metaid.empty()', 'return NULL'])]
+            if self.document:
+                code.append(self.write_id_index_lookup('mMetaIdIndex',
+                                                       'metaid'))
+            code.append(self.create_code_block('line', ['{0}* obj = NUL'
+                                                        'L'.format(self.std_base)]))
             if_block = ['obj != NULL', 'return obj']
             if_code = self.create_code_block('if', if_block)
             for i in range(0, len(self.child_elements)):
@@ -275,8 +288,8 @@ class GlobalQueryFunctions():
     def write_get_all_elements(self):
         """
         This writes the 'getAllElements(ElementFilter*) function.
-        The function uses macros to loop through any child elements and return
-        objects to the list to be returned.
+        The function collects the objects passed to it by forEachElement()
+        into the list to be returned.
         The optional ElementFilter argument allows users to define a filter
         to allow/disallow objects from being added to the list.
         For example, this would allow users to return all elements that have a
@@ -290,15 +303,7 @@ class GlobalQueryFunctions():
 
         :return: dictionary of parts of function
         """
-        # create appropriate names
-        if self.cap_language == 'SBML':
-            element_filter = 'ElementFilter'
-            add_filtered = 'ADD_FILTERED'
-        else:
-            element_filter = '{0}ElementFilter'.\
-                format(global_variables.prefix)
-            add_filtered = 'ADD_{0}_FILTERED'\
-                .format(global_variables.prefix.upper())
+        element_filter = self.get_element_filter()
 
         # only write for this function for elements with base derived
         # children in cpp code
@@ -327,40 +332,423 @@ class GlobalQueryFunctions():
 
         code = []
         if not self.is_header:
-            sublist = 'NULL'
-            if self.is_list_of:
-                sublist = 'ListOf::getAllElements(filter)'
             implementation = ['List* ret = new List()',
-                              'List* sublist = {0}'.format(sublist)]
+                              'forEachElement(addElementToList, ret, '
+                              'filter)',
+                              'return ret']
             code = [self.create_code_block('line', implementation)]
-            implementation = []
-            for child_element in self.child_elements:
-                # do not write for an ASTNode
-                if child_element['element'] == 'ASTNode':
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write forEachElement
+    def write_for_each_element(self):
+        """
+        This writes the 'forEachElement(action, userData, filter)' function,
+        which walks the child elements depth first without building lists.
+
+        Every class gets the function so that a parent can call it on any
+        child; a class without child elements only visits elements held by
+        its plugins, or inherits the function from a generated base class.
+
+        :return: dictionary of parts of function
+        """
+        if not self.is_cpp_api:
+            return
+        if self.is_plugin and not self.has_std_children():
+            return
+        # a class without children of its own inherits the walk of a
+        # base class generated here
+        if not self.is_list_of and not self.has_std_children() \
+                and query.get_class(self.base_class, self.root) is not None:
+            return
+
+        element_filter = self.get_element_filter()
+        with_plugins = self.cap_language == 'SBML' and not self.is_plugin
+
+        # create comment parts
+        title_line = 'Calls @p action on each child {0} object, including ' \
+                     'those nested to an arbitrary depth, in the order ' \
+                     'getAllElements() lists them.'.format(self.std_base)
+        params = ['@param action the function to call with each element and '
+                  '@p userData; returning {0} stops the '
+                  'walk.'.format(self.false),
+                  '@param userData a pointer passed on to @p action.',
+                  '@param filter an ElementFilter that may impose '
+                  'restrictions on the objects passed to @p action.']
+        return_lines = ['@return {0} if @p action stopped the walk, {1} '
+                        'otherwise.'.format(self.false, self.true)]
+        additional = ['The walk itself allocates no memory.']
+        if with_plugins:
+            additional = ['The walk itself allocates no memory unless an '
+                          'element has plugins, whose children are listed '
+                          'with getAllElementsFromPlugins().']
+
+        # create the function declaration
+        function = 'forEachElement'
+        return_type = 'bool'
+        arguments = ['bool (*action)({0}*, void*)'.format(self.std_base),
+                     'void* userData']
+        if self.is_header:
+            arguments.append('{0} * filter = NULL'.format(element_filter))
+        else:
+            arguments.append('{0}* filter'.format(element_filter))
+
+        code = []
+        if not self.is_header:
+            if self.is_list_of:
+                item = self.create_code_block(
+                    'line', ['{0}* item = get(i)'.format(self.child_name)])
+                code.append(self.create_code_block(
+                    'for', ['unsigned int i = 0; i < size(); i++', item,
+                            self.write_visit('item')] +
+                    self.write_descend('item', '->', self.child_name,
+                                       self.root)))
+            for child in self.child_elements:
+                if child['element'] == 'ASTNode' or \
+                        child['element'] == 'XMLNode':
                     continue
-                name = child_element['memberName']
-                implementation.append('{1}_POINTER(ret, sublist, {0}, '
-                                      'filter)'.format(name, add_filtered))
-            code.append(self.create_code_block('line', implementation))
-            implementation = []
-            for child_lo_element in self.child_lo_elements:
-                name = child_lo_element['memberName']
-                elementType = 'LIST'
-                if 'recursive_child' in child_lo_element and \
-                        child_lo_element['recursive_child']:
-                    elementType = 'POINTER'
-                implementation.append('{2}_{1}(ret, sublist, {0}, '
-                                      'filter)'.format(name, elementType,
-                                                       add_filtered))
+                name = child['memberName']
+                code.append(self.create_code_block(
+                    'if', ['{0} != NULL'.format(name),
+                           self.write_visit(name)] +
+                    self.write_descend(name, '->', child['element'],
+                                       child.get('root', self.root))))
+            for child in self.child_lo_elements:
+                name = child['memberName']
+                if 'recursive_child' in child and child['recursive_child']:
+                    condition = '{0} != NULL'.format(name)
+                    visit = self.write_visit(name)
+                    descend = self.write_descend(name, '->', child['element'],
+                                                 child.get('root', self.root))
+                else:
+                    condition = '{0}.size() > 0'.format(name)
+                    visit = self.write_visit('&' + name)
+                    descend = self.write_descend(name, '.', child['element'],
+                                                 child.get('root', self.root))
+                code.append(self.create_code_block(
+                    'if', [condition, visit] + descend))
+            if with_plugins:
+                code.append(self.create_code_block(
+                    'if', ['getNumPlugins() > 0'] +
+                    self.write_visit_list('getAllElementsFromPlugins'
+                                          '(filter)')))
+            code.append(self.create_code_block('line', ['return true']))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': True,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    def write_visit(self, element):
+        return self.create_code_block(
+            'if', ['(filter == NULL || filter->filter({0})) && '
+                   '!action({0}, userData)'.format(element),
+                   'return false'])
+
+    # children of a class generated here have forEachElement; any other
+    # child lists its descendants with getAllElements()
+    def write_descend(self, element, symbol, element_type, root):
+        if query.get_class(element_type, root) is not None:
+            return [self.create_code_block(
+                'if', ['!{0}{1}forEachElement(action, userData, '
+                       'filter)'.format(element, symbol), 'return false'])]
+        return self.write_visit_list('{0}{1}getAllElements(filter)'
+                                     ''.format(element, symbol))
+
+    def write_visit_list(self, list_call):
+        drain = self.create_code_block(
+            'while', ['visiting == true && sublist->getSize() > 0',
+                      'visiting = action(static_cast<{0}*>(sublist->'
+                      'remove(0)), userData)'.format(self.std_base)])
+        return [self.create_code_block('line',
+                                       ['List* sublist = {0}'.format(list_call),
+                                        'bool visiting = true']),
+                drain,
+                self.create_code_block('line', ['delete sublist']),
+                self.create_code_block('if', ['visiting == false',
+                                              'return false'])]
+
+    def get_element_filter(self):
+        if self.cap_language == 'SBML':
+            return 'ElementFilter'
+        return '{0}ElementFilter'.format(global_variables.prefix)
+
+    def has_std_children(self):
+        return self.num_children > 0 and \
+            self.num_children != self.num_non_std_children
+
+    ########################################################################
+
+    # Functions for writing the identifier index of a document
+
+    # function to write the lookup in the document index
+    def write_id_index_lookup(self, member, name):
+        rebuild = self.create_code_block('if', ['mIdIndexValid == false',
+                                                'rebuildIdIndex()'])
+        # elements sharing an identifier are kept in document order
+        lookup = self.create_code_block(
+            'line', ['multimap<string, {0}*>::iterator it = '
+                     '{1}.lower_bound({2})'.format(self.std_base, member,
+                                                   name),
+                     'bool found = (it != {0}.end() && it->first == {1})'
+                     ''.format(member, name),
+                     'return found ? it->second : NULL'])
+        return self.create_code_block('if', ['mIdIndexEnabled == true',
+                                             rebuild, lookup])
+
+    # function to write enableIdIndex
+    def write_enable_id_index(self):
+        if not self.is_cpp_api or not self.document:
+            return
+
+        # create comment parts
+        title_line = 'Sets whether getElementBySId() and getElementByMetaId() ' \
+                     'on this {0} use an identifier index.'.format(self.class_name)
+        params = ['@param enable a boolean, @c true to use the index, '
+                  '@c false to search the whole document on every call.']
+        return_lines = []
+        additional = ['The index is built on first use and kept up to date '
+                      'as the document changes. It is enabled by default.']
+
+        # create the function declaration
+        function = 'enableIdIndex'
+        return_type = 'void'
+        arguments = ['bool enable']
+
+        code = []
+        if not self.is_header:
+            implementation = ['mIdIndexEnabled = enable',
+                              'mIdIndexValid = false',
+                              'mSIdIndex.clear()',
+                              'mMetaIdIndex.clear()']
+            code = [self.create_code_block('line', implementation)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write isIdIndexEnabled
+    def write_is_id_index_enabled(self):
+        if not self.is_cpp_api or not self.document:
+            return
+
+        # create comment parts
+        title_line = 'Predicate returning {0} if the identifier index of ' \
+                     'this {1} is enabled.'.format(self.true, self.class_name)
+        params = []
+        return_lines = ['@return {0} if getElementBySId() and '
+                        'getElementByMetaId() use the identifier index, '
+                        '{1} otherwise.'.format(self.true, self.false)]
+        additional = []
+
+        # create the function declaration
+        function = 'isIdIndexEnabled'
+        return_type = 'bool'
+        arguments = []
+
+        code = []
+        if not self.is_header:
+            code = [self.create_code_block('line',
+                                           ['return mIdIndexEnabled'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write invalidateIdIndex
+    def write_invalidate_id_index(self):
+        if not self.is_cpp_api or not self.document:
+            return
+
+        # create comment parts
+        title_line = 'Marks the identifier index of this {0} as out of ' \
+                     'date.'.format(self.class_name)
+        params = []
+        return_lines = []
+        additional = ['The index is rebuilt by the next call to '
+                      'getElementBySId() or getElementByMetaId(). This is '
+                      'called whenever elements are added to or removed from '
+                      'the document.']
+
+        # create the function declaration
+        function = 'invalidateIdIndex'
+        return_type = 'void'
+        arguments = []
+
+        code = []
+        if not self.is_header:
+            code = [self.create_code_block('line',
+                                           ['mIdIndexValid = false'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write updateSIdIndex/updateMetaIdIndex
+    def write_update_id_index(self, is_metaid=False):
+        if not self.is_cpp_api or not self.document:
+            return
+
+        if is_metaid:
+            att_name = 'metaid'
+            member = 'mMetaIdIndex'
+            function = 'updateMetaIdIndex'
+        else:
+            att_name = 'id'
+            member = 'mSIdIndex'
+            function = 'updateSIdIndex'
+
+        # create comment parts
+        title_line = 'Updates the identifier index of this {0} when the ' \
+                     '\"{1}\" of an element changes.'.format(self.class_name,
+                                                              att_name)
+        params = ['@param element the {0} whose \"{1}\" is '
+                  'changing.'.format(self.std_base, att_name),
+                  '@param oldId the previous value, which may be empty.',
+                  '@param newId the new value, which may be empty.']
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        return_type = 'void'
+        arguments = ['{0}* element'.format(self.std_base),
+                     'const std::string& oldId', 'const std::string& newId']
+
+        code = []
+        if not self.is_header:
+            code = [self.create_code_block('if',
+                                           ['mIdIndexValid == false || '
+                                            'element == this', 'return'])]
+            code.append(self.create_code_block(
+                'comment', ['any other element with the old value stays '
+                            'indexed in document order']))
+            implementation = ['multimap<string, {0}*>::iterator it = '
+                              '{1}.lower_bound(oldId)'.format(self.std_base,
+                                                              member)]
             code.append(self.create_code_block('line', implementation))
+            implementation = ['; it != {0}.end() && it->first == oldId; '
+                              '++it'.format(member),
+                              self.create_code_block(
+                                  'if', ['it->second == element',
+                                         '{0}.erase(it)'.format(member),
+                                         'break'])]
+            code.append(self.create_code_block('for', implementation))
+            code.append(self.create_code_block(
+                'comment', ['the order among others with the new value '
+                            'needs a full search']))
+            implementation = ['{0}.find(newId) != {0}.end()'.format(member),
+                              'mIdIndexValid = false',
+                              'else',
+                              '{0}.insert(make_pair(newId, '
+                              'element))'.format(member)]
+            code.append(self.create_code_block(
+                'if', ['newId.empty() == false',
+                       self.create_code_block('if_else', implementation)]))
 
-            # only write get elements from plugin if this is an SBML plugin
-            if self.cap_language == 'SBML' and not self.is_plugin:
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write rebuildIdIndex
+    def write_rebuild_id_index(self):
+        if not self.is_cpp_api or not self.document:
+            return
+
+        # create comment parts
+        title_line = 'Rebuilds the identifier index of this {0} from all ' \
+                     'the elements it contains.'.format(self.class_name)
+        params = []
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'rebuildIdIndex'
+        return_type = 'void'
+        arguments = []
+
+        code = []
+        if not self.is_header:
+            code = [self.create_code_block('line', ['mSIdIndex.clear()',
+                                                    'mMetaIdIndex.clear()'])]
+            # getAllElements is only available if we have base children
+            if self.num_children > self.num_non_std_children:
+                obj = 'obj'
+                # elements are visited in the order of the full search and
+                # the first of several with the same identifier is found
+                implementation = ['elements->getSize() > 0',
+                                  '{0}* {1} = static_cast<{0}*>(elements->'
+                                  'remove(0))'.format(self.std_base, obj),
+                                  self.create_code_block(
+                                      'if', ['{0}->isSetId()'.format(obj),
+                                             'mSIdIndex.insert(make_pair({0}->'
+                                             'getId(), {0}))'.format(obj)]),
+                                  self.create_code_block(
+                                      'if', ['{0}->isSetMetaId()'.format(obj),
+                                             'mMetaIdIndex.insert(make_pair('
+                                             '{0}->getMetaId(), '
+                                             '{0}))'.format(obj)])]
+                code.append(self.create_code_block(
+                    'line', ['List* elements = getAllElements()']))
+                code.append(self.create_code_block('while', implementation))
                 code.append(self.create_code_block('line',
-                                                   ['ADD_FILTERED_FROM_PLUGIN'
-                                                    '(ret, sublist, '
-                                                    'filter)']))
-            code.append(self.create_code_block('line', ['return ret']))
+                                                   ['delete elements']))
+            code.append(self.create_code_block('line',
+                                               ['mIdIndexValid = true']))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -371,7 +759,7 @@ class GlobalQueryFunctions():
                      'return_type': return_type,
                      'arguments': arguments,
                      'constant': False,
-                     'virtual': True,
+                     'virtual': False,
                      'object_name': self.struct_name,
                      'implementation': code})
 
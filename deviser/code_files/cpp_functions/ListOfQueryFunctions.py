@@ -106,6 +106,21 @@ class ListOfQueryFunctions():
         self.used_sidrefs = []
         self.used_eq_names = []
 
+        # listOf classes may keep an index of their children by identifier
+        self.id_index = False
+        if self.is_list_of and 'lo_id_index' in class_object:
+            self.id_index = class_object['lo_id_index']
+
+        # scalar attributes of the children that can be moved in columns
+        self.columns = []
+        if self.is_cpp_api and self.is_list_of \
+                and 'lo_child_attributes' in class_object:
+            for attribute in class_object['lo_child_attributes']:
+                if attribute['attType'] in ['string', 'enum', 'integer',
+                                            'double', 'boolean',
+                                            'unsigned integer']:
+                    self.columns.append(attribute)
+
         # useful variables
         if not self.is_cpp_api and self.is_list_of:
             self.struct_name = self.class_name + '_t'
@@ -395,7 +410,11 @@ class ListOfQueryFunctions():
                      'implementation': code})
 
     def cpp_list_write_get_element_by_id(self, const):
-        if const:
+        if const and self.id_index:
+            implementation = ['int n = findIndexById(sid)',
+                              'return (n < 0) ? 0 : static_cast <const {0}*> '
+                              '(mItems[n])'.format(self.object_child_name)]
+        elif const:
             implementation = ['vector<{0}*>::const_iterator '
                               'result'.format(self.std_base),
                               'result = find_if(mItems.begin(), mItems.end(), '
@@ -646,6 +665,8 @@ class ListOfQueryFunctions():
                 implementation = ['return static_cast<{0}*>({1}::'
                                   'remove(n))'.format(self.object_child_name,
                                                       list_type)]
+                if self.id_index:
+                    implementation.insert(0, 'invalidateIdIndex()')
                 code = [self.create_code_block('line', implementation)]
             elif self.status == 'cpp_not_list':
                 member = self.class_object['memberName']
@@ -735,7 +756,12 @@ class ListOfQueryFunctions():
 
         code = []
         if not self.is_header:
-            if self.status == 'cpp_list':
+            if self.status == 'cpp_list' and self.id_index:
+                implementation = ['int n = findIndexById(sid)',
+                                  'return (n < 0) ? NULL : '
+                                  'remove(static_cast<unsigned int>(n))']
+                code = [self.create_code_block('line', implementation)]
+            elif self.status == 'cpp_list':
                implementation = ['{0}* item = NULL'.format(self.std_base),
                                   'vector<{0}*>::iterator '
                                   'result'.format(self.std_base)]
@@ -749,6 +775,11 @@ class ListOfQueryFunctions():
                                                            self.ideq)])]
                implementation = ['result != mItems.end()', 'item = *result',
                                   'mItems.erase(result)']
+               # the removed element no longer belongs to the document
+               if not global_variables.is_sbml:
+                   implementation += ['invalidateDocumentIdIndex()',
+                                      'item->set{0}(NULL)'.format(
+                                          global_variables.document_class)]
                code.append(self.create_code_block('if', implementation))
                code.append(
                     self.create_code_block(
@@ -795,6 +826,164 @@ class ListOfQueryFunctions():
 
     ########################################################################
 
+    # Functions for writing the identifier index of a listOf
+
+    # function to write the public function invalidating the index
+    def write_invalidate_id_index(self):
+        if not self.is_cpp_api or not self.id_index:
+            return
+
+        # create comment parts
+        title_line = 'Marks the identifier index of this {0} as out of ' \
+                     'date.'.format(self.object_name)
+        params = []
+        return_lines = []
+        additional = ['The index is rebuilt the next time a {0} is '
+                      'retrieved or removed using its identifier. This '
+                      'function is called by {0}::setId() and {0}::unsetId() '
+                      'and need only be called directly if the identifier of '
+                      'a child is changed by other '
+                      'means.'.format(self.object_child_name)]
+
+        # create the function declaration
+        function = 'invalidateIdIndex'
+        return_type = 'void'
+        arguments = []
+
+        code = []
+        if not self.is_header:
+            implementation = ['mIdIndexValid = false']
+            code = [self.create_code_block('line', implementation)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write the lookup of a child index using the id index
+    def write_find_index_by_id(self):
+        if not self.is_cpp_api or not self.id_index:
+            return
+
+        # create comment parts
+        title_line = 'Returns the index of the {0} with the given identifier ' \
+                     'or -1 if no such {0} exists, rebuilding the identifier ' \
+                     'index if necessary.'.format(self.object_child_name)
+        params = ['@param sid a string representing the identifier '
+                  'of the {0} to find.'.format(self.object_child_name)]
+        return_lines = ['@return the index of the {0} with the given '
+                        '@p sid or -1.'.format(self.object_child_name)]
+        additional = []
+
+        # create the function declaration
+        function = 'findIndexById'
+        return_type = 'int'
+        arguments = ['const std::string& sid']
+
+        code = []
+        if not self.is_header:
+            implementation = ['!mIdIndexValid || mIdIndexSize != mItems.size()',
+                              'rebuildIdIndex()']
+            code.append(self.create_code_block('if', implementation))
+            implementation = ['map<string, unsigned int>::const_iterator '
+                              'result = mIdIndex.find(sid)']
+            code.append(self.create_code_block('line', implementation))
+            # ListOf::clear() is not virtual, so the items can be replaced
+            # by the same number of others without the index seeing it; a
+            # miss is therefore confirmed by searching the items, which
+            # costs no more than the search the index replaces
+            scan = self.create_code_block(
+                'for', ['unsigned int i = 0; i < mItems.size(); i++',
+                        self.create_code_block(
+                            'if', ['static_cast<const {0}*>(mItems[i])->getId() '
+                                   '== sid'.format(self.object_child_name),
+                                   'rebuildIdIndex()',
+                                   'return static_cast<int>(i)'])])
+            implementation = ['result != mIdIndex.end() && static_cast<const '
+                              '{0}*>(mItems[result->second])->getId() != '
+                              'sid'.format(self.object_child_name),
+                              'rebuildIdIndex()',
+                              'result = mIdIndex.find(sid)',
+                              'else if', 'result == mIdIndex.end()',
+                              scan]
+            code.append(self.create_code_block('else_if', implementation))
+            implementation = ['return (result == mIdIndex.end()) ? -1 : '
+                              'static_cast<int>(result->second)']
+            code.append(self.create_code_block('line', implementation))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write the rebuild of the id index
+    def write_rebuild_id_index(self):
+        if not self.is_cpp_api or not self.id_index:
+            return
+
+        # create comment parts
+        title_line = 'Rebuilds the identifier index of this {0}.'.format(
+            self.object_name)
+        params = []
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'rebuildIdIndex'
+        return_type = 'void'
+        arguments = []
+
+        code = []
+        if not self.is_header:
+            code.append(self.create_code_block('line', ['mIdIndex.clear()']))
+            # insert keeps the first occurrence of a duplicate identifier
+            # as a linear search would
+            implementation = ['unsigned int i = 0; i < mItems.size(); i++',
+                              'const {0}* {1} = static_cast<const {0}*>'
+                              '(mItems[i])'.format(self.object_child_name,
+                                                   self.abbrev_child),
+                              self.create_code_block(
+                                  'if',
+                                  ['{0}->isSetId()'.format(self.abbrev_child),
+                                   'mIdIndex.insert(make_pair({0}->getId(), '
+                                   'i))'.format(self.abbrev_child)])]
+            code.append(self.create_code_block('for', implementation))
+            implementation = ['mIdIndexSize = static_cast<unsigned int>'
+                              '(mItems.size())',
+                              'mIdIndexValid = true']
+            code.append(self.create_code_block('line', implementation))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    ########################################################################
+
     # Functions for writing add and create element functions
 
     # function to write add element
@@ -1187,6 +1376,171 @@ class ListOfQueryFunctions():
 
     ########################################################################
 
+    # Functions for moving the attributes of all children in columns
+
+    # the declaration of the struct holding one vector for each attribute
+    def get_columns_struct(self):
+        if len(self.columns) == 0:
+            return None
+        lines = []
+        for attribute in self.columns:
+            if attribute['attType'] == 'string':
+                column_type = 'std::string'
+            else:
+                column_type = attribute['attTypeCode']
+            lines.append('std::vector<{0}> {1};'.format(column_type,
+                                                        attribute['name']))
+            lines.append('std::vector<bool> isSet{0};'
+                         ''.format(attribute['capAttName']))
+        return lines
+
+    # function to write exportColumns
+    def write_export_columns(self):
+        if len(self.columns) == 0:
+            return
+        # create comment parts
+        title_line = 'Fills the given columns with the attributes of every ' \
+                     '{0} in this {1}.'.format(self.object_child_name,
+                                               self.object_name)
+        params = ['@param columns the Columns to fill; each column is '
+                  'resized to the number of {0} objects and row i '
+                  'describes the {0} at index i.'
+                  ''.format(self.object_child_name)]
+        return_lines = []
+        additional = ['@note this reads every object in one pass, which is '
+                      'faster than calling the getters of each object in '
+                      'turn.']
+
+        # create the function declaration
+        function = 'exportColumns'
+        return_type = 'void'
+        arguments = ['Columns& columns']
+
+        # create the function implementation
+        resize = ['unsigned int n = size()']
+        copy = ['const {0}* item = get(i)'.format(self.child_name)]
+        for attribute in self.columns:
+            name = attribute['name']
+            cap_name = attribute['capAttName']
+            resize.append('columns.{0}.resize(n)'.format(name))
+            resize.append('columns.isSet{0}.resize(n)'.format(cap_name))
+            copy.append('columns.{0}[i] = item->get{1}()'.format(name,
+                                                                 cap_name))
+            copy.append('columns.isSet{0}[i] = item->isSet{0}()'
+                        ''.format(cap_name))
+        code = [self.create_code_block('line', resize),
+                self.create_code_block('for',
+                                       ['unsigned int i = 0; i < n; i++',
+                                        self.create_code_block('line',
+                                                               copy)])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write importColumns
+    def write_import_columns(self):
+        if len(self.columns) == 0:
+            return
+        elif len(self.concretes) > 0 or self.class_object['abstract']:
+            return
+        # create comment parts
+        title_line = 'Creates a {0} in this {1} for each row of the given ' \
+                     'columns.'.format(self.object_child_name,
+                                       self.object_name)
+        params = ['@param columns the Columns to read; every column must '
+                  'have the same number of rows.']
+        return_lines = ['@copydetails doc_returns_success_code',
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  global_variables.ret_success,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  global_variables.ret_invalid_att,
+                                  self.close_br),
+                        '@li @{0}constant{1}{2}, OperationReturnValues_t{3}'
+                        ''.format(self.language, self.open_br,
+                                  global_variables.ret_failed,
+                                  self.close_br)]
+        additional = ['@note attributes that are not set in a row are left '
+                      'unset on the {0} created for it; a value that cannot '
+                      'be set does not stop the remaining rows being '
+                      'created.'.format(self.object_child_name)]
+
+        # create the function declaration
+        function = 'importColumns'
+        return_type = 'int'
+        arguments = ['const Columns& columns']
+
+        # create the function implementation
+        used_cpp_name = strFunctions.remove_prefix(self.used_child_name)
+        if self.package == 'Render' or self.package == 'render':
+            used_cpp_name = strFunctions.remove_prefix(
+                self.used_child_name,
+                prefix=strFunctions.upper_first(self.package))
+        first = self.columns[0]['name']
+        sizes = ['size_t n = columns.{0}.size()'.format(first),
+                 'bool sameSize = (columns.isSet{0}.size() == n)'
+                 ''.format(self.columns[0]['capAttName'])]
+        sets = []
+        for attribute in self.columns[1:]:
+            sizes.append('sameSize = sameSize && (columns.{0}.size() == n)'
+                         ''.format(attribute['name']))
+            sizes.append('sameSize = sameSize && (columns.isSet{0}.size() '
+                         '== n)'.format(attribute['capAttName']))
+        for attribute in self.columns:
+            cap_name = attribute['capAttName']
+            sets.append(self.create_code_block(
+                'if', ['columns.isSet{0}[i] && item->set{0}(columns.{1}[i]) '
+                       '!= {2}'.format(cap_name, attribute['name'],
+                                       global_variables.ret_success),
+                       'result = {0}'.format(global_variables.ret_invalid_att)]))
+        body = [self.create_code_block('line',
+                                       ['{0}* item = create{1}()'
+                                        ''.format(self.child_name,
+                                                  used_cpp_name)]),
+                self.create_code_block('if',
+                                       ['item == NULL',
+                                        'return {0}'.format(
+                                            global_variables.ret_failed)])]
+        code = [self.create_code_block('line', sizes),
+                self.create_code_block('if',
+                                       ['!sameSize',
+                                        'return {0}'.format(
+                                            global_variables.ret_invalid_att)]),
+                self.create_code_block('line',
+                                       ['int result = {0}'.format(
+                                           global_variables.ret_success)]),
+                self.create_code_block('for',
+                                       ['size_t i = 0; i < n; i++'] + body
+                                       + sets),
+                self.create_code_block('line', ['return result'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    ########################################################################
+
     # Functions for writing getListOf
 
     # function to write get num
@@ -97,6 +97,8 @@ class ProtectedFunctions():
         if 'concretes' in class_object:
             self.concretes = class_object['concretes']
         self.has_array = class_object['has_array']
+        self.lazy_array = is_cpp_api and 'lazy_array' in class_object \
+            and class_object['lazy_array']
 
         self.child_lo_elements = class_object['child_lo_elements']
         self.child_elements = class_object['child_elements']
@@ -397,72 +399,78 @@ class ProtectedFunctions():
 
 
     def write_create_object_lo(self, upkg, ns):
-        if global_variables.is_package:
-            implementation = ['const std::string& name = '
-                              'stream.peek().getName()',
-                              '{0}* object = NULL'.format(self.std_base),
-                              '{0}_CREATE_NS({1}, '
-                              'get{2}Namespaces'
-                              '())'.format(upkg, ns, global_variables.prefix)]
-        else:
-            implementation = ['const std::string& name = '
-                              'stream.peek().getName()',
-                              '{0}* object = NULL'.format(self.std_base)]
-        code = [dict({'code_type': 'line', 'code': implementation})]
-        implementation = self.write_create_object_class(self.child_name,
-                                                        ns)
-        code.append(self.create_code_block('if', implementation))
+        branches = [self.write_create_object_class(self.child_name, ns)]
         for i in range(0, len(self.concretes)):
-            implementation = \
-                self.write_create_object_class(
-                    self.concretes[i]['element'], ns)
-            code.append(self.create_code_block('if', implementation))
-        if global_variables.is_package:
-            code.append(self.create_code_block('line',
-                                               ['delete {0}'.format(ns),
-                                                'return object']))
-        else:
-            code.append(self.create_code_block('line',
-                                               ['return object']))
-        return code
+            branches.append(self.write_create_object_class(
+                self.concretes[i]['element'], ns))
+        return self.write_create_object_dispatch(upkg, ns, branches)
 
     def write_create_object_anomalous_lo(self, upkg, ns):
         # the unusual case where a list of have a child element
         # is not of the same type as the list of
-        if global_variables.is_package:
-            implementation = ['const std::string& name = '
-                              'stream.peek().getName()',
-                              '{0}* object = NULL'.format(self.std_base),
-                              '{0}_CREATE_NS({1}, '
-                              'get{2}Namespaces'
-                              '())'.format(upkg, ns, global_variables.prefix)]
-        else:
-            implementation = ['const std::string& name = '
-                              'stream.peek().getName()',
-                              '{0}* object = NULL'.format(self.std_base)]
-
-        code = [dict({'code_type': 'line', 'code': implementation})]
-        implementation = self.write_create_object_class(self.child_name,
-                                                        ns)
-        code.append(self.create_code_block('if', implementation))
+        branches = [self.write_create_object_class(self.child_name, ns)]
         for i in range(0, len(self.child_elements)):
-            implementation = \
-                self.write_create_object_class(
-                    self.child_elements[i]['element'], ns, True)
-            code.append(self.create_code_block('if', implementation))
+            branches.append(self.write_create_object_class(
+                self.child_elements[i]['element'], ns, True))
+        return self.write_create_object_dispatch(upkg, ns, branches)
+
+    def write_create_object_dispatch(self, upkg, ns, branches):
+        implementation = ['const std::string& name = '
+                          'stream.peek().getName()',
+                          '{0}* object = NULL'.format(self.std_base)]
+        code = [dict({'code_type': 'line', 'code': implementation})]
         if global_variables.is_package:
-            code.append(self.create_code_block('line',
-                                               ['delete {0}'.format(ns),
-                                                'return object']))
-        else:
-            code.append(self.create_code_block('line',
-                                               ['return object']))
-
+            # the package namespaces are built once per list and only
+            # rebuilt if the level or version of the list changes
+            refresh = ['mChildNamespaces == NULL || '
+                       'mChildNamespaces->getLevel() != getLevel() || '
+                       'mChildNamespaces->getVersion() != getVersion() || '
+                       'mChildNamespaces->getPackageVersion() != '
+                       'getPackageVersion()',
+                       'delete mChildNamespaces',
+                       '{0}_CREATE_NS({1}, get{2}Namespaces'
+                       '())'.format(upkg, ns, global_variables.prefix),
+                       'mChildNamespaces = {0}'.format(ns)]
+            code.append(self.create_code_block('if', refresh))
+
+        # names that are only known at runtime are tested first; the
+        # remainder are bucketed by length so at most a few are compared
+        buckets = dict()
+        dynamic = []
+        for branch in branches:
+            if branch[0].startswith('name == \"'):
+                length = len(branch[0]) - len('name == \"\"')
+                buckets.setdefault(length, []).append(branch)
+            else:
+                dynamic.append(branch)
+        if len(buckets) == 0 or len(branches) == 1:
+            for branch in branches:
+                code.append(self.create_code_block('if', branch))
+            code.append(self.create_code_block('line', ['return object']))
+            return code
+        for branch in dynamic:
+            code.append(self.create_code_block('if',
+                                               branch + ['return object']))
+        cases = ['name.size()']
+        for length in sorted(buckets):
+            block = []
+            for branch in buckets[length]:
+                if len(block) > 0:
+                    block.append('else if')
+                block += branch
+            if len(buckets[length]) > 1:
+                block = [self.create_code_block('else_if', block)]
+            else:
+                block = [self.create_code_block('if', block)]
+            cases += ['case {0}'.format(length), block + ['break']]
+        cases += ['default', ['break']]
+        code.append(self.create_code_block('switch', cases))
+        code.append(self.create_code_block('line', ['return object']))
         return code
 
     def write_create_object_class(self, name, ns, create=False):
         if global_variables.is_package:
-            use_ns = ns
+            use_ns = 'mChildNamespaces'
         else:
             use_ns = 'get{0}Namespaces()'.format(global_variables.prefix)
         xmlname = strFunctions.lower_first(name)
@@ -705,7 +713,9 @@ class ProtectedFunctions():
             code.append(self.create_code_block('if', line))
 
         if self.base_class:
-            line = ['{0}::readAttributes(attributes, '
+            # only errors logged while reading this element need rewriting
+            line = ['unsigned int errMark = log ? log->getNumErrors() : 0',
+                    '{0}::readAttributes(attributes, '
                     'expectedAttributes)'.format(self.base_class),
                     ]
             code.append(self.create_code_block('line', line))
@@ -1125,35 +1135,18 @@ class ProtectedFunctions():
         return_type = 'void'
         arguments = ['const std::string& text']
 
-        # find the array attribute
-        name = ''
-        array_type = ''
-        for attrib in self.attributes:
-            if attrib['isArray']:
-                name = attrib['capAttName']
-                array_type = attrib['element']
-        # create the function implementation
-        implementation = ['stringstream strStream(text)',
-                          '{0} val'.format(array_type),
-                          'vector<{0}> valuesVector'.format(array_type)]
-        code = [self.create_code_block('line', implementation),
-                self.create_code_block('while',
-                                       ['strStream >> val',
-                                        'valuesVector.push_back(val)']),
-                self.create_code_block('line',
-                                       ['unsigned int length = (unsigned '
-                                        'int)valuesVector.size()'])]
-        for_loop = self.create_code_block('for',
-                                          ['unsigned int i = 0; '
-                                           'i < length; ++i',
-                                           'data[i] = valuesVector.at(i)'])
-        code.append(self.create_code_block('if',
-                                           ['length > 0',
-                                            '{0}* data = new {0}'
-                                            '[length]'.format(array_type),
-                                            for_loop,
-                                            'set{0}(data, length)'.format(name),
-                                            'delete[] data']))
+        array_att = self.get_array_attribute()
+        if self.lazy_array:
+            additional = ['@note the text is only parsed when the array is '
+                          'first used.']
+            code = [self.create_code_block(
+                'line', ['{0}Text = text'.format(array_att['memberName']),
+                         '{0}TextState = ARRAY_TEXT_KEPT'
+                         ''.format(array_att['memberName'])])]
+        else:
+            code = self.write_parse_array(array_att,
+                                          'adopt{0}(data, length)'
+                                          ''.format(array_att['capAttName']))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -1168,6 +1161,199 @@ class ProtectedFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to write the parse of array text kept by setElementText
+    def write_parse_array_text(self):
+        if not self.lazy_array:
+            return
+
+        array_att = self.get_array_attribute()
+        name = array_att['capAttName']
+
+        # create comment parts
+        title_line = 'Parses the text kept for the array data, if any'
+        params = []
+        return_lines = []
+        additional = ['The const getters call this, so threads reading the '
+                      'same object, as a parallel validation does, may call '
+                      'it at once; the first of them to find the text kept '
+                      'parses it while the others wait, and once it is '
+                      'parsed no thread waits at all.']
+
+        # create the function declaration
+        function = 'parse{0}Text'.format(name)
+        return_type = 'void'
+        arguments = []
+
+        # create the function implementation
+        state = '{0}TextState'.format(array_att['memberName'])
+        code = [self.create_code_block(
+                    'if', ['ARRAY_TEXT_STATE_LOAD({0}) == '
+                           'ARRAY_TEXT_NONE'.format(state), 'return']),
+                self.create_code_block(
+                    'if', ['ARRAY_TEXT_STATE_SWAP({0}, ARRAY_TEXT_KEPT, '
+                           'ARRAY_TEXT_PARSING)'.format(state),
+                           'doParse{0}Text()'.format(name),
+                           'ARRAY_TEXT_STATE_SWAP({0}, ARRAY_TEXT_PARSING, '
+                           'ARRAY_TEXT_NONE)'.format(state),
+                           'return']),
+                self.create_code_block(
+                    'while', ['ARRAY_TEXT_STATE_LOAD({0}) != '
+                              'ARRAY_TEXT_NONE'.format(state),
+                              self.create_code_block(
+                                  'comment',
+                                  ['another thread is parsing the text'])])]
+
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to write the parse itself, called with the text guarded
+    def write_do_parse_array_text(self):
+        if not self.lazy_array:
+            return
+
+        array_att = self.get_array_attribute()
+        name = array_att['capAttName']
+        member = array_att['memberName']
+
+        # create comment parts
+        title_line = 'Parses the text kept for the array data; only ' \
+                     'parse{0}Text() calls this'.format(name)
+        params = []
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'doParse{0}Text'.format(name)
+        return_type = 'void'
+        arguments = []
+
+        # create the function implementation
+        code = [self.create_code_block('if', ['{0}Text.empty()'.format(member),
+                                              'return']),
+                self.create_code_block('line', ['std::string text',
+                                                'text.swap({0}Text)'
+                                                ''.format(member)])]
+        code += self.write_parse_array(array_att,
+                                       'const_cast<{0}*>(this)->adopt{1}'
+                                       '(data, length)'.format(self.class_name,
+                                                               name))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # find the array attribute
+    def get_array_attribute(self):
+        array_att = None
+        for attrib in self.attributes:
+            if attrib['isArray']:
+                array_att = attrib
+        return array_att
+
+    # code that parses the text into a new array and hands it on with adopt
+    def write_parse_array(self, array_att, adopt):
+        array_type = array_att['element']
+        limits = 'std::numeric_limits<{0}>'.format(array_type)
+        if array_type == 'double' or array_type == 'float':
+            # the special values are written as NaN, INF and -INF
+            number = [self.create_code_block(
+                          'line', ['double val = 0']),
+                      self.create_code_block(
+                          'else_if',
+                          ['word == \"NaN\"',
+                           'val = std::numeric_limits<double>::quiet_NaN()',
+                           'else if', 'word == \"INF\"',
+                           'val = std::numeric_limits<double>::infinity()',
+                           'else if', 'word == \"-INF\"',
+                           'val = -std::numeric_limits<double>::infinity()',
+                           'else',
+                           self.create_code_block('line',
+                                                  ['number.clear()',
+                                                   'number.str(word)',
+                                                   'number >> val']),
+                           self.create_code_block(
+                               'if', ['number.fail() || '
+                                      'number.peek() != EOF', 'break'])])]
+        else:
+            if array_type.startswith('unsigned'):
+                low = 'val < 0'
+                high = '(unsigned long)(val) > {0}::max()'.format(limits)
+            else:
+                low = 'val < {0}::min()'.format(limits)
+                high = 'val > {0}::max()'.format(limits)
+            number = [self.create_code_block(
+                          'line', ['long val = 0',
+                                   'number.clear()',
+                                   'number.str(word)',
+                                   'number >> val']),
+                      self.create_code_block(
+                          'comment', ['the value must be the whole word and '
+                                      'fit the array type']),
+                      self.create_code_block(
+                          'else_if', ['number.fail() || '
+                                      'number.peek() != EOF', 'break',
+                                      'else if', low, 'break',
+                                      'else if', high, 'break'])]
+        number.append(self.create_code_block(
+            'line', ['data[length++] = ({0})(val)'.format(array_type)]))
+
+        implementation = ['unsigned int capacity = 0',
+                          'unsigned int length = 0',
+                          'bool inValue = false']
+        is_space = self.create_code_block('else_if',
+                                          ['*c == \' \' || *c == \'\\t\' '
+                                           '|| *c == \'\\n\' || '
+                                           '*c == \'\\r\'',
+                                           'inValue = false',
+                                           'else if', 'inValue == false',
+                                           'inValue = true',
+                                           'capacity++'])
+        streams = ['std::istringstream parser(text)',
+                   'std::istringstream number',
+                   'parser.imbue(std::locale::classic())',
+                   'number.imbue(std::locale::classic())',
+                   'std::string word',
+                   '{0}* data = new {0}[capacity]'.format(array_type)]
+        code = [self.create_code_block('line', implementation),
+                self.create_code_block('comment',
+                                       ['count the values so the array is '
+                                        'only allocated once']),
+                self.create_code_block('for',
+                                       ['const char* c = text.c_str(); '
+                                        '*c != \'\\0\'; ++c',
+                                        is_space]),
+                self.create_code_block('if', ['capacity == 0', 'return']),
+                self.create_code_block('comment',
+                                       ['the classic locale reads the same '
+                                        'numbers whatever the global locale '
+                                        'is']),
+                self.create_code_block('line', streams),
+                self.create_code_block('while',
+                                       ['length < capacity && '
+                                        'parser >> word'] + number),
+                self.create_code_block('if_else', ['length == 0',
+                                                   'delete[] data', 'else',
+                                                   adopt])]
+        return code
+
     ########################################################################
 
     # Functions for writing isValidTypeForList
@@ -1242,24 +1428,19 @@ class ProtectedFunctions():
                 c_err = global_variables.unknown_error
         if global_variables.is_package:
             line = ['log->getError(n)->getErrorId() == UnknownPackageAttribute',
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove(UnknownPackageAttribute)',
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'.format(self.error, error,
-                                                        self.given_args),
-                    'else if', 'log->getError(n)->getErrorId() == '
-                               'UnknownCoreAttribute',
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove(UnknownCoreAttribute)',
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'.format(self.error, c_err,
-                                                        self.given_args,
-                                                        )]
+                    'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines('UnknownPackageAttribute',
+                                                  error) \
+                   + ['else if', 'log->getError(n)->getErrorId() == '
+                                 'UnknownCoreAttribute',
+                      'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines('UnknownCoreAttribute',
+                                                  c_err)
             if_err = self.create_code_block('else_if', line)
         else:
             line = ['log->getError(n)->getErrorId() == {0}'.format(unknown_error_att),
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove({0})'.format(unknown_error_att),
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'.format(self.error, c_err,
-                                                        self.given_args)]
+                    'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines(unknown_error_att, c_err)
             if_err = self.create_code_block('if', line)
 
         line = ['int n = numErrs-1; n >= 0; n--', if_err]
@@ -1282,6 +1463,23 @@ class ProtectedFunctions():
 
         return line
 
+    def get_rewrite_error_lines(self, unknown_error_att, error):
+        # SBMLErrorLog::remove() takes out the first error with the id
+        # anywhere in the log, which need not be the nth; so the nth error
+        # is overwritten in place, as replaceError does for other libraries
+        if global_variables.is_sbml:
+            if global_variables.is_package:
+                args = ', LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, \"{0}\", ' \
+                       'pkgVersion'.format(self.package.lower())
+            else:
+                args = ''
+            return ['SBMLError rewritten({0}, level, version, details, '
+                    'getLine(), getColumn(){1})'.format(error, args),
+                    '*const_cast<SBMLError*>(log->getError(n)) = rewritten']
+        else:
+            return ['log->replaceError(n, {0}, {1}, details, getLine(), '
+                    'getColumn())'.format(error, self.given_args)]
+
     def get_error_from_base_class(self):
         if self.is_plugin:
             class_name = strFunctions.get_class_from_plugin(
@@ -1317,34 +1515,30 @@ class ProtectedFunctions():
 
         if global_variables.is_package:
             line = ['log->getError(n)->getErrorId() == UnknownPackageAttribute',
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove(UnknownPackageAttribute)',
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'
-                    ''.format(self.error, error, self.given_args),
-                    'else if', 'log->getError(n)->getErrorId() == '
-                               'UnknownCoreAttribute',
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove(UnknownCoreAttribute)',
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'
-                    ''.format(self.error, core_err, self.given_args)]
+                    'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines('UnknownPackageAttribute',
+                                                  error) \
+                   + ['else if', 'log->getError(n)->getErrorId() == '
+                                 'UnknownCoreAttribute',
+                      'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines('UnknownCoreAttribute',
+                                                  core_err)
             if self.is_plugin:
                 line += ['else if', 'log->getError(n)->getErrorId() == '
                             'NotSchemaConformant',
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove(NotSchemaConformant)',
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'
-                    ''.format(self.error, error, self.given_args)]
+                    'const std::string details = log->getError(n)->getMessage()'] \
+                    + self.get_rewrite_error_lines('NotSchemaConformant',
+                                                   error)
             if_err = self.create_code_block('else_if', line)
         else:
             line = ['log->getError(n)->getErrorId() == {0}'.format(unknown_error_att),
-                    'const std::string details = log->getError(n)->getMessage()',
-                    'log->remove({0})'.format(unknown_error_att),
-                    'log->{0}{1}, {2}, details, getLine(), getColumn())'
-                    ''.format(self.error, error, self.given_args)]
+                    'const std::string details = log->getError(n)->getMessage()'] \
+                   + self.get_rewrite_error_lines(unknown_error_att, error)
             if_err = self.create_code_block('if', line)
 
 
-        line = ['int n = numErrs-1; n >= 0; n--', if_err]
+        line = ['int n = numErrs-1; n >= static_cast<int>(errMark); n--',
+                if_err]
         return line
 
     def write_write_att(self, attributes, index, code):
@@ -1692,9 +1886,10 @@ class ProtectedFunctions():
                 '\"<{1}>\")'.format(att_name, self.class_name),
                 'else',
                 self.create_code_block('line',
-                                       ['{0} = {1}_fromString({2}.'
-                                        'c_str())'.format(member, element,
-                                                          att_name)]),
+                                       ['{0} = {1}_fromStringWithLength('
+                                        '{2}.c_str(), {2}.size())'
+                                        ''.format(member, element,
+                                                  att_name)]),
                 second_if]
         first_if = self.create_code_block('if_else', line)
 
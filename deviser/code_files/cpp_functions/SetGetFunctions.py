@@ -110,6 +110,21 @@ class SetGetFunctions():
         if 'is_plugin' in class_object:
             self.is_plugin = class_object['is_plugin']
 
+        # the listOf containing this class may index it by identifier
+        self.parent_id_index = False
+        if not is_list_of and 'lo_id_index' in class_object \
+                and class_object['lo_id_index']:
+            self.parent_id_index = True
+            if 'lo_class_name' in class_object \
+                    and class_object['lo_class_name'] != '':
+                self.lo_class_name = class_object['lo_class_name']
+            else:
+                self.lo_class_name = strFunctions.list_of_name(self.class_name)
+
+        # array text read from a file is only parsed when first used
+        self.lazy_array = is_cpp_api and 'lazy_array' in class_object \
+            and class_object['lazy_array']
+
         self.open_br = '{'
         self.close_br = '}'
 
@@ -247,6 +262,7 @@ class SetGetFunctions():
             else:
                 implementation = self.write_get_for_doc_functions(attribute)
             code = [self.create_code_block('line', implementation)]
+            self.parse_length_array_text(attribute, code)
         else:
             code = self.get_c_attribute(attribute)
 
@@ -399,8 +415,10 @@ class SetGetFunctions():
                                 self.class_name)]
         return_lines = []
         additional = ['@note the value of the \"{0}\" attribute of this '
-                      '{1} is returned in the argument '
-                      'array.'.format(name, self.class_name)]
+                      '{1} is returned in the argument array; no more than '
+                      'get{2}Length() values are '
+                      'copied.'.format(name, self.class_name,
+                                       attribute['capAttName'])]
 
         # create the function declaration
         function = 'get{0}'.format(attribute['capAttName'])
@@ -410,9 +428,19 @@ class SetGetFunctions():
             'if',
             ['outArray == NULL || {0} == NULL'.format(attribute['memberName']),
              'return'])]
-        line = ['memcpy(outArray, {0}, sizeof({1})*{0}'
-                'Length)'.format(attribute['memberName'], attribute['element'])]
-        code.append(self.create_code_block('line', line))
+        if self.lazy_array:
+            code.insert(0, self.parse_array_text(attribute))
+        # the length attribute may be set to more values than are held
+        member = attribute['memberName']
+        code.append(self.create_code_block(
+            'line', ['int count = {0}Count'.format(member)]))
+        code.append(self.create_code_block(
+            'if', ['{0}Length < count'.format(member),
+                   'count = {0}Length'.format(member)]))
+        line = ['count > 0',
+                'memcpy(outArray, {0}, sizeof({1})*count)'
+                ''.format(member, attribute['element'])]
+        code.append(self.create_code_block('if', line))
 
         # return the parts
         return dict({'title_line': title_line,
@@ -427,6 +455,98 @@ class SetGetFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to return a read only view of an array without copying it
+    def write_get_array_pointer(self, is_attribute, index):
+        if not self.is_cpp_api or not is_attribute:
+            return
+        elif index < len(self.attributes):
+            attribute = self.attributes[index]
+        else:
+            return
+        if not attribute['isArray']:
+            return
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        # create comment parts
+        title_line = 'Returns a pointer to the value of the \"{0}\" ' \
+                     'attribute of this {1}.'.format(name, self.class_name)
+        params = []
+        return_lines = ['@return a pointer to the array held by this {0}, '
+                        'or @c NULL if it is not set.'.format(self.class_name)]
+        additional = ['@note the array is not copied; it has '
+                      'get{0}Count() entries and remains owned by '
+                      'this {1}.'.format(attribute['capAttName'],
+                                         self.class_name)]
+
+        # create the function declaration
+        function = 'get{0}Pointer'.format(attribute['capAttName'])
+        return_type = 'const {0}*'.format(attribute['element'])
+        arguments = []
+        code = [self.create_code_block(
+            'line', ['return {0}'.format(attribute['memberName'])])]
+        if self.lazy_array:
+            code.insert(0, self.parse_array_text(attribute))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to return the number of values the array actually holds
+    def write_get_array_count(self, is_attribute, index):
+        if not self.is_cpp_api or not is_attribute:
+            return
+        elif index < len(self.attributes):
+            attribute = self.attributes[index]
+        else:
+            return
+        if not attribute['isArray']:
+            return
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        # create comment parts
+        title_line = 'Returns the number of values held by the \"{0}\" ' \
+                     'attribute of this {1}.'.format(name, self.class_name)
+        params = []
+        return_lines = ['@return the number of values in the array returned '
+                        'by get{0}Pointer(), or @c 0 if it is not '
+                        'set.'.format(attribute['capAttName'])]
+        additional = ['@note this is the size of the array itself, which '
+                      'the \"{0}Length\" attribute need not '
+                      'match.'.format(attribute['name'])]
+
+        # create the function declaration
+        function = 'get{0}Count'.format(attribute['capAttName'])
+        return_type = 'int'
+        arguments = []
+        code = [self.create_code_block(
+            'line', ['return {0}Count'.format(attribute['memberName'])])]
+        if self.lazy_array:
+            code.insert(0, self.parse_array_text(attribute))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write get functions for extension
     def write_static_extension_get(self, index, const=True, static=True):
         if index < len(self.attributes):
@@ -625,6 +745,10 @@ class SetGetFunctions():
                                                      attribute['capAttName'])]
 
         code = [dict({'code_type': 'line', 'code': implementation})]
+        if self.lazy_array and attribute['isArray']:
+            code.insert(0, self.parse_array_text(attribute))
+        elif self.is_cpp_api:
+            self.parse_length_array_text(attribute, code)
 
         # return the parts
         virtual = False
@@ -839,6 +963,7 @@ class SetGetFunctions():
         # create the function implementation
         if self.is_cpp_api:
             code = self.set_cpp_attribute(attribute)
+            self.parse_length_array_text(attribute, code)
         else:
             if not self.is_list_of:
                 use_name = self.abbrev_parent
@@ -962,8 +1087,9 @@ class SetGetFunctions():
         if self.is_cpp_api:
             code = []
             [deal_with_versions, code, topif] = self.get_multiple_version_info(name)
-            line = ['{0} = {1}_fromString({2}.c_str())'.format(attribute['memberName'],
-                                                 attribute['element'], codename)]
+            line = ['{0} = {1}_fromStringWithLength({2}.c_str(), {2}.size())'
+                    ''.format(attribute['memberName'], attribute['element'],
+                              codename)]
             if_block = ['{0} == {1}'.format(attribute['memberName'], attribute['default']),
                               'return {0}'.format(self.invalid_att)]
             success_line = ['return {0}'.format(self.success)]
@@ -1059,9 +1185,12 @@ class SetGetFunctions():
                 self.create_code_block('if',
                                        ['{0} != NULL'.format(member),
                                         'delete[] {0}'.format(member)])]
+        if self.lazy_array:
+            code.insert(1, self.clear_array_text(attribute))
         implementation = ['{0} = new {1}[arrayLength]'.format(member, ar_type),
                           'memcpy({0}, inArray, sizeof('
                           '{1})*arrayLength)'.format(member, ar_type),
+                          '{0}Count = arrayLength'.format(member),
                           '{0} = true'.format(is_set_l),
                           '{0} = arrayLength'.format(length)]
         code.append(self.create_code_block('line', implementation))
@@ -1081,6 +1210,133 @@ class SetGetFunctions():
                      'object_name': self.struct_name,
                      'implementation': code})
 
+    # function to hand an allocated array to the object without copying it
+    def write_adopt_array(self, is_attribute, index):
+        if not self.is_cpp_api or not is_attribute:
+            return
+        elif index < len(self.attributes):
+            attribute = self.attributes[index]
+        else:
+            return
+        if not attribute['isArray']:
+            return
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        # create comment parts
+        title_line = 'Sets the value of the \"{0}\" attribute of this {1} ' \
+                     'by taking ownership of the given array.' \
+            .format(name, self.class_name)
+        params = ['@param inArray {0} array allocated with new[].'
+                  ''.format(attribute['attTypeCode']),
+                  '@param arrayLength int value for the length of '
+                  'the \"{0}\" attribute to be '
+                  'set.'.format(name)]
+        return_lines = ["@copydetails doc_returns_success_code",
+                        '@li @{0}constant{1}{2}, '
+                        'OperationReturnValues_t{3}'.format(self.language,
+                                                            self.open_br,
+                                                            self.success,
+                                                            self.close_br),
+                        '@li @{0}constant{1}{2},'
+                        ' OperationReturnValues_t{3}'.format(self.language,
+                                                             self.open_br,
+                                                             self.invalid_att,
+                                                             self.close_br)]
+        additional = ['@note the array is not copied; this {0} deletes it '
+                      'when it is no longer needed.'.format(self.class_name)]
+
+        # create the function declaration
+        function = 'adopt{0}'.format(attribute['capAttName'])
+        return_type = 'int'
+        arguments = ['{0} inArray'.format(attribute['attTypeCode']),
+                     'int arrayLength']
+        member = attribute['memberName']
+        is_set_l = 'mIsSet' + strFunctions.upper_first(attribute['name']) \
+                   + 'Length'
+        code = [self.create_code_block('if',
+                                       ['inArray == NULL',
+                                        'return {0}'.format(self.invalid_att)]),
+                self.create_code_block('if',
+                                       ['{0} != NULL && {0} != '
+                                        'inArray'.format(member),
+                                        'delete[] {0}'.format(member)]),
+                self.create_code_block('line',
+                                       ['{0} = inArray'.format(member),
+                                        '{0}Count = arrayLength'
+                                        ''.format(member),
+                                        '{0} = true'.format(is_set_l),
+                                        '{0}Length = arrayLength'
+                                        ''.format(member)]),
+                self.create_code_block('line',
+                                       ['return {0}'.format(self.success)])]
+        if self.lazy_array:
+            code.insert(1, self.clear_array_text(attribute))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
+    # function to hand the array of the object to the caller
+    def write_release_array(self, is_attribute, index):
+        if not self.is_cpp_api or not is_attribute:
+            return
+        elif index < len(self.attributes):
+            attribute = self.attributes[index]
+        else:
+            return
+        if not attribute['isArray']:
+            return
+        name = attribute['name']
+        if 'xml_name' in attribute and attribute['xml_name'] != '':
+            name = attribute['xml_name']
+        # create comment parts
+        title_line = 'Releases the value of the \"{0}\" attribute of this ' \
+                     '{1} to the caller.'.format(name, self.class_name)
+        params = []
+        return_lines = ['@return the array held by this {0}, or @c NULL if '
+                        'it is not set.'.format(self.class_name)]
+        additional = ['@note the caller owns the returned array and must '
+                      'delete[] it; the attribute is unset.']
+
+        # create the function declaration
+        function = 'release{0}'.format(attribute['capAttName'])
+        return_type = '{0}*'.format(attribute['element'])
+        arguments = []
+        member = attribute['memberName']
+        code = [self.create_code_block('line',
+                                       ['{0}* array = {1}'.format(
+                                           attribute['element'], member),
+                                        '{0} = NULL'.format(member),
+                                        '{0}Count = 0'.format(member),
+                                        'unset{0}Length()'.format(
+                                            attribute['capAttName']),
+                                        'return array'])]
+        if self.lazy_array:
+            code.insert(0, self.parse_array_text(attribute))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.struct_name,
+                     'implementation': code})
+
     # function to write set function for an array
     # specialised c function
     def write_c_set_array(self, index):
@@ -1297,6 +1553,7 @@ class SetGetFunctions():
         # create the function implementation
         if self.is_cpp_api:
             code = self.unset_cpp_attribute(attribute)
+            self.parse_length_array_text(attribute, code)
         else:
             if not self.is_list_of:
                 use_name = self.abbrev_parent
@@ -1636,7 +1893,24 @@ class SetGetFunctions():
             else:
                 implementation = ['{0} = {1}'.format(member, name),
                                   'return {0}'.format(self.success)]
-            if not deal_with_versions:
+            if self.notifies_doc_id_index(attribute):
+                implementation.insert(0, 'updateDocumentSIdIndex({0}, '
+                                         '{1})'.format(member, name))
+            if not deal_with_versions and self.notifies_id_index(attribute):
+                if self.language == 'sbml':
+                    line = ['int success = SyntaxChecker::'
+                            'checkAndSetSId(id, mId)']
+                else:
+                    line = ['{0} = {1}'.format(member, name),
+                            'int success = {0}'.format(self.success)]
+                if self.notifies_doc_id_index(attribute):
+                    line.insert(0, 'updateDocumentSIdIndex({0}, '
+                                   '{1})'.format(member, name))
+                code = [self.create_code_block('line', line)]
+                code += self.write_invalidate_parent_id_index()
+                code.append(self.create_code_block('line',
+                                                   ['return success']))
+            elif not deal_with_versions:
                 code = [dict({'code_type': 'line', 'code': implementation})]
             else:
                 implementation = topif + implementation + ['else'] + \
@@ -1673,6 +1947,10 @@ class SetGetFunctions():
                               'return {0}'.format(self.invalid_att), 'else',
                               '{0} = {1}'.format(member, codename),
                               'return {0}'.format(self.success)]
+            if attribute['type'] == 'ID' \
+                    and self.notifies_doc_id_index(attribute):
+                implementation.insert(3, 'updateDocumentSIdIndex({0}, '
+                                         '{1})'.format(member, codename))
             if not deal_with_versions:
                 code = [dict({'code_type': 'if_else', 'code': implementation})]
             else:
@@ -1749,6 +2027,13 @@ class SetGetFunctions():
                                       'delete {0}'.format(member),
                                       '{0} = NULL'.format(member),
                                       'return {0}'.format(self.success)]
+                    # the deleted element may be referenced by the
+                    # document index
+                    invalidate = not global_variables.is_sbml \
+                        and attribute['element'] != 'ASTNode' \
+                        and attribute['element'] != 'XMLNode'
+                    if invalidate:
+                        implementation.insert(4, 'invalidateDocumentIdIndex()')
                     if attribute['element'] == 'ASTNode':
                         clone = 'deepCopy'
                         implementation.append('else if')
@@ -1768,6 +2053,8 @@ class SetGetFunctions():
                         line.append('{0}->connectToParent(this)'.format(member))
                         nested_if = self.create_code_block('if', line)
                     implementation.append('else')
+                    if invalidate:
+                        implementation.append('invalidateDocumentIdIndex()')
                     implementation.append('delete {0}'.format(member))
                     implementation.append('{0} = ({1} != NULL) ? {1}->{2}() '
                                           ': NULL'.format(member, codename, clone))
@@ -1905,12 +2192,17 @@ class SetGetFunctions():
     def unset_cpp_attribute(self, attribute):
         if attribute['attType'] == 'string':
             implementation = ['{0}.erase()'.format(attribute['memberName'])]
+            if self.notifies_doc_id_index(attribute):
+                implementation.insert(0, 'updateDocumentSIdIndex({0}, '
+                                         '\"\")'.format(attribute['memberName']))
             implementation2 = ['{0}.empty() == '
                                'true'.format(attribute['memberName']),
                                'return {0}'.format(self.success), 'else',
                                'return {0}'.format(self.failed)]
-            code = [dict({'code_type': 'line', 'code': implementation}),
-                    dict({'code_type': 'if_else', 'code': implementation2})]
+            code = [dict({'code_type': 'line', 'code': implementation})]
+            if self.notifies_id_index(attribute):
+                code += self.write_invalidate_parent_id_index()
+            code.append(dict({'code_type': 'if_else', 'code': implementation2}))
         elif attribute['attType'] == 'enum':
             implementation = ['{0} = {1}'.format(attribute['memberName'],
                                                  attribute['default']),
@@ -1931,21 +2223,69 @@ class SetGetFunctions():
             implementation = ['delete {0}'.format(attribute['memberName']),
                               '{0} = NULL'.format(attribute['memberName']),
                               'return {0}'.format(self.success)]
+            # the deleted element may be referenced by the document index
+            if not global_variables.is_sbml \
+                    and attribute['element'] != 'ASTNode' \
+                    and attribute['element'] != 'XMLNode':
+                implementation.insert(0, 'invalidateDocumentIdIndex()')
             code = [dict({'code_type': 'line', 'code': implementation})]
         elif attribute['isArray']:
             code = [self.create_code_block(
                 'if', ['{0} != NULL'.format(attribute['memberName']),
                        'delete[] {0}'.format(attribute['memberName'])]),
                     self.create_code_block('line', [
-                        '{0} = NULL'.format(attribute['memberName'])]),
+                        '{0} = NULL'.format(attribute['memberName']),
+                        '{0}Count = 0'.format(attribute['memberName'])]),
                     self.create_code_block('line', [
                         'return unset{0}Length()'.format(
                             strFunctions.upper_first(attribute['name']))])]
+            if self.lazy_array:
+                code.insert(0, self.clear_array_text(attribute))
         else:
             implementation = ['TO DO']
             code = [dict({'code_type': 'line', 'code': implementation})]
         return code
 
+    # line parsing array text that was kept when the object was read
+    def parse_array_text(self, attribute):
+        return self.create_code_block(
+            'line', ['parse{0}Text()'.format(attribute['capAttName'])])
+
+    # the parse sets the length of the array so kept text must be parsed
+    # before the length attribute is used
+    def parse_length_array_text(self, attribute, code):
+        if not self.lazy_array:
+            return
+        for array in self.attributes:
+            if array['isArray'] \
+                    and array['name'] + 'Length' == attribute['name']:
+                code.insert(0, self.parse_array_text(array))
+                return
+
+    # line discarding array text that has not been parsed yet
+    def clear_array_text(self, attribute):
+        return self.create_code_block(
+            'line', ['{0}Text.clear()'.format(attribute['memberName'])])
+
+    # does changing this attribute need to update the id index of the parent
+    def notifies_id_index(self, attribute):
+        return self.parent_id_index and attribute['name'] == 'id'
+
+    # does changing this attribute need to update the document id index
+    # (only generated documents of other libraries have one)
+    def notifies_doc_id_index(self, attribute):
+        return not global_variables.is_sbml and not self.document \
+            and attribute['name'] == 'id'
+
+    def write_invalidate_parent_id_index(self):
+        line = ['{0}* parent = dynamic_cast<{0}*>(getParent{1}'
+                'Object())'.format(self.lo_class_name,
+                                   global_variables.prefix)]
+        code = [self.create_code_block('line', line)]
+        line = ['parent != NULL', 'parent->invalidateIdIndex()']
+        code.append(self.create_code_block('if', line))
+        return code
+
     @staticmethod
     def create_code_block(code_type, lines):
         code = dict({'code_type': code_type, 'code': lines})
@@ -86,7 +86,10 @@ class ValidatorClassFunctions():
                          'LIB{0}_CAT_{0}'.format(self.cap_language)]
             arguments_no_defaults = ['{0}ErrorCategory_t '
                                      'category'.format(self.cap_language)]
-            constructor_args = [': Validator(category)']
+            constructor_args = [': Validator(category)',
+                                ', mNumThreads(1)',
+                                ', mUsesIdIndex(false)',
+                                ', mIdIndex(NULL)']
         code = []
         if not self.is_header:
             if name == 'visitor':
@@ -248,21 +251,40 @@ class ValidatorClassFunctions():
         if not self.is_header and object_type == 'doc':
             code.append(self.create_code_block('line', ['const Model* m = '
                                                         'd.getModel()']))
-            nested_if = self.create_code_block('if', ['plugin != NULL',
-                                                      'plugin->accept(vv)'])
-            lines = ['m != NULL',
-                     '{0}ValidatingVisitor vv(*this, '
-                     '*m)'.format(self.up_package),
-                     'const {0}SBMLDocumentPlugin* plugin = static_cast<const '
-                     '{0}SBMLDocumentPlugin*>(d.getPlugin(\"{1}\")'
-                     ')'.format(self.up_package, self.package),
-                     nested_if]
-            code.append(self.create_code_block('if', lines))
+            plugin = 'const {0}SBMLDocumentPlugin* plugin = static_cast<const ' \
+                     '{0}SBMLDocumentPlugin*>(d.getPlugin(\"{1}\")' \
+                     ')'.format(self.up_package, self.package)
+            nested_if = self.create_code_block(
+                'else_if', ['plugin != NULL && mNumThreads > 1',
+                            '{0}ElementCollector '
+                            'collector'.format(self.up_package),
+                            'plugin->accept(collector)',
+                            'validateElements(*m, collector.elements)',
+                            'else if', 'plugin != NULL',
+                            '{0}ValidatingVisitor vv(*this, '
+                            '*m)'.format(self.up_package),
+                            'plugin->accept(vv)'])
+            code.append(self.create_code_block(
+                'if', ['m != NULL',
+                       self.create_code_block(
+                           'comment',
+                           ['an index shared by the caller is used as it is']),
+                       self.create_code_block(
+                           'line',
+                           ['map<string, const {0}*> '
+                            'index'.format(self.std_base if self.std_base
+                                           else 'SBase')]),
+                       self.create_code_block(
+                           'if', ['mIdIndex == NULL',
+                                  'shareIdIndex(index, *m)']),
+                       self.create_code_block('line', [plugin]),
+                       nested_if]))
             code.append(self.create_code_block('comment',
                                                ['ADD ANY OTHER OBJECTS '
                                                 'THAT HAS PLUGINS']))
             code.append(self.create_code_block('line',
-                                               ['return (unsigned int)'
+                                               ['mIdIndex = NULL',
+                                                'return (unsigned int)'
                                                 '(mFailures.size())']))
         elif not self.is_header and object_type != 'doc':
             line = ['{0}Reader  reader'.format(self.cap_language),
@@ -298,6 +320,297 @@ class ValidatorClassFunctions():
 
     ########################################################################
 
+    # Functions for writing the parallel validation functions
+
+    def write_set_num_threads_function(self):
+        # create comment parts
+        title_line = 'Sets the number of threads used to validate the ' \
+                     'elements of a document.'
+        params = ['@param numThreads the number of threads to use; values '
+                  'less than 2 validate the document serially, which is the '
+                  'default.']
+        return_lines = []
+        additional = ['The elements are split into contiguous runs, one for '
+                      'each thread, and the failures are reported in '
+                      'document order just as they would be by a serial '
+                      'validation. Threads are only used when the library is '
+                      'built with OpenMP.',
+                      'The threads only read the document, which must not be '
+                      'changed while it is validated; array text kept to be '
+                      'parsed on first use is parsed by one thread at a '
+                      'time.']
+
+        # create the function declaration
+        function = 'setNumThreads'
+        return_type = 'void'
+        arguments = ['unsigned int numThreads']
+        code = []
+        if not self.is_header:
+            line = ['mNumThreads = (numThreads > 0) ? numThreads : 1']
+            code = [self.create_code_block('line', line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    def write_get_num_threads_function(self):
+        # create comment parts
+        title_line = 'Returns the number of threads used to validate the ' \
+                     'elements of a document.'
+        params = []
+        return_lines = ['@return the number of threads.']
+        additional = []
+
+        # create the function declaration
+        function = 'getNumThreads'
+        return_type = 'unsigned int'
+        arguments = []
+        code = []
+        if not self.is_header:
+            line = ['return mNumThreads']
+            code = [self.create_code_block('line', line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    def write_create_worker_function(self, consistency=False):
+        # create comment parts
+        if consistency:
+            title_line = 'Creates an initialised {0} to validate part of a ' \
+                         'document on another thread.'.format(self.class_name)
+        else:
+            title_line = 'Creates a validator with the same constraints as ' \
+                         'this one to validate part of a document on ' \
+                         'another thread.'
+        params = []
+        return_lines = ['@return the new validator, owned by the caller, or '
+                        '@c NULL if this validator cannot be copied; the '
+                        'document is then validated serially.']
+        additional = []
+
+        # create the function declaration
+        function = 'createWorker'
+        return_type = '{0}Validator*'.format(self.up_package)
+        arguments = []
+        code = []
+        if not self.is_header:
+            if consistency:
+                line = ['{0}* worker = new {0}()'.format(self.class_name),
+                        'worker->init()', 'return worker']
+            else:
+                line = ['return NULL']
+            code = [self.create_code_block('line', line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': True,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    def write_validate_elements_function(self):
+        # create comment parts
+        title_line = 'Validates the given elements, in document order, ' \
+                     'using up to getNumThreads() workers.'
+        params = ['@param m the Model containing the elements.',
+                  '@param elements the elements to validate.']
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'validateElements'
+        return_type = 'void'
+        arguments = ['const Model& m',
+                     'const std::vector<const {0}*>& '
+                     'elements'.format(self.std_base if self.std_base
+                                       else 'SBase')]
+
+        # the implementation uses OpenMP pragmas so is written line by line
+        # by the ValidatorCodeFile
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': []})
+
+    ########################################################################
+
+    # Functions for writing the id index functions
+
+    def write_get_indexed_element_function(self):
+        # create comment parts
+        title_line = 'Returns the element of the Model being validated ' \
+                     'with the given identifier.'
+        params = ['@param id the identifier of the element to return.']
+        return_lines = ['@return the element with the given identifier, or '
+                        '@c NULL if there is no such element.']
+        additional = ['Constraints use this to resolve references; the '
+                      'index is built once at the start of each validation '
+                      'rather than the Model being searched for each '
+                      'reference, and only if a constraint of this '
+                      'validator resolves references.']
+        base = self.std_base if self.std_base else 'SBase'
+
+        # create the function declaration
+        function = 'getIndexedElement'
+        return_type = 'const {0}*'.format(base)
+        arguments = ['const std::string& id']
+        code = []
+        if not self.is_header:
+            line = ['map<string, const {0}*>::const_iterator it = '
+                    'mIdIndex->find(id)'.format(base),
+                    'return (it != mIdIndex->end()) ? it->second : NULL']
+            code = [self.create_code_block('if', ['mIdIndex == NULL',
+                                                  'return NULL']),
+                    self.create_code_block('line', line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    def write_share_id_index_function(self):
+        # create comment parts
+        title_line = 'Makes the next validation use the given index of ' \
+                     'the elements of the Model by identifier.'
+        params = ['@param index the index, which is filled from @p m first '
+                  'if it is empty; the caller keeps it.',
+                  '@param m the Model to be validated.']
+        return_lines = []
+        additional = ['Nothing is done if no constraint of this validator '
+                      'resolves references. Validators of the same document '
+                      'may share one index, so that the Model is only '
+                      'indexed once however many of them need it.']
+        base = self.std_base if self.std_base else 'SBase'
+
+        # create the function declaration
+        function = 'shareIdIndex'
+        return_type = 'void'
+        arguments = ['std::map<std::string, const {0}*>& index'.format(base),
+                     'const Model& m']
+        code = []
+        if not self.is_header:
+            code = [self.create_code_block('if', ['mUsesIdIndex == false',
+                                                  'return']),
+                    self.create_code_block('if', ['index.empty()',
+                                                  'indexIds(m, index)']),
+                    self.create_code_block('line', ['mIdIndex = &index'])]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    def write_index_ids_function(self):
+        # create comment parts
+        title_line = 'Indexes the elements of the given Model by identifier.'
+        params = ['@param m the Model to index.',
+                  '@param index the index to fill.']
+        return_lines = []
+        additional = ['Only elements whose identifiers are in the global SId '
+                      'namespace are indexed, so that a UnitDefinition or a '
+                      'LocalParameter never hides the element a reference '
+                      'resolves to.']
+        base = self.std_base if self.std_base else 'SBase'
+
+        # create the function declaration
+        function = 'indexIds'
+        return_type = 'void'
+        arguments = ['const Model& m',
+                     'std::map<std::string, const {0}*>& index'.format(base)]
+        code = []
+        if not self.is_header:
+            code.append(self.create_code_block(
+                'line', ['index.clear()',
+                         'List* elements = '
+                         'const_cast<Model&>(m).getAllElements()']))
+            skip_comment = self.create_code_block(
+                'comment', ['unit definitions and the parameters of a '
+                            'kinetic law',
+                            'are not in the global SId namespace'])
+            skip_core = self.create_code_block(
+                'if', ['core && (type == SBML_UNIT_DEFINITION || '
+                       'type == SBML_LOCAL_PARAMETER)',
+                       'continue'])
+            skip_law = self.create_code_block(
+                'if', ['element->getAncestorOfType(SBML_KINETIC_LAW) != NULL',
+                       'continue'])
+            nested_if = self.create_code_block(
+                'if', ['element->isSetIdAttribute()',
+                       'index.insert(pair<string, const {0}*>'
+                       '(element->getIdAttribute(), element))'.format(base)])
+            code.append(self.create_code_block(
+                'while', ['elements->getSize() > 0',
+                          'const {0}* element = static_cast<const {0}*>'
+                          '(elements->remove(0))'.format(base),
+                          'int type = element->getTypeCode()',
+                          'bool core = element->getPackageName() == "core"',
+                          skip_comment, skip_core, skip_law,
+                          nested_if]))
+            code.append(self.create_code_block('line', ['delete elements']))
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': True,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
+    ########################################################################
+
     # Function for writing the validator structure functions
 
     def write_apply_function(self):
@@ -481,6 +794,37 @@ class ValidatorClassFunctions():
                      'object_name': self.class_name,
                      'implementation': code})
 
+    def write_typed_add_constraint_function(self, name):
+        # create comment parts
+        title_line = 'Adds the given constraint on {0} objects straight to ' \
+                     'the ConstraintSet for {0}.'.format(name)
+        params = ['@param c the TConstraint<{0}> object to add.'.format(name)]
+        return_lines = []
+        additional = []
+
+        # create the function declaration
+        function = 'addConstraint'
+        return_type = 'void'
+        arguments = ['TConstraint<{0}>* c'.format(name)]
+        code = []
+        if not self.is_header:
+            line = ['m{0}Constraints->add(m{0}Constraints->m{1}, '
+                    'c)'.format(self.up_package, name)]
+            code = [self.create_code_block('line', line)]
+
+        # return the parts
+        return dict({'title_line': title_line,
+                     'params': params,
+                     'return_lines': return_lines,
+                     'additional': additional,
+                     'function': function,
+                     'return_type': return_type,
+                     'arguments': arguments,
+                     'constant': False,
+                     'virtual': False,
+                     'object_name': self.class_name,
+                     'implementation': code})
+
     def create_if_add_constraint_block(self, name):
         lines = ['dynamic_cast< TConstraint<{0}>* >(c) != NULL'.format(name),
                  'm{0}.add(static_cast< TConstraint<{0}>* >(c) )'.format(name),
@@ -502,11 +846,13 @@ class ValidatorClassFunctions():
         function = 'visit'
         return_type = 'bool'
         arguments = ['const {0}& x'.format(name)]
-        line = ['v.m{0}Constraints->m{1}.applyTo(m, x)'.format(self.up_package,
-                                                               name),
-                'return !v.m{0}Constraints->m{1}.empty()'
-                ''.format(self.up_package, name)]
-        code = [self.create_code_block('line', line)]
+        constraints = 'v.m{0}Constraints->m{1}'.format(self.up_package, name)
+        code = [self.create_code_block('if',
+                                       ['{0}.empty()'.format(constraints),
+                                        'return false']),
+                self.create_code_block('line',
+                                       ['{0}.applyTo(m, x)'.format(constraints),
+                                        'return true'])]
 
         # return the parts
         return dict({'title_line': title_line,
@@ -535,32 +881,17 @@ class ValidatorClassFunctions():
         std_return = 'return {0}Visitor::visit(x)'.format(self.cap_language)
         line = ['x.getPackageName() != \"{0}\"'.format(self.package),
                 std_return]
+        # ListOf classes report the core list typecode and so fall
+        # through to the default case
+        cases = ['x.getTypeCode()']
+        for element in self.elements:
+            cases.append('case {0}'.format(element['typecode']))
+            cases.append(['return visit((const {0}&)x)'
+                          ''.format(element['name'])])
+        cases.append('default')
+        cases.append([std_return])
         code = [self.create_code_block('if', line),
-                self.create_code_block('line',
-                                       ['int code = x.getTypeCode()']),
-                self.create_code_block('line',
-                                       ['const ListOf* list = dynamic_cast'
-                                        '<const ListOf*>(&x)'])]
-        no_elements = len(self.elements)
-        element = self.elements[0]
-        lines = ['code == {0}'.format(element['typecode']),
-                 'return visit((const {0}&)x)'.format(element['name'])]
-        index = 1
-        code_type = 'if_else'
-        while index < no_elements:
-            code_type = 'else_if'
-            element = self.elements[index]
-            lines.append('else if')
-            lines.append('code == {0}'.format(element['typecode']))
-            lines.append('return visit((const {0}&)x)'.format(element['name']))
-            index += 1
-        lines.append('else')
-        lines.append(std_return)
-        nested_if = self.create_code_block(code_type, lines)
-
-        code.append(self.create_code_block('if_else', ['list != NULL',
-                                                       std_return, 'else',
-                                                       nested_if]))
+                self.create_code_block('switch', cases)]
 
         # return the parts
         return dict({'title_line': title_line,
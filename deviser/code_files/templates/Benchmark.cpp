@@ -0,0 +1,126 @@
+<verbatim>
+#include <ctime>
+#include <iostream>
+#include <set>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+</verbatim>
+
+#include <sbml/SBMLTypes.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_USE
+
+
+/*
+ * Returns the peak resident memory of this process in kilobytes, or 0 where
+ * it cannot be found.
+ */
+static long
+getPeakMemory()
+{
+#if defined(_WIN32)
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+
+/*
+ * The elements of a document and the namespaces objects they use.
+ */
+struct NamespacesCount
+{
+  unsigned int numElements;
+  std::set<const SBMLNamespaces*> namespaces;
+};
+
+
+static bool
+countNamespaces(SBase* element, void* userData)
+{
+  NamespacesCount* count = static_cast<NamespacesCount*>(userData);
+  count->numElements++;
+  count->namespaces.insert(element->getSharedSBMLNamespaces());
+  return true;
+}
+
+
+static void
+report(const std::string& step, SBMLDocument* doc, clock_t start,
+       long memory)
+{
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  NamespacesCount count;
+  count.numElements = 0;
+  countNamespaces(doc, &count);
+  doc->forEachElement(countNamespaces, &count);
+
+  cout << step << ": " << seconds << "s, peak memory +"
+       << getPeakMemory() - memory << "KB, " << count.numElements
+       << " elements using " << count.namespaces.size()
+       << " namespaces objects" << endl;
+}
+
+
+/*
+ * Reads a document, writes it and copies it, reporting the time and memory
+ * each step takes and how many namespaces objects the elements of the
+ * result use. Array text kept unparsed by the read is parsed by the write.
+ *
+ * usage: SBMLBenchmark filename
+ */
+int
+main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    cout << "usage: SBMLBenchmark filename" << endl;
+    return 2;
+  }
+
+  long memory = getPeakMemory();
+  clock_t start = clock();
+  SBMLReader reader;
+  SBMLDocument* doc = reader.readSBMLFromFile(argv[1]);
+  if (doc == NULL || doc->getNumErrors(LIBSBML_SEV_FATAL) > 0)
+  {
+    cout << "could not read " << argv[1] << endl;
+    delete doc;
+    return 1;
+  }
+  report("read", doc, start, memory);
+
+  memory = getPeakMemory();
+  start = clock();
+  std::string text;
+  SBMLWriter writer;
+  writer.writeSBMLToStdString(doc, text);
+  report("write", doc, start, memory);
+
+  memory = getPeakMemory();
+  start = clock();
+  SBMLDocument* copy = doc->clone();
+  report("copy", copy, start, memory);
+
+  delete copy;
+  delete doc;
+  return 0;
+}
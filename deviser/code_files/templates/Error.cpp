@@ -150,14 +150,22 @@ SBMLError::SBMLError (  const unsigned int errorId
   {
     unsigned int tableSize = sizeof(language_ErrorTable)/sizeof(language_ErrorTable[0]);
     unsigned int index = 0;
+    unsigned int low = 0;
+    unsigned int high = tableSize;
 
-    for ( unsigned int i = 0; i < tableSize; i++ )
+    // the table is written in order of error code so we can bisect it
+    while ( low < high )
     {
-      if ( mErrorId == language_ErrorTable[i].code )
-      {
-        index = i;
-        break;
-      }
+      unsigned int mid = low + (high - low) / 2;
+      if ( language_ErrorTable[mid].code < mErrorId )
+        low = mid + 1;
+      else
+        high = mid;
+    }
+
+    if ( low < tableSize && language_ErrorTable[low].code == mErrorId )
+    {
+      index = low;
     }
 
     if ( index == 0 && mErrorId != SBMLUnknown )
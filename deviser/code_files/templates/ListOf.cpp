@@ -314,6 +314,7 @@ ListOf::clear (bool doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
   
   mItems.clear();
+  invalidateDocumentIdIndex();
 }
 
 
@@ -336,7 +337,13 @@ ListOf::remove (unsigned int n)
 {
   SBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    mItems.erase( mItems.begin() + n );
+    // the removed item no longer belongs to the document
+    invalidateDocumentIdIndex();
+    item->setSBMLDocument(NULL);
+  }
   
   return item;
 }
@@ -9,6 +9,22 @@ using namespace std;
 
 /** @endcond */
 
+/*
+ * Frozen objects are shared between documents, which may be read, copied
+ * and deleted on different threads, so their reference counts are changed
+ * atomically. Both macros return the new count.
+ */
+#if defined(_MSC_VER)
+<verbatim>
+#include <intrin.h>
+</verbatim>
+#define SBML_ATOMIC_INCREMENT(count) _InterlockedIncrement(&(count))
+#define SBML_ATOMIC_DECREMENT(count) _InterlockedDecrement(&(count))
+#else
+#define SBML_ATOMIC_INCREMENT(count) __sync_add_and_fetch(&(count), 1)
+#define SBML_ATOMIC_DECREMENT(count) __sync_sub_and_fetch(&(count), 1)
+#endif
+
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
@@ -48,6 +64,10 @@ SBMLNamespaces::initSBMLNamespace()
 SBMLNamespaces::SBMLNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mRefCount(0)
+  ,mFrozen(false)
+  ,mFrozenCopy(NULL)
+  ,mWithoutNamespaces(NULL)
 {
   initSBMLNamespace();
 }
@@ -57,6 +77,8 @@ SBMLNamespaces::~SBMLNamespaces()
 {
   if (mNamespaces != NULL)
     delete mNamespaces;
+  release(mFrozenCopy);
+  release(mWithoutNamespaces);
 }
 
 
@@ -67,6 +89,10 @@ SBMLNamespaces::SBMLNamespaces(const SBMLNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mRefCount(0)
+ , mFrozen(false)
+ , mFrozenCopy(NULL)
+ , mWithoutNamespaces(NULL)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -110,6 +136,9 @@ SBMLNamespaces::operator=(const SBMLNamespaces& rhs)
             new XMLNamespaces(*const_cast<SBMLNamespaces&>(rhs).mNamespaces);
     else
       this->mNamespaces = NULL;
+    // the reference count belongs to this object, not to its contents
+    release(mFrozenCopy);
+    mFrozenCopy = NULL;
   }
 
   return *this;
@@ -348,6 +377,177 @@ SBMLNamespaces::setNamespaces(XMLNamespaces * xmlns)
   else
     mNamespaces = NULL;
 }
+
+
+SBMLNamespaces*
+SBMLNamespaces::share(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return NULL;
+
+  if (sbmlns->mFrozen)
+  {
+    SBML_ATOMIC_INCREMENT(sbmlns->mRefCount);
+    return sbmlns;
+  }
+
+  // an object that can still be changed is never shared itself; its frozen
+  // copy is, and is made again if the object has changed since
+  if (sbmlns->mFrozenCopy == NULL ||
+      !sbmlns->mFrozenCopy->hasSameNamespaces(*sbmlns))
+  {
+    release(sbmlns->mFrozenCopy);
+    sbmlns->mFrozenCopy = freeze(sbmlns->clone());
+  }
+
+  return share(sbmlns->mFrozenCopy);
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::adopt(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns != NULL)
+  {
+    SBML_ATOMIC_INCREMENT(sbmlns->mRefCount);
+  }
+
+  return sbmlns;
+}
+
+
+void
+SBMLNamespaces::release(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL) return;
+
+  // an object never adopted belongs to the caller, whose release deletes it
+  if (SBML_ATOMIC_DECREMENT(sbmlns->mRefCount) <= 0)
+  {
+    delete sbmlns;
+  }
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::unshare(SBMLNamespaces* sbmlns)
+{
+  if (sbmlns == NULL || !sbmlns->mFrozen) return sbmlns;
+
+  SBMLNamespaces* copy = adopt(sbmlns->clone());
+  copy->mFrozenCopy = sbmlns;
+  return copy;
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::intern(unsigned int level, unsigned int version)
+{
+  // the list is NULL while the library is still being loaded
+  if (mInternedNamespaces != NULL)
+  {
+    for (unsigned int i = 0; i < mInternedNamespaces->getSize(); i++)
+    {
+      SBMLNamespaces* sbmlns =
+        static_cast<SBMLNamespaces*>(mInternedNamespaces->get(i));
+      if (sbmlns->mLevel == level && sbmlns->mVersion == version)
+      {
+        return share(sbmlns);
+      }
+    }
+  }
+
+  return freeze(new SBMLNamespaces(level, version));
+}
+
+
+bool
+SBMLNamespaces::isFrozen() const
+{
+  return mFrozen;
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::shareWithoutNamespaces()
+{
+  if (!mFrozen)
+  {
+    SBMLNamespaces* frozen = share(this);
+    SBMLNamespaces* variant = frozen->shareWithoutNamespaces();
+    release(frozen);
+    return variant;
+  }
+
+  if (mWithoutNamespaces == NULL)
+  {
+    return share(this);
+  }
+
+  return share(mWithoutNamespaces);
+}
+
+
+SBMLNamespaces*
+SBMLNamespaces::freeze(SBMLNamespaces* sbmlns)
+{
+  // the variant without XML namespaces is made now rather than on first
+  // use, so that nothing about a frozen object changes once it is shared
+  if (sbmlns->mNamespaces != NULL)
+  {
+    SBMLNamespaces* variant = new SBMLNamespaces(*sbmlns);
+    variant->setNamespaces(NULL);
+    sbmlns->mWithoutNamespaces = freeze(variant);
+  }
+
+  sbmlns->mFrozen = true;
+  return adopt(sbmlns);
+}
+
+
+bool
+SBMLNamespaces::hasSameNamespaces(const SBMLNamespaces& rhs) const
+{
+  if (mLevel != rhs.mLevel || mVersion != rhs.mVersion)
+    return false;
+
+  if (mNamespaces == NULL || rhs.mNamespaces == NULL)
+    return mNamespaces == rhs.mNamespaces;
+
+  if (mNamespaces->getLength() != rhs.mNamespaces->getLength())
+    return false;
+
+  for (int i = 0; i < mNamespaces->getLength(); i++)
+  {
+    if (mNamespaces->getURI(i) != rhs.mNamespaces->getURI(i) ||
+        mNamespaces->getPrefix(i) != rhs.mNamespaces->getPrefix(i))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+const List*
+SBMLNamespaces::internSupportedNamespaces()
+{
+  const List* supported = getSupportedNamespaces();
+  for (unsigned int i = 0; i < supported->getSize(); i++)
+  {
+    freeze(static_cast<SBMLNamespaces*>(supported->get(i)));
+  }
+
+  return supported;
+}
+
+
+/*
+ * The supported namespaces are frozen when the library is loaded and kept
+ * for as long as it is.
+ */
+const List* SBMLNamespaces::mInternedNamespaces =
+  SBMLNamespaces::internSupportedNamespaces();
 /** @endcond */
 
 #endif /* __cplusplus */
@@ -234,6 +234,59 @@ public:
 
 
   void setNamespaces(XMLNamespaces * xmlns);
+
+
+  /*
+   * Reference counting used by SBase so that the elements of a document
+   * share namespaces objects rather than each holding a deep copy.
+   *
+   * Only frozen objects are ever shared, and a frozen object is never
+   * changed. share() returns a new reference to a frozen object; for any
+   * other object it returns a frozen copy, which is kept on the object and
+   * reused for as long as the two match. adopt() takes ownership of an
+   * object that is not shared and release() drops one reference, deleting
+   * the object when the last one goes.
+   *
+   * Reference counts change atomically, so elements of different documents
+   * may share and release the same frozen object on different threads.
+   * An object that is not frozen belongs to one document and, like the
+   * rest of that document, must only be used by one thread at a time.
+   */
+  static SBMLNamespaces* share(SBMLNamespaces* sbmlns);
+
+
+  static SBMLNamespaces* adopt(SBMLNamespaces* sbmlns);
+
+
+  static void release(SBMLNamespaces* sbmlns);
+
+
+  /*
+   * Returns an object that may be changed in place of the given reference:
+   * the object itself if it is not frozen or otherwise a copy, which keeps
+   * the reference as its frozen copy.
+   */
+  static SBMLNamespaces* unshare(SBMLNamespaces* sbmlns);
+
+
+  /*
+   * Returns a shared reference to the frozen object for the given level
+   * and version; the supported ones are made once, when the library is
+   * loaded, so that elements created from a level and version share them.
+   */
+  static SBMLNamespaces* intern(unsigned int level, unsigned int version);
+
+
+  bool isFrozen() const;
+
+
+  /*
+   * Returns a shared reference to a frozen object with the same level and
+   * version as this one but no XML namespaces; every frozen object makes
+   * its own when it is frozen, so that every element read from a document
+   * uses the same one.
+   */
+  SBMLNamespaces* shareWithoutNamespaces();
   /** @endcond */
 
 protected:  
@@ -244,6 +297,19 @@ protected:
   unsigned int    mVersion;
   XMLNamespaces * mNamespaces;
 
+  volatile long   mRefCount;
+  bool            mFrozen;
+  SBMLNamespaces* mFrozenCopy;
+  SBMLNamespaces* mWithoutNamespaces;
+
+  static SBMLNamespaces* freeze(SBMLNamespaces* sbmlns);
+
+  static const List* internSupportedNamespaces();
+
+  static const List* mInternedNamespaces;
+
+  bool hasSameNamespaces(const SBMLNamespaces& rhs) const;
+
   /** @endcond */
 };
 
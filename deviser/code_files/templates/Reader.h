@@ -5,10 +5,15 @@
 #include <sbml/common/extern.h>
 #include <sbml/common/sbmlfwd.h>
 
+<verbatim>
+#include <stddef.h>
+</verbatim>
+
 #ifdef __cplusplus
 
 
 #include <string>
+#include <vector>
 
 LIBSBML_CPP_NAMESPACE_BEGIN
 
@@ -77,6 +82,52 @@ public:
   SBMLDocument* readSBMLFromString (const std::string& xml);
 
 
+  /**
+   * Reads an SBML_Lang document from the given buffer, for example one
+   * received from a message queue.
+   *
+   * The buffer need not be null-terminated.  It is parsed in place, without
+   * being copied, when it begins with an XML declaration and @p length
+   * includes a terminating null character; otherwise it is copied once,
+   * with the XML declaration prepended if it is missing.
+   *
+   * @param data the XML content.
+   *
+   * @param length the number of characters in @p data.
+   *
+   * @return a pointer to the SBMLDocument created from the SBML content.
+   *
+   * @see SBMLReader::readSBMLFromString(@if java String@endif)
+   */
+  SBMLDocument* readSBMLFromBuffer (const char* data, size_t length);
+
+
+#ifndef SWIG
+  /**
+   * Reads each of the given files into a document of its own, using up to
+   * @p numThreads threads.
+   *
+   * Documents share no mutable state, so each file is read independently
+   * and each document has its own error log.  A file that cannot be read
+   * gives a document reporting the error, as readSBMLFromFile() does.
+   * Threads are only used when the library is built with OpenMP; otherwise
+   * the files are read in turn.
+   *
+   * @param filenames the names or full pathnames of the files to be read.
+   *
+   * @param numThreads the maximum number of threads to use.
+   *
+   * @return the documents in the order of @p filenames.  The caller owns
+   * them and should delete each one when it is no longer needed.
+   *
+   * @see SBMLReader::readSBMLFromFile(@if java String@endif)
+   */
+  static std::vector<SBMLDocument*>
+  readBatch (const std::vector<std::string>& filenames,
+             unsigned int numThreads = 1);
+#endif
+
+
   /**
    * Static method; returns @c true if this copy of libSBML supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -205,6 +256,24 @@ SBMLDocument_t *
 SBMLReader_readSBMLFromString (SBMLReader_t *sr, const char *xml);
 
 
+/**
+ * @param sr the SBMLReader_t structure to use
+ *
+ * @param data the input xml, which need not be null-terminated.
+ *
+ * @param length the number of characters in @p data.
+ *
+ * @return a pointer to the SBMLDocument read.
+ *
+ * @if conly
+ * @memberof SBMLReader_t
+ * @endif
+ */
+LIBSBML_EXTERN
+SBMLDocument_t *
+SBMLReader_readSBMLFromBuffer (SBMLReader_t *sr, const char *data, size_t length);
+
+
 /**
  * Returns @c true if the underlying libSBML supports @em gzip and @em zlib
  * format compression.
@@ -86,7 +86,7 @@ SBase::SBase (unsigned int level, unsigned int version)
   , mEmptyString("")
  , mURI("")
 {
-  mSBMLNamespaces = new SBMLNamespaces(level, version);
+  mSBMLNamespaces = SBMLNamespaces::intern(level, version);
 
   //
   // Sets the XMLNS URI of corresponding SBML_Lang Level/Version to
@@ -122,9 +122,9 @@ SBase::SBase (SBMLNamespaces *sbmlns)
     std::string err("SBase::SBase(SBMLNamespaces*) : SBMLNamespaces is null");
     throw SBMLConstructorException(err);
   }
-  mSBMLNamespaces = sbmlns->clone();
+  mSBMLNamespaces = SBMLNamespaces::share(sbmlns);
 
-  setElementNamespace(static_cast<SBMLNamespaces>(*mSBMLNamespaces).getURI());
+  setElementNamespace(mSBMLNamespaces->getURI());
 }
 /** @endcond */
 
@@ -156,11 +156,12 @@ SBase::SBase(const SBase& orig)
   else
     this->m<Annotation> = NULL;
 
-  if(orig.getSBMLNamespaces() != NULL)
-    this->mSBMLNamespaces =
-    new SBMLNamespaces(*const_cast<SBase&>(orig).getSBMLNamespaces());
+  // share what the original uses without asking it for a copy it may change
+  const SBase* owner = (orig.mSBML != NULL) ? orig.mSBML : &orig;
+  if (owner->mSBMLNamespaces != NULL)
+    this->mSBMLNamespaces = SBMLNamespaces::share(owner->mSBMLNamespaces);
   else
-    this->mSBMLNamespaces = NULL;
+    this->mSBMLNamespaces = SBMLNamespaces::share(orig.getSBMLNamespaces());
 
   this->mHasBeenDeleted = false;
 }
@@ -172,9 +173,11 @@ SBase::SBase(const SBase& orig)
  */
 SBase::~SBase ()
 {
+  // the document index may still point at this object
+  invalidateDocumentIdIndex();
   if (m<Notes> != NULL)       delete m<Notes>;
   if (m<Annotation> != NULL)  delete m<Annotation>;
-  if (mSBMLNamespaces != NULL)  delete mSBMLNamespaces;
+  SBMLNamespaces::release(mSBMLNamespaces);
 }
 
 /*
@@ -207,13 +210,9 @@ SBase& SBase::operator=(const SBase& rhs)
     this->mParentSBMLObject = rhs.mParentSBMLObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mSBMLNamespaces;
-
-    if(rhs.mSBMLNamespaces != NULL)
-      this->mSBMLNamespaces =
-      new SBMLNamespaces(*const_cast<SBase&>(rhs).mSBMLNamespaces);
-    else
-      this->mSBMLNamespaces = NULL;
+    SBMLNamespaces* sbmlns = SBMLNamespaces::share(rhs.mSBMLNamespaces);
+    SBMLNamespaces::release(this->mSBMLNamespaces);
+    this->mSBMLNamespaces = sbmlns;
 
 
     this->mURI = rhs.mURI;
@@ -327,7 +326,7 @@ SBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  SBMLNamespaces* sbmlns = doc->getSBMLNamespaces();
+  const SBMLNamespaces* sbmlns = doc->getSharedSBMLNamespaces();
 
   if (sbmlns == NULL)
     return getElementNamespace();
@@ -395,20 +394,16 @@ SBase::unsetUserData()
 XMLNamespaces*
 SBase::getNamespaces()
 {
-  if (mSBML != NULL)
-    return mSBML->getSBMLNamespaces()->getNamespaces();
-  else
-    return mSBMLNamespaces->getNamespaces();
+  // the caller may change the namespaces returned, which getSBMLNamespaces
+  // allows for
+  return getSBMLNamespaces()->getNamespaces();
 }
 
 
 const XMLNamespaces*
 SBase::getNamespaces() const
 {
-  if (mSBML != NULL)
-    return mSBML->getSBMLNamespaces()->getNamespaces();
-  else
-    return mSBMLNamespaces->getNamespaces();
+  return getSharedSBMLNamespaces()->getNamespaces();
 }
 
 
@@ -591,6 +586,8 @@ SBase::isSet<Annotation> () const
 int
 SBase::setMetaId (const std::string& metaid)
 {
+  updateDocumentMetaIdIndex(mMetaId, metaid);
+
   if (metaid.empty())
   {
     mMetaId.erase();
@@ -609,6 +606,8 @@ SBase::setMetaId (const std::string& metaid)
 int
 SBase::setId (const std::string& sid)
 {
+  updateDocumentSIdIndex(mId, sid);
+
   if (sid.empty())
   {
     mId.erase();
@@ -1456,6 +1455,8 @@ SBase::connectToParent (SBase* parent)
          << " " << parent->getSBMLDocument() << endl;
 #endif
     setSBMLDocument(mParentSBMLObject->getSBMLDocument());
+    // anything below this object may now be found in the document
+    invalidateDocumentIdIndex();
   }
   else
   {
@@ -1545,11 +1546,19 @@ SBase::setNamespaces(XMLNamespaces* xmlns)
 {
   if (xmlns == NULL)
   {
-    mSBMLNamespaces->setNamespaces(NULL);
+    // this happens for nearly every element read so rather than making
+    // a copy we switch to the variant shared by the whole document
+    if (mSBMLNamespaces->getNamespaces() != NULL)
+    {
+      SBMLNamespaces* sbmlns = mSBMLNamespaces->shareWithoutNamespaces();
+      SBMLNamespaces::release(mSBMLNamespaces);
+      mSBMLNamespaces = sbmlns;
+    }
     return LIBSBML_OPERATION_SUCCESS;
   }
   else
   {
+    unshareSBMLNamespaces();
     mSBMLNamespaces->setNamespaces(xmlns);
     return LIBSBML_OPERATION_SUCCESS;
   }
@@ -1563,6 +1572,7 @@ SBase::setNamespaces(XMLNamespaces* xmlns)
 int
 SBase::unsetMetaId ()
 {
+  updateDocumentMetaIdIndex(mMetaId, "");
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -1582,6 +1592,7 @@ SBase::unsetMetaId ()
 int
 SBase::unsetId ()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty())
@@ -1727,8 +1738,8 @@ SBase::matchesCoreSBMLNamespace(const SBase * sb)
 {
   bool match = false;
 
-  SBMLNamespaces *sbmlns = getSBMLNamespaces();
-  SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns = getSharedSBMLNamespaces();
+  const SBMLNamespaces *sbmlns_rhs = sb->getSharedSBMLNamespaces();
 
   if (sbmlns->getLevel() != sbmlns_rhs->getLevel())
     return match;
@@ -1754,8 +1765,8 @@ SBase::matchesCoreSBMLNamespace(const SBase * sb) const
 {
   bool match = false;
 
-  SBMLNamespaces *sbmlns = getSBMLNamespaces();
-  SBMLNamespaces *sbmlns_rhs = sb->getSBMLNamespaces();
+  const SBMLNamespaces *sbmlns = getSharedSBMLNamespaces();
+  const SBMLNamespaces *sbmlns_rhs = sb->getSharedSBMLNamespaces();
 
   if (sbmlns->getLevel() != sbmlns_rhs->getLevel())
     return match;
@@ -1827,8 +1838,10 @@ SBase::setSBMLNamespaces(SBMLNamespaces * sbmlns)
   if (sbmlns == NULL)
     return LIBSBML_INVALID_OBJECT;
 
-  SBMLNamespaces* sbmlnsClone = (sbmlns) ? sbmlns->clone() : 0;
-  setSBMLNamespacesAndOwn(sbmlnsClone);
+  SBMLNamespaces* shared = SBMLNamespaces::share(sbmlns);
+  SBMLNamespaces::release(mSBMLNamespaces);
+  mSBMLNamespaces = shared;
+  setElementNamespace(shared->getURI());
 
   return LIBSBML_OPERATION_SUCCESS;
 }
@@ -1840,25 +1853,48 @@ SBase::setSBMLNamespaces(SBMLNamespaces * sbmlns)
 void
 SBase::setSBMLNamespacesAndOwn(SBMLNamespaces * sbmlns)
 {
-  delete mSBMLNamespaces;
-  mSBMLNamespaces = sbmlns;
+  SBMLNamespaces::release(mSBMLNamespaces);
+  mSBMLNamespaces = SBMLNamespaces::adopt(sbmlns);
 
   if(sbmlns != NULL)
     setElementNamespace(sbmlns->getURI());
 }
 
 
+void
+SBase::unshareSBMLNamespaces()
+{
+  mSBMLNamespaces = SBMLNamespaces::unshare(mSBMLNamespaces);
+}
+
+
 /* gets the SBMLnamespaces - internal use only*/
 SBMLNamespaces *
 SBase::getSBMLNamespaces() const
 {
-  if (mSBML != NULL)
-    return mSBML->mSBMLNamespaces;
-  
+  // the caller may change the object returned, so it must be one that is
+  // not shared with other elements
+  SBase* owner = (mSBML != NULL) ? mSBML : const_cast<SBase*>(this);
+
   // initialize SBML_Lang namespace if need be
-  if (mSBMLNamespaces == NULL)
-    const_cast<SBase*>(this)->mSBMLNamespaces = new SBMLNamespaces(getLevel(), getVersion());
-  return mSBMLNamespaces;  
+  if (owner->mSBMLNamespaces == NULL)
+    owner->mSBMLNamespaces = SBMLNamespaces::adopt(
+      new SBMLNamespaces(owner->getLevel(), owner->getVersion()));
+  else
+    owner->unshareSBMLNamespaces();
+  return owner->mSBMLNamespaces;
+}
+
+
+/* gets the SBMLnamespaces to read from - internal use only*/
+const SBMLNamespaces *
+SBase::getSharedSBMLNamespaces() const
+{
+  const SBase* owner = (mSBML != NULL) ? mSBML : this;
+
+  if (owner->mSBMLNamespaces == NULL)
+    return getSBMLNamespaces();
+  return owner->mSBMLNamespaces;
 }
 /** @endcond */
 
@@ -2134,8 +2170,7 @@ SBase::read (XMLInputStream& stream)
 
         if (error == true && errorLoggedAlready == false)
         {
-          static ostringstream errMsg;
-          errMsg.str("");
+          ostringstream errMsg;
           errMsg << "The prefix for the <sbml> element does not match "
             << "the prefix for the SBML_Lang namespace.  This means that "
             << "the <sbml> element in not in the SBMLNamespace."<< endl;
@@ -2649,6 +2684,53 @@ SBase::getRootElement()
 }
 
 
+/*
+ * Updates the identifier index of the parent SBMLDocument (if any) when
+ * the id of this object changes.
+ */
+void
+SBase::updateDocumentSIdIndex(const std::string& oldId,
+    const std::string& newId)
+{
+  SBMLDocument* doc = getSBMLDocument();
+  if (doc != NULL)
+  {
+    doc->updateSIdIndex(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Updates the identifier index of the parent SBMLDocument (if any) when
+ * the metaid of this object changes.
+ */
+void
+SBase::updateDocumentMetaIdIndex(const std::string& oldId,
+    const std::string& newId)
+{
+  SBMLDocument* doc = getSBMLDocument();
+  if (doc != NULL)
+  {
+    doc->updateMetaIdIndex(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Marks the identifier index of the parent SBMLDocument (if any) as out
+ * of date.
+ */
+void
+SBase::invalidateDocumentIdIndex()
+{
+  SBMLDocument* doc = getSBMLDocument();
+  if (doc != NULL)
+  {
+    doc->invalidateIdIndex();
+  }
+}
+
+
 /*
  * Subclasses should override this method to write their XML attributes
  * to the XMLOutputStream.  Be sure to call your parents implementation
@@ -2800,8 +2882,7 @@ SBase::checkDefaultNamespace(const XMLNamespaces* xmlns,
        && (elementName == "notes" || elementName == <annotation_variable>))
     return;
 
-  static ostringstream errMsg;
-  errMsg.str("");
+  ostringstream errMsg;
   errMsg << "xmlns=\"" << defaultURI << "\" in <" << elementName
          << "> element is an invalid namespace." << endl;
 
@@ -1580,12 +1580,21 @@ public:
 
   /* sets the SBMLNamaepaces and owns the given object - internal use only */
   void setSBMLNamespacesAndOwn(SBMLNamespaces * disownedNs);
+
+  /* the namespaces object may be shared with other elements of the
+   * document; this gives the object its own copy before it is changed */
+  void unshareSBMLNamespaces();
   /** @endcond */
 
 
   /** @cond doxygenLibsbmlInternal */
-  /* gets the SBMLnamespaces - internal use only*/
+  /* gets the SBMLnamespaces, first giving the document its own copy if
+   * they were shared, since the caller may change them - internal use only*/
   virtual SBMLNamespaces * getSBMLNamespaces() const;
+
+  /* gets the SBMLnamespaces, which may be shared with other elements and so
+   * must not be changed - internal use only */
+  const SBMLNamespaces * getSharedSBMLNamespaces() const;
   /** @endcond */
 
 
@@ -1970,6 +1979,31 @@ protected:
   SBase* getRootElement();
 
 
+  /** @cond doxygenLibsbmlInternal */
+  /**
+   * Keeps the identifier index of the parent SBMLDocument (if any) in
+   * sync when the "id" of this object changes from @p oldId to @p newId.
+   */
+  void updateDocumentSIdIndex(const std::string& oldId,
+                              const std::string& newId);
+
+
+  /**
+   * Keeps the identifier index of the parent SBMLDocument (if any) in
+   * sync when the "metaid" of this object changes from @p oldId to @p newId.
+   */
+  void updateDocumentMetaIdIndex(const std::string& oldId,
+                                 const std::string& newId);
+
+
+  /**
+   * Marks the identifier index of the parent SBMLDocument (if any) as out
+   * of date, e.g. after elements have been added or removed.
+   */
+  void invalidateDocumentIdIndex();
+  /** @endcond */
+
+
   // ------------------------------------------------------------------
 
 
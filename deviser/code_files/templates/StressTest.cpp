@@ -0,0 +1,270 @@
+<verbatim>
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+</verbatim>
+
+#include <sbml/SBMLTypes.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_USE
+
+
+static bool
+countElement(SBase*, void* userData)
+{
+  ++*static_cast<unsigned int*>(userData);
+  return true;
+}
+
+
+static unsigned int
+countElements(SBMLDocument* doc)
+{
+  unsigned int count = 1;
+  doc->forEachElement(countElement, &count);
+  return count;
+}
+
+
+/*
+ * Adds the given file to the list or, for a directory, the .xml files in
+ * it and in the directories below it, in name order.
+ */
+static void
+addDocuments(const std::string& path, std::vector<std::string>& filenames,
+             bool named)
+{
+  std::vector<std::string> found;
+
+#if defined(_WIN32)
+  WIN32_FIND_DATAA entry;
+  HANDLE dir = FindFirstFileA((path + "\\*").c_str(), &entry);
+  if (dir == INVALID_HANDLE_VALUE)
+  {
+    dir = NULL;
+  }
+  else
+  {
+    do
+    {
+      if (strcmp(entry.cFileName, ".") != 0
+        && strcmp(entry.cFileName, "..") != 0)
+      {
+        found.push_back(path + "\\" + entry.cFileName);
+      }
+    }
+    while (FindNextFileA(dir, &entry));
+    FindClose(dir);
+  }
+#else
+  DIR* dir = opendir(path.c_str());
+  if (dir != NULL)
+  {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+      if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+      {
+        found.push_back(path + "/" + entry->d_name);
+      }
+    }
+    closedir(dir);
+  }
+#endif
+
+  if (dir == NULL)
+  {
+    size_t length = path.size();
+    if (named || (length > 4 && path.compare(length - 4, 4, ".xml") == 0))
+    {
+      filenames.push_back(path);
+    }
+    return;
+  }
+
+  std::sort(found.begin(), found.end());
+  for (size_t i = 0; i < found.size(); i++)
+  {
+    addDocuments(found[i], filenames, false);
+  }
+}
+
+
+/*
+ * What a document read on its own comes out as.
+ */
+struct Expected
+{
+  unsigned int level;
+  unsigned int version;
+  unsigned int numElements;
+  unsigned int numErrors;
+};
+
+
+static bool
+matches(SBMLDocument* doc, const Expected& expected)
+{
+  return doc != NULL && doc->getLevel() == expected.level
+    && doc->getVersion() == expected.version
+    && countElements(doc) == expected.numElements;
+}
+
+
+/*
+ * Reads the documents named, or the .xml files in and below the
+ * directories named, such as the test-examples tree of the deviser test
+ * suite, on many threads at once; then copies and deletes the copies on
+ * many threads at once, so that different packages and error paths run
+ * concurrently and the namespaces objects the documents share are
+ * referenced and released concurrently. Every document must come out the
+ * same as when its file is read on its own.
+ *
+ * usage: SBMLStressTest [-t numThreads] [-n numRounds] path [path ...]
+ */
+int
+main(int argc, char* argv[])
+{
+  unsigned int numThreads = 8;
+  unsigned int numRounds = 10;
+  int first = 1;
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-t") == 0)
+    {
+      numThreads = atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-n") == 0)
+    {
+      numRounds = atoi(argv[first + 1]);
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if (first >= argc || argv[first][0] == '-')
+  {
+    cout << "usage: SBMLStressTest [-t numThreads] [-n numRounds] "
+         << "path [path ...]" << endl;
+    return 2;
+  }
+  if (numThreads < 1) numThreads = 1;
+
+  std::vector<std::string> files;
+  for (int i = first; i < argc; i++)
+  {
+    addDocuments(argv[i], files, true);
+  }
+
+  // each file is first read on its own; files that cannot be read are
+  // kept, so that error paths run concurrently too
+  SBMLReader reader;
+  std::vector<Expected> expected(files.size());
+  unsigned int level = 0;
+  unsigned int version = 0;
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    SBMLDocument* doc = reader.readSBMLFromFile(files[i]);
+    expected[i].level = doc->getLevel();
+    expected[i].version = doc->getVersion();
+    expected[i].numElements = countElements(doc);
+    expected[i].numErrors = doc->getNumErrors();
+    if (level == 0 && doc->getNumErrors(LIBSBML_SEV_FATAL) == 0)
+    {
+      level = doc->getLevel();
+      version = doc->getVersion();
+    }
+    delete doc;
+  }
+
+  if (level == 0)
+  {
+    cout << "none of the " << files.size() << " files could be read"
+         << endl;
+    return 1;
+  }
+
+  // every thread gets several documents each round
+  std::vector<std::string> filenames;
+  while (filenames.size() < numThreads * 4)
+  {
+    filenames.insert(filenames.end(), files.begin(), files.end());
+  }
+  int count = static_cast<int>(filenames.size());
+  int numFiles = static_cast<int>(files.size());
+  int failures = 0;
+
+  for (unsigned int round = 0; round < numRounds; round++)
+  {
+    std::vector<SBMLDocument*> docs =
+      SBMLReader::readBatch(filenames, numThreads);
+    std::vector<SBMLDocument*> copies(docs.size(), NULL);
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1) reduction(+:failures)
+#endif
+    for (int i = 0; i < count; i++)
+    {
+      // new elements share the interned namespaces for their level and
+      // version, as do the elements read from the files
+      SBMLDocument created(level, version);
+      if (created.getSharedSBMLNamespaces()->getLevel() != level)
+      {
+        failures++;
+      }
+
+      if (!matches(docs[i], expected[i % numFiles])
+        || docs[i]->getNumErrors() != expected[i % numFiles].numErrors)
+      {
+        failures++;
+      }
+      if (docs[i] != NULL)
+      {
+        copies[i] = docs[i]->clone();
+      }
+      delete docs[i];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1) reduction(+:failures)
+#endif
+    for (int i = 0; i < count; i++)
+    {
+      if (!matches(copies[i], expected[i % numFiles]))
+      {
+        failures++;
+      }
+      delete copies[i];
+    }
+  }
+
+  // the interned namespaces must have outlived every document
+  SBMLDocument created(level, version);
+  if (created.getSharedSBMLNamespaces()->getVersion() != version)
+  {
+    failures++;
+  }
+
+  cout << numRounds << " rounds of " << count << " documents from "
+       << numFiles << " files on " << numThreads << " threads: "
+       << failures << " failures" << endl;
+  return (failures == 0) ? 0 : 1;
+}
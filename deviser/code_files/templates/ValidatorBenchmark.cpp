@@ -0,0 +1,156 @@
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#include <sbml/SBMLTypes.h>
+#include <sbml/packages/pkg/validator/PkgConsistencyValidator.h>
+#include <sbml/packages/pkg/validator/PkgIdentifierConsistencyValidator.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBSBML_CPP_NAMESPACE_USE
+
+
+/*
+ * Adds the .xml files in the given directory to the list, in name order,
+ * or the path itself if it is not a directory.
+ */
+static void
+addDocuments(const std::string& path, std::vector<std::string>& filenames)
+{
+  std::vector<std::string> found;
+
+#if defined(_WIN32)
+  WIN32_FIND_DATAA entry;
+  HANDLE dir = FindFirstFileA((path + "\\*.xml").c_str(), &entry);
+  if (dir == INVALID_HANDLE_VALUE)
+  {
+    filenames.push_back(path);
+    return;
+  }
+  do
+  {
+    found.push_back(path + "\\" + entry.cFileName);
+  }
+  while (FindNextFileA(dir, &entry));
+  FindClose(dir);
+#else
+  DIR* dir = opendir(path.c_str());
+  if (dir == NULL)
+  {
+    filenames.push_back(path);
+    return;
+  }
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != NULL)
+  {
+    size_t length = strlen(entry->d_name);
+    if (length > 4 && strcmp(entry->d_name + length - 4, ".xml") == 0)
+    {
+      found.push_back(path + "/" + entry->d_name);
+    }
+  }
+  closedir(dir);
+#endif
+
+  std::sort(found.begin(), found.end());
+  filenames.insert(filenames.end(), found.begin(), found.end());
+}
+
+
+/*
+ * Reads the documents named, or the .xml files in the directories named,
+ * such as the pkg validation examples of the deviser test suite, and
+ * reports the time the pkg consistency and identifier validators take to
+ * validate all the documents that use the pkg package.
+ *
+ * usage: PkgValidatorBenchmark [-n numRounds] path [path ...]
+ */
+int
+main(int argc, char* argv[])
+{
+  int first = 1;
+  unsigned int numRounds = 10;
+  if (argc > 2 && strcmp(argv[1], "-n") == 0)
+  {
+    numRounds = atoi(argv[2]);
+    first = 3;
+  }
+
+  if (first >= argc || numRounds < 1)
+  {
+    cout << "usage: PkgValidatorBenchmark [-n numRounds] path [path ...]"
+         << endl;
+    return 2;
+  }
+
+  std::vector<std::string> filenames;
+  for (int i = first; i < argc; i++)
+  {
+    addDocuments(argv[i], filenames);
+  }
+
+  SBMLReader reader;
+  std::vector<SBMLDocument*> docs;
+  for (size_t i = 0; i < filenames.size(); i++)
+  {
+    SBMLDocument* doc = reader.readSBMLFromFile(filenames[i]);
+    if (doc == NULL || doc->getNumErrors(LIBSBML_SEV_FATAL) > 0
+      || !doc->isPackageEnabled("pkg"))
+    {
+      delete doc;
+      continue;
+    }
+    docs.push_back(doc);
+  }
+
+  if (docs.empty())
+  {
+    cout << "no documents using the pkg package were read" << endl;
+    return 1;
+  }
+
+  PkgConsistencyValidator consistency;
+  consistency.init();
+  PkgIdentifierConsistencyValidator identifier;
+  identifier.init();
+
+  unsigned int failures = 0;
+  clock_t start = clock();
+  for (unsigned int round = 0; round < numRounds; round++)
+  {
+    for (size_t i = 0; i < docs.size(); i++)
+    {
+      failures += consistency.validate(*docs[i]);
+      failures += identifier.validate(*docs[i]);
+      consistency.clearFailures();
+      identifier.clearFailures();
+    }
+  }
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  cout << numRounds << " rounds of " << docs.size() << " documents: "
+       << seconds << "s, " << seconds * 1000000 / (numRounds * docs.size())
+       << "us per document, " << failures / numRounds
+       << " failures per round" << endl;
+
+  for (size_t i = 0; i < docs.size(); i++)
+  {
+    delete docs[i];
+  }
+  return 0;
+}
@@ -2,6 +2,9 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <streambuf>
+#include <cstdlib>
+#include <cstring>
 
 #include <sbml/common/common.h>
 <verbatim>
@@ -28,6 +31,129 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+/** @cond doxygenLibsbmlInternal */
+/*
+ * Stream buffer handing its contents to an SBMLWriterSink_t in chunks of
+ * at most BUFFER_SIZE bytes.
+ */
+class SinkStreamBuf : public std::streambuf
+{
+public:
+
+  SinkStreamBuf (SBMLWriterSink_t sink, void* userData)
+    : mSink (sink)
+    , mUserData (userData)
+  {
+    setp(mBuffer, mBuffer + BUFFER_SIZE);
+  }
+
+protected:
+
+  int overflow (int c)
+  {
+    if (!flushBuffer())
+    {
+      return traits_type::eof();
+    }
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+  }
+
+  int sync ()
+  {
+    return flushBuffer() ? 0 : -1;
+  }
+
+private:
+
+  enum { BUFFER_SIZE = 8192 };
+
+  bool flushBuffer ()
+  {
+    size_t length = static_cast<size_t>(pptr() - pbase());
+
+    if (length > 0 && mSink(pbase(), length, mUserData) == 0)
+    {
+      return false;
+    }
+
+    setp(mBuffer, mBuffer + BUFFER_SIZE);
+    return true;
+  }
+
+  SinkStreamBuf (const SinkStreamBuf&);
+  SinkStreamBuf& operator= (const SinkStreamBuf&);
+
+  SBMLWriterSink_t mSink;
+  void* mUserData;
+  char mBuffer[BUFFER_SIZE];
+};
+
+
+/*
+ * malloc'd buffer grown geometrically by appendToBuffer.
+ */
+struct GrowableBuffer
+{
+  char* data;
+  size_t length;
+  size_t capacity;
+};
+
+
+static int
+appendToBuffer (const char* data, size_t length, void* userData)
+{
+  GrowableBuffer* buffer = static_cast<GrowableBuffer*>(userData);
+  size_t required = buffer->length + length + 1;
+
+  if (required > buffer->capacity)
+  {
+    size_t capacity = buffer->capacity > 0 ? buffer->capacity * 2 : 16384;
+    while (capacity < required)
+    {
+      capacity *= 2;
+    }
+
+    char* grown = static_cast<char*>(realloc(buffer->data, capacity));
+    if (grown == NULL)
+    {
+      return 0;
+    }
+
+    buffer->data = grown;
+    buffer->capacity = capacity;
+  }
+
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return 1;
+}
+
+
+static int
+appendToString (const char* data, size_t length, void* userData)
+{
+  static_cast<std::string*>(userData)->append(data, length);
+  return 1;
+}
+
+
+static int
+countBytes (const char*, size_t length, void* userData)
+{
+  *static_cast<size_t*>(userData) += length;
+  return 1;
+}
+/** @endcond */
+
+
 /*
  * Creates a new SBMLWriter.
  */
@@ -221,12 +347,48 @@ SBMLWriter::writeSBML (const SBMLDocument* d, std::ostream& stream)
 }
 
 
+/*
+ * Writes the given SBMLDocument to a sink callback.  The final chunk is
+ * delivered by the std::endl that terminates the document.
+ *
+ * @return true on success and false if the sink aborted the write or one
+ * of the underlying parser components fail (rare).
+ */
+bool
+SBMLWriter::writeSBML (const SBMLDocument* d, SBMLWriterSink_t sink,
+                       void* userData)
+{
+  if (d == NULL || sink == NULL) return false;
+
+  SinkStreamBuf buffer(sink, userData);
+  std::ostream stream(&buffer);
+
+  return writeSBML(d, stream);
+}
+
+
+/*
+ * Returns the number of bytes the given SBMLDocument occupies when written
+ * out, or 0 if it could not be written.
+ */
+size_t
+SBMLWriter::getSerializedSize (const SBMLDocument* d)
+{
+  size_t size = 0;
+
+  return writeSBML(d, countBytes, &size) ? size : 0;
+}
+
+
 /** @cond doxygenLibsbmlInternal */
 /*
  * Writes the given SBMLDocument to an in-memory string and returns a
  * pointer to it.  The string is owned by the caller and should be freed
  * (with free()) when no longer needed.
  *
+ * The output is appended directly to the returned buffer, which is
+ * trimmed to size once the document is complete.
+ *
  * @return the string on success and 0 if one of the underlying parser
  * components fail (rare).
  */
@@ -234,20 +396,32 @@ LIBSBML_EXTERN
 char*
 SBMLWriter::writeToString (const SBMLDocument* d)
 {
-  ostringstream stream;
-  writeSBML(d, stream);
+  GrowableBuffer buffer = { NULL, 0, 0 };
 
-  return sbml_safe_strdup( stream.str().c_str() );
+  if (!writeSBML(d, appendToBuffer, &buffer) || buffer.data == NULL)
+  {
+    free(buffer.data);
+    return NULL;
+  }
+
+  buffer.data[buffer.length] = '\0';
+
+  char* trimmed = static_cast<char*>(realloc(buffer.data, buffer.length + 1));
+  return (trimmed != NULL) ? trimmed : buffer.data;
 }
 
 std::string 
 SBMLWriter::writeSBMLToStdString(const SBMLDocument* d)
 {
-  if (d == NULL) return "";
-  
-  ostringstream stream;
-  writeSBML(d, stream);
-  return stream.str();
+  std::string result;
+  writeSBMLToStdString(d, result);
+  return result;
+}
+
+bool
+SBMLWriter::writeSBMLToStdString(const SBMLDocument* d, std::string& buffer)
+{
+  return writeSBML(d, appendToString, &buffer);
 }
 
 LIBSBML_EXTERN
@@ -373,6 +547,31 @@ SBMLWriter_writeSBMLToString (SBMLWriter_t *sw, const SBMLDocument_t *d)
 }
 
 
+LIBSBML_EXTERN
+int
+SBMLWriter_writeSBMLToSink ( SBMLWriter_t         *sw,
+                             const SBMLDocument_t *d,
+                             SBMLWriterSink_t     sink,
+                             void                 *userData )
+{
+  if (sw == NULL || d == NULL || sink == NULL)
+    return 0;
+  else
+    return static_cast<int>( sw->writeSBML(d, sink, userData) );
+}
+
+
+LIBSBML_EXTERN
+size_t
+SBMLWriter_getSerializedSize (SBMLWriter_t *sw, const SBMLDocument_t *d)
+{
+  if (sw == NULL || d == NULL)
+    return 0;
+  else
+    return sw->getSerializedSize(d);
+}
+
+
 LIBSBML_EXTERN
 int
 SBMLWriter_hasZlib ()
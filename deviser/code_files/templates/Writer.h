@@ -5,6 +5,30 @@
 #include <sbml/common/extern.h>
 #include <sbml/common/sbmlfwd.h>
 
+<verbatim>
+#include <stddef.h>
+</verbatim>
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+BEGIN_C_DECLS
+
+/**
+ * Callback receiving the written form of a document in successive chunks.
+ *
+ * @param data the next chunk of output; it is not NUL-terminated and is
+ * only valid for the duration of the call
+ *
+ * @param length the number of bytes in @p data
+ *
+ * @param userData the pointer given to the writer, passed through unchanged
+ *
+ * @return non-zero to continue writing and zero to abort.
+ */
+typedef int (*SBMLWriterSink_t) (const char *data, size_t length, void *userData);
+
+END_C_DECLS
+LIBSBML_CPP_NAMESPACE_END
+
 
 #ifdef __cplusplus
 
@@ -127,6 +151,43 @@ public:
   bool writeSBML (const SBMLDocument* d, std::ostream& stream);
 
 
+  /**
+   * Writes the given SBMLDocument to a sink callback.
+   *
+   * The output is passed to @p sink in chunks of bounded size as it is
+   * produced, so the whole document is never held in memory by the
+   * writer itself.
+   *
+   * @param d the SBMLDocument to be written
+   *
+   * @param sink the callback receiving each chunk of output
+   *
+   * @param userData an opaque pointer passed on to every call of @p sink
+   *
+   * @return @c true on success and @c false if @p sink aborted the write
+   * or one of the underlying parser components fail (rare).
+   *
+   * @see getSerializedSize(const SBMLDocument* d)
+   */
+  bool writeSBML (const SBMLDocument* d, SBMLWriterSink_t sink,
+                  void* userData);
+
+
+  /**
+   * Returns the number of bytes the given SBMLDocument occupies when
+   * written out.
+   *
+   * The document is serialised without storing the output, so this can be
+   * used to size a buffer before calling one of the writing methods.
+   *
+   * @param d the SBMLDocument to be measured
+   *
+   * @return the size of the output in bytes, excluding any terminating NUL
+   * character, or @c 0 if the document could not be written.
+   */
+  size_t getSerializedSize (const SBMLDocument* d);
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
@@ -200,6 +261,26 @@ public:
    * @see setProgramName(const std::string& name)
    */
   std::string writeSBMLToStdString(const SBMLDocument* d);
+
+
+  /**
+   * Appends the given SBMLDocument to a caller-supplied string.
+   *
+   * Existing content of @p buffer is kept and any capacity already
+   * reserved (for example from getSerializedSize()) is reused, so no
+   * intermediate copy of the document is made.
+   *
+   * @param d the SBMLDocument to be written
+   *
+   * @param buffer the string the output is appended to
+   *
+   * @return @c true on success and @c false if one of the underlying
+   * parser components fail.
+   * 
+   * @see setProgramVersion(const std::string& version)
+   * @see setProgramName(const std::string& name)
+   */
+  bool writeSBMLToStdString(const SBMLDocument* d, std::string& buffer);
 #endif
   
 
@@ -412,6 +493,34 @@ char *
 SBMLWriter_writeSBMLToString (SBMLWriter_t *sw, const SBMLDocument_t *d);
 
 
+/**
+ * Writes the given SBMLDocument to a sink callback, which receives the
+ * output in chunks as it is produced.
+ *
+ * @return non-zero on success and zero if the sink aborted the write or
+ * one of the underlying parser components fail (rare).
+ *
+ * @memberof SBMLWriter_t
+ */
+LIBSBML_EXTERN
+int
+SBMLWriter_writeSBMLToSink ( SBMLWriter_t         *sw,
+                             const SBMLDocument_t *d,
+                             SBMLWriterSink_t     sink,
+                             void                 *userData );
+
+
+/**
+ * Returns the number of bytes the given SBMLDocument occupies when
+ * written out, or zero if it could not be written.
+ *
+ * @memberof SBMLWriter_t
+ */
+LIBSBML_EXTERN
+size_t
+SBMLWriter_getSerializedSize (SBMLWriter_t *sw, const SBMLDocument_t *d);
+
+
 /**
  * Predicate returning @c non-zero or @c zero depending on whether
  * libSBML is linked with zlib at compile time.
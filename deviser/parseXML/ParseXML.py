@@ -928,6 +928,9 @@ class ParseXML():
             lo_class_name = \
                 self.get_loclass_name_value(self, node)
             min_lo_children = self.get_lo_min_children(self, node)
+            lo_id_index = self.get_bool_value(self, node, 'listOfIdIndex')
+            pooled = self.get_bool_value(self, node, 'pooled')
+            lazy_array = self.get_bool_value(self, node, 'lazyArray')
             add_decls = self.get_add_code_value(self, node, 'additionalDecls')
             add_defs = self.get_add_code_value(self, node, 'additionalDefs')
 
@@ -957,6 +960,9 @@ class ParseXML():
                             'lo_elementName': xml_lo_element_name,
                             'lo_class_name': lo_class_name,
                             'min_lo_children': min_lo_children,
+                            'lo_id_index': lo_id_index,
+                            'pooled': pooled,
+                            'lazyArray': lazy_array,
                             'num_versions': self.num_versions,
                             'version': version_count,
                             'childrenOverwriteElementName': children_overwrite
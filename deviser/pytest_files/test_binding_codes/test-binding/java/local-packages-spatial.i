@@ -72,65 +72,53 @@
   {
     if (cPtr == 0) return null;
 
-    SBase sb = new SBase(cPtr, false);
-    switch ( sb.getTypeCode() )
+    switch ( $moduleJNI.SBase_getTypeCode(cPtr, null) )
     {
       case (int) libsbml.SBML_LIST_OF:
-        String name = sb.getElementName();
-        if (name.equals("listOfDomainTypes"))
-        {
-          return new ListOfDomainTypes(cPtr, owner);
-        }
-        else if (name.equals("listOfDomains"))
-        {
-          return new ListOfDomains(cPtr, owner);
-        }
-        else if (name.equals("listOfInteriorPoints"))
-        {
-          return new ListOfInteriorPoints(cPtr, owner);
-        }
-        else if (name.equals("listOfAdjacentDomains"))
-        {
-          return new ListOfAdjacentDomains(cPtr, owner);
-        }
-        else if (name.equals("listOfGeometryDefinitions"))
-        {
-          return new ListOfGeometryDefinitions(cPtr, owner);
-        }
-        else if (name.equals("listOfCoordinateComponents"))
-        {
-          return new ListOfCoordinateComponents(cPtr, owner);
-        }
-        else if (name.equals("listOfSampledFields"))
-        {
-          return new ListOfSampledFields(cPtr, owner);
-        }
-        else if (name.equals("listOfSampledVolumes"))
+        switch ( $moduleJNI.ListOf_getItemTypeCode(cPtr, null) )
         {
-          return new ListOfSampledVolumes(cPtr, owner);
-        }
-        else if (name.equals("listOfAnalyticVolumes"))
-        {
-          return new ListOfAnalyticVolumes(cPtr, owner);
-        }
-        else if (name.equals("listOfParametricObjects"))
-        {
-          return new ListOfParametricObjects(cPtr, owner);
-        }
-        else if (name.equals("listOfCSGObjects"))
-        {
-          return new ListOfCSGObjects(cPtr, owner);
-        }
-        else if (name.equals("listOfCSGNodes"))
-        {
-          return new ListOfCSGNodes(cPtr, owner);
-        }
-        else if (name.equals("listOfOrdinalMappings"))
-        {
-          return new ListOfOrdinalMappings(cPtr, owner);
-        }
+          case (int) libsbml.SBML_SPATIAL_DOMAINTYPE:
+            return new ListOfDomainTypes(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_DOMAIN:
+            return new ListOfDomains(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_INTERIORPOINT:
+            return new ListOfInteriorPoints(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_ADJACENTDOMAINS:
+            return new ListOfAdjacentDomains(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_GEOMETRYDEFINITION:
+            return new ListOfGeometryDefinitions(cPtr, owner);
 
-        return new ListOf(cPtr, owner);
+          case (int) libsbml.SBML_SPATIAL_COORDINATECOMPONENT:
+            return new ListOfCoordinateComponents(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_SAMPLEDFIELD:
+            return new ListOfSampledFields(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_SAMPLEDVOLUME:
+            return new ListOfSampledVolumes(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_ANALYTICVOLUME:
+            return new ListOfAnalyticVolumes(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_PARAMETRICOBJECT:
+            return new ListOfParametricObjects(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_CSGOBJECT:
+            return new ListOfCSGObjects(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_CSGNODE:
+            return new ListOfCSGNodes(cPtr, owner);
+
+          case (int) libsbml.SBML_SPATIAL_ORDINALMAPPING:
+            return new ListOfOrdinalMappings(cPtr, owner);
+
+          default:
+            return new ListOf(cPtr, owner);
+        }
 
       case (int) libsbml.SBML_SPATIAL_DOMAINTYPE:
         return new DomainType(cPtr, owner);
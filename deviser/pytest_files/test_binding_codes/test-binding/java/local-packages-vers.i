@@ -66,21 +66,20 @@
   {
     if (cPtr == 0) return null;
 
-    SBase sb = new SBase(cPtr, false);
-    switch ( sb.getTypeCode() )
+    switch ( $moduleJNI.SBase_getTypeCode(cPtr, null) )
     {
       case (int) libsbml.SBML_LIST_OF:
-        String name = sb.getElementName();
-        if (name.equals("listOfAnothers"))
-        {
-          return new ListOfAnothers(cPtr, owner);
-        }
-        else if (name.equals("listOfClassThrees"))
+        switch ( $moduleJNI.ListOf_getItemTypeCode(cPtr, null) )
         {
-          return new ListOfClassThrees(cPtr, owner);
-        }
+          case (int) libsbml.CLASS_A:
+            return new ListOfAnothers(cPtr, owner);
+
+          case (int) libsbml.CLASS_THREE:
+            return new ListOfClassThrees(cPtr, owner);
 
-        return new ListOf(cPtr, owner);
+          default:
+            return new ListOf(cPtr, owner);
+        }
 
       case (int) libsbml.CLASS_ONE:
         return new ClassOne(cPtr, owner);
@@ -42,61 +42,50 @@ else if (pkgName == "spatial")
   switch ( sb->getTypeCode() )
   {
     case SBML_LIST_OF:
-      name = sb->getElementName();
-      if (name == "listOfDomainTypes")
+      switch ( static_cast<ListOf*>(sb)->getItemTypeCode() )
       {
-        return SWIGTYPE_p_ListOfDomainTypes;
-      }
-      else if (name == "listOfDomains")
-      {
-        return SWIGTYPE_p_ListOfDomains;
-      }
-      else if (name == "listOfInteriorPoints")
-      {
-        return SWIGTYPE_p_ListOfInteriorPoints;
-      }
-      else if (name == "listOfAdjacentDomains")
-      {
-        return SWIGTYPE_p_ListOfAdjacentDomains;
-      }
-      else if (name == "listOfGeometryDefinitions")
-      {
-        return SWIGTYPE_p_ListOfGeometryDefinitions;
-      }
-      else if (name == "listOfCoordinateComponents")
-      {
-        return SWIGTYPE_p_ListOfCoordinateComponents;
-      }
-      else if (name == "listOfSampledFields")
-      {
-        return SWIGTYPE_p_ListOfSampledFields;
-      }
-      else if (name == "listOfSampledVolumes")
-      {
-        return SWIGTYPE_p_ListOfSampledVolumes;
-      }
-      else if (name == "listOfAnalyticVolumes")
-      {
-        return SWIGTYPE_p_ListOfAnalyticVolumes;
-      }
-      else if (name == "listOfParametricObjects")
-      {
-        return SWIGTYPE_p_ListOfParametricObjects;
-      }
-      else if (name == "listOfCSGObjects")
-      {
-        return SWIGTYPE_p_ListOfCSGObjects;
-      }
-      else if (name == "listOfCSGNodes")
-      {
-        return SWIGTYPE_p_ListOfCSGNodes;
-      }
-      else if (name == "listOfOrdinalMappings")
-      {
-        return SWIGTYPE_p_ListOfOrdinalMappings;
-      }
+        case SBML_SPATIAL_DOMAINTYPE:
+          return SWIGTYPE_p_ListOfDomainTypes;
+
+        case SBML_SPATIAL_DOMAIN:
+          return SWIGTYPE_p_ListOfDomains;
+
+        case SBML_SPATIAL_INTERIORPOINT:
+          return SWIGTYPE_p_ListOfInteriorPoints;
+
+        case SBML_SPATIAL_ADJACENTDOMAINS:
+          return SWIGTYPE_p_ListOfAdjacentDomains;
+
+        case SBML_SPATIAL_GEOMETRYDEFINITION:
+          return SWIGTYPE_p_ListOfGeometryDefinitions;
 
-      return SWIGTYPE_p_ListOf;
+        case SBML_SPATIAL_COORDINATECOMPONENT:
+          return SWIGTYPE_p_ListOfCoordinateComponents;
+
+        case SBML_SPATIAL_SAMPLEDFIELD:
+          return SWIGTYPE_p_ListOfSampledFields;
+
+        case SBML_SPATIAL_SAMPLEDVOLUME:
+          return SWIGTYPE_p_ListOfSampledVolumes;
+
+        case SBML_SPATIAL_ANALYTICVOLUME:
+          return SWIGTYPE_p_ListOfAnalyticVolumes;
+
+        case SBML_SPATIAL_PARAMETRICOBJECT:
+          return SWIGTYPE_p_ListOfParametricObjects;
+
+        case SBML_SPATIAL_CSGOBJECT:
+          return SWIGTYPE_p_ListOfCSGObjects;
+
+        case SBML_SPATIAL_CSGNODE:
+          return SWIGTYPE_p_ListOfCSGNodes;
+
+        case SBML_SPATIAL_ORDINALMAPPING:
+          return SWIGTYPE_p_ListOfOrdinalMappings;
+
+        default:
+          return SWIGTYPE_p_ListOf;
+      }
 
     case SBML_SPATIAL_DOMAINTYPE:
       return SWIGTYPE_p_DomainType;
@@ -54,6 +54,30 @@
 
 %template (SpatialPkgNamespaces) SBMLExtensionNamespaces<SpatialExtension>;
 
+%include "std_vector.i"
+%template(SpatialStringStdVector) std::vector<std::string>;
+%template(SpatialIntStdVector) std::vector<int>;
+%template(SpatialBoolStdVector) std::vector<bool>;
+%template(CoordinateKindStdVector) std::vector<CoordinateKind_t>;
+%template(DataKindStdVector) std::vector<DataKind_t>;
+%template(InterpolationKindStdVector) std::vector<InterpolationKind_t>;
+%template(CompressionKindStdVector) std::vector<CompressionKind_t>;
+%template(FunctionKindStdVector) std::vector<FunctionKind_t>;
+%template(PolygonKindStdVector) std::vector<PolygonKind_t>;
+%rename(ListOfDomainTypesColumns) ListOfDomainTypes::Columns;
+%rename(ListOfDomainsColumns) ListOfDomains::Columns;
+%rename(ListOfInteriorPointsColumns) ListOfInteriorPoints::Columns;
+%rename(ListOfAdjacentDomainsColumns) ListOfAdjacentDomains::Columns;
+%rename(ListOfGeometryDefinitionsColumns) ListOfGeometryDefinitions::Columns;
+%rename(ListOfCoordinateComponentsColumns) ListOfCoordinateComponents::Columns;
+%rename(ListOfSampledFieldsColumns) ListOfSampledFields::Columns;
+%rename(ListOfSampledVolumesColumns) ListOfSampledVolumes::Columns;
+%rename(ListOfAnalyticVolumesColumns) ListOfAnalyticVolumes::Columns;
+%rename(ListOfParametricObjectsColumns) ListOfParametricObjects::Columns;
+%rename(ListOfCSGObjectsColumns) ListOfCSGObjects::Columns;
+%rename(ListOfCSGNodesColumns) ListOfCSGNodes::Columns;
+%rename(ListOfOrdinalMappingsColumns) ListOfOrdinalMappings::Columns;
+
 %include <sbml/packages/spatial/extension/SpatialExtension.h>
 %include <sbml/packages/spatial/extension/SpatialModelPlugin.h>
 %include <sbml/packages/spatial/extension/SpatialCompartmentPlugin.h>
@@ -108,5 +132,289 @@
 %include <sbml/packages/spatial/sbml/ListOfCSGNodes.h>
 %include <sbml/packages/spatial/sbml/ListOfOrdinalMappings.h>
 
+#ifdef SWIGPYTHON
+
+%{
+/* keeps the object owning an array alive for as long as a view of it */
+struct SpatialArrayOwner
+{
+  PyObject_HEAD
+  PyObject* owner;
+  void* data;
+  Py_ssize_t length;
+};
+
+static int
+SpatialArrayOwner_getbuffer(PyObject* self, Py_buffer* view, int flags)
+{
+  SpatialArrayOwner* exporter = (SpatialArrayOwner*)(self);
+  return PyBuffer_FillInfo(view, self, exporter->data, exporter->length, 1,
+                           flags);
+}
+
+static void
+SpatialArrayOwner_dealloc(PyObject* self)
+{
+  Py_XDECREF(((SpatialArrayOwner*)(self))->owner);
+  PyObject_Del(self);
+}
+
+static PyBufferProcs SpatialArrayOwner_buffer;
+static PyTypeObject SpatialArrayOwner_type =
+  { PyVarObject_HEAD_INIT(NULL, 0) };
+
+static PyObject*
+newSpatialArrayView(PyObject* owner, const void* data, Py_ssize_t length,
+                    const char* format)
+{
+  if (SpatialArrayOwner_type.tp_name == NULL)
+  {
+    SpatialArrayOwner_buffer.bf_getbuffer = SpatialArrayOwner_getbuffer;
+    SpatialArrayOwner_type.tp_name = "SpatialArrayOwner";
+    SpatialArrayOwner_type.tp_basicsize = sizeof(SpatialArrayOwner);
+    SpatialArrayOwner_type.tp_dealloc = SpatialArrayOwner_dealloc;
+    SpatialArrayOwner_type.tp_flags = Py_TPFLAGS_DEFAULT;
+    SpatialArrayOwner_type.tp_as_buffer = &SpatialArrayOwner_buffer;
+    if (PyType_Ready(&SpatialArrayOwner_type) != 0)
+    {
+      SpatialArrayOwner_type.tp_name = NULL;
+      return NULL;
+    }
+  }
+
+  SpatialArrayOwner* exporter =
+    PyObject_New(SpatialArrayOwner, &SpatialArrayOwner_type);
+  if (exporter == NULL)
+  {
+    return NULL;
+  }
+
+  Py_INCREF(owner);
+  exporter->owner = owner;
+  exporter->data = const_cast<void*>(data);
+  exporter->length = length;
+  PyObject* raw = PyMemoryView_FromObject((PyObject*)(exporter));
+  Py_DECREF(exporter);
+  if (raw == NULL)
+  {
+    return NULL;
+  }
+
+  PyObject* view = PyObject_CallMethod(raw, (char*)"cast", (char*)"s", format);
+  Py_DECREF(raw);
+  return view;
+}
+%}
+
+/**
+ * Buffer protocol access to the "samples" array of SampledField.
+ * The view returned by getSamplesBuffer() is read only, keeps the object alive
+ * and is valid until the array is changed.
+ */
+%extend SampledField
+{
+  PyObject* getSamplesBufferFor(PyObject* owner) const
+  {
+    const int* data = $self->getSamplesPointer();
+    // the view covers the values actually held, whatever the length
+    // attribute says
+    int count = $self->getSamplesCount();
+    if (data == NULL || count <= 0)
+    {
+      Py_RETURN_NONE;
+    }
+
+    Py_ssize_t length = sizeof(int) * (Py_ssize_t)(count);
+    return newSpatialArrayView(owner, data, length, "i");
+  }
+
+  %pythoncode
+  %{
+    def getSamplesBuffer(self):
+      return self.getSamplesBufferFor(self)
+  %}
+
+  int setSamplesFromBuffer(PyObject* buffer)
+  {
+    Py_buffer view;
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(buffer, &view, flags) != 0)
+    {
+      PyErr_Clear();
+      return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    const char* format = view.format + strspn(view.format, "@=");
+    int result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    bool matches = view.itemsize == sizeof(int) && *format != '\0';
+    if (matches && strchr("il", *format) != NULL)
+    {
+      int length = (int)(view.len / sizeof(int));
+      result = $self->setSamples((int*)(view.buf), length);
+    }
+
+    PyBuffer_Release(&view);
+    return result;
+  }
+}
+
+/**
+ * Buffer protocol access to the "pointIndex" array of ParametricObject.
+ * The view returned by getPointIndexBuffer() is read only, keeps the object alive
+ * and is valid until the array is changed.
+ */
+%extend ParametricObject
+{
+  PyObject* getPointIndexBufferFor(PyObject* owner) const
+  {
+    const int* data = $self->getPointIndexPointer();
+    // the view covers the values actually held, whatever the length
+    // attribute says
+    int count = $self->getPointIndexCount();
+    if (data == NULL || count <= 0)
+    {
+      Py_RETURN_NONE;
+    }
+
+    Py_ssize_t length = sizeof(int) * (Py_ssize_t)(count);
+    return newSpatialArrayView(owner, data, length, "i");
+  }
+
+  %pythoncode
+  %{
+    def getPointIndexBuffer(self):
+      return self.getPointIndexBufferFor(self)
+  %}
+
+  int setPointIndexFromBuffer(PyObject* buffer)
+  {
+    Py_buffer view;
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(buffer, &view, flags) != 0)
+    {
+      PyErr_Clear();
+      return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    const char* format = view.format + strspn(view.format, "@=");
+    int result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    bool matches = view.itemsize == sizeof(int) && *format != '\0';
+    if (matches && strchr("il", *format) != NULL)
+    {
+      int length = (int)(view.len / sizeof(int));
+      result = $self->setPointIndex((int*)(view.buf), length);
+    }
+
+    PyBuffer_Release(&view);
+    return result;
+  }
+}
+
+/**
+ * Buffer protocol access to the "components" array of TransformationComponent.
+ * The view returned by getComponentsBuffer() is read only, keeps the object alive
+ * and is valid until the array is changed.
+ */
+%extend TransformationComponent
+{
+  PyObject* getComponentsBufferFor(PyObject* owner) const
+  {
+    const double* data = $self->getComponentsPointer();
+    // the view covers the values actually held, whatever the length
+    // attribute says
+    int count = $self->getComponentsCount();
+    if (data == NULL || count <= 0)
+    {
+      Py_RETURN_NONE;
+    }
+
+    Py_ssize_t length = sizeof(double) * (Py_ssize_t)(count);
+    return newSpatialArrayView(owner, data, length, "d");
+  }
+
+  %pythoncode
+  %{
+    def getComponentsBuffer(self):
+      return self.getComponentsBufferFor(self)
+  %}
+
+  int setComponentsFromBuffer(PyObject* buffer)
+  {
+    Py_buffer view;
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(buffer, &view, flags) != 0)
+    {
+      PyErr_Clear();
+      return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    const char* format = view.format + strspn(view.format, "@=");
+    int result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    bool matches = view.itemsize == sizeof(double) && *format != '\0';
+    if (matches && strchr("d", *format) != NULL)
+    {
+      int length = (int)(view.len / sizeof(double));
+      result = $self->setComponents((double*)(view.buf), length);
+    }
+
+    PyBuffer_Release(&view);
+    return result;
+  }
+}
+
+/**
+ * Buffer protocol access to the "arrayData" array of SpatialPoints.
+ * The view returned by getArrayDataBuffer() is read only, keeps the object alive
+ * and is valid until the array is changed.
+ */
+%extend SpatialPoints
+{
+  PyObject* getArrayDataBufferFor(PyObject* owner) const
+  {
+    const double* data = $self->getArrayDataPointer();
+    // the view covers the values actually held, whatever the length
+    // attribute says
+    int count = $self->getArrayDataCount();
+    if (data == NULL || count <= 0)
+    {
+      Py_RETURN_NONE;
+    }
+
+    Py_ssize_t length = sizeof(double) * (Py_ssize_t)(count);
+    return newSpatialArrayView(owner, data, length, "d");
+  }
+
+  %pythoncode
+  %{
+    def getArrayDataBuffer(self):
+      return self.getArrayDataBufferFor(self)
+  %}
+
+  int setArrayDataFromBuffer(PyObject* buffer)
+  {
+    Py_buffer view;
+    int flags = PyBUF_C_CONTIGUOUS | PyBUF_FORMAT;
+    if (PyObject_GetBuffer(buffer, &view, flags) != 0)
+    {
+      PyErr_Clear();
+      return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    const char* format = view.format + strspn(view.format, "@=");
+    int result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    bool matches = view.itemsize == sizeof(double) && *format != '\0';
+    if (matches && strchr("d", *format) != NULL)
+    {
+      int length = (int)(view.len / sizeof(double));
+      result = $self->setArrayData((double*)(view.buf), length);
+    }
+
+    PyBuffer_Release(&view);
+    return result;
+  }
+}
+
+#endif /* SWIGPYTHON */
+
 #endif /* USE_SPATIAL */
 
@@ -78,6 +78,26 @@ def generate_cmake_example_files(filename, name):
     os.chdir(os.path.normpath('../../../../.'))
 
 
+def generate_cmake_benchmark_files(filename):
+    """
+    Generic set-up code used by the test wrapper function.
+    Parse XML file and use the big dictionary structure obtained to
+    generate the CMake file building the validator benchmark.
+
+    :param filename: the XML file to parse
+    :return: nothing
+    """
+    parser = ParseXML.ParseXML(filename)
+    ob = parser.parse_deviser_xml()
+    os.chdir(os.path.normpath('./temp'))
+    if not os.path.exists('validator'):
+        os.mkdir('validator')
+    os.chdir('validator')
+    all_files = CMakeFiles.CMakeFiles(ob, os.getcwd(), True)
+    all_files.write_validator_test_files()
+    os.chdir(os.path.normpath('../../.'))
+
+
 #############################################################################
 # Specific compare functions
 
@@ -154,6 +174,16 @@ def compare_examples(name):
     temp_file = os.path.normpath('./temp/examples/c++/{0}/{0}_example1.cpp'.format(name))
     return compare_files(correct_file, temp_file)
 
+def compare_cmake_benchmark():
+    """
+    Compare two CMake files building the validator benchmark.
+
+    :return: 0 on success, or file not present; 1 on failure.
+    """
+    correct_file = os.path.normpath('./test-cmake/validator/CMakeLists.txt')
+    temp_file = os.path.normpath('./temp/validator/CMakeLists.txt')
+    return compare_files(correct_file, temp_file)
+
 #############################################################################
 # Specific test functions
 
@@ -204,3 +234,17 @@ def run_example_test(name):
     return fail
 
 
+def run_benchmark_test(name):
+    """
+    CMake validator benchmark test.
+
+    :param name: stub of XML filename, e.g. 'dyn' for filename 'dyn.xml'
+    :return: 0 if all comparisons succeed, else number of failures.
+    """
+    filename = functions.set_up_test(name, 'CMake', 'benchmark')
+    generate_cmake_benchmark_files(filename)
+    fail = compare_cmake_benchmark()
+    print('')
+    return fail
+
+
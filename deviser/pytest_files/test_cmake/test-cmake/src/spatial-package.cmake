@@ -74,8 +74,7 @@ SET(LIBSBML_SOURCES ${LIBSBML_SOURCES} ${SPATIAL_SOURCES})
  # add test scripts
  #
 if (WITH_CHECK)
-
-
+  add_subdirectory(sbml/packages/spatial/validator/test)
 endif()
 
 endif()
@@ -31,6 +31,7 @@ def teardown():
     ('spatial', 'run_register_test'),
     ('spatial', 'run_example_test'),
     ('groups', 'run_example_test'),
+    ('spatial', 'run_benchmark_test'),
 ])
 def test_all(name, funcname):
     """
@@ -45,6 +46,7 @@ def test_all(name, funcname):
               'run_cmake_test': rct.run_cmake_test,
               'run_register_test': rct.run_register_test,
               'run_example_test': rct.run_example_test,
+              'run_benchmark_test': rct.run_benchmark_test,
               }
     myfunc = mydict[funcname]
     assert myfunc(name) == 0
@@ -357,10 +357,11 @@ Abc::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "letter")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getLetter();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -380,9 +381,11 @@ Abc::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "letter")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetLetter();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -470,9 +473,11 @@ Abc::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "letter")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setLetter(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -492,9 +497,11 @@ Abc::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "letter")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetLetter();
+    value = unsetAttribute(attributeId);
   }
 
   return value;
@@ -504,6 +511,276 @@ Abc::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Abc.
+ */
+int
+Abc::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "letter" };
+
+  for (int i = ATTR_LETTER; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_LETTER])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_LETTER:
+    value = getLetter();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Abc is set.
+ */
+bool
+Abc::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_LETTER:
+    return isSetLetter();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_LETTER:
+    return setLetter(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Abc.
+ */
+int
+Abc::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_LETTER:
+    return unsetLetter();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Abc::forEachElement(bool (*action)(SBase*, void*),
+                    void* userData,
+                    ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -537,27 +814,30 @@ Abc::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("copy", CopyAbcAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(CopyAbcAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "copy",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("copy", CopyAbcAllowedCoreAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(CopyAbcAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "copy", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -270,6 +270,21 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Identifiers for the attributes of this Abc, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_LETTER = 0,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
@@ -500,10 +515,285 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this Abc.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this Abc is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this Abc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
 
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
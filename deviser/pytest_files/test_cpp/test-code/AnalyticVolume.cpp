@@ -288,7 +288,8 @@ AnalyticVolume::setFunctionType(const FunctionKind_t functionType)
 int
 AnalyticVolume::setFunctionType(const std::string& functionType)
 {
-  mFunctionType = FunctionKind_fromString(functionType.c_str());
+  mFunctionType = FunctionKind_fromStringWithLength(functionType.c_str(),
+    functionType.size());
 
   if (mFunctionType == SPATIAL_FUNCTIONKIND_INVALID)
   {
@@ -678,10 +679,11 @@ AnalyticVolume::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "ordinal")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getOrdinal();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -743,20 +745,11 @@ AnalyticVolume::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "functionType")
-  {
-    value = getFunctionTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "domainType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getDomainType();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -777,21 +770,11 @@ AnalyticVolume::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "functionType")
-  {
-    value = isSetFunctionType();
-  }
-  else if (attributeName == "ordinal")
-  {
-    value = isSetOrdinal();
-  }
-  else if (attributeName == "domainType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetDomainType();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -828,9 +811,11 @@ AnalyticVolume::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "ordinal")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setOrdinal(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -886,17 +871,11 @@ AnalyticVolume::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "functionType")
-  {
-    return_value = setFunctionType(value);
-  }
-  else if (attributeName == "domainType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setDomainType(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -916,30 +895,342 @@ AnalyticVolume::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "functionType")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "functionType", "ordinal",
+    "domainType" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetFunctionType();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "ordinal")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetOrdinal();
+  case ATTR_ORDINAL:
+    value = getOrdinal();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "domainType")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetDomainType();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FUNCTION_TYPE:
+    value = getFunctionTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_DOMAIN_TYPE:
+    value = getDomainType();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this AnalyticVolume is set.
+ */
+bool
+AnalyticVolume::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_FUNCTION_TYPE:
+    return isSetFunctionType();
+  case ATTR_ORDINAL:
+    return isSetOrdinal();
+  case ATTR_DOMAIN_TYPE:
+    return isSetDomainType();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ORDINAL:
+    return setOrdinal(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_FUNCTION_TYPE:
+    return setFunctionType(value);
+  case ATTR_DOMAIN_TYPE:
+    return setDomainType(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * AnalyticVolume.
+ */
+int
+AnalyticVolume::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_FUNCTION_TYPE:
+    return unsetFunctionType();
+  case ATTR_ORDINAL:
+    return unsetOrdinal();
+  case ATTR_DOMAIN_TYPE:
+    return unsetDomainType();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+AnalyticVolume::forEachElement(bool (*action)(SBase*, void*),
+                               void* userData,
+                               ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -988,44 +1279,46 @@ AnalyticVolume::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialAnalyticGeometryLOAnalyticVolumesAllowedAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialAnalyticGeometryLOAnalyticVolumesAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialAnalyticGeometryLOAnalyticVolumesAllowedCoreAttributes,
-            pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialAnalyticGeometryLOAnalyticVolumesAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialAnalyticVolumeAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialAnalyticVolumeAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialAnalyticVolumeAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialAnalyticVolumeAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1075,7 +1368,8 @@ AnalyticVolume::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mFunctionType = FunctionKind_fromString(functionType.c_str());
+      mFunctionType = FunctionKind_fromStringWithLength(functionType.c_str(),
+        functionType.size());
 
       if (log && FunctionKind_isValid(mFunctionType) == 0)
       {
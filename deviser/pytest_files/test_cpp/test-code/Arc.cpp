@@ -65,7 +65,6 @@ Arc::Arc(unsigned int level, unsigned int version)
   , mEnd (NULL)
   , mPorts (level, version)
 {
-  setSbgnNamespacesAndOwn(new SbgnNamespaces(level, version));
   mPoints.setElementName("next");
   connectToChild();
 }
@@ -275,6 +274,7 @@ Arc::setId(const std::string& id)
   }
   else
   {
+    updateDocumentSIdIndex(mId, id);
     mId = id;
     return LIBSBGN_OPERATION_SUCCESS;
   }
@@ -334,6 +334,7 @@ Arc::setTarget(const std::string& target)
 int
 Arc::unsetId()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -476,12 +477,14 @@ Arc::setStart(const Point* start)
   }
   else if (start == NULL)
   {
+    invalidateDocumentIdIndex();
     delete mStart;
     mStart = NULL;
     return LIBSBGN_OPERATION_SUCCESS;
   }
   else
   {
+    invalidateDocumentIdIndex();
     delete mStart;
     mStart = (start != NULL) ? start->clone() : NULL;
     if (mStart != NULL)
@@ -507,12 +510,14 @@ Arc::setEnd(const Point* end)
   }
   else if (end == NULL)
   {
+    invalidateDocumentIdIndex();
     delete mEnd;
     mEnd = NULL;
     return LIBSBGN_OPERATION_SUCCESS;
   }
   else
   {
+    invalidateDocumentIdIndex();
     delete mEnd;
     mEnd = (end != NULL) ? end->clone() : NULL;
     if (mEnd != NULL)
@@ -576,6 +581,7 @@ Arc::createEnd()
 int
 Arc::unsetStart()
 {
+  invalidateDocumentIdIndex();
   delete mStart;
   mStart = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -588,6 +594,7 @@ Arc::unsetStart()
 int
 Arc::unsetEnd()
 {
+  invalidateDocumentIdIndex();
   delete mEnd;
   mEnd = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -1303,25 +1310,11 @@ Arc::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "class")
-  {
-    value = getClazz();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "source")
-  {
-    value = getSource();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "target")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getTarget();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1341,21 +1334,11 @@ Arc::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "class")
-  {
-    value = isSetClazz();
-  }
-  else if (attributeName == "source")
-  {
-    value = isSetSource();
-  }
-  else if (attributeName == "target")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetTarget();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1443,21 +1426,11 @@ Arc::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "class")
-  {
-    return_value = setClazz(value);
-  }
-  else if (attributeName == "source")
-  {
-    return_value = setSource(value);
-  }
-  else if (attributeName == "target")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setTarget(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1477,24 +1450,280 @@ Arc::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "class")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Arc.
+ */
+int
+Arc::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "class", "source", "target" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetClazz();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "source")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetSource();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_CLAZZ:
+    value = getClazz();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_SOURCE:
+    value = getSource();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_TARGET:
+    value = getTarget();
+    return LIBSBGN_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "target")
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Arc is set.
+ */
+bool
+Arc::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetTarget();
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_CLAZZ:
+    return isSetClazz();
+  case ATTR_SOURCE:
+    return isSetSource();
+  case ATTR_TARGET:
+    return isSetTarget();
+  default:
+    break;
   }
 
-  return value;
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::setAttribute(int attributeId, bool value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::setAttribute(int attributeId, int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::setAttribute(int attributeId, double value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_CLAZZ:
+    return setClazz(value);
+  case ATTR_SOURCE:
+    return setSource(value);
+  case ATTR_TARGET:
+    return setTarget(value);
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Arc.
+ */
+int
+Arc::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_CLAZZ:
+    return unsetClazz();
+  case ATTR_SOURCE:
+    return unsetSource();
+  case ATTR_TARGET:
+    return unsetTarget();
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1780,6 +2009,17 @@ Arc::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SbgnBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SbgnBase objects, including those nested to an
  * arbitrary depth.
@@ -1788,16 +2028,90 @@ List*
 Arc::getAllElements(SbgnElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_SBGN_FILTERED_POINTER(ret, sublist, mStart, filter);
-  ADD_SBGN_FILTERED_POINTER(ret, sublist, mEnd, filter);
 
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mGlyphs, filter);
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mPoints, filter);
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mPorts, filter);
+/*
+ * Calls @p action on each child SbgnBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Arc::forEachElement(bool (*action)(SbgnBase*, void*),
+                    void* userData,
+                    SbgnElementFilter* filter)
+{
+  if (mStart != NULL)
+  {
+    if ((filter == NULL || filter->filter(mStart)) && !action(mStart,
+      userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mStart->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mEnd != NULL)
+  {
+    if ((filter == NULL || filter->filter(mEnd)) && !action(mEnd, userData))
+    {
+      return false;
+    }
+
+    if (!mEnd->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mGlyphs.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mGlyphs)) && !action(&mGlyphs,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mGlyphs.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mPoints.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mPoints)) && !action(&mPoints,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mPoints.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mPorts.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mPorts)) && !action(&mPorts,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mPorts.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1909,27 +2223,26 @@ Arc::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlMapLOArcsAllowedCoreAttributes, level, version,
-          details, getLine(), getColumn());
+        log->replaceError(n, SbgnmlMapLOArcsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn());
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlArcAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, SbgnmlArcAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
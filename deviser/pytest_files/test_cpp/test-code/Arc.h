@@ -1096,6 +1096,24 @@ public:
 
 
 
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Identifiers for the attributes of this Arc, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_ID = 0,
+    ATTR_CLAZZ,
+    ATTR_SOURCE,
+    ATTR_TARGET,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
   /** @cond doxygenlibSBGNInternal */
 
   /**
@@ -1326,6 +1344,259 @@ public:
 
 
 
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this Arc.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this Arc is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibSBGNInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this Arc.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenlibSBGNInternal */
 
   /**
@@ -1443,6 +1714,27 @@ public:
   virtual List* getAllElements(SbgnElementFilter * filter = NULL);
 
 
+  /**
+   * Calls @p action on each child SbgnBase object, including those nested to
+   * an arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory.
+   */
+  virtual bool forEachElement(bool (*action)(SbgnBase*, void*),
+                              void* userData,
+                              SbgnElementFilter * filter = NULL);
+
+
 protected:
 
 
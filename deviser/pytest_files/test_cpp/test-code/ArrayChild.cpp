@@ -37,6 +37,13 @@
 #include <sbml/packages/test/sbml/ArrayChild.h>
 #include <sbml/packages/test/validator/TestSBMLError.h>
 #include <sbml/util/ElementFilter.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 
 using namespace std;
@@ -61,6 +68,7 @@ ArrayChild::ArrayChild(unsigned int level,
   : SBase(level, version)
   , mUnit (NULL)
   , mNumber (NULL)
+  , mNumberCount (0)
 {
   setSBMLNamespacesAndOwn(new TestPkgNamespaces(level, version, pkgVersion));
   connectToChild();
@@ -74,6 +82,7 @@ ArrayChild::ArrayChild(TestPkgNamespaces *testns)
   : SBase(testns)
   , mUnit (NULL)
   , mNumber (NULL)
+  , mNumberCount (0)
 {
   setElementNamespace(testns->getURI());
   connectToChild();
@@ -88,8 +97,11 @@ ArrayChild::ArrayChild(const ArrayChild& orig)
   : SBase( orig )
   , mUnit ( NULL )
   , mNumber ( NULL )
+  , mNumberCount ( 0 )
 {
-  setNumber(orig.mNumber, orig.mNumberLength);
+  setNumber(orig.mNumber, orig.mNumberCount);
+  mNumberLength = orig.mNumberLength;
+  mIsSetNumberLength = orig.mIsSetNumberLength;
 
   if (orig.mUnit != NULL)
   {
@@ -109,8 +121,8 @@ ArrayChild::operator=(const ArrayChild& rhs)
   if (&rhs != this)
   {
     SBase::operator=(rhs);
-    mNumber = NULL;
-    setNumber(rhs.mNumber, rhs.mNumberLength);
+    unsetNumber();
+    setNumber(rhs.mNumber, rhs.mNumberCount);
     delete mUnit;
     if (rhs.mUnit != NULL)
     {
@@ -166,7 +178,38 @@ ArrayChild::getNumber(double* outArray) const
     return;
   }
 
-  memcpy(outArray, mNumber, sizeof(double)*mNumberLength);
+  int count = mNumberCount;
+
+  if (mNumberLength < count)
+  {
+    count = mNumberLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mNumber, sizeof(double)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "number" attribute of this ArrayChild.
+ */
+const double*
+ArrayChild::getNumberPointer() const
+{
+  return mNumber;
+}
+
+
+/*
+ * Returns the number of values held by the "number" attribute of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getNumberCount() const
+{
+  return mNumberCount;
 }
 
 
@@ -198,6 +241,33 @@ ArrayChild::setNumber(double* inArray, int arrayLength)
 
   mNumber = new double[arrayLength];
   memcpy(mNumber, inArray, sizeof(double)*arrayLength);
+  mNumberCount = arrayLength;
+  mIsSetNumberLength = true;
+  mNumberLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "number" attribute of this ArrayChild by taking
+ * ownership of the given array.
+ */
+int
+ArrayChild::adoptNumber(double* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (mNumber != NULL && mNumber != inArray)
+  {
+    delete[] mNumber;
+  }
+
+  mNumber = inArray;
+  mNumberCount = arrayLength;
   mIsSetNumberLength = true;
   mNumberLength = arrayLength;
 
@@ -205,6 +275,21 @@ ArrayChild::setNumber(double* inArray, int arrayLength)
 }
 
 
+/*
+ * Releases the value of the "number" attribute of this ArrayChild to the
+ * caller.
+ */
+double*
+ArrayChild::releaseNumber()
+{
+  double* array = mNumber;
+  mNumber = NULL;
+  mNumberCount = 0;
+  unsetNumberLength();
+  return array;
+}
+
+
 /*
  * Unsets the value of the "number" attribute of this ArrayChild.
  */
@@ -217,6 +302,7 @@ ArrayChild::unsetNumber()
   }
 
   mNumber = NULL;
+  mNumberCount = 0;
 
   return unsetNumberLength();
 }
@@ -430,10 +516,64 @@ ArrayChild::write(XMLOutputStream& stream) const
 
   if (isSetNumber())
   {
-    for (int i = 0; i < mNumberLength; ++i)
+    // values are formatted straight into a chunk that is written
+    // when full, without a stream for each value
+
+    char chunk[65536 + 32];
+    size_t used = 0;
+    char point = *localeconv()->decimal_point;
+
+    for (int i = 0; i < mNumberCount; ++i)
     {
-      stream << (double)mNumber[i] << " ";
+      double val = (double)mNumber[i];
+
+      if (val != val)
+      {
+        memcpy(chunk + used, "NaN ", 4);
+        used += 4;
+      }
+      else if (val - val != 0 && val > 0)
+      {
+        memcpy(chunk + used, "INF ", 4);
+        used += 4;
+      }
+      else if (val - val != 0)
+      {
+        memcpy(chunk + used, "-INF ", 5);
+        used += 5;
+      }
+      else
+      {
+        int n = sprintf(chunk + used, "%.15g", val);
+
+        if (strtod(chunk + used, NULL) != val)
+        {
+          n = sprintf(chunk + used, "%.17g", val);
+        }
+
+        if (point != '.')
+        {
+          for (int j = 0; j < n; ++j)
+          {
+            if (chunk[used + j] == point)
+            {
+              chunk[used + j] = '.';
+            }
+          }
+        }
+
+        used += n;
+        chunk[used++] = ' ';
+      }
+
+      if (used >= 65536)
+      {
+        stream << std::string(chunk, used);
+        used = 0;
+      }
     }
+
+    stream << std::string(chunk, used);
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -606,9 +746,11 @@ ArrayChild::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "number")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetNumber();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -714,9 +856,11 @@ ArrayChild::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "number")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetNumber();
+    value = unsetAttribute(attributeId);
   }
 
   return value;
@@ -726,6 +870,239 @@ ArrayChild::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this ArrayChild.
+ */
+int
+ArrayChild::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "number" };
+
+  for (int i = ATTR_NUMBER; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_NUMBER])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ArrayChild is set.
+ */
+bool
+ArrayChild::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_NUMBER:
+    return isSetNumber();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ArrayChild.
+ */
+int
+ArrayChild::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_NUMBER:
+    return unsetNumber();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -902,6 +1279,17 @@ ArrayChild::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -910,14 +1298,52 @@ List*
 ArrayChild::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ArrayChild::forEachElement(bool (*action)(SBase*, void*),
+                           void* userData,
+                           ElementFilter* filter)
+{
+  if (mUnit != NULL)
+  {
+    if ((filter == NULL || filter->filter(mUnit)) && !action(mUnit, userData))
+    {
+      return false;
+    }
+
+    if (!mUnit->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_FILTERED_POINTER(ret, sublist, mUnit, filter);
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    delete sublist;
 
-  return ret;
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -992,27 +1418,30 @@ ArrayChild::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("test", TestArrayChildAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestArrayChildAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("test", TestArrayChildAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestArrayChildAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1047,28 +1476,78 @@ ArrayChild::writeAttributes(XMLOutputStream& stream) const
 void
 ArrayChild::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  double val;
-  vector<double> valuesVector;
+  unsigned int capacity = 0;
+  unsigned int length = 0;
+  bool inValue = false;
+
+  // count the values so the array is only allocated once
 
-  while (strStream >> val)
+  for (const char* c = text.c_str(); *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
+    if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+    {
+      inValue = false;
+    }
+    else if (inValue == false)
+    {
+      inValue = true;
+      capacity++;
+    }
   }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+  if (capacity == 0)
+  {
+    return;
+  }
 
-  if (length > 0)
+  // the classic locale reads the same numbers whatever the global locale is
+
+  std::istringstream parser(text);
+  std::istringstream number;
+  parser.imbue(std::locale::classic());
+  number.imbue(std::locale::classic());
+  std::string word;
+  double* data = new double[capacity];
+
+  while (length < capacity && parser >> word)
   {
-    double* data = new double[length];
-    for (unsigned int i = 0; i < length; ++i)
+    double val = 0;
+
+    if (word == "NaN")
+    {
+      val = std::numeric_limits<double>::quiet_NaN();
+    }
+    else if (word == "INF")
     {
-      data[i] = valuesVector.at(i);
+      val = std::numeric_limits<double>::infinity();
     }
+    else if (word == "-INF")
+    {
+      val = -std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+      number.clear();
+      number.str(word);
+      number >> val;
 
-    setNumber(data, length);
+      if (number.fail() || number.peek() != EOF)
+      {
+        break;
+      }
+    }
+
+    data[length++] = (double)(val);
+  }
+
+  if (length == 0)
+  {
     delete[] data;
   }
+  else
+  {
+    adoptNumber(data, length);
+  }
 }
 
 /** @endcond */
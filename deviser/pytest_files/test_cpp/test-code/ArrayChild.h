@@ -70,6 +70,7 @@ protected:
 
   Unit* mUnit;
   double* mNumber;
+  int mNumberCount;
 
   /** @endcond */
 
@@ -145,11 +146,37 @@ public:
    * "number" attribute of this ArrayChild.
    *
    * @note the value of the "number" attribute of this ArrayChild is returned
-   * in the argument array.
+   * in the argument array; no more than getNumberLength() values are copied.
    */
   void getNumber(double* outArray) const;
 
 
+  /**
+   * Returns a pointer to the value of the "number" attribute of this
+   * ArrayChild.
+   *
+   * @return a pointer to the array held by this ArrayChild, or @c NULL if it
+   * is not set.
+   *
+   * @note the array is not copied; it has getNumberCount() entries and remains
+   * owned by this ArrayChild.
+   */
+  const double* getNumberPointer() const;
+
+
+  /**
+   * Returns the number of values held by the "number" attribute of this
+   * ArrayChild.
+   *
+   * @return the number of values in the array returned by getNumberPointer(),
+   * or @c 0 if it is not set.
+   *
+   * @note this is the size of the array itself, which the "numberLength"
+   * attribute need not match.
+   */
+  int getNumberCount() const;
+
+
   /**
    * Predicate returning @c true if this ArrayChild's "number" attribute is
    * set.
@@ -176,6 +203,38 @@ public:
   int setNumber(double* inArray, int arrayLength);
 
 
+  /**
+   * Sets the value of the "number" attribute of this ArrayChild by taking
+   * ownership of the given array.
+   *
+   * @param inArray double* array allocated with new[].
+   *
+   * @param arrayLength int value for the length of the "number" attribute to
+   * be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * @note the array is not copied; this ArrayChild deletes it when it is no
+   * longer needed.
+   */
+  int adoptNumber(double* inArray, int arrayLength);
+
+
+  /**
+   * Releases the value of the "number" attribute of this ArrayChild to the
+   * caller.
+   *
+   * @return the array held by this ArrayChild, or @c NULL if it is not set.
+   *
+   * @note the caller owns the returned array and must delete[] it; the
+   * attribute is unset.
+   */
+  double* releaseNumber();
+
+
   /**
    * Unsets the value of the "number" attribute of this ArrayChild.
    *
@@ -366,6 +425,21 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Identifiers for the attributes of this ArrayChild, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_NUMBER = 0,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
@@ -596,6 +670,271 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this
+   * ArrayChild.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this ArrayChild is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this
+   * ArrayChild.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
@@ -725,6 +1064,28 @@ public:
   virtual List* getAllElements(ElementFilter * filter = NULL);
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
@@ -466,6 +466,244 @@ Association::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Association.
+ */
+int
+Association::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Association is set.
+ */
+bool
+Association::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * Association.
+ */
+int
+Association::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Association::forEachElement(bool (*action)(SBase*, void*),
+                            void* userData,
+                            ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 
 #endif /* __cplusplus */
 
@@ -567,10 +567,11 @@ BBB::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -590,9 +591,11 @@ BBB::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetId();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -680,9 +683,11 @@ BBB::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -702,9 +707,11 @@ BBB::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
 
   return value;
@@ -714,6 +721,245 @@ BBB::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this BBB.
+ */
+int
+BBB::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this BBB is set.
+ */
+bool
+BBB::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this BBB.
+ */
+int
+BBB::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -875,6 +1121,17 @@ BBB::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -883,14 +1140,53 @@ List*
 BBB::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mAnothers, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+BBB::forEachElement(bool (*action)(SBase*, void*),
+                    void* userData,
+                    ElementFilter* filter)
+{
+  if (mAnothers.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mAnothers)) && !action(&mAnothers,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mAnothers.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -973,27 +1269,30 @@ BBB::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("vers", VersBBBAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersBBBAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "vers",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("vers", VersBBBAllowedCoreAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersBBBAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
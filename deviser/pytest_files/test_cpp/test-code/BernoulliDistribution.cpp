@@ -663,6 +663,215 @@ BernoulliDistribution::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::lookupAttribute(const std::string& attributeName)
+{
+  return CategoricalUnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::getAttribute(int attributeId, bool& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::getAttribute(int attributeId, int& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::getAttribute(int attributeId, double& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::getAttribute(int attributeId,
+                                    unsigned int& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::getAttribute(int attributeId, std::string& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this BernoulliDistribution is set.
+ */
+bool
+BernoulliDistribution::isSetAttribute(int attributeId) const
+{
+  return CategoricalUnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::setAttribute(int attributeId, bool value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::setAttribute(int attributeId, int value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::setAttribute(int attributeId, double value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::setAttribute(int attributeId, unsigned int value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::setAttribute(int attributeId, const std::string& value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * BernoulliDistribution.
+ */
+int
+BernoulliDistribution::unsetAttribute(int attributeId)
+{
+  return CategoricalUnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -842,6 +1051,17 @@ BernoulliDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -850,14 +1070,52 @@ List*
 BernoulliDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mProb, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+BernoulliDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                      void* userData,
+                                      ElementFilter* filter)
+{
+  if (mProb != NULL)
+  {
+    if ((filter == NULL || filter->filter(mProb)) && !action(mProb, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mProb->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -934,6 +1192,7 @@ BernoulliDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   CategoricalUnivariateDistribution::readAttributes(attributes,
     expectedAttributes);
 
@@ -941,23 +1200,23 @@ BernoulliDistribution::readAttributes(const XMLAttributes& attributes,
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribBernoulliDistributionAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribBernoulliDistributionAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribBernoulliDistributionAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribBernoulliDistributionAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
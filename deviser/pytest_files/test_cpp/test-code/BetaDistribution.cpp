@@ -801,6 +801,214 @@ BetaDistribution::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::lookupAttribute(const std::string& attributeName)
+{
+  return ContinuousUnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::getAttribute(int attributeId, bool& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::getAttribute(int attributeId, int& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::getAttribute(int attributeId, double& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::getAttribute(int attributeId, unsigned int& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::getAttribute(int attributeId, std::string& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this BetaDistribution is set.
+ */
+bool
+BetaDistribution::isSetAttribute(int attributeId) const
+{
+  return ContinuousUnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::setAttribute(int attributeId, bool value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::setAttribute(int attributeId, int value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::setAttribute(int attributeId, double value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::setAttribute(int attributeId, unsigned int value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::setAttribute(int attributeId, const std::string& value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * BetaDistribution.
+ */
+int
+BetaDistribution::unsetAttribute(int attributeId)
+{
+  return ContinuousUnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1032,6 +1240,17 @@ BetaDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1040,15 +1259,66 @@ List*
 BetaDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+BetaDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                 void* userData,
+                                 ElementFilter* filter)
+{
+  if (mAlpha != NULL)
+  {
+    if ((filter == NULL || filter->filter(mAlpha)) && !action(mAlpha,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mAlpha->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mBeta != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBeta)) && !action(mBeta, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mAlpha, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mBeta, filter);
+    if (!mBeta->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1138,6 +1408,7 @@ BetaDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   ContinuousUnivariateDistribution::readAttributes(attributes,
     expectedAttributes);
 
@@ -1145,23 +1416,23 @@ BetaDistribution::readAttributes(const XMLAttributes& attributes,
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribBetaDistributionAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(DistribBetaDistributionAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribBetaDistributionAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribBetaDistributionAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
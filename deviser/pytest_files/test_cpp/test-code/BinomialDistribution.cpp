@@ -825,6 +825,214 @@ BinomialDistribution::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::lookupAttribute(const std::string& attributeName)
+{
+  return DiscreteUnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::getAttribute(int attributeId, bool& value) const
+{
+  return DiscreteUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::getAttribute(int attributeId, int& value) const
+{
+  return DiscreteUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::getAttribute(int attributeId, double& value) const
+{
+  return DiscreteUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::getAttribute(int attributeId, unsigned int& value) const
+{
+  return DiscreteUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::getAttribute(int attributeId, std::string& value) const
+{
+  return DiscreteUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this BinomialDistribution is set.
+ */
+bool
+BinomialDistribution::isSetAttribute(int attributeId) const
+{
+  return DiscreteUnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::setAttribute(int attributeId, bool value)
+{
+  return DiscreteUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::setAttribute(int attributeId, int value)
+{
+  return DiscreteUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::setAttribute(int attributeId, double value)
+{
+  return DiscreteUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::setAttribute(int attributeId, unsigned int value)
+{
+  return DiscreteUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::setAttribute(int attributeId, const std::string& value)
+{
+  return DiscreteUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * BinomialDistribution.
+ */
+int
+BinomialDistribution::unsetAttribute(int attributeId)
+{
+  return DiscreteUnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1057,6 +1265,17 @@ BinomialDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1065,15 +1284,67 @@ List*
 BinomialDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+BinomialDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                     void* userData,
+                                     ElementFilter* filter)
+{
+  if (mNumberOfTrials != NULL)
+  {
+    if ((filter == NULL || filter->filter(mNumberOfTrials)) &&
+      !action(mNumberOfTrials, userData))
+    {
+      return false;
+    }
+
+    if (!mNumberOfTrials->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mProbabilityOfSuccess != NULL)
+  {
+    if ((filter == NULL || filter->filter(mProbabilityOfSuccess)) &&
+      !action(mProbabilityOfSuccess, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mNumberOfTrials, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mProbabilityOfSuccess, filter);
+    if (!mProbabilityOfSuccess->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1164,6 +1435,7 @@ BinomialDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   DiscreteUnivariateDistribution::readAttributes(attributes,
     expectedAttributes);
 
@@ -1171,23 +1443,23 @@ BinomialDistribution::readAttributes(const XMLAttributes& attributes,
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribBinomialDistributionAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribBinomialDistributionAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribBinomialDistributionAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribBinomialDistributionAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
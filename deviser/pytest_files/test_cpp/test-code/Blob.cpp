@@ -0,0 +1,1518 @@
+/**
+ * @file Blob.cpp
+ * @brief Implementation of the Blob class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sbml/packages/pool/sbml/Blob.h>
+#include <sbml/packages/pool/sbml/ListOfBlobs.h>
+#include <sbml/packages/pool/validator/PoolSBMLError.h>
+#include <map>
+
+
+using namespace std;
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new Blob using the given SBML Level, Version and
+ * &ldquo;pool&rdquo; package version.
+ */
+Blob::Blob(unsigned int level, unsigned int version, unsigned int pkgVersion)
+  : SBase(level, version)
+  , mValue (util_NaN())
+  , mIsSetValue (false)
+{
+  setSBMLNamespacesAndOwn(new PoolPkgNamespaces(level, version, pkgVersion));
+}
+
+
+/*
+ * Creates a new Blob using the given PoolPkgNamespaces object.
+ */
+Blob::Blob(PoolPkgNamespaces *poolns)
+  : SBase(poolns)
+  , mValue (util_NaN())
+  , mIsSetValue (false)
+{
+  setElementNamespace(poolns->getURI());
+  loadPlugins(poolns);
+}
+
+
+/*
+ * Copy constructor for Blob.
+ */
+Blob::Blob(const Blob& orig)
+  : SBase( orig )
+  , mValue ( orig.mValue )
+  , mIsSetValue ( orig.mIsSetValue )
+{
+}
+
+
+/*
+ * Assignment operator for Blob.
+ */
+Blob&
+Blob::operator=(const Blob& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(rhs);
+    mValue = rhs.mValue;
+    mIsSetValue = rhs.mIsSetValue;
+  }
+
+  return *this;
+}
+
+
+/*
+ * Creates and returns a deep copy of this Blob object.
+ */
+Blob*
+Blob::clone() const
+{
+  return new Blob(*this);
+}
+
+
+/*
+ * Destructor for Blob.
+ */
+Blob::~Blob()
+{
+}
+
+
+/*
+ * Allocates memory for a Blob from the pool kept for the class.
+ */
+void*
+Blob::operator new(size_t size)
+{
+  if (size != sizeof(Blob))
+  {
+    return ::operator new(size);
+  }
+
+  void*& freeList = getPoolFreeList();
+
+  if (freeList == NULL)
+  {
+    // carve a new chunk of 256 blocks into the list
+    // its first block links the chunks so trimPool() can free them
+
+    char* chunk = static_cast<char*>(::operator new(257 * size));
+    void*& chunkList = getPoolChunkList();
+    *reinterpret_cast<void**>(chunk) = chunkList;
+    chunkList = chunk;
+
+    for (unsigned int i = 1; i < 257; i++)
+    {
+      void* block = chunk + i * size;
+      *static_cast<void**>(block) = freeList;
+      freeList = block;
+    }
+  }
+
+  void* block = freeList;
+  freeList = *static_cast<void**>(block);
+  return block;
+}
+
+
+/*
+ * Returns the memory used by a Blob to the pool kept for the class.
+ */
+void
+Blob::operator delete(void* ptr, size_t size)
+{
+  if (ptr == NULL)
+  {
+    return;
+  }
+
+  if (size != sizeof(Blob))
+  {
+    ::operator delete(ptr);
+    return;
+  }
+
+  void*& freeList = getPoolFreeList();
+  *static_cast<void**>(ptr) = freeList;
+  freeList = ptr;
+}
+
+
+/*
+ * Frees the chunks of the calling thread's Blob pool that hold no live
+ * objects.
+ */
+unsigned int
+Blob::trimPool()
+{
+  void*& freeList = getPoolFreeList();
+  void*& chunkList = getPoolChunkList();
+  size_t chunkSize = 257 * sizeof(Blob);
+
+  // count the unused blocks of each chunk of this thread
+
+  std::map<char*, unsigned int> unused;
+  void* chunk = chunkList;
+
+  while (chunk != NULL)
+  {
+    unused[static_cast<char*>(chunk)] = 0;
+    chunk = *static_cast<void**>(chunk);
+  }
+
+  for (void* next = freeList; next != NULL; next = *static_cast<void**>(next))
+  {
+    char* block = static_cast<char*>(next);
+    std::map<char*, unsigned int>::iterator it = unused.upper_bound(block);
+    if (it != unused.begin() && block < (--it)->first + chunkSize)
+    {
+      it->second++;
+    }
+  }
+
+  // keep the blocks of chunks that are still in use and those of other threads
+
+  void* kept = NULL;
+
+  while (freeList != NULL)
+  {
+    char* block = static_cast<char*>(freeList);
+    freeList = *static_cast<void**>(freeList);
+    std::map<char*, unsigned int>::iterator it = unused.upper_bound(block);
+    if (it != unused.begin() && block < (--it)->first + chunkSize)
+    {
+      if (it->second == 256)
+      {
+        continue;
+      }
+    }
+
+    *reinterpret_cast<void**>(block) = kept;
+    kept = block;
+  }
+
+  freeList = kept;
+
+  // free the chunks none of whose blocks are in use
+
+  unsigned int freed = 0;
+  void* keptChunks = NULL;
+  std::map<char*, unsigned int>::iterator it;
+
+  for (it = unused.begin(); it != unused.end(); ++it)
+  {
+    if (it->second == 256)
+    {
+      ::operator delete(it->first);
+      freed++;
+    }
+    else
+    {
+      *reinterpret_cast<void**>(it->first) = keptChunks;
+      keptChunks = it->first;
+    }
+  }
+
+  chunkList = keptChunks;
+  return freed;
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Blob.
+ */
+const std::string&
+Blob::getId() const
+{
+  return mId;
+}
+
+
+/*
+ * Returns the value of the "name" attribute of this Blob.
+ */
+const std::string&
+Blob::getName() const
+{
+  return mName;
+}
+
+
+/*
+ * Returns the value of the "value" attribute of this Blob.
+ */
+double
+Blob::getValue() const
+{
+  return mValue;
+}
+
+
+/*
+ * Predicate returning @c true if this Blob's "id" attribute is set.
+ */
+bool
+Blob::isSetId() const
+{
+  return (mId.empty() == false);
+}
+
+
+/*
+ * Predicate returning @c true if this Blob's "name" attribute is set.
+ */
+bool
+Blob::isSetName() const
+{
+  return (mName.empty() == false);
+}
+
+
+/*
+ * Predicate returning @c true if this Blob's "value" attribute is set.
+ */
+bool
+Blob::isSetValue() const
+{
+  return mIsSetValue;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Blob.
+ */
+int
+Blob::setId(const std::string& id)
+{
+  return SyntaxChecker::checkAndSetSId(id, mId);
+}
+
+
+/*
+ * Sets the value of the "name" attribute of this Blob.
+ */
+int
+Blob::setName(const std::string& name)
+{
+  mName = name;
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "value" attribute of this Blob.
+ */
+int
+Blob::setValue(double value)
+{
+  mValue = value;
+  mIsSetValue = true;
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Blob.
+ */
+int
+Blob::unsetId()
+{
+  mId.erase();
+
+  if (mId.empty() == true)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Unsets the value of the "name" attribute of this Blob.
+ */
+int
+Blob::unsetName()
+{
+  mName.erase();
+
+  if (mName.empty() == true)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Unsets the value of the "value" attribute of this Blob.
+ */
+int
+Blob::unsetValue()
+{
+  mValue = util_NaN();
+  mIsSetValue = false;
+
+  if (isSetValue() == false)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Returns the XML element name of this Blob object.
+ */
+const std::string&
+Blob::getElementName() const
+{
+  static const string name = "blob";
+  return name;
+}
+
+
+/*
+ * Returns the libSBML type code for this Blob object.
+ */
+int
+Blob::getTypeCode() const
+{
+  return SBML_POOL_BLOB;
+}
+
+
+/*
+ * Predicate returning @c true if all the required attributes for this Blob
+ * object have been set.
+ */
+bool
+Blob::hasRequiredAttributes() const
+{
+  bool allPresent = true;
+
+  if (isSetId() == false)
+  {
+    allPresent = false;
+  }
+
+  return allPresent;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Write any contained elements
+ */
+void
+Blob::writeElements(XMLOutputStream& stream) const
+{
+  SBase::writeElements(stream);
+
+  SBase::writeExtensionElements(stream);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Accepts the given SBMLVisitor
+ */
+bool
+Blob::accept(SBMLVisitor& v) const
+{
+  return v.visit(*this);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the parent SBMLDocument
+ */
+void
+Blob::setSBMLDocument(SBMLDocument* d)
+{
+  SBase::setSBMLDocument(d);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Enables/disables the given package with this element
+ */
+void
+Blob::enablePackageInternal(const std::string& pkgURI,
+                            const std::string& pkgPrefix,
+                            bool flag)
+{
+  SBase::enablePackageInternal(pkgURI, pkgPrefix, flag);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::getAttribute(const std::string& attributeName, bool& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::getAttribute(const std::string& attributeName, int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::getAttribute(const std::string& attributeName, double& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::getAttribute(const std::string& attributeName,
+                   unsigned int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::getAttribute(const std::string& attributeName, std::string& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if this Blob's attribute "attributeName" is set.
+ */
+bool
+Blob::isSetAttribute(const std::string& attributeName) const
+{
+  bool value = SBase::isSetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = isSetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::setAttribute(const std::string& attributeName, bool value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::setAttribute(const std::string& attributeName, int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::setAttribute(const std::string& attributeName, double value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::setAttribute(const std::string& attributeName, unsigned int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::setAttribute(const std::string& attributeName, const std::string& value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::unsetAttribute(const std::string& attributeName)
+{
+  int value = SBase::unsetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = unsetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Blob.
+ */
+int
+Blob::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "name", "value" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    value = getValue();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getName();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Blob is set.
+ */
+bool
+Blob::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_VALUE:
+    return isSetValue();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    return setValue(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_NAME:
+    return setName(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Blob.
+ */
+int
+Blob::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_VALUE:
+    return unsetValue();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Blob::forEachElement(bool (*action)(SBase*, void*),
+                     void* userData,
+                     ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the expected attributes for this element
+ */
+void
+Blob::addExpectedAttributes(ExpectedAttributes& attributes)
+{
+  SBase::addExpectedAttributes(attributes);
+
+  attributes.add("id");
+
+  attributes.add("name");
+
+  attributes.add("value");
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Reads the expected attributes into the member data variables
+ */
+void
+Blob::readAttributes(const XMLAttributes& attributes,
+                     const ExpectedAttributes& expectedAttributes)
+{
+  unsigned int level = getLevel();
+  unsigned int version = getVersion();
+  unsigned int pkgVersion = getPackageVersion();
+  unsigned int numErrs;
+  bool assigned = false;
+  SBMLErrorLog* log = getErrorLog();
+
+  if (log && getParentSBMLObject() &&
+    static_cast<ListOfBlobs*>(getParentSBMLObject())->size() < 2)
+  {
+    numErrs = log->getNumErrors();
+    for (int n = numErrs-1; n >= 0; n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(PoolModelLOBlobsAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "pool", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(PoolModelLOBlobsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "pool", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  unsigned int errMark = log ? log->getNumErrors() : 0;
+  SBase::readAttributes(attributes, expectedAttributes);
+
+  if (log)
+  {
+    numErrs = log->getNumErrors();
+
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(PoolBlobAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "pool",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(PoolBlobAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "pool", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  // 
+  // id SId (use = "required" )
+  // 
+
+  assigned = attributes.readInto("id", mId);
+
+  if (assigned == true)
+  {
+    if (mId.empty() == true)
+    {
+      logEmptyString(mId, level, version, "<Blob>");
+    }
+    else if (SyntaxChecker::isValidSBMLSId(mId) == false)
+    {
+      log->logPackageError("pool", PoolIdSyntaxRule, pkgVersion, level,
+        version, "The id on the <" + getElementName() + "> is '" + mId + "', "
+          "which does not conform to the syntax.", getLine(), getColumn());
+    }
+  }
+  else
+  {
+    if (log)
+    {
+      std::string message = "Pool attribute 'id' is missing from the <Blob> "
+        "element.";
+      log->logPackageError("pool", PoolBlobAllowedAttributes, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+
+  // 
+  // name string (use = "optional" )
+  // 
+
+  assigned = attributes.readInto("name", mName);
+
+  if (assigned == true)
+  {
+    if (mName.empty() == true)
+    {
+      logEmptyString(mName, level, version, "<Blob>");
+    }
+  }
+
+  // 
+  // value double (use = "optional" )
+  // 
+
+  numErrs = log ? log->getNumErrors() : 0;
+  mIsSetValue = attributes.readInto("value", mValue);
+
+  if ( mIsSetValue == false && log)
+  {
+    if (log && log->getNumErrors() == numErrs + 1 &&
+      log->contains(XMLAttributeTypeMismatch))
+    {
+      log->remove(XMLAttributeTypeMismatch);
+      std::string message = "Pool attribute 'value' from the <Blob> element "
+        "must be an integer.";
+      log->logPackageError("pool", PoolBlobValueMustBeDouble, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Writes the attributes to the stream
+ */
+void
+Blob::writeAttributes(XMLOutputStream& stream) const
+{
+  SBase::writeAttributes(stream);
+
+  if (isSetId() == true)
+  {
+    stream.writeAttribute("id", getPrefix(), mId);
+  }
+
+  if (isSetName() == true)
+  {
+    stream.writeAttribute("name", getPrefix(), mName);
+  }
+
+  if (isSetValue() == true)
+  {
+    stream.writeAttribute("value", getPrefix(), mValue);
+  }
+
+  SBase::writeExtensionAttributes(stream);
+}
+
+/** @endcond */
+
+
+#ifndef POOL_THREAD_LOCAL
+#if defined(_MSC_VER)
+#define POOL_THREAD_LOCAL __declspec(thread)
+#else
+#define POOL_THREAD_LOCAL __thread
+#endif
+#endif
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the calling thread's list of unused Blob blocks; each block holds a
+ * pointer to the next.
+ */
+void*&
+Blob::getPoolFreeList()
+{
+  static POOL_THREAD_LOCAL void* freeList = NULL;
+  return freeList;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the calling thread's list of the chunks its Blob blocks are carved
+ * from; the first block of each chunk holds a pointer to the next.
+ */
+void*&
+Blob::getPoolChunkList()
+{
+  static POOL_THREAD_LOCAL void* chunkList = NULL;
+  return chunkList;
+}
+
+/** @endcond */
+
+
+
+
+#endif /* __cplusplus */
+
+
+/*
+ * Creates a new Blob_t using the given SBML Level, Version and
+ * &ldquo;pool&rdquo; package version.
+ */
+LIBSBML_EXTERN
+Blob_t *
+Blob_create(unsigned int level, unsigned int version, unsigned int pkgVersion)
+{
+  return new Blob(level, version, pkgVersion);
+}
+
+
+/*
+ * Creates and returns a deep copy of this Blob_t object.
+ */
+LIBSBML_EXTERN
+Blob_t*
+Blob_clone(const Blob_t* b)
+{
+  if (b != NULL)
+  {
+    return static_cast<Blob_t*>(b->clone());
+  }
+  else
+  {
+    return NULL;
+  }
+}
+
+
+/*
+ * Frees this Blob_t object.
+ */
+LIBSBML_EXTERN
+void
+Blob_free(Blob_t* b)
+{
+  if (b != NULL)
+  {
+    delete b;
+  }
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+char *
+Blob_getId(const Blob_t * b)
+{
+  if (b == NULL)
+  {
+    return NULL;
+  }
+
+  return b->getId().empty() ? NULL : safe_strdup(b->getId().c_str());
+}
+
+
+/*
+ * Returns the value of the "name" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+char *
+Blob_getName(const Blob_t * b)
+{
+  if (b == NULL)
+  {
+    return NULL;
+  }
+
+  return b->getName().empty() ? NULL : safe_strdup(b->getName().c_str());
+}
+
+
+/*
+ * Returns the value of the "value" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+double
+Blob_getValue(const Blob_t * b)
+{
+  return (b != NULL) ? b->getValue() : util_NaN();
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Blob_t's "id" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Blob_isSetId(const Blob_t * b)
+{
+  return (b != NULL) ? static_cast<int>(b->isSetId()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Blob_t's "name" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Blob_isSetName(const Blob_t * b)
+{
+  return (b != NULL) ? static_cast<int>(b->isSetName()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Blob_t's "value" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Blob_isSetValue(const Blob_t * b)
+{
+  return (b != NULL) ? static_cast<int>(b->isSetValue()) : 0;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_setId(Blob_t * b, const char * id)
+{
+  return (b != NULL) ? b->setId(id) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "name" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_setName(Blob_t * b, const char * name)
+{
+  return (b != NULL) ? b->setName(name) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "value" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_setValue(Blob_t * b, double value)
+{
+  return (b != NULL) ? b->setValue(value) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_unsetId(Blob_t * b)
+{
+  return (b != NULL) ? b->unsetId() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "name" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_unsetName(Blob_t * b)
+{
+  return (b != NULL) ? b->unsetName() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "value" attribute of this Blob_t.
+ */
+LIBSBML_EXTERN
+int
+Blob_unsetValue(Blob_t * b)
+{
+  return (b != NULL) ? b->unsetValue() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if all the required attributes for this
+ * Blob_t object have been set.
+ */
+LIBSBML_EXTERN
+int
+Blob_hasRequiredAttributes(const Blob_t * b)
+{
+  return (b != NULL) ? static_cast<int>(b->hasRequiredAttributes()) : 0;
+}
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
@@ -402,10 +402,11 @@ Boundary::getAttribute(const std::string& attributeName, double& value) const
     return return_value;
   }
 
-  if (attributeName == "value")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getValue();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -449,10 +450,11 @@ Boundary::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -473,13 +475,11 @@ Boundary::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "value")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetValue();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -533,9 +533,11 @@ Boundary::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "value")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setValue(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -573,9 +575,11 @@ Boundary::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -595,22 +599,312 @@ Boundary::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "value")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Boundary.
+ */
+int
+Boundary::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "value" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetValue();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    value = getValue();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Boundary is set.
+ */
+bool
+Boundary::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_VALUE:
+    return isSetValue();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    return setValue(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Boundary.
+ */
+int
+Boundary::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * Boundary.
+ */
+int
+Boundary::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_VALUE:
+    return unsetValue();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Boundary::forEachElement(bool (*action)(SBase*, void*),
+                         void* userData,
+                         ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -646,27 +940,30 @@ Boundary::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialBoundaryAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialBoundaryAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial", SpatialBoundaryAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialBoundaryAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
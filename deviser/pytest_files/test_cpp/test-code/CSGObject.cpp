@@ -768,10 +768,11 @@ CSGObject::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "ordinal")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getOrdinal();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -832,15 +833,11 @@ CSGObject::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "domainType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getDomainType();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -861,17 +858,11 @@ CSGObject::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "domainType")
-  {
-    value = isSetDomainType();
-  }
-  else if (attributeName == "ordinal")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetOrdinal();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -908,9 +899,11 @@ CSGObject::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "ordinal")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setOrdinal(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -965,13 +958,11 @@ CSGObject::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "domainType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setDomainType(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -991,20 +982,284 @@ CSGObject::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "domainType")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this CSGObject.
+ */
+int
+CSGObject::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "domainType", "ordinal" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetDomainType();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "ordinal")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetOrdinal();
+  case ATTR_ORDINAL:
+    value = getOrdinal();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_DOMAIN_TYPE:
+    value = getDomainType();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CSGObject is set.
+ */
+bool
+CSGObject::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_DOMAIN_TYPE:
+    return isSetDomainType();
+  case ATTR_ORDINAL:
+    return isSetOrdinal();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ORDINAL:
+    return setOrdinal(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this CSGObject.
+ */
+int
+CSGObject::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_DOMAIN_TYPE:
+    return setDomainType(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CSGObject.
+ */
+int
+CSGObject::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_DOMAIN_TYPE:
+    return unsetDomainType();
+  case ATTR_ORDINAL:
+    return unsetOrdinal();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1264,6 +1519,17 @@ CSGObject::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1272,14 +1538,53 @@ List*
 CSGObject::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CSGObject::forEachElement(bool (*action)(SBase*, void*),
+                          void* userData,
+                          ElementFilter* filter)
+{
+  if (mCSGNode != NULL)
+  {
+    if ((filter == NULL || filter->filter(mCSGNode)) && !action(mCSGNode,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mCSGNode, filter);
+    if (!mCSGNode->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1434,43 +1739,46 @@ CSGObject::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialCSGeometryLOCSGObjectsAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGeometryLOCSGObjectsAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialCSGeometryLOCSGObjectsAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGeometryLOCSGObjectsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialCSGObjectAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGObjectAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial", SpatialCSGObjectAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGObjectAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
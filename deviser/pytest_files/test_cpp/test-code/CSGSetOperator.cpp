@@ -244,7 +244,8 @@ CSGSetOperator::setOperationType(const SetOperation_t operationType)
 int
 CSGSetOperator::setOperationType(const std::string& operationType)
 {
-  mOperationType = SetOperation_fromString(operationType.c_str());
+  mOperationType = SetOperation_fromStringWithLength(operationType.c_str(),
+    operationType.size());
 
   if (mOperationType == SPATIAL_SETOPERATION_INVALID)
   {
@@ -906,30 +907,14 @@ int
 CSGSetOperator::getAttribute(const std::string& attributeName,
                              std::string& value) const
 {
-  int return_value = CSGNode::getAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  if (attributeId != -1)
   {
-    return return_value;
+    return getAttribute(attributeId, value);
   }
 
-  if (attributeName == "operationType")
-  {
-    value = getOperationTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "complementA")
-  {
-    value = getComplementA();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "complementB")
-  {
-    value = getComplementB();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-
-  return return_value;
+  return CSGNode::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -945,22 +930,14 @@ CSGSetOperator::getAttribute(const std::string& attributeName,
 bool
 CSGSetOperator::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = CSGNode::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "operationType")
-  {
-    value = isSetOperationType();
-  }
-  else if (attributeName == "complementA")
-  {
-    value = isSetComplementA();
-  }
-  else if (attributeName == "complementB")
+  if (attributeId != -1)
   {
-    value = isSetComplementB();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return CSGNode::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -1045,22 +1022,63 @@ int
 CSGSetOperator::setAttribute(const std::string& attributeName,
                              const std::string& value)
 {
-  int return_value = CSGNode::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "operationType")
+  if (attributeId != -1)
   {
-    return_value = setOperationType(value);
+    return setAttribute(attributeId, value);
   }
-  else if (attributeName == "complementA")
+
+  return CSGNode::setAttribute(attributeName, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this CSGSetOperator.
+ */
+int
+CSGSetOperator::unsetAttribute(const std::string& attributeName)
+{
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setComplementA(value);
+    return unsetAttribute(attributeId);
   }
-  else if (attributeName == "complementB")
+
+  return CSGNode::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "operationType", "complementA",
+    "complementB" };
+
+  for (int i = ATTR_OPERATION_TYPE; i < ATTR_COUNT; i++)
   {
-    return_value = setComplementB(value);
+    if (attributeName == names[i - ATTR_OPERATION_TYPE])
+    {
+      return i;
+    }
   }
 
-  return return_value;
+  return CSGNode::lookupAttribute(attributeName);
 }
 
 /** @endcond */
@@ -1070,27 +1088,240 @@ CSGSetOperator::setAttribute(const std::string& attributeName,
 /** @cond doxygenLibsbmlInternal */
 
 /*
- * Unsets the value of the "attributeName" attribute of this CSGSetOperator.
+ * Gets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
  */
 int
-CSGSetOperator::unsetAttribute(const std::string& attributeName)
+CSGSetOperator::getAttribute(int attributeId, bool& value) const
 {
-  int value = CSGNode::unsetAttribute(attributeName);
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::getAttribute(int attributeId, int& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::getAttribute(int attributeId, double& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::getAttribute(int attributeId, unsigned int& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_OPERATION_TYPE:
+    value = getOperationTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COMPLEMENT_A:
+    value = getComplementA();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COMPLEMENT_B:
+    value = getComplementB();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
 
-  if (attributeName == "operationType")
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CSGSetOperator is set.
+ */
+bool
+CSGSetOperator::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetOperationType();
+  case ATTR_OPERATION_TYPE:
+    return isSetOperationType();
+  case ATTR_COMPLEMENT_A:
+    return isSetComplementA();
+  case ATTR_COMPLEMENT_B:
+    return isSetComplementB();
+  default:
+    break;
   }
-  else if (attributeName == "complementA")
+
+  return CSGNode::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::setAttribute(int attributeId, bool value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::setAttribute(int attributeId, int value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::setAttribute(int attributeId, double value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::setAttribute(int attributeId, unsigned int value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetComplementA();
+  case ATTR_OPERATION_TYPE:
+    return setOperationType(value);
+  case ATTR_COMPLEMENT_A:
+    return setComplementA(value);
+  case ATTR_COMPLEMENT_B:
+    return setComplementB(value);
+  default:
+    break;
   }
-  else if (attributeName == "complementB")
+
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CSGSetOperator.
+ */
+int
+CSGSetOperator::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetComplementB();
+  case ATTR_OPERATION_TYPE:
+    return unsetOperationType();
+  case ATTR_COMPLEMENT_A:
+    return unsetComplementA();
+  case ATTR_COMPLEMENT_B:
+    return unsetComplementB();
+  default:
+    break;
   }
 
-  return value;
+  return CSGNode::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -1326,6 +1557,17 @@ CSGSetOperator::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1334,14 +1576,53 @@ List*
 CSGSetOperator::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mCSGNodes, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CSGSetOperator::forEachElement(bool (*action)(SBase*, void*),
+                               void* userData,
+                               ElementFilter* filter)
+{
+  if (mCSGNodes.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mCSGNodes)) && !action(&mCSGNodes,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mCSGNodes.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1416,28 +1697,30 @@ CSGSetOperator::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   CSGNode::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialCSGSetOperatorAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGSetOperatorAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialCSGSetOperatorAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGSetOperatorAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1457,7 +1740,8 @@ CSGSetOperator::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mOperationType = SetOperation_fromString(operationType.c_str());
+      mOperationType = SetOperation_fromStringWithLength(operationType.c_str(),
+        operationType.size());
 
       if (log && SetOperation_isValid(mOperationType) == 0)
       {
@@ -813,6 +813,214 @@ CSGTransformation::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::lookupAttribute(const std::string& attributeName)
+{
+  return CSGNode::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::getAttribute(int attributeId, bool& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::getAttribute(int attributeId, int& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::getAttribute(int attributeId, double& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::getAttribute(int attributeId, unsigned int& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::getAttribute(int attributeId, std::string& value) const
+{
+  return CSGNode::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CSGTransformation is set.
+ */
+bool
+CSGTransformation::isSetAttribute(int attributeId) const
+{
+  return CSGNode::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::setAttribute(int attributeId, bool value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::setAttribute(int attributeId, int value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::setAttribute(int attributeId, double value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::setAttribute(int attributeId, unsigned int value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::setAttribute(int attributeId, const std::string& value)
+{
+  return CSGNode::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CSGTransformation.
+ */
+int
+CSGTransformation::unsetAttribute(int attributeId)
+{
+  return CSGNode::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1067,6 +1275,17 @@ CSGTransformation::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1075,14 +1294,53 @@ List*
 CSGTransformation::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mCSGNode, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CSGTransformation::forEachElement(bool (*action)(SBase*, void*),
+                                  void* userData,
+                                  ElementFilter* filter)
+{
+  if (mCSGNode != NULL)
+  {
+    if ((filter == NULL || filter->filter(mCSGNode)) && !action(mCSGNode,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mCSGNode->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1222,29 +1480,30 @@ CSGTransformation::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   CSGNode::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialCSGTransformationAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGTransformationAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialCSGTransformationAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGTransformationAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
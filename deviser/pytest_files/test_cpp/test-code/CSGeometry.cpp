@@ -680,6 +680,213 @@ CSGeometry::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this CSGeometry.
+ */
+int
+CSGeometry::lookupAttribute(const std::string& attributeName)
+{
+  return GeometryDefinition::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::getAttribute(int attributeId, bool& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::getAttribute(int attributeId, int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::getAttribute(int attributeId, double& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::getAttribute(int attributeId, std::string& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CSGeometry is set.
+ */
+bool
+CSGeometry::isSetAttribute(int attributeId) const
+{
+  return GeometryDefinition::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::setAttribute(int attributeId, bool value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::setAttribute(int attributeId, int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::setAttribute(int attributeId, double value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::setAttribute(int attributeId, unsigned int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::setAttribute(int attributeId, const std::string& value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CSGeometry.
+ */
+int
+CSGeometry::unsetAttribute(int attributeId)
+{
+  return GeometryDefinition::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -844,6 +1051,17 @@ CSGeometry::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -852,14 +1070,53 @@ List*
 CSGeometry::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CSGeometry::forEachElement(bool (*action)(SBase*, void*),
+                           void* userData,
+                           ElementFilter* filter)
+{
+  if (mCSGObjects.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mCSGObjects)) &&
+      !action(&mCSGObjects, userData))
+    {
+      return false;
+    }
+
+    if (!mCSGObjects.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  ADD_FILTERED_LIST(ret, sublist, mCSGObjects, filter);
+    delete sublist;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  return true;
 }
 
 
@@ -928,27 +1185,30 @@ CSGeometry::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GeometryDefinition::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialCSGeometryAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGeometryAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial", SpatialCSGeometryAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCSGeometryAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
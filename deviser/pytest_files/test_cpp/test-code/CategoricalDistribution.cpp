@@ -658,6 +658,217 @@ CategoricalDistribution::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::lookupAttribute(const std::string& attributeName)
+{
+  return CategoricalUnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::getAttribute(int attributeId, bool& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::getAttribute(int attributeId, int& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::getAttribute(int attributeId, double& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::getAttribute(int attributeId,
+                                      unsigned int& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::getAttribute(int attributeId,
+                                      std::string& value) const
+{
+  return CategoricalUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CategoricalDistribution is set.
+ */
+bool
+CategoricalDistribution::isSetAttribute(int attributeId) const
+{
+  return CategoricalUnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::setAttribute(int attributeId, bool value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::setAttribute(int attributeId, int value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::setAttribute(int attributeId, double value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::setAttribute(int attributeId, unsigned int value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::setAttribute(int attributeId,
+                                      const std::string& value)
+{
+  return CategoricalUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CategoricalDistribution.
+ */
+int
+CategoricalDistribution::unsetAttribute(int attributeId)
+{
+  return CategoricalUnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -835,6 +1046,17 @@ CategoricalDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -843,14 +1065,53 @@ List*
 CategoricalDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mCategories, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CategoricalDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                        void* userData,
+                                        ElementFilter* filter)
+{
+  if (mCategories.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mCategories)) &&
+      !action(&mCategories, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mCategories.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -920,6 +1181,7 @@ CategoricalDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   CategoricalUnivariateDistribution::readAttributes(attributes,
     expectedAttributes);
 
@@ -927,23 +1189,24 @@ CategoricalDistribution::readAttributes(const XMLAttributes& attributes,
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribCategoricalDistributionAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribCategoricalDistributionAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribCategoricalDistributionAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError
+          rewritten(DistribCategoricalDistributionAllowedCoreAttributes, level,
+            version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+              LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
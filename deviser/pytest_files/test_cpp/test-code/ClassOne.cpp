@@ -430,15 +430,11 @@ ClassOne::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "att1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAtt1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "att2")
-  {
-    value = getAtt2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -516,10 +512,11 @@ ClassOne::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -540,17 +537,11 @@ ClassOne::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "att1")
-  {
-    value = isSetAtt1();
-  }
-  else if (attributeName == "att2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetAtt2();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -570,13 +561,11 @@ ClassOne::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "att1")
-  {
-    return_value = setAtt1(value);
-  }
-  else if (attributeName == "att2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAtt2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -648,9 +637,11 @@ ClassOne::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -670,26 +661,321 @@ ClassOne::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "att1")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this ClassOne.
+ */
+int
+ClassOne::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "att1", "att2" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetAtt1();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "att2")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
   {
-    value = unsetAtt2();
+  case ATTR_ATT1:
+    value = getAtt1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT2:
+    value = getAtt2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ClassOne is set.
+ */
+bool
+ClassOne::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_ATT1:
+    return isSetAtt1();
+  case ATTR_ATT2:
+    return isSetAtt2();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ATT1:
+    return setAtt1(value);
+  case ATTR_ATT2:
+    return setAtt2(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this ClassOne.
+ */
+int
+ClassOne::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ClassOne.
+ */
+int
+ClassOne::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_ATT1:
+    return unsetAtt1();
+  case ATTR_ATT2:
+    return unsetAtt2();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ClassOne::forEachElement(bool (*action)(SBase*, void*),
+                         void* userData,
+                         ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -737,27 +1023,30 @@ ClassOne::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("vers", VersClassOneAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersClassOneAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("vers", VersClassOneAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersClassOneAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
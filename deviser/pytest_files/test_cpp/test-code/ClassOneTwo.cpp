@@ -541,7 +541,7 @@ ClassOneTwo::setAttEnum(const std::string& attEnum)
 
   if (coreLevel == 4 && coreVersion == 1 && pkgVersion == 1)
   {
-    mAttEnum = AbcType_fromString(attEnum.c_str());
+    mAttEnum = AbcType_fromStringWithLength(attEnum.c_str(), attEnum.size());
 
     if (mAttEnum == OBJECTIVE_TYPE_INVALID)
     {
@@ -840,15 +840,11 @@ ClassOneTwo::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "att1")
-  {
-    value = getAtt1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "att2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAtt2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -873,10 +869,11 @@ ClassOneTwo::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "attInt")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAttInt();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -902,10 +899,11 @@ ClassOneTwo::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "attDbl")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAttDbl();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -949,25 +947,11 @@ ClassOneTwo::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attStr")
-  {
-    value = getAttStr();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attUnit")
-  {
-    value = getAttUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAttEnumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -988,37 +972,11 @@ ClassOneTwo::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "att1")
-  {
-    value = isSetAtt1();
-  }
-  else if (attributeName == "attStr")
-  {
-    value = isSetAttStr();
-  }
-  else if (attributeName == "attInt")
-  {
-    value = isSetAttInt();
-  }
-  else if (attributeName == "att2")
-  {
-    value = isSetAtt2();
-  }
-  else if (attributeName == "attDbl")
-  {
-    value = isSetAttDbl();
-  }
-  else if (attributeName == "attUnit")
-  {
-    value = isSetAttUnit();
-  }
-  else if (attributeName == "attEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetAttEnum();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1038,13 +996,11 @@ ClassOneTwo::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "att1")
-  {
-    return_value = setAtt1(value);
-  }
-  else if (attributeName == "att2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAtt2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1064,9 +1020,11 @@ ClassOneTwo::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "attInt")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAttInt(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1086,9 +1044,11 @@ ClassOneTwo::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "attDbl")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAttDbl(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1127,24 +1087,92 @@ ClassOneTwo::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
-  else if (attributeName == "attStr")
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this ClassOneTwo.
+ */
+int
+ClassOneTwo::unsetAttribute(const std::string& attributeName)
+{
+  int value = SBase::unsetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAttStr(value);
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "attUnit")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this ClassOneTwo.
+ */
+int
+ClassOneTwo::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "att1", "attStr", "attInt",
+    "att2", "attDbl", "attUnit", "attEnum" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    return_value = setAttUnit(value);
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "attEnum")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
   {
-    return_value = setAttEnum(value);
+  case ATTR_ATT1:
+    value = getAtt1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT2:
+    value = getAtt2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return return_value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1154,52 +1182,329 @@ ClassOneTwo::setAttribute(const std::string& attributeName,
 /** @cond doxygenLibsbmlInternal */
 
 /*
- * Unsets the value of the "attributeName" attribute of this ClassOneTwo.
+ * Gets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
  */
 int
-ClassOneTwo::unsetAttribute(const std::string& attributeName)
+ClassOneTwo::getAttribute(int attributeId, int& value) const
 {
-  int value = SBase::unsetAttribute(attributeName);
+  switch (attributeId)
+  {
+  case ATTR_ATT_INT:
+    value = getAttInt();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
 
-  if (attributeName == "id")
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
   {
-    value = unsetId();
+  case ATTR_ATT_DBL:
+    value = getAttDbl();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "att1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetAtt1();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT_STR:
+    value = getAttStr();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT_UNIT:
+    value = getAttUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT_ENUM:
+    value = getAttEnumAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "attStr")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ClassOneTwo is set.
+ */
+bool
+ClassOneTwo::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetAttStr();
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_ATT1:
+    return isSetAtt1();
+  case ATTR_ATT_STR:
+    return isSetAttStr();
+  case ATTR_ATT_INT:
+    return isSetAttInt();
+  case ATTR_ATT2:
+    return isSetAtt2();
+  case ATTR_ATT_DBL:
+    return isSetAttDbl();
+  case ATTR_ATT_UNIT:
+    return isSetAttUnit();
+  case ATTR_ATT_ENUM:
+    return isSetAttEnum();
+  default:
+    break;
   }
-  else if (attributeName == "attInt")
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
   {
-    value = unsetAttInt();
+  case ATTR_ATT1:
+    return setAtt1(value);
+  case ATTR_ATT2:
+    return setAtt2(value);
+  default:
+    break;
   }
-  else if (attributeName == "att2")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
   {
-    value = unsetAtt2();
+  case ATTR_ATT_INT:
+    return setAttInt(value);
+  default:
+    break;
   }
-  else if (attributeName == "attDbl")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
   {
-    value = unsetAttDbl();
+  case ATTR_ATT_DBL:
+    return setAttDbl(value);
+  default:
+    break;
   }
-  else if (attributeName == "attUnit")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetAttUnit();
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_ATT_STR:
+    return setAttStr(value);
+  case ATTR_ATT_UNIT:
+    return setAttUnit(value);
+  case ATTR_ATT_ENUM:
+    return setAttEnum(value);
+  default:
+    break;
   }
-  else if (attributeName == "attEnum")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ClassOneTwo.
+ */
+int
+ClassOneTwo::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetAttEnum();
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_ATT1:
+    return unsetAtt1();
+  case ATTR_ATT_STR:
+    return unsetAttStr();
+  case ATTR_ATT_INT:
+    return unsetAttInt();
+  case ATTR_ATT2:
+    return unsetAtt2();
+  case ATTR_ATT_DBL:
+    return unsetAttDbl();
+  case ATTR_ATT_UNIT:
+    return unsetAttUnit();
+  case ATTR_ATT_ENUM:
+    return unsetAttEnum();
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ClassOneTwo::forEachElement(bool (*action)(SBase*, void*),
+                            void* userData,
+                            ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -1266,29 +1571,30 @@ ClassOneTwo::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("coreversmultipkg",
-          CoreversmultipkgClassOneTwoAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(CoreversmultipkgClassOneTwoAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "coreversmultipkg", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("coreversmultipkg",
-          CoreversmultipkgClassOneTwoAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(CoreversmultipkgClassOneTwoAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "coreversmultipkg", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1736,7 +2042,7 @@ ClassOneTwo::readL4V1V1Attributes(const XMLAttributes& attributes)
     }
     else
     {
-      mAttEnum = AbcType_fromString(attEnum.c_str());
+      mAttEnum = AbcType_fromStringWithLength(attEnum.c_str(), attEnum.size());
 
       if (log && AbcType_isValid(mAttEnum) == 0)
       {
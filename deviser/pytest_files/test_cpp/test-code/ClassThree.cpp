@@ -315,7 +315,7 @@ ClassThree::setNumber(const Enum_t number)
 int
 ClassThree::setNumber(const std::string& number)
 {
-  mNumber = Enum_fromString(number.c_str());
+  mNumber = Enum_fromStringWithLength(number.c_str(), number.size());
 
   if (mNumber == TEST_ENUM_INVALID)
   {
@@ -351,7 +351,7 @@ ClassThree::setName(const Fred_t name)
 int
 ClassThree::setName(const std::string& name)
 {
-  mName = Fred_fromString(name.c_str());
+  mName = Fred_fromStringWithLength(name.c_str(), name.size());
 
   if (mName == TEST_FRED_INVALID)
   {
@@ -387,7 +387,7 @@ ClassThree::setBadName(const Fred_t badName)
 int
 ClassThree::setBadName(const std::string& badName)
 {
-  mBadName = Fred_fromString(badName.c_str());
+  mBadName = Fred_fromStringWithLength(badName.c_str(), badName.size());
 
   if (mBadName == TEST_FRED_INVALID)
   {
@@ -423,7 +423,7 @@ ClassThree::setOtherNum(const Enum_t otherNum)
 int
 ClassThree::setOtherNum(const std::string& otherNum)
 {
-  mOtherNum = Enum_fromString(otherNum.c_str());
+  mOtherNum = Enum_fromStringWithLength(otherNum.c_str(), otherNum.size());
 
   if (mOtherNum == TEST_ENUM_INVALID)
   {
@@ -459,7 +459,8 @@ ClassThree::setLongEnum(const ExtraLong_t longEnum)
 int
 ClassThree::setLongEnum(const std::string& longEnum)
 {
-  mLongEnum = ExtraLong_fromString(longEnum.c_str());
+  mLongEnum = ExtraLong_fromStringWithLength(longEnum.c_str(),
+    longEnum.size());
 
   if (mLongEnum == TEST_EXTRALONG_INVALID)
   {
@@ -720,30 +721,11 @@ ClassThree::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "number")
-  {
-    value = getNumberAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getNameAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "badName")
-  {
-    value = getBadNameAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "otherNum")
-  {
-    value = getOtherNumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "longEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getLongEnumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -764,25 +746,11 @@ ClassThree::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "number")
-  {
-    value = isSetNumber();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "badName")
-  {
-    value = isSetBadName();
-  }
-  else if (attributeName == "otherNum")
-  {
-    value = isSetOtherNum();
-  }
-  else if (attributeName == "longEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetLongEnum();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -871,25 +839,11 @@ ClassThree::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "number")
-  {
-    return_value = setNumber(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "badName")
-  {
-    return_value = setBadName(value);
-  }
-  else if (attributeName == "otherNum")
-  {
-    return_value = setOtherNum(value);
-  }
-  else if (attributeName == "longEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setLongEnum(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -909,33 +863,337 @@ ClassThree::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "number")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetNumber();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "name")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this ClassThree.
+ */
+int
+ClassThree::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "number", "name", "badName", "otherNum",
+    "longEnum" };
+
+  for (int i = ATTR_NUMBER; i < ATTR_COUNT; i++)
   {
-    value = unsetName();
+    if (attributeName == names[i - ATTR_NUMBER])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "badName")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetBadName();
+  case ATTR_NUMBER:
+    value = getNumberAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getNameAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_BAD_NAME:
+    value = getBadNameAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_OTHER_NUM:
+    value = getOtherNumAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_LONG_ENUM:
+    value = getLongEnumAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "otherNum")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ClassThree is set.
+ */
+bool
+ClassThree::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_NUMBER:
+    return isSetNumber();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_BAD_NAME:
+    return isSetBadName();
+  case ATTR_OTHER_NUM:
+    return isSetOtherNum();
+  case ATTR_LONG_ENUM:
+    return isSetLongEnum();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetOtherNum();
+  case ATTR_NUMBER:
+    return setNumber(value);
+  case ATTR_NAME:
+    return setName(value);
+  case ATTR_BAD_NAME:
+    return setBadName(value);
+  case ATTR_OTHER_NUM:
+    return setOtherNum(value);
+  case ATTR_LONG_ENUM:
+    return setLongEnum(value);
+  default:
+    break;
   }
-  else if (attributeName == "longEnum")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ClassThree.
+ */
+int
+ClassThree::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetLongEnum();
+  case ATTR_NUMBER:
+    return unsetNumber();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_BAD_NAME:
+    return unsetBadName();
+  case ATTR_OTHER_NUM:
+    return unsetOtherNum();
+  case ATTR_LONG_ENUM:
+    return unsetLongEnum();
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ClassThree::forEachElement(bool (*action)(SBase*, void*),
+                           void* userData,
+                           ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -978,28 +1236,30 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("testcase", TestcaseClassThreeAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestcaseClassThreeAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "testcase", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("testcase",
-          TestcaseClassThreeAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(TestcaseClassThreeAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "testcase", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1019,7 +1279,7 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mNumber = Enum_fromString(number.c_str());
+      mNumber = Enum_fromStringWithLength(number.c_str(), number.size());
 
       if (log && Enum_isValid(mNumber) == 0)
       {
@@ -1063,7 +1323,7 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mName = Fred_fromString(name.c_str());
+      mName = Fred_fromStringWithLength(name.c_str(), name.size());
 
       if (log && Fred_isValid(mName) == 0)
       {
@@ -1106,7 +1366,7 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mBadName = Fred_fromString(badName.c_str());
+      mBadName = Fred_fromStringWithLength(badName.c_str(), badName.size());
 
       if (log && Fred_isValid(mBadName) == 0)
       {
@@ -1141,7 +1401,7 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mOtherNum = Enum_fromString(otherNum.c_str());
+      mOtherNum = Enum_fromStringWithLength(otherNum.c_str(), otherNum.size());
 
       if (log && Enum_isValid(mOtherNum) == 0)
       {
@@ -1176,7 +1436,8 @@ ClassThree::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mLongEnum = ExtraLong_fromString(longEnum.c_str());
+      mLongEnum = ExtraLong_fromStringWithLength(longEnum.c_str(),
+        longEnum.size());
 
       if (log && ExtraLong_isValid(mLongEnum) == 0)
       {
@@ -68,7 +68,6 @@ Compartment::Compartment(unsigned int level, unsigned int version)
   , mOutside ("")
   , mCompartmentType ("")
 {
-  setSBMLNamespacesAndOwn(new SBMLNamespaces(level, version));
 }
 
 
@@ -663,10 +662,11 @@ Compartment::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "constant")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getConstant();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -709,15 +709,11 @@ Compartment::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "size")
-  {
-    value = getSize();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "volume")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getVolume();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -743,10 +739,11 @@ Compartment::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "spatialDimensions")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getSpatialDimensions();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -772,20 +769,11 @@ Compartment::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "units")
-  {
-    value = getUnits();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "outside")
-  {
-    value = getOutside();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "compartmentType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getCompartmentType();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -806,33 +794,11 @@ Compartment::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "size")
-  {
-    value = isSetSize();
-  }
-  else if (attributeName == "volume")
-  {
-    value = isSetVolume();
-  }
-  else if (attributeName == "units")
-  {
-    value = isSetUnits();
-  }
-  else if (attributeName == "spatialDimensions")
-  {
-    value = isSetSpatialDimensions();
-  }
-  else if (attributeName == "constant")
-  {
-    value = isSetConstant();
-  }
-  else if (attributeName == "outside")
-  {
-    value = isSetOutside();
-  }
-  else if (attributeName == "compartmentType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetCompartmentType();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -852,9 +818,11 @@ Compartment::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "constant")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setConstant(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -891,13 +859,11 @@ Compartment::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "size")
-  {
-    return_value = setSize(value);
-  }
-  else if (attributeName == "volume")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setVolume(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -918,9 +884,11 @@ Compartment::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "spatialDimensions")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setSpatialDimensions(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -941,17 +909,11 @@ Compartment::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "units")
-  {
-    return_value = setUnits(value);
-  }
-  else if (attributeName == "outside")
-  {
-    return_value = setOutside(value);
-  }
-  else if (attributeName == "compartmentType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setCompartmentType(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -971,41 +933,391 @@ Compartment::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "size")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = unsetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Compartment.
+ */
+int
+Compartment::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "size", "volume", "units",
+    "spatialDimensions", "constant", "outside", "compartmentType" };
+
+  for (int i = ATTR_SIZE; i < ATTR_COUNT; i++)
   {
-    value = unsetSize();
+    if (attributeName == names[i - ATTR_SIZE])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "volume")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_CONSTANT:
+    value = getConstant();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_SIZE:
+    value = getSize();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_VOLUME:
+    value = getVolume();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::getAttribute(int attributeId, unsigned int& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_SPATIAL_DIMENSIONS:
+    value = getSpatialDimensions();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetVolume();
+  case ATTR_UNITS:
+    value = getUnits();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_OUTSIDE:
+    value = getOutside();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COMPARTMENT_TYPE:
+    value = getCompartmentType();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Compartment is set.
+ */
+bool
+Compartment::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_SIZE:
+    return isSetSize();
+  case ATTR_VOLUME:
+    return isSetVolume();
+  case ATTR_UNITS:
+    return isSetUnits();
+  case ATTR_SPATIAL_DIMENSIONS:
+    return isSetSpatialDimensions();
+  case ATTR_CONSTANT:
+    return isSetConstant();
+  case ATTR_OUTSIDE:
+    return isSetOutside();
+  case ATTR_COMPARTMENT_TYPE:
+    return isSetCompartmentType();
+  default:
+    break;
   }
-  else if (attributeName == "units")
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
   {
-    value = unsetUnits();
+  case ATTR_CONSTANT:
+    return setConstant(value);
+  default:
+    break;
   }
-  else if (attributeName == "spatialDimensions")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
   {
-    value = unsetSpatialDimensions();
+  case ATTR_SIZE:
+    return setSize(value);
+  case ATTR_VOLUME:
+    return setVolume(value);
+  default:
+    break;
   }
-  else if (attributeName == "constant")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
   {
-    value = unsetConstant();
+  case ATTR_SPATIAL_DIMENSIONS:
+    return setSpatialDimensions(value);
+  default:
+    break;
   }
-  else if (attributeName == "outside")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetOutside();
+  case ATTR_UNITS:
+    return setUnits(value);
+  case ATTR_OUTSIDE:
+    return setOutside(value);
+  case ATTR_COMPARTMENT_TYPE:
+    return setCompartmentType(value);
+  default:
+    break;
   }
-  else if (attributeName == "compartmentType")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * Compartment.
+ */
+int
+Compartment::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetCompartmentType();
+  case ATTR_SIZE:
+    return unsetSize();
+  case ATTR_VOLUME:
+    return unsetVolume();
+  case ATTR_UNITS:
+    return unsetUnits();
+  case ATTR_SPATIAL_DIMENSIONS:
+    return unsetSpatialDimensions();
+  case ATTR_CONSTANT:
+    return unsetConstant();
+  case ATTR_OUTSIDE:
+    return unsetOutside();
+  case ATTR_COMPARTMENT_TYPE:
+    return unsetCompartmentType();
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Compartment::forEachElement(bool (*action)(SBase*, void*),
+                            void* userData,
+                            ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -1060,27 +1372,28 @@ Compartment::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreModelLOCompartmentsAllowedCoreAttributes, level,
-          version, details, getLine(), getColumn());
+        SBMLError rewritten(CoreModelLOCompartmentsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreCompartmentAllowedAttributes, level, version,
+        SBMLError rewritten(CoreCompartmentAllowedAttributes, level, version,
           details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -281,7 +281,7 @@ CoordinateComponent::setType(const CoordinateKind_t type)
 int
 CoordinateComponent::setType(const std::string& type)
 {
-  mType = CoordinateKind_fromString(type.c_str());
+  mType = CoordinateKind_fromStringWithLength(type.c_str(), type.size());
 
   if (mType == SPATIAL_COORDINATEKIND_INVALID)
   {
@@ -886,20 +886,11 @@ CoordinateComponent::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "type")
-  {
-    value = getTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "unit")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -920,17 +911,11 @@ CoordinateComponent::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "type")
-  {
-    value = isSetType();
-  }
-  else if (attributeName == "unit")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetUnit();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1022,17 +1007,11 @@ CoordinateComponent::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "type")
-  {
-    return_value = setType(value);
-  }
-  else if (attributeName == "unit")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setUnit(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1053,20 +1032,283 @@ CoordinateComponent::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "type")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "type", "unit" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetType();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "unit")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetUnit();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_TYPE:
+    value = getTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_UNIT:
+    value = getUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CoordinateComponent is set.
+ */
+bool
+CoordinateComponent::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_TYPE:
+    return isSetType();
+  case ATTR_UNIT:
+    return isSetUnit();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_TYPE:
+    return setType(value);
+  case ATTR_UNIT:
+    return setUnit(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CoordinateComponent.
+ */
+int
+CoordinateComponent::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_TYPE:
+    return unsetType();
+  case ATTR_UNIT:
+    return unsetUnit();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1304,6 +1546,17 @@ CoordinateComponent::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1312,15 +1565,67 @@ List*
 CoordinateComponent::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CoordinateComponent::forEachElement(bool (*action)(SBase*, void*),
+                                    void* userData,
+                                    ElementFilter* filter)
+{
+  if (mBoundaryMin != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBoundaryMin)) &&
+      !action(mBoundaryMin, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mBoundaryMin, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mBoundaryMax, filter);
+    if (!mBoundaryMin->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (mBoundaryMax != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBoundaryMax)) &&
+      !action(mBoundaryMax, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mBoundaryMax->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1426,45 +1731,47 @@ CoordinateComponent::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialGeometryLOCoordinateComponentsAllowedAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError
+          rewritten(SpatialGeometryLOCoordinateComponentsAllowedAttributes,
+            level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+              LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialGeometryLOCoordinateComponentsAllowedCoreAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialGeometryLOCoordinateComponentsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialCoordinateComponentAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCoordinateComponentAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialCoordinateComponentAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialCoordinateComponentAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1515,7 +1822,7 @@ CoordinateComponent::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mType = CoordinateKind_fromString(type.c_str());
+      mType = CoordinateKind_fromStringWithLength(type.c_str(), type.size());
 
       if (log && CoordinateKind_isValid(mType) == 0)
       {
@@ -593,10 +593,11 @@ DefaultValues::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "stroke-width")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getStrokeWidth();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -640,10 +641,11 @@ DefaultValues::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "startHead")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getStartHead();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -664,13 +666,11 @@ DefaultValues::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "stroke-width")
-  {
-    value = isSetStrokeWidth();
-  }
-  else if (attributeName == "startHead")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetStartHead();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -724,9 +724,11 @@ DefaultValues::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "stroke-width")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setStrokeWidth(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -765,9 +767,11 @@ DefaultValues::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "startHead")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setStartHead(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -787,16 +791,286 @@ DefaultValues::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "stroke-width")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetStrokeWidth();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "startHead")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * DefaultValues.
+ */
+int
+DefaultValues::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "stroke-width", "startHead" };
+
+  for (int i = ATTR_STROKE_WIDTH; i < ATTR_COUNT; i++)
   {
-    value = unsetStartHead();
+    if (attributeName == names[i - ATTR_STROKE_WIDTH])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_STROKE_WIDTH:
+    value = getStrokeWidth();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_START_HEAD:
+    value = getStartHead();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this DefaultValues is set.
+ */
+bool
+DefaultValues::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_STROKE_WIDTH:
+    return isSetStrokeWidth();
+  case ATTR_START_HEAD:
+    return isSetStartHead();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_STROKE_WIDTH:
+    return setStrokeWidth(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_START_HEAD:
+    return setStartHead(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * DefaultValues.
+ */
+int
+DefaultValues::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_STROKE_WIDTH:
+    return unsetStrokeWidth();
+  case ATTR_START_HEAD:
+    return unsetStartHead();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -980,6 +1254,17 @@ DefaultValues::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -988,14 +1273,53 @@ List*
 DefaultValues::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mFontSize, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+DefaultValues::forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter* filter)
+{
+  if (mFontSize != NULL)
+  {
+    if ((filter == NULL || filter->filter(mFontSize)) && !action(mFontSize,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mFontSize->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1075,28 +1399,30 @@ DefaultValues::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("render", RenderDefaultValuesAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderDefaultValuesAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("render",
-          RenderDefaultValuesAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(RenderDefaultValuesAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
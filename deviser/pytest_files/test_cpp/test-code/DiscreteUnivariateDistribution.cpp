@@ -875,6 +875,222 @@ DiscreteUnivariateDistribution::unsetAttribute(const std::string&
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::lookupAttribute(const std::string&
+  attributeName)
+{
+  return UnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::getAttribute(int attributeId,
+                                             bool& value) const
+{
+  return UnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::getAttribute(int attributeId,
+                                             int& value) const
+{
+  return UnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::getAttribute(int attributeId,
+                                             double& value) const
+{
+  return UnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::getAttribute(int attributeId,
+                                             unsigned int& value) const
+{
+  return UnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::getAttribute(int attributeId,
+                                             std::string& value) const
+{
+  return UnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this DiscreteUnivariateDistribution is set.
+ */
+bool
+DiscreteUnivariateDistribution::isSetAttribute(int attributeId) const
+{
+  return UnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::setAttribute(int attributeId, bool value)
+{
+  return UnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::setAttribute(int attributeId, int value)
+{
+  return UnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::setAttribute(int attributeId, double value)
+{
+  return UnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::setAttribute(int attributeId,
+                                             unsigned int value)
+{
+  return UnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::setAttribute(int attributeId,
+                                             const std::string& value)
+{
+  return UnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * DiscreteUnivariateDistribution.
+ */
+int
+DiscreteUnivariateDistribution::unsetAttribute(int attributeId)
+{
+  return UnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1111,6 +1327,17 @@ DiscreteUnivariateDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1119,15 +1346,67 @@ List*
 DiscreteUnivariateDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+DiscreteUnivariateDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                               void* userData,
+                                               ElementFilter* filter)
+{
+  if (mTruncationLowerBound != NULL)
+  {
+    if ((filter == NULL || filter->filter(mTruncationLowerBound)) &&
+      !action(mTruncationLowerBound, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mTruncationLowerBound, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mTruncationUpperBound, filter);
+    if (!mTruncationLowerBound->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (mTruncationUpperBound != NULL)
+  {
+    if ((filter == NULL || filter->filter(mTruncationUpperBound)) &&
+      !action(mTruncationUpperBound, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mTruncationUpperBound->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1221,29 +1500,31 @@ DiscreteUnivariateDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   UnivariateDistribution::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribDiscreteUnivariateDistributionAllowedAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError
+          rewritten(DistribDiscreteUnivariateDistributionAllowedAttributes,
+            level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+              LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribDiscreteUnivariateDistributionAllowedCoreAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribDiscreteUnivariateDistributionAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -64,7 +64,6 @@ Event::Event(unsigned int level, unsigned int version)
   , mEventAssignments (level, version)
   , mTimeUnits ("")
 {
-  setSBMLNamespacesAndOwn(new SBMLNamespaces(level, version));
   connectToChild();
 }
 
@@ -903,10 +902,11 @@ Event::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "useValuesFromTriggerTime")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getUseValuesFromTriggerTime();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -984,10 +984,11 @@ Event::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "timeUnits")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getTimeUnits();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1008,13 +1009,11 @@ Event::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "useValuesFromTriggerTime")
-  {
-    value = isSetUseValuesFromTriggerTime();
-  }
-  else if (attributeName == "timeUnits")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetTimeUnits();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1034,9 +1033,11 @@ Event::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "useValuesFromTriggerTime")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setUseValuesFromTriggerTime(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1108,9 +1109,11 @@ Event::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "timeUnits")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setTimeUnits(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1130,16 +1133,275 @@ Event::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "useValuesFromTriggerTime")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetUseValuesFromTriggerTime();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "timeUnits")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Event.
+ */
+int
+Event::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "useValuesFromTriggerTime", "timeUnits"
+    };
+
+  for (int i = ATTR_USE_VALUES_FROM_TRIGGER_TIME; i < ATTR_COUNT; i++)
   {
-    value = unsetTimeUnits();
+    if (attributeName == names[i - ATTR_USE_VALUES_FROM_TRIGGER_TIME])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_USE_VALUES_FROM_TRIGGER_TIME:
+    value = getUseValuesFromTriggerTime();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_TIME_UNITS:
+    value = getTimeUnits();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Event is set.
+ */
+bool
+Event::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_USE_VALUES_FROM_TRIGGER_TIME:
+    return isSetUseValuesFromTriggerTime();
+  case ATTR_TIME_UNITS:
+    return isSetTimeUnits();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
+  {
+  case ATTR_USE_VALUES_FROM_TRIGGER_TIME:
+    return setUseValuesFromTriggerTime(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_TIME_UNITS:
+    return setTimeUnits(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Event.
+ */
+int
+Event::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_USE_VALUES_FROM_TRIGGER_TIME:
+    return unsetUseValuesFromTriggerTime();
+  case ATTR_TIME_UNITS:
+    return unsetTimeUnits();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1400,6 +1662,17 @@ Event::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1408,17 +1681,95 @@ List*
 Event::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mTrigger, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mPriority, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mDelay, filter);
 
-  ADD_FILTERED_LIST(ret, sublist, mEventAssignments, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Event::forEachElement(bool (*action)(SBase*, void*),
+                      void* userData,
+                      ElementFilter* filter)
+{
+  if (mTrigger != NULL)
+  {
+    if ((filter == NULL || filter->filter(mTrigger)) && !action(mTrigger,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mTrigger->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+  if (mPriority != NULL)
+  {
+    if ((filter == NULL || filter->filter(mPriority)) && !action(mPriority,
+      userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mPriority->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mDelay != NULL)
+  {
+    if ((filter == NULL || filter->filter(mDelay)) && !action(mDelay,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mDelay->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mEventAssignments.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mEventAssignments)) &&
+      !action(&mEventAssignments, userData))
+    {
+      return false;
+    }
+
+    if (!mEventAssignments.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1534,27 +1885,28 @@ Event::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreModelLOEventsAllowedCoreAttributes, level, version,
-          details, getLine(), getColumn());
+        SBMLError rewritten(CoreModelLOEventsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreEventAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        SBMLError rewritten(CoreEventAllowedAttributes, level, version,
+          details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
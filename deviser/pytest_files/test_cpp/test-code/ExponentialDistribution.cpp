@@ -664,6 +664,217 @@ ExponentialDistribution::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::lookupAttribute(const std::string& attributeName)
+{
+  return ContinuousUnivariateDistribution::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::getAttribute(int attributeId, bool& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::getAttribute(int attributeId, int& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::getAttribute(int attributeId, double& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::getAttribute(int attributeId,
+                                      unsigned int& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::getAttribute(int attributeId,
+                                      std::string& value) const
+{
+  return ContinuousUnivariateDistribution::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ExponentialDistribution is set.
+ */
+bool
+ExponentialDistribution::isSetAttribute(int attributeId) const
+{
+  return ContinuousUnivariateDistribution::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::setAttribute(int attributeId, bool value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::setAttribute(int attributeId, int value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::setAttribute(int attributeId, double value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::setAttribute(int attributeId, unsigned int value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::setAttribute(int attributeId,
+                                      const std::string& value)
+{
+  return ContinuousUnivariateDistribution::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ExponentialDistribution.
+ */
+int
+ExponentialDistribution::unsetAttribute(int attributeId)
+{
+  return ContinuousUnivariateDistribution::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -843,6 +1054,17 @@ ExponentialDistribution::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -851,14 +1073,52 @@ List*
 ExponentialDistribution::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mRate, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ExponentialDistribution::forEachElement(bool (*action)(SBase*, void*),
+                                        void* userData,
+                                        ElementFilter* filter)
+{
+  if (mRate != NULL)
+  {
+    if ((filter == NULL || filter->filter(mRate)) && !action(mRate, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mRate->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -935,6 +1195,7 @@ ExponentialDistribution::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   ContinuousUnivariateDistribution::readAttributes(attributes,
     expectedAttributes);
 
@@ -942,23 +1203,24 @@ ExponentialDistribution::readAttributes(const XMLAttributes& attributes,
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribExponentialDistributionAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribExponentialDistributionAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribExponentialDistributionAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError
+          rewritten(DistribExponentialDistributionAllowedCoreAttributes, level,
+            version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+              LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -571,20 +571,14 @@ int
 ExternalParameter::getAttribute(const std::string& attributeName,
                                 std::string& value) const
 {
-  int return_value = UncertValue::getAttribute(attributeName, value);
-
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
-  {
-    return return_value;
-  }
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "definitionURL")
+  if (attributeId != -1)
   {
-    value = getDefinitionURL();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return getAttribute(attributeId, value);
   }
 
-  return return_value;
+  return UncertValue::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -600,14 +594,14 @@ ExternalParameter::getAttribute(const std::string& attributeName,
 bool
 ExternalParameter::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = UncertValue::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "definitionURL")
+  if (attributeId != -1)
   {
-    value = isSetDefinitionURL();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return UncertValue::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -693,14 +687,14 @@ int
 ExternalParameter::setAttribute(const std::string& attributeName,
                                 const std::string& value)
 {
-  int return_value = UncertValue::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "definitionURL")
+  if (attributeId != -1)
   {
-    return_value = setDefinitionURL(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return UncertValue::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -715,14 +709,265 @@ ExternalParameter::setAttribute(const std::string& attributeName,
 int
 ExternalParameter::unsetAttribute(const std::string& attributeName)
 {
-  int value = UncertValue::unsetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return unsetAttribute(attributeId);
+  }
+
+  return UncertValue::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "definitionURL" };
+
+  for (int i = ATTR_DEFINITION_URL; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_DEFINITION_URL])
+    {
+      return i;
+    }
+  }
+
+  return UncertValue::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::getAttribute(int attributeId, bool& value) const
+{
+  return UncertValue::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::getAttribute(int attributeId, int& value) const
+{
+  return UncertValue::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::getAttribute(int attributeId, double& value) const
+{
+  return UncertValue::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::getAttribute(int attributeId, unsigned int& value) const
+{
+  return UncertValue::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_DEFINITION_URL:
+    value = getDefinitionURL();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return UncertValue::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ExternalParameter is set.
+ */
+bool
+ExternalParameter::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_DEFINITION_URL:
+    return isSetDefinitionURL();
+  default:
+    break;
+  }
+
+  return UncertValue::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::setAttribute(int attributeId, bool value)
+{
+  return UncertValue::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::setAttribute(int attributeId, int value)
+{
+  return UncertValue::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::setAttribute(int attributeId, double value)
+{
+  return UncertValue::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::setAttribute(int attributeId, unsigned int value)
+{
+  return UncertValue::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_DEFINITION_URL:
+    return setDefinitionURL(value);
+  default:
+    break;
+  }
 
-  if (attributeName == "definitionURL")
+  return UncertValue::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ExternalParameter.
+ */
+int
+ExternalParameter::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetDefinitionURL();
+  case ATTR_DEFINITION_URL:
+    return unsetDefinitionURL();
+  default:
+    break;
   }
 
-  return value;
+  return UncertValue::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -905,6 +1150,17 @@ ExternalParameter::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -913,14 +1169,53 @@ List*
 ExternalParameter::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ExternalParameter::forEachElement(bool (*action)(SBase*, void*),
+                                  void* userData,
+                                  ElementFilter* filter)
+{
+  if (mExternalParameters != NULL)
+  {
+    if ((filter == NULL || filter->filter(mExternalParameters)) &&
+      !action(mExternalParameters, userData))
+    {
+      return false;
+    }
 
+    if (!mExternalParameters->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_FILTERED_POINTER(ret, sublist, mExternalParameters, filter);
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1000,44 +1295,46 @@ ExternalParameter::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribExternalDistributionLOExternalParametersAllowedAttributes,
-            pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribExternalDistributionLOExternalParametersAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib", DistribExternalDistributionLOExternalParametersAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribExternalDistributionLOExternalParametersAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   UncertValue::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("distrib",
-          DistribExternalParameterAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(DistribExternalParameterAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("distrib",
-          DistribExternalParameterAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(DistribExternalParameterAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "distrib", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
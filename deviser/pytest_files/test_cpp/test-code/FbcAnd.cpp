@@ -680,6 +680,202 @@ FbcAnd::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this FbcAnd.
+ */
+int
+FbcAnd::lookupAttribute(const std::string& attributeName)
+{
+  return Association::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::getAttribute(int attributeId, bool& value) const
+{
+  return Association::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::getAttribute(int attributeId, int& value) const
+{
+  return Association::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::getAttribute(int attributeId, double& value) const
+{
+  return Association::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::getAttribute(int attributeId, unsigned int& value) const
+{
+  return Association::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::getAttribute(int attributeId, std::string& value) const
+{
+  return Association::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this FbcAnd is set.
+ */
+bool
+FbcAnd::isSetAttribute(int attributeId) const
+{
+  return Association::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::setAttribute(int attributeId, bool value)
+{
+  return Association::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::setAttribute(int attributeId, int value)
+{
+  return Association::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::setAttribute(int attributeId, double value)
+{
+  return Association::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::setAttribute(int attributeId, unsigned int value)
+{
+  return Association::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::setAttribute(int attributeId, const std::string& value)
+{
+  return Association::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this FbcAnd.
+ */
+int
+FbcAnd::unsetAttribute(int attributeId)
+{
+  return Association::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -885,6 +1081,17 @@ FbcAnd::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -893,14 +1100,53 @@ List*
 FbcAnd::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mAssociations, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+FbcAnd::forEachElement(bool (*action)(SBase*, void*),
+                       void* userData,
+                       ElementFilter* filter)
+{
+  if (mAssociations.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mAssociations)) &&
+      !action(&mAssociations, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mAssociations.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -962,27 +1208,30 @@ FbcAnd::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   Association::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("fbc", FbcAndAllowedAttributes, pkgVersion, level,
-          version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcAndAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "fbc",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("fbc", FbcAndAllowedCoreAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcAndAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "fbc", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -0,0 +1,1705 @@
+/**
+ * @file Field.cpp
+ * @brief Implementation of the Field class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sbml/packages/lazy/sbml/Field.h>
+#include <sbml/packages/lazy/sbml/ListOfFields.h>
+#include <sbml/packages/lazy/validator/LazySBMLError.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
+
+
+#define ARRAY_TEXT_NONE 0
+#define ARRAY_TEXT_KEPT 1
+#define ARRAY_TEXT_PARSING 2
+
+#ifndef ARRAY_TEXT_STATE_LOAD
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define ARRAY_TEXT_STATE_LOAD(state) (state)
+#define ARRAY_TEXT_STATE_SWAP(state, from, to) \
+  (_InterlockedCompareExchange(&(state), (to), (from)) == (from))
+#else
+#define ARRAY_TEXT_STATE_LOAD(state) \
+  __atomic_load_n(&(state), __ATOMIC_ACQUIRE)
+#define ARRAY_TEXT_STATE_SWAP(state, from, to) \
+  __sync_bool_compare_and_swap(&(state), (from), (to))
+#endif
+#endif
+
+using namespace std;
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new Field using the given SBML Level, Version and
+ * &ldquo;lazy&rdquo; package version.
+ */
+Field::Field(unsigned int level,
+             unsigned int version,
+             unsigned int pkgVersion)
+  : SBase(level, version)
+  , mSamples (NULL)
+  , mSamplesCount (0)
+  , mSamplesTextState (ARRAY_TEXT_NONE)
+  , mSamplesLength (SBML_INT_MAX)
+  , mIsSetSamplesLength (false)
+{
+  setSBMLNamespacesAndOwn(new LazyPkgNamespaces(level, version, pkgVersion));
+}
+
+
+/*
+ * Creates a new Field using the given LazyPkgNamespaces object.
+ */
+Field::Field(LazyPkgNamespaces *lazyns)
+  : SBase(lazyns)
+  , mSamples (NULL)
+  , mSamplesCount (0)
+  , mSamplesTextState (ARRAY_TEXT_NONE)
+  , mSamplesLength (SBML_INT_MAX)
+  , mIsSetSamplesLength (false)
+{
+  setElementNamespace(lazyns->getURI());
+  loadPlugins(lazyns);
+}
+
+
+/*
+ * Copy constructor for Field.
+ */
+Field::Field(const Field& orig)
+  : SBase( orig )
+  , mSamples ( NULL )
+  , mSamplesCount ( 0 )
+  , mSamplesTextState ( ARRAY_TEXT_NONE )
+  , mSamplesLength ( orig.mSamplesLength )
+  , mIsSetSamplesLength ( orig.mIsSetSamplesLength )
+{
+  orig.parseSamplesText();
+  setSamples(orig.mSamples, orig.mSamplesCount);
+  mSamplesLength = orig.mSamplesLength;
+  mIsSetSamplesLength = orig.mIsSetSamplesLength;
+
+}
+
+
+/*
+ * Assignment operator for Field.
+ */
+Field&
+Field::operator=(const Field& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(rhs);
+    rhs.parseSamplesText();
+    unsetSamples();
+    setSamples(rhs.mSamples, rhs.mSamplesCount);
+    mSamplesLength = rhs.mSamplesLength;
+    mIsSetSamplesLength = rhs.mIsSetSamplesLength;
+  }
+
+  return *this;
+}
+
+
+/*
+ * Creates and returns a deep copy of this Field object.
+ */
+Field*
+Field::clone() const
+{
+  return new Field(*this);
+}
+
+
+/*
+ * Destructor for Field.
+ */
+Field::~Field()
+{
+  if (mSamples != NULL)
+  {
+    delete [] mSamples;
+  }
+
+  mSamples = NULL;
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Field.
+ */
+const std::string&
+Field::getId() const
+{
+  return mId;
+}
+
+
+/*
+ * Returns the value of the "samples" attribute of this Field.
+ */
+void
+Field::getSamples(double* outArray) const
+{
+  parseSamplesText();
+
+  if (outArray == NULL || mSamples == NULL)
+  {
+    return;
+  }
+
+  int count = mSamplesCount;
+
+  if (mSamplesLength < count)
+  {
+    count = mSamplesLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mSamples, sizeof(double)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "samples" attribute of this Field.
+ */
+const double*
+Field::getSamplesPointer() const
+{
+  parseSamplesText();
+
+  return mSamples;
+}
+
+
+/*
+ * Returns the number of values held by the "samples" attribute of this Field.
+ */
+int
+Field::getSamplesCount() const
+{
+  parseSamplesText();
+
+  return mSamplesCount;
+}
+
+
+/*
+ * Returns the value of the "samplesLength" attribute of this Field.
+ */
+int
+Field::getSamplesLength() const
+{
+  parseSamplesText();
+
+  return mSamplesLength;
+}
+
+
+/*
+ * Predicate returning @c true if this Field's "id" attribute is set.
+ */
+bool
+Field::isSetId() const
+{
+  return (mId.empty() == false);
+}
+
+
+/*
+ * Predicate returning @c true if this Field's "samples" attribute is set.
+ */
+bool
+Field::isSetSamples() const
+{
+  parseSamplesText();
+
+  return (mSamples != NULL);
+}
+
+
+/*
+ * Predicate returning @c true if this Field's "samplesLength" attribute is
+ * set.
+ */
+bool
+Field::isSetSamplesLength() const
+{
+  parseSamplesText();
+
+  return mIsSetSamplesLength;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Field.
+ */
+int
+Field::setId(const std::string& id)
+{
+  return SyntaxChecker::checkAndSetSId(id, mId);
+}
+
+
+/*
+ * Sets the value of the "samples" attribute of this Field.
+ */
+int
+Field::setSamples(double* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  mSamplesText.clear();
+
+  if (mSamples != NULL)
+  {
+    delete[] mSamples;
+  }
+
+  mSamples = new double[arrayLength];
+  memcpy(mSamples, inArray, sizeof(double)*arrayLength);
+  mSamplesCount = arrayLength;
+  mIsSetSamplesLength = true;
+  mSamplesLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "samples" attribute of this Field by taking ownership
+ * of the given array.
+ */
+int
+Field::adoptSamples(double* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  mSamplesText.clear();
+
+  if (mSamples != NULL && mSamples != inArray)
+  {
+    delete[] mSamples;
+  }
+
+  mSamples = inArray;
+  mSamplesCount = arrayLength;
+  mIsSetSamplesLength = true;
+  mSamplesLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Releases the value of the "samples" attribute of this Field to the caller.
+ */
+double*
+Field::releaseSamples()
+{
+  parseSamplesText();
+
+  double* array = mSamples;
+  mSamples = NULL;
+  mSamplesCount = 0;
+  unsetSamplesLength();
+  return array;
+}
+
+
+/*
+ * Sets the value of the "samplesLength" attribute of this Field.
+ */
+int
+Field::setSamplesLength(int samplesLength)
+{
+  parseSamplesText();
+
+  mSamplesLength = samplesLength;
+  mIsSetSamplesLength = true;
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Field.
+ */
+int
+Field::unsetId()
+{
+  mId.erase();
+
+  if (mId.empty() == true)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Unsets the value of the "samples" attribute of this Field.
+ */
+int
+Field::unsetSamples()
+{
+  mSamplesText.clear();
+
+  if (mSamples != NULL)
+  {
+    delete[] mSamples;
+  }
+
+  mSamples = NULL;
+  mSamplesCount = 0;
+
+  return unsetSamplesLength();
+}
+
+
+/*
+ * Unsets the value of the "samplesLength" attribute of this Field.
+ */
+int
+Field::unsetSamplesLength()
+{
+  parseSamplesText();
+
+  mSamplesLength = SBML_INT_MAX;
+  mIsSetSamplesLength = false;
+
+  if (isSetSamplesLength() == false)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Returns the XML element name of this Field object.
+ */
+const std::string&
+Field::getElementName() const
+{
+  static const string name = "field";
+  return name;
+}
+
+
+/*
+ * Returns the libSBML type code for this Field object.
+ */
+int
+Field::getTypeCode() const
+{
+  return SBML_LAZY_FIELD;
+}
+
+
+/*
+ * Predicate returning @c true if all the required attributes for this Field
+ * object have been set.
+ */
+bool
+Field::hasRequiredAttributes() const
+{
+  bool allPresent = true;
+
+  if (isSetId() == false)
+  {
+    allPresent = false;
+  }
+
+  if (isSetSamples() == false)
+  {
+    allPresent = false;
+  }
+
+  if (isSetSamplesLength() == false)
+  {
+    allPresent = false;
+  }
+
+  return allPresent;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Write any contained elements
+ */
+void
+Field::writeElements(XMLOutputStream& stream) const
+{
+  SBase::writeElements(stream);
+
+  SBase::writeExtensionElements(stream);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Accepts the given SBMLVisitor
+ */
+bool
+Field::accept(SBMLVisitor& v) const
+{
+  return v.visit(*this);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the parent SBMLDocument
+ */
+void
+Field::setSBMLDocument(SBMLDocument* d)
+{
+  SBase::setSBMLDocument(d);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * used to write arrays
+ */
+void
+Field::write(XMLOutputStream& stream) const
+{
+  stream.startElement(getElementName(), getPrefix());
+  writeAttributes(stream);
+
+  if (isSetSamples())
+  {
+    // values are formatted straight into a chunk that is written
+    // when full, without a stream for each value
+
+    char chunk[65536 + 32];
+    size_t used = 0;
+    char point = *localeconv()->decimal_point;
+
+    for (int i = 0; i < mSamplesCount; ++i)
+    {
+      double val = (double)mSamples[i];
+
+      if (val != val)
+      {
+        memcpy(chunk + used, "NaN ", 4);
+        used += 4;
+      }
+      else if (val - val != 0 && val > 0)
+      {
+        memcpy(chunk + used, "INF ", 4);
+        used += 4;
+      }
+      else if (val - val != 0)
+      {
+        memcpy(chunk + used, "-INF ", 5);
+        used += 5;
+      }
+      else
+      {
+        int n = sprintf(chunk + used, "%.15g", val);
+
+        if (strtod(chunk + used, NULL) != val)
+        {
+          n = sprintf(chunk + used, "%.17g", val);
+        }
+
+        if (point != '.')
+        {
+          for (int j = 0; j < n; ++j)
+          {
+            if (chunk[used + j] == point)
+            {
+              chunk[used + j] = '.';
+            }
+          }
+        }
+
+        used += n;
+        chunk[used++] = ' ';
+      }
+
+      if (used >= 65536)
+      {
+        stream << std::string(chunk, used);
+        used = 0;
+      }
+    }
+
+    stream << std::string(chunk, used);
+  }
+
+  stream.endElement(getElementName(), getPrefix());
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Enables/disables the given package with this element
+ */
+void
+Field::enablePackageInternal(const std::string& pkgURI,
+                             const std::string& pkgPrefix,
+                             bool flag)
+{
+  SBase::enablePackageInternal(pkgURI, pkgPrefix, flag);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::getAttribute(const std::string& attributeName, bool& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::getAttribute(const std::string& attributeName, int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::getAttribute(const std::string& attributeName, double& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::getAttribute(const std::string& attributeName,
+                    unsigned int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::getAttribute(const std::string& attributeName,
+                    std::string& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if this Field's attribute "attributeName" is
+ * set.
+ */
+bool
+Field::isSetAttribute(const std::string& attributeName) const
+{
+  bool value = SBase::isSetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = isSetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::setAttribute(const std::string& attributeName, bool value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::setAttribute(const std::string& attributeName, int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::setAttribute(const std::string& attributeName, double value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::setAttribute(const std::string& attributeName, unsigned int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::setAttribute(const std::string& attributeName,
+                    const std::string& value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this Field.
+ */
+int
+Field::unsetAttribute(const std::string& attributeName)
+{
+  int value = SBase::unsetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = unsetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Field.
+ */
+int
+Field::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "samples", "samplesLength" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_SAMPLES_LENGTH:
+    value = getSamplesLength();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Field is set.
+ */
+bool
+Field::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_SAMPLES:
+    return isSetSamples();
+  case ATTR_SAMPLES_LENGTH:
+    return isSetSamplesLength();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_SAMPLES_LENGTH:
+    return setSamplesLength(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Field.
+ */
+int
+Field::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_SAMPLES:
+    return unsetSamples();
+  case ATTR_SAMPLES_LENGTH:
+    return unsetSamplesLength();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Field::forEachElement(bool (*action)(SBase*, void*),
+                      void* userData,
+                      ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the expected attributes for this element
+ */
+void
+Field::addExpectedAttributes(ExpectedAttributes& attributes)
+{
+  SBase::addExpectedAttributes(attributes);
+
+  attributes.add("id");
+
+  attributes.add("samplesLength");
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Reads the expected attributes into the member data variables
+ */
+void
+Field::readAttributes(const XMLAttributes& attributes,
+                      const ExpectedAttributes& expectedAttributes)
+{
+  unsigned int level = getLevel();
+  unsigned int version = getVersion();
+  unsigned int pkgVersion = getPackageVersion();
+  unsigned int numErrs;
+  bool assigned = false;
+  SBMLErrorLog* log = getErrorLog();
+
+  if (log && getParentSBMLObject() &&
+    static_cast<ListOfFields*>(getParentSBMLObject())->size() < 2)
+  {
+    numErrs = log->getNumErrors();
+    for (int n = numErrs-1; n >= 0; n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(LazyModelLOFieldsAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "lazy", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(LazyModelLOFieldsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "lazy", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  unsigned int errMark = log ? log->getNumErrors() : 0;
+  SBase::readAttributes(attributes, expectedAttributes);
+
+  if (log)
+  {
+    numErrs = log->getNumErrors();
+
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(LazyFieldAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "lazy", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(LazyFieldAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "lazy", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  // 
+  // id SId (use = "required" )
+  // 
+
+  assigned = attributes.readInto("id", mId);
+
+  if (assigned == true)
+  {
+    if (mId.empty() == true)
+    {
+      logEmptyString(mId, level, version, "<Field>");
+    }
+    else if (SyntaxChecker::isValidSBMLSId(mId) == false)
+    {
+      log->logPackageError("lazy", LazyIdSyntaxRule, pkgVersion, level,
+        version, "The id on the <" + getElementName() + "> is '" + mId + "', "
+          "which does not conform to the syntax.", getLine(), getColumn());
+    }
+  }
+  else
+  {
+    if (log)
+    {
+      std::string message = "Lazy attribute 'id' is missing from the <Field> "
+        "element.";
+      log->logPackageError("lazy", LazyFieldAllowedAttributes, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+
+  // 
+  // samplesLength int (use = "required" )
+  // 
+
+  numErrs = log ? log->getNumErrors() : 0;
+  mIsSetSamplesLength = attributes.readInto("samplesLength", mSamplesLength);
+
+  if ( mIsSetSamplesLength == false && log)
+  {
+    if (log && log->getNumErrors() == numErrs + 1 &&
+      log->contains(XMLAttributeTypeMismatch))
+    {
+      log->remove(XMLAttributeTypeMismatch);
+      std::string message = "Lazy attribute 'samplesLength' from the <Field> "
+        "element must be an integer.";
+      log->logPackageError("lazy", LazyFieldSamplesLengthMustBeInteger,
+        pkgVersion, level, version, message, getLine(), getColumn());
+    }
+    else
+    {
+      std::string message = "Lazy attribute 'samplesLength' is missing from the "
+        "<Field> element.";
+      log->logPackageError("lazy", LazyFieldAllowedAttributes, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Writes the attributes to the stream
+ */
+void
+Field::writeAttributes(XMLOutputStream& stream) const
+{
+  SBase::writeAttributes(stream);
+
+  if (isSetId() == true)
+  {
+    stream.writeAttribute("id", getPrefix(), mId);
+  }
+
+  if (isSetSamplesLength() == true)
+  {
+    stream.writeAttribute("samplesLength", getPrefix(), mSamplesLength);
+  }
+
+  SBase::writeExtensionAttributes(stream);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Writes the array data as a text element
+ */
+void
+Field::setElementText(const std::string& text)
+{
+  mSamplesText = text;
+  mSamplesTextState = ARRAY_TEXT_KEPT;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Parses the text kept for the array data, if any
+ */
+void
+Field::parseSamplesText() const
+{
+  if (ARRAY_TEXT_STATE_LOAD(mSamplesTextState) == ARRAY_TEXT_NONE)
+  {
+    return;
+  }
+
+  if (ARRAY_TEXT_STATE_SWAP(mSamplesTextState, ARRAY_TEXT_KEPT,
+    ARRAY_TEXT_PARSING))
+  {
+    doParseSamplesText();
+    ARRAY_TEXT_STATE_SWAP(mSamplesTextState, ARRAY_TEXT_PARSING,
+      ARRAY_TEXT_NONE);
+    return;
+  }
+
+  while (ARRAY_TEXT_STATE_LOAD(mSamplesTextState) != ARRAY_TEXT_NONE)
+  {
+    // another thread is parsing the text
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Parses the text kept for the array data; only parseSamplesText() calls this
+ */
+void
+Field::doParseSamplesText() const
+{
+  if (mSamplesText.empty())
+  {
+    return;
+  }
+
+  std::string text;
+  text.swap(mSamplesText);
+
+  unsigned int capacity = 0;
+  unsigned int length = 0;
+  bool inValue = false;
+
+  // count the values so the array is only allocated once
+
+  for (const char* c = text.c_str(); *c != '\0'; ++c)
+  {
+    if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+    {
+      inValue = false;
+    }
+    else if (inValue == false)
+    {
+      inValue = true;
+      capacity++;
+    }
+  }
+
+  if (capacity == 0)
+  {
+    return;
+  }
+
+  // the classic locale reads the same numbers whatever the global locale is
+
+  std::istringstream parser(text);
+  std::istringstream number;
+  parser.imbue(std::locale::classic());
+  number.imbue(std::locale::classic());
+  std::string word;
+  double* data = new double[capacity];
+
+  while (length < capacity && parser >> word)
+  {
+    double val = 0;
+
+    if (word == "NaN")
+    {
+      val = std::numeric_limits<double>::quiet_NaN();
+    }
+    else if (word == "INF")
+    {
+      val = std::numeric_limits<double>::infinity();
+    }
+    else if (word == "-INF")
+    {
+      val = -std::numeric_limits<double>::infinity();
+    }
+    else
+    {
+      number.clear();
+      number.str(word);
+      number >> val;
+
+      if (number.fail() || number.peek() != EOF)
+      {
+        break;
+      }
+    }
+
+    data[length++] = (double)(val);
+  }
+
+  if (length == 0)
+  {
+    delete[] data;
+  }
+  else
+  {
+    const_cast<Field*>(this)->adoptSamples(data, length);
+  }
+}
+
+/** @endcond */
+
+
+
+
+#endif /* __cplusplus */
+
+
+/*
+ * Creates a new Field_t using the given SBML Level, Version and
+ * &ldquo;lazy&rdquo; package version.
+ */
+LIBSBML_EXTERN
+Field_t *
+Field_create(unsigned int level,
+             unsigned int version,
+             unsigned int pkgVersion)
+{
+  return new Field(level, version, pkgVersion);
+}
+
+
+/*
+ * Creates and returns a deep copy of this Field_t object.
+ */
+LIBSBML_EXTERN
+Field_t*
+Field_clone(const Field_t* f)
+{
+  if (f != NULL)
+  {
+    return static_cast<Field_t*>(f->clone());
+  }
+  else
+  {
+    return NULL;
+  }
+}
+
+
+/*
+ * Frees this Field_t object.
+ */
+LIBSBML_EXTERN
+void
+Field_free(Field_t* f)
+{
+  if (f != NULL)
+  {
+    delete f;
+  }
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+char *
+Field_getId(const Field_t * f)
+{
+  if (f == NULL)
+  {
+    return NULL;
+  }
+
+  return f->getId().empty() ? NULL : safe_strdup(f->getId().c_str());
+}
+
+
+/*
+ * Returns the value of the "samplesLength" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_getSamplesLength(const Field_t * f)
+{
+  return (f != NULL) ? f->getSamplesLength() : SBML_INT_MAX;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Field_t's "id" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Field_isSetId(const Field_t * f)
+{
+  return (f != NULL) ? static_cast<int>(f->isSetId()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Field_t's "samples" attribute is
+ * set.
+ */
+LIBSBML_EXTERN
+int
+Field_isSetSamples(const Field_t * f)
+{
+  return (f != NULL) ? static_cast<int>(f->isSetSamples()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Field_t's "samplesLength" attribute
+ * is set.
+ */
+LIBSBML_EXTERN
+int
+Field_isSetSamplesLength(const Field_t * f)
+{
+  return (f != NULL) ? static_cast<int>(f->isSetSamplesLength()) : 0;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_setId(Field_t * f, const char * id)
+{
+  return (f != NULL) ? f->setId(id) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "samples" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_setSamples(Field_t* f, double* samples, int arrayLength)
+{
+  return (f != NULL) ? f->setSamples(samples, arrayLength) :
+    LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "samplesLength" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_setSamplesLength(Field_t * f, int samplesLength)
+{
+  return (f != NULL) ? f->setSamplesLength(samplesLength) :
+    LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_unsetId(Field_t * f)
+{
+  return (f != NULL) ? f->unsetId() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "samples" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_unsetSamples(Field_t * f)
+{
+  return (f != NULL) ? f->unsetSamples() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "samplesLength" attribute of this Field_t.
+ */
+LIBSBML_EXTERN
+int
+Field_unsetSamplesLength(Field_t * f)
+{
+  return (f != NULL) ? f->unsetSamplesLength() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if all the required attributes for this
+ * Field_t object have been set.
+ */
+LIBSBML_EXTERN
+int
+Field_hasRequiredAttributes(const Field_t * f)
+{
+  return (f != NULL) ? static_cast<int>(f->hasRequiredAttributes()) : 0;
+}
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,1350 @@
+/**
+ * @file Field.h
+ * @brief Definition of the Field class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class Field
+ * @sbmlbrief{lazy} TODO:Definition of the Field class.
+ */
+
+
+#ifndef Field_H__
+#define Field_H__
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+#include <sbml/packages/lazy/common/lazyfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+
+
+#include <sbml/SBase.h>
+#include <sbml/packages/lazy/extension/LazyExtension.h>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSBML_EXTERN Field : public SBase
+{
+protected:
+
+  /** @cond doxygenLibsbmlInternal */
+
+  double* mSamples;
+  int mSamplesCount;
+  mutable std::string mSamplesText;
+  mutable volatile long mSamplesTextState;
+  int mSamplesLength;
+  bool mIsSetSamplesLength;
+
+  /** @endcond */
+
+public:
+
+  /**
+   * Creates a new Field using the given SBML Level, Version and
+   * &ldquo;lazy&rdquo; package version.
+   *
+   * @param level an unsigned int, the SBML Level to assign to this Field.
+   *
+   * @param version an unsigned int, the SBML Version to assign to this Field.
+   *
+   * @param pkgVersion an unsigned int, the SBML Lazy Version to assign to this
+   * Field.
+   *
+   * @copydetails doc_note_setting_lv_pkg
+   */
+  Field(unsigned int level = LazyExtension::getDefaultLevel(),
+        unsigned int version = LazyExtension::getDefaultVersion(),
+        unsigned int pkgVersion = LazyExtension::getDefaultPackageVersion());
+
+
+  /**
+   * Creates a new Field using the given LazyPkgNamespaces object.
+   *
+   * @copydetails doc_what_are_sbml_package_namespaces
+   *
+   * @param lazyns the LazyPkgNamespaces object.
+   *
+   * @copydetails doc_note_setting_lv_pkg
+   */
+  Field(LazyPkgNamespaces *lazyns);
+
+
+  /**
+   * Copy constructor for Field.
+   *
+   * @param orig the Field instance to copy.
+   */
+  Field(const Field& orig);
+
+
+  /**
+   * Assignment operator for Field.
+   *
+   * @param rhs the Field object whose values are to be used as the basis of
+   * the assignment.
+   */
+  Field& operator=(const Field& rhs);
+
+
+  /**
+   * Creates and returns a deep copy of this Field object.
+   *
+   * @return a (deep) copy of this Field object.
+   */
+  virtual Field* clone() const;
+
+
+  /**
+   * Destructor for Field.
+   */
+  virtual ~Field();
+
+
+  /**
+   * Returns the value of the "id" attribute of this Field.
+   *
+   * @return the value of the "id" attribute of this Field as a string.
+   */
+  virtual const std::string& getId() const;
+
+
+  /**
+   * Returns the value of the "samples" attribute of this Field.
+   *
+   * @param outArray double* array that will be used to return the value of the
+   * "samples" attribute of this Field.
+   *
+   * @note the value of the "samples" attribute of this Field is returned in
+   * the argument array; no more than getSamplesLength() values are copied.
+   */
+  void getSamples(double* outArray) const;
+
+
+  /**
+   * Returns a pointer to the value of the "samples" attribute of this Field.
+   *
+   * @return a pointer to the array held by this Field, or @c NULL if it is not
+   * set.
+   *
+   * @note the array is not copied; it has getSamplesCount() entries and
+   * remains owned by this Field.
+   */
+  const double* getSamplesPointer() const;
+
+
+  /**
+   * Returns the number of values held by the "samples" attribute of this
+   * Field.
+   *
+   * @return the number of values in the array returned by getSamplesPointer(),
+   * or @c 0 if it is not set.
+   *
+   * @note this is the size of the array itself, which the "samplesLength"
+   * attribute need not match.
+   */
+  int getSamplesCount() const;
+
+
+  /**
+   * Returns the value of the "samplesLength" attribute of this Field.
+   *
+   * @return the value of the "samplesLength" attribute of this Field as a
+   * integer.
+   */
+  int getSamplesLength() const;
+
+
+  /**
+   * Predicate returning @c true if this Field's "id" attribute is set.
+   *
+   * @return @c true if this Field's "id" attribute has been set, otherwise
+   * @c false is returned.
+   */
+  virtual bool isSetId() const;
+
+
+  /**
+   * Predicate returning @c true if this Field's "samples" attribute is set.
+   *
+   * @return @c true if this Field's "samples" attribute has been set,
+   * otherwise @c false is returned.
+   */
+  bool isSetSamples() const;
+
+
+  /**
+   * Predicate returning @c true if this Field's "samplesLength" attribute is
+   * set.
+   *
+   * @return @c true if this Field's "samplesLength" attribute has been set,
+   * otherwise @c false is returned.
+   */
+  bool isSetSamplesLength() const;
+
+
+  /**
+   * Sets the value of the "id" attribute of this Field.
+   *
+   * @param id std::string& value of the "id" attribute to be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * Calling this function with @p id = @c NULL or an empty string is
+   * equivalent to calling unsetId().
+   */
+  virtual int setId(const std::string& id);
+
+
+  /**
+   * Sets the value of the "samples" attribute of this Field.
+   *
+   * @param inArray double* array value of the "samples" attribute to be set.
+   *
+   * @param arrayLength int value for the length of the "samples" attribute to
+   * be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   */
+  int setSamples(double* inArray, int arrayLength);
+
+
+  /**
+   * Sets the value of the "samples" attribute of this Field by taking
+   * ownership of the given array.
+   *
+   * @param inArray double* array allocated with new[].
+   *
+   * @param arrayLength int value for the length of the "samples" attribute to
+   * be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * @note the array is not copied; this Field deletes it when it is no longer
+   * needed.
+   */
+  int adoptSamples(double* inArray, int arrayLength);
+
+
+  /**
+   * Releases the value of the "samples" attribute of this Field to the caller.
+   *
+   * @return the array held by this Field, or @c NULL if it is not set.
+   *
+   * @note the caller owns the returned array and must delete[] it; the
+   * attribute is unset.
+   */
+  double* releaseSamples();
+
+
+  /**
+   * Sets the value of the "samplesLength" attribute of this Field.
+   *
+   * @param samplesLength int value of the "samplesLength" attribute to be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   */
+  int setSamplesLength(int samplesLength);
+
+
+  /**
+   * Unsets the value of the "id" attribute of this Field.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetId();
+
+
+  /**
+   * Unsets the value of the "samples" attribute of this Field.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int unsetSamples();
+
+
+  /**
+   * Unsets the value of the "samplesLength" attribute of this Field.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  int unsetSamplesLength();
+
+
+  /**
+   * Returns the XML element name of this Field object.
+   *
+   * For Field, the XML element name is always @c "field".
+   *
+   * @return the name of this element, i.e. @c "field".
+   */
+  virtual const std::string& getElementName() const;
+
+
+  /**
+   * Returns the libSBML type code for this Field object.
+   *
+   * @copydetails doc_what_are_typecodes
+   *
+   * @return the SBML type code for this object:
+   * @sbmlconstant{SBML_LAZY_FIELD, SBMLLazyTypeCode_t}.
+   *
+   * @copydetails doc_warning_typecodes_not_unique
+   *
+   * @see getElementName()
+   * @see getPackageName()
+   */
+  virtual int getTypeCode() const;
+
+
+  /**
+   * Predicate returning @c true if all the required attributes for this Field
+   * object have been set.
+   *
+   * @return @c true to indicate that all the required attributes of this Field
+   * have been set, otherwise @c false is returned.
+   *
+   *
+   * @note The required attributes for the Field object are:
+   * @li "id"
+   * @li "samples"
+   * @li "samplesLength"
+   */
+  virtual bool hasRequiredAttributes() const;
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Write any contained elements
+   */
+  virtual void writeElements(XMLOutputStream& stream) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Accepts the given SBMLVisitor
+   */
+  virtual bool accept(SBMLVisitor& v) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the parent SBMLDocument
+   */
+  virtual void setSBMLDocument(SBMLDocument* d);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * used to write arrays
+   */
+  virtual void write(XMLOutputStream& stream) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Enables/disables the given package with this element
+   */
+  virtual void enablePackageInternal(const std::string& pkgURI,
+                                     const std::string& pkgPrefix,
+                                     bool flag);
+
+  /** @endcond */
+
+
+
+
+  #ifndef SWIG
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Identifiers for the attributes of this Field, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_ID = 0,
+    ATTR_SAMPLES,
+    ATTR_SAMPLES_LENGTH,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to retrieve.
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(const std::string& attributeName, bool& value)
+    const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to retrieve.
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(const std::string& attributeName, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to retrieve.
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(const std::string& attributeName,
+                           double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to retrieve.
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(const std::string& attributeName,
+                           unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to retrieve.
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(const std::string& attributeName,
+                           std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Predicate returning @c true if this Field's attribute "attributeName" is
+   * set.
+   *
+   * @param attributeName, the name of the attribute to query.
+   *
+   * @return @c true if this Field's attribute "attributeName" has been set,
+   * otherwise @c false is returned.
+   */
+  virtual bool isSetAttribute(const std::string& attributeName) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to set.
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(const std::string& attributeName, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to set.
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(const std::string& attributeName, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to set.
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(const std::string& attributeName, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to set.
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(const std::string& attributeName,
+                           unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to set.
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(const std::string& attributeName,
+                           const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Unsets the value of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute to query.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this Field.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this Field is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this Field.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
+
+  #endif /* !SWIG */
+
+
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
+protected:
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the expected attributes for this element
+   */
+  virtual void addExpectedAttributes(ExpectedAttributes& attributes);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Reads the expected attributes into the member data variables
+   */
+  virtual void readAttributes(const XMLAttributes& attributes,
+                              const ExpectedAttributes& expectedAttributes);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Writes the attributes to the stream
+   */
+  virtual void writeAttributes(XMLOutputStream& stream) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Writes the array data as a text element
+   *
+   * @note the text is only parsed when the array is first used.
+   */
+  virtual void setElementText(const std::string& text);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Parses the text kept for the array data, if any
+   *
+   * The const getters call this, so threads reading the same object, as a
+   * parallel validation does, may call it at once; the first of them to find
+   * the text kept parses it while the others wait, and once it is parsed no
+   * thread waits at all.
+   */
+  void parseSamplesText() const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Parses the text kept for the array data; only parseSamplesText() calls
+   * this
+   */
+  void doParseSamplesText() const;
+
+  /** @endcond */
+
+
+};
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
+
+
+#endif /* __cplusplus */
+
+
+
+
+#ifndef SWIG
+
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+BEGIN_C_DECLS
+
+
+/**
+ * Creates a new Field_t using the given SBML Level, Version and
+ * &ldquo;lazy&rdquo; package version.
+ *
+ * @param level an unsigned int, the SBML Level to assign to this Field_t.
+ *
+ * @param version an unsigned int, the SBML Version to assign to this Field_t.
+ *
+ * @param pkgVersion an unsigned int, the SBML Lazy Version to assign to this
+ * Field_t.
+ *
+ * @copydetails doc_note_setting_lv_pkg
+ *
+ * @copydetails doc_returned_owned_pointer
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+Field_t *
+Field_create(unsigned int level,
+             unsigned int version,
+             unsigned int pkgVersion);
+
+
+/**
+ * Creates and returns a deep copy of this Field_t object.
+ *
+ * @param f the Field_t structure.
+ *
+ * @return a (deep) copy of this Field_t object.
+ *
+ * @copydetails doc_returned_owned_pointer
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+Field_t*
+Field_clone(const Field_t* f);
+
+
+/**
+ * Frees this Field_t object.
+ *
+ * @param f the Field_t structure.
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+void
+Field_free(Field_t* f);
+
+
+/**
+ * Returns the value of the "id" attribute of this Field_t.
+ *
+ * @param f the Field_t structure whose id is sought.
+ *
+ * @return the value of the "id" attribute of this Field_t as a pointer to a
+ * string.
+ *
+ * @copydetails doc_returned_owned_char
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+char *
+Field_getId(const Field_t * f);
+
+
+/**
+ * Returns the value of the "samplesLength" attribute of this Field_t.
+ *
+ * @param f the Field_t structure whose samplesLength is sought.
+ *
+ * @return the value of the "samplesLength" attribute of this Field_t as a
+ * integer.
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_getSamplesLength(const Field_t * f);
+
+
+/**
+ * Predicate returning @c 1 (true) if this Field_t's "id" attribute is set.
+ *
+ * @param f the Field_t structure.
+ *
+ * @return @c 1 (true) if this Field_t's "id" attribute has been set, otherwise
+ * @c 0 (false) is returned.
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_isSetId(const Field_t * f);
+
+
+/**
+ * Predicate returning @c 1 (true) if this Field_t's "samples" attribute is
+ * set.
+ *
+ * @param f the Field_t structure.
+ *
+ * @return @c 1 (true) if this Field_t's "samples" attribute has been set,
+ * otherwise @c 0 (false) is returned.
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_isSetSamples(const Field_t * f);
+
+
+/**
+ * Predicate returning @c 1 (true) if this Field_t's "samplesLength" attribute
+ * is set.
+ *
+ * @param f the Field_t structure.
+ *
+ * @return @c 1 (true) if this Field_t's "samplesLength" attribute has been
+ * set, otherwise @c 0 (false) is returned.
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_isSetSamplesLength(const Field_t * f);
+
+
+/**
+ * Sets the value of the "id" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @param id const char * value of the "id" attribute to be set.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+ *
+ * Calling this function with @p id = @c NULL or an empty string is equivalent
+ * to calling Field_unsetId().
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_setId(Field_t * f, const char * id);
+
+
+/**
+ * Sets the value of the "samples" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @param samples pointer value of the "samples" attribute to be set.
+ *
+ * @param arrayLength int value for the length of the "samples" attribute to be
+ * set.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_setSamples(Field_t* f, double* samples, int arrayLength);
+
+
+/**
+ * Sets the value of the "samplesLength" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @param samplesLength int value of the "samplesLength" attribute to be set.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_setSamplesLength(Field_t * f, int samplesLength);
+
+
+/**
+ * Unsets the value of the "id" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_unsetId(Field_t * f);
+
+
+/**
+ * Unsets the value of the "samples" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_unsetSamples(Field_t * f);
+
+
+/**
+ * Unsets the value of the "samplesLength" attribute of this Field_t.
+ *
+ * @param f the Field_t structure.
+ *
+ * @copydetails doc_returns_success_code
+ * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+ * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_unsetSamplesLength(Field_t * f);
+
+
+/**
+ * Predicate returning @c 1 (true) if all the required attributes for this
+ * Field_t object have been set.
+ *
+ * @param f the Field_t structure.
+ *
+ * @return @c 1 (true) to indicate that all the required attributes of this
+ * Field_t have been set, otherwise @c 0 (false) is returned.
+ *
+ *
+ * @note The required attributes for the Field_t object are:
+ * @li "id"
+ * @li "samples"
+ * @li "samplesLength"
+ *
+ * @memberof Field_t
+ */
+LIBSBML_EXTERN
+int
+Field_hasRequiredAttributes(const Field_t * f);
+
+
+
+
+END_C_DECLS
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
+
+
+#endif /* !SWIG */
+
+
+
+
+#endif /* !Field_H__ */
+
+
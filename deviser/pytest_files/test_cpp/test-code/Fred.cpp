@@ -384,7 +384,7 @@ Fred::setMyEnum(const Kind_t kind)
 int
 Fred::setMyEnum(const std::string& kind)
 {
-  mMyEnum = Kind_fromString(kind.c_str());
+  mMyEnum = Kind_fromStringWithLength(kind.c_str(), kind.size());
 
   if (mMyEnum == X_KIND_INVALID)
   {
@@ -1024,10 +1024,11 @@ Fred::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "myBoolean")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getBol();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1052,10 +1053,11 @@ Fred::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "myNumber")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1115,20 +1117,11 @@ Fred::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "identifier")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "myString")
-  {
-    value = getStr();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "myEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getMyEnumAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1148,25 +1141,11 @@ Fred::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "identifier")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "myBoolean")
-  {
-    value = isSetBol();
-  }
-  else if (attributeName == "myNumber")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "myString")
-  {
-    value = isSetStr();
-  }
-  else if (attributeName == "myEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetMyEnum();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1186,9 +1165,11 @@ Fred::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "myBoolean")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setBol(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1208,9 +1189,11 @@ Fred::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "myNumber")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1264,17 +1247,11 @@ Fred::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "identifier")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "myString")
-  {
-    return_value = setStr(value);
-  }
-  else if (attributeName == "myEnum")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setMyEnum(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1294,28 +1271,314 @@ Fred::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "identifier")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = unsetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Fred.
+ */
+int
+Fred::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "identifier", "myBoolean", "myNumber",
+    "myString", "myEnum" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetId();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "myBoolean")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
   {
-    value = unsetBol();
+  case ATTR_BOL:
+    value = getBol();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "myNumber")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetNum();
+  case ATTR_NUM:
+    value = getNum();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "myString")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetStr();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_STR:
+    value = getStr();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_KIND:
+    value = getMyEnumAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "myEnum")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Fred is set.
+ */
+bool
+Fred::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetMyEnum();
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_BOL:
+    return isSetBol();
+  case ATTR_NUM:
+    return isSetNum();
+  case ATTR_STR:
+    return isSetStr();
+  case ATTR_KIND:
+    return isSetMyEnum();
+  default:
+    break;
   }
 
-  return value;
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
+  {
+  case ATTR_BOL:
+    return setBol(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_NUM:
+    return setNum(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_STR:
+    return setStr(value);
+  case ATTR_KIND:
+    return setMyEnum(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Fred.
+ */
+int
+Fred::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_BOL:
+    return unsetBol();
+  case ATTR_NUM:
+    return unsetNum();
+  case ATTR_STR:
+    return unsetStr();
+  case ATTR_KIND:
+    return unsetMyEnum();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1600,6 +1863,17 @@ Fred::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1608,16 +1882,81 @@ List*
 Fred::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Fred::forEachElement(bool (*action)(SBase*, void*),
+                     void* userData,
+                     ElementFilter* filter)
+{
+  if (mOther != NULL)
+  {
+    if ((filter == NULL || filter->filter(mOther)) && !action(mOther,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mOther, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mOther1, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mMyOther, filter);
+    if (!mOther->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
+  if (mOther1 != NULL)
+  {
+    if ((filter == NULL || filter->filter(mOther1)) && !action(mOther1,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mOther1->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mMyOther != NULL)
+  {
+    if ((filter == NULL || filter->filter(mMyOther)) && !action(mMyOther,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mMyOther->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1730,27 +2069,30 @@ Fred::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("x", XFredAllowedAttributes, pkgVersion, level,
-          version, details, getLine(), getColumn());
+        SBMLError rewritten(XFredAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "x",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("x", XFredAllowedCoreAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(XFredAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "x", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1859,7 +2201,7 @@ Fred::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mMyEnum = Kind_fromString(kind.c_str());
+      mMyEnum = Kind_fromStringWithLength(kind.c_str(), kind.size());
 
       if (log && Kind_isValid(mMyEnum) == 0)
       {
@@ -243,7 +243,9 @@ Geometry::setCoordinateSystem(const GeometryKind_t coordinateSystem)
 int
 Geometry::setCoordinateSystem(const std::string& coordinateSystem)
 {
-  mCoordinateSystem = GeometryKind_fromString(coordinateSystem.c_str());
+  mCoordinateSystem =
+    GeometryKind_fromStringWithLength(coordinateSystem.c_str(),
+      coordinateSystem.size());
 
   if (mCoordinateSystem == SPATIAL_GEOMETRYKIND_INVALID)
   {
@@ -1727,15 +1729,11 @@ Geometry::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "coordinateSystem")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getCoordinateSystemAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1756,13 +1754,11 @@ Geometry::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "coordinateSystem")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetCoordinateSystem();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1851,13 +1847,11 @@ Geometry::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "coordinateSystem")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setCoordinateSystem(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1877,16 +1871,263 @@ Geometry::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "coordinateSystem")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Geometry.
+ */
+int
+Geometry::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "coordinateSystem" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetCoordinateSystem();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COORDINATE_SYSTEM:
+    value = getCoordinateSystemAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Geometry is set.
+ */
+bool
+Geometry::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_COORDINATE_SYSTEM:
+    return isSetCoordinateSystem();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Geometry.
+ */
+int
+Geometry::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_COORDINATE_SYSTEM:
+    return setCoordinateSystem(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * Geometry.
+ */
+int
+Geometry::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_COORDINATE_SYSTEM:
+    return unsetCoordinateSystem();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -2308,6 +2549,17 @@ Geometry::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -2316,19 +2568,123 @@ List*
 Geometry::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mCoordinateComponents, filter);
-  ADD_FILTERED_LIST(ret, sublist, mDomainTypes, filter);
-  ADD_FILTERED_LIST(ret, sublist, mDomains, filter);
-  ADD_FILTERED_LIST(ret, sublist, mAdjacentDomains, filter);
-  ADD_FILTERED_LIST(ret, sublist, mGeometryDefinitions, filter);
-  ADD_FILTERED_LIST(ret, sublist, mSampledFields, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Geometry::forEachElement(bool (*action)(SBase*, void*),
+                         void* userData,
+                         ElementFilter* filter)
+{
+  if (mCoordinateComponents.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mCoordinateComponents)) &&
+      !action(&mCoordinateComponents, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mCoordinateComponents.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mDomainTypes.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mDomainTypes)) &&
+      !action(&mDomainTypes, userData))
+    {
+      return false;
+    }
+
+    if (!mDomainTypes.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mDomains.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mDomains)) && !action(&mDomains,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mDomains.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mAdjacentDomains.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mAdjacentDomains)) &&
+      !action(&mAdjacentDomains, userData))
+    {
+      return false;
+    }
+
+    if (!mAdjacentDomains.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mGeometryDefinitions.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mGeometryDefinitions)) &&
+      !action(&mGeometryDefinitions, userData))
+    {
+      return false;
+    }
+
+    if (!mGeometryDefinitions.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mSampledFields.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mSampledFields)) &&
+      !action(&mSampledFields, userData))
+    {
+      return false;
+    }
+
+    if (!mSampledFields.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -2456,27 +2812,30 @@ Geometry::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialGeometryAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialGeometryAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial", SpatialGeometryAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialGeometryAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -2516,7 +2875,9 @@ Geometry::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mCoordinateSystem = GeometryKind_fromString(coordinateSystem.c_str());
+      mCoordinateSystem =
+        GeometryKind_fromStringWithLength(coordinateSystem.c_str(),
+          coordinateSystem.size());
 
       if (log && GeometryKind_isValid(mCoordinateSystem) == 0)
       {
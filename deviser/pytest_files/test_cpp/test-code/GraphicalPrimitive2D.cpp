@@ -223,7 +223,7 @@ GraphicalPrimitive2D::setFillRule(const FillRule_t fillRule)
 int
 GraphicalPrimitive2D::setFillRule(const std::string& fillRule)
 {
-  mFillRule = FillRule_fromString(fillRule.c_str());
+  mFillRule = FillRule_fromStringWithLength(fillRule.c_str(), fillRule.size());
 
   if (mFillRule == FILL_EVENODD_INVALID)
   {
@@ -507,25 +507,14 @@ int
 GraphicalPrimitive2D::getAttribute(const std::string& attributeName,
                                    std::string& value) const
 {
-  int return_value = GraphicalPrimitive1D::getAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  if (attributeId != -1)
   {
-    return return_value;
+    return getAttribute(attributeId, value);
   }
 
-  if (attributeName == "fill")
-  {
-    value = getFill();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "fill-rule")
-  {
-    value = getFillRuleAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-
-  return return_value;
+  return GraphicalPrimitive1D::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -541,18 +530,14 @@ GraphicalPrimitive2D::getAttribute(const std::string& attributeName,
 bool
 GraphicalPrimitive2D::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = GraphicalPrimitive1D::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "fill")
-  {
-    value = isSetFill();
-  }
-  else if (attributeName == "fill-rule")
+  if (attributeId != -1)
   {
-    value = isSetFillRule();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return GraphicalPrimitive1D::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -645,18 +630,14 @@ int
 GraphicalPrimitive2D::setAttribute(const std::string& attributeName,
                                    const std::string& value)
 {
-  int return_value = GraphicalPrimitive1D::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "fill")
-  {
-    return_value = setFill(value);
-  }
-  else if (attributeName == "fill-rule")
+  if (attributeId != -1)
   {
-    return_value = setFillRule(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive1D::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -672,18 +653,274 @@ GraphicalPrimitive2D::setAttribute(const std::string& attributeName,
 int
 GraphicalPrimitive2D::unsetAttribute(const std::string& attributeName)
 {
-  int value = GraphicalPrimitive1D::unsetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "fill")
+  if (attributeId != -1)
   {
-    value = unsetFill();
+    return unsetAttribute(attributeId);
   }
-  else if (attributeName == "fill-rule")
+
+  return GraphicalPrimitive1D::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "fill", "fill-rule" };
+
+  for (int i = ATTR_FILL; i < ATTR_COUNT; i++)
   {
-    value = unsetFillRule();
+    if (attributeName == names[i - ATTR_FILL])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return GraphicalPrimitive1D::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::getAttribute(int attributeId, bool& value) const
+{
+  return GraphicalPrimitive1D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::getAttribute(int attributeId, int& value) const
+{
+  return GraphicalPrimitive1D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::getAttribute(int attributeId, double& value) const
+{
+  return GraphicalPrimitive1D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GraphicalPrimitive1D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_FILL:
+    value = getFill();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FILL_RULE:
+    value = getFillRuleAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive1D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this GraphicalPrimitive2D is set.
+ */
+bool
+GraphicalPrimitive2D::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_FILL:
+    return isSetFill();
+  case ATTR_FILL_RULE:
+    return isSetFillRule();
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive1D::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::setAttribute(int attributeId, bool value)
+{
+  return GraphicalPrimitive1D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::setAttribute(int attributeId, int value)
+{
+  return GraphicalPrimitive1D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::setAttribute(int attributeId, double value)
+{
+  return GraphicalPrimitive1D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::setAttribute(int attributeId, unsigned int value)
+{
+  return GraphicalPrimitive1D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_FILL:
+    return setFill(value);
+  case ATTR_FILL_RULE:
+    return setFillRule(value);
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive1D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * GraphicalPrimitive2D.
+ */
+int
+GraphicalPrimitive2D::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_FILL:
+    return unsetFill();
+  case ATTR_FILL_RULE:
+    return unsetFillRule();
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive1D::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -745,29 +982,30 @@ GraphicalPrimitive2D::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GraphicalPrimitive1D::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("render",
-          RenderGraphicalPrimitive2DAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderGraphicalPrimitive2DAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("render",
-          RenderGraphicalPrimitive2DAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderGraphicalPrimitive2DAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -801,7 +1039,8 @@ GraphicalPrimitive2D::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mFillRule = FillRule_fromString(fillRule.c_str());
+      mFillRule = FillRule_fromStringWithLength(fillRule.c_str(),
+        fillRule.size());
 
       if (log && FillRule_isValid(mFillRule) == 0)
       {
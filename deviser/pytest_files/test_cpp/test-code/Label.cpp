@@ -58,7 +58,6 @@ Label::Label(unsigned int level, unsigned int version)
   , mText ("")
   , mBBox (NULL)
 {
-  setSbgnNamespacesAndOwn(new SbgnNamespaces(level, version));
   connectToChild();
 }
 
@@ -192,6 +191,7 @@ Label::setId(const std::string& id)
   }
   else
   {
+    updateDocumentSIdIndex(mId, id);
     mId = id;
     return LIBSBGN_OPERATION_SUCCESS;
   }
@@ -215,6 +215,7 @@ Label::setText(const std::string& text)
 int
 Label::unsetId()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -289,12 +290,14 @@ Label::setBBox(const BBox* bbox)
   }
   else if (bbox == NULL)
   {
+    invalidateDocumentIdIndex();
     delete mBBox;
     mBBox = NULL;
     return LIBSBGN_OPERATION_SUCCESS;
   }
   else
   {
+    invalidateDocumentIdIndex();
     delete mBBox;
     mBBox = (bbox != NULL) ? bbox->clone() : NULL;
     if (mBBox != NULL)
@@ -333,6 +336,7 @@ Label::createBBox()
 int
 Label::unsetBBox()
 {
+  invalidateDocumentIdIndex();
   delete mBBox;
   mBBox = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -552,15 +556,11 @@ Label::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getId();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "text")
-  {
-    value = getText();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -581,13 +581,11 @@ Label::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "text")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetText();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -676,13 +674,11 @@ Label::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "text")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setText(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -702,16 +698,262 @@ Label::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "text")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Label.
+ */
+int
+Label::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "text" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetText();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_TEXT:
+    value = getText();
+    return LIBSBGN_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Label is set.
+ */
+bool
+Label::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_TEXT:
+    return isSetText();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::setAttribute(int attributeId, bool value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::setAttribute(int attributeId, int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::setAttribute(int attributeId, double value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_TEXT:
+    return setText(value);
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Label.
+ */
+int
+Label::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_TEXT:
+    return unsetText();
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -861,6 +1103,17 @@ Label::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SbgnBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SbgnBase objects, including those nested to an
  * arbitrary depth.
@@ -869,12 +1122,34 @@ List*
 Label::getAllElements(SbgnElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_SBGN_FILTERED_POINTER(ret, sublist, mBBox, filter);
 
+/*
+ * Calls @p action on each child SbgnBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Label::forEachElement(bool (*action)(SbgnBase*, void*),
+                      void* userData,
+                      SbgnElementFilter* filter)
+{
+  if (mBBox != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBBox)) && !action(mBBox, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mBBox->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -947,20 +1222,20 @@ Label::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SbgnErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlLabelAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, SbgnmlLabelAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
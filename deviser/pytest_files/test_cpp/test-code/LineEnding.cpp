@@ -689,20 +689,14 @@ LineEnding::updateSBMLNamespace(const std::string& package,
 int
 LineEnding::getAttribute(const std::string& attributeName, bool& value) const
 {
-  int return_value = GraphicalPrimitive2D::getAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  if (attributeId != -1)
   {
-    return return_value;
-  }
-
-  if (attributeName == "enableRotationalMapping")
-  {
-    value = getEnableRotationalMapping();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return getAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive2D::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -771,20 +765,14 @@ int
 LineEnding::getAttribute(const std::string& attributeName,
                          std::string& value) const
 {
-  int return_value = GraphicalPrimitive2D::getAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  if (attributeId != -1)
   {
-    return return_value;
+    return getAttribute(attributeId, value);
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-
-  return return_value;
+  return GraphicalPrimitive2D::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -800,18 +788,14 @@ LineEnding::getAttribute(const std::string& attributeName,
 bool
 LineEnding::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = GraphicalPrimitive2D::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "enableRotationalMapping")
+  if (attributeId != -1)
   {
-    value = isSetEnableRotationalMapping();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return GraphicalPrimitive2D::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -826,14 +810,14 @@ LineEnding::isSetAttribute(const std::string& attributeName) const
 int
 LineEnding::setAttribute(const std::string& attributeName, bool value)
 {
-  int return_value = GraphicalPrimitive2D::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "enableRotationalMapping")
+  if (attributeId != -1)
   {
-    return_value = setEnableRotationalMapping(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive2D::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -900,14 +884,14 @@ int
 LineEnding::setAttribute(const std::string& attributeName,
                          const std::string& value)
 {
-  int return_value = GraphicalPrimitive2D::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "id")
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive2D::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -922,18 +906,285 @@ LineEnding::setAttribute(const std::string& attributeName,
 int
 LineEnding::unsetAttribute(const std::string& attributeName)
 {
-  int value = GraphicalPrimitive2D::unsetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return unsetAttribute(attributeId);
+  }
+
+  return GraphicalPrimitive2D::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this LineEnding.
+ */
+int
+LineEnding::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "enableRotationalMapping" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return GraphicalPrimitive2D::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ENABLE_ROTATIONAL_MAPPING:
+    value = getEnableRotationalMapping();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::getAttribute(int attributeId, int& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::getAttribute(int attributeId, double& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this LineEnding is set.
+ */
+bool
+LineEnding::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_ENABLE_ROTATIONAL_MAPPING:
+    return isSetEnableRotationalMapping();
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive2D::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ENABLE_ROTATIONAL_MAPPING:
+    return setEnableRotationalMapping(value);
+  default:
+    break;
+  }
+
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::setAttribute(int attributeId, int value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
 
-  if (attributeName == "id")
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::setAttribute(int attributeId, double value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::setAttribute(int attributeId, unsigned int value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetId();
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
   }
-  else if (attributeName == "enableRotationalMapping")
+
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * LineEnding.
+ */
+int
+LineEnding::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetEnableRotationalMapping();
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_ENABLE_ROTATIONAL_MAPPING:
+    return unsetEnableRotationalMapping();
+  default:
+    break;
   }
 
-  return value;
+  return GraphicalPrimitive2D::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -1169,6 +1420,17 @@ LineEnding::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1177,15 +1439,77 @@ List*
 LineEnding::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+LineEnding::forEachElement(bool (*action)(SBase*, void*),
+                           void* userData,
+                           ElementFilter* filter)
+{
+  if (mGroup != NULL)
+  {
+    if ((filter == NULL || filter->filter(mGroup)) && !action(mGroup,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mGroup->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_FILTERED_POINTER(ret, sublist, mGroup, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mBoundingBox, filter);
+  if (mBoundingBox != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBoundingBox)) &&
+      !action(mBoundingBox, userData))
+    {
+      return false;
+    }
 
+    List* sublist = mBoundingBox->getAllElements(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1291,43 +1615,46 @@ LineEnding::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("render",
-          RenderRenderInformationBaseLOLineEndingsAllowedAttributes, pkgVersion,
-            level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderRenderInformationBaseLOLineEndingsAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("render",
-          RenderRenderInformationBaseLOLineEndingsAllowedCoreAttributes,
-            pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderRenderInformationBaseLOLineEndingsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GraphicalPrimitive2D::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("render", RenderLineEndingAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderLineEndingAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("render", RenderLineEndingAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderLineEndingAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -59,6 +59,7 @@ ListOfAnalyticVolumes::ListOfAnalyticVolumes(unsigned int level,
                                              unsigned int version,
                                              unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new SpatialPkgNamespaces(level, version,
     pkgVersion));
@@ -71,6 +72,7 @@ ListOfAnalyticVolumes::ListOfAnalyticVolumes(unsigned int level,
  */
 ListOfAnalyticVolumes::ListOfAnalyticVolumes(SpatialPkgNamespaces *spatialns)
   : ListOf(spatialns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(spatialns->getURI());
 }
@@ -81,6 +83,7 @@ ListOfAnalyticVolumes::ListOfAnalyticVolumes(SpatialPkgNamespaces *spatialns)
  */
 ListOfAnalyticVolumes::ListOfAnalyticVolumes(const ListOfAnalyticVolumes& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -94,6 +97,8 @@ ListOfAnalyticVolumes::operator=(const ListOfAnalyticVolumes& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -115,6 +120,8 @@ ListOfAnalyticVolumes::clone() const
  */
 ListOfAnalyticVolumes::~ListOfAnalyticVolumes()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -311,6 +318,100 @@ ListOfAnalyticVolumes::getByDomainType(const std::string& sid)
 }
 
 
+/*
+ * Fills the given columns with the attributes of every AnalyticVolume in this
+ * ListOfAnalyticVolumes.
+ */
+void
+ListOfAnalyticVolumes::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.functionType.resize(n);
+  columns.isSetFunctionType.resize(n);
+  columns.ordinal.resize(n);
+  columns.isSetOrdinal.resize(n);
+  columns.domainType.resize(n);
+  columns.isSetDomainType.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const AnalyticVolume* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.functionType[i] = item->getFunctionType();
+    columns.isSetFunctionType[i] = item->isSetFunctionType();
+    columns.ordinal[i] = item->getOrdinal();
+    columns.isSetOrdinal[i] = item->isSetOrdinal();
+    columns.domainType[i] = item->getDomainType();
+    columns.isSetDomainType[i] = item->isSetDomainType();
+  }
+}
+
+
+/*
+ * Creates a AnalyticVolume in this ListOfAnalyticVolumes for each row of the
+ * given columns.
+ */
+int
+ListOfAnalyticVolumes::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.functionType.size() == n);
+  sameSize = sameSize && (columns.isSetFunctionType.size() == n);
+  sameSize = sameSize && (columns.ordinal.size() == n);
+  sameSize = sameSize && (columns.isSetOrdinal.size() == n);
+  sameSize = sameSize && (columns.domainType.size() == n);
+  sameSize = sameSize && (columns.isSetDomainType.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    AnalyticVolume* item = createAnalyticVolume();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetFunctionType[i] &&
+      item->setFunctionType(columns.functionType[i]) !=
+        LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetOrdinal[i] && item->setOrdinal(columns.ordinal[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetDomainType[i] &&
+      item->setDomainType(columns.domainType[i]) != LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfAnalyticVolumes object.
  */
@@ -343,6 +444,52 @@ ListOfAnalyticVolumes::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfAnalyticVolumes::forEachElement(bool (*action)(SBase*, void*),
+                                      void* userData,
+                                      ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    AnalyticVolume* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -354,15 +501,22 @@ ListOfAnalyticVolumes::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+    mChildNamespaces = spatialns;
+  }
 
   if (name == "analyticVolume")
   {
-    object = new AnalyticVolume(spatialns);
+    object = new AnalyticVolume(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete spatialns;
   return object;
 }
 
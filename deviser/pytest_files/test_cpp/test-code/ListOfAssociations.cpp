@@ -63,6 +63,7 @@ ListOfAssociations::ListOfAssociations(unsigned int level,
                                        unsigned int pkgVersion)
   : ListOf(level, version)
   , mElementName("listOfAssociations")
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new FbcPkgNamespaces(level, version, pkgVersion));
 }
@@ -74,6 +75,7 @@ ListOfAssociations::ListOfAssociations(unsigned int level,
 ListOfAssociations::ListOfAssociations(FbcPkgNamespaces *fbcns)
   : ListOf(fbcns)
   , mElementName("listOfAssociations")
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(fbcns->getURI());
 }
@@ -85,6 +87,7 @@ ListOfAssociations::ListOfAssociations(FbcPkgNamespaces *fbcns)
 ListOfAssociations::ListOfAssociations(const ListOfAssociations& orig)
   : ListOf( orig )
   , mElementName ( orig.mElementName )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -99,6 +102,8 @@ ListOfAssociations::operator=(const ListOfAssociations& rhs)
   {
     ListOf::operator=(rhs);
     mElementName = rhs.mElementName;
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -120,6 +125,8 @@ ListOfAssociations::clone() const
  */
 ListOfAssociations::~ListOfAssociations()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -377,6 +384,52 @@ ListOfAssociations::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfAssociations::forEachElement(bool (*action)(SBase*, void*),
+                                   void* userData,
+                                   ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Association* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -388,33 +441,54 @@ ListOfAssociations::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  FBC_CREATE_NS(fbcns, getSBMLNamespaces());
-
-  if (name == "association")
-  {
-    object = new Association(fbcns);
-    appendAndOwn(object);
-  }
-
-  if (name == "fbcAnd")
-  {
-    object = new FbcAnd(fbcns);
-    appendAndOwn(object);
-  }
 
-  if (name == "fbcOr")
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
   {
-    object = new FbcOr(fbcns);
-    appendAndOwn(object);
+    delete mChildNamespaces;
+    FBC_CREATE_NS(fbcns, getSBMLNamespaces());
+    mChildNamespaces = fbcns;
   }
 
-  if (name == "geneProductRef")
+  switch (name.size())
   {
-    object = new GeneProductRef(fbcns);
-    appendAndOwn(object);
+  case 5:
+    if (name == "fbcOr")
+    {
+      object = new FbcOr(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 6:
+    if (name == "fbcAnd")
+    {
+      object = new FbcAnd(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 11:
+    if (name == "association")
+    {
+      object = new Association(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 14:
+    if (name == "geneProductRef")
+    {
+      object = new GeneProductRef(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  default:
+    break;
   }
 
-  delete fbcns;
   return object;
 }
 
@@ -66,6 +66,7 @@ ListOfCSGNodes::ListOfCSGNodes(unsigned int level,
                                unsigned int pkgVersion)
   : ListOf(level, version)
   , mElementName("csgNode")
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new SpatialPkgNamespaces(level, version,
     pkgVersion));
@@ -78,6 +79,7 @@ ListOfCSGNodes::ListOfCSGNodes(unsigned int level,
 ListOfCSGNodes::ListOfCSGNodes(SpatialPkgNamespaces *spatialns)
   : ListOf(spatialns)
   , mElementName("csgNode")
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(spatialns->getURI());
 }
@@ -89,6 +91,7 @@ ListOfCSGNodes::ListOfCSGNodes(SpatialPkgNamespaces *spatialns)
 ListOfCSGNodes::ListOfCSGNodes(const ListOfCSGNodes& orig)
   : ListOf( orig )
   , mElementName ( orig.mElementName )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -103,6 +106,8 @@ ListOfCSGNodes::operator=(const ListOfCSGNodes& rhs)
   {
     ListOf::operator=(rhs);
     mElementName = rhs.mElementName;
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -124,6 +129,8 @@ ListOfCSGNodes::clone() const
  */
 ListOfCSGNodes::~ListOfCSGNodes()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -416,6 +423,26 @@ ListOfCSGNodes::createCSGSetOperator()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every CSGNode in this
+ * ListOfCSGNodes.
+ */
+void
+ListOfCSGNodes::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const CSGNode* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+  }
+}
+
+
 /*
  * Returns the XML element name of this ListOfCSGNodes object.
  */
@@ -462,62 +489,132 @@ ListOfCSGNodes::getItemTypeCode() const
 }
 
 
-
-/** @cond doxygenLibsbmlInternal */
-
 /*
- * Creates a new CSGNode in this ListOfCSGNodes
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
  */
-SBase*
-ListOfCSGNodes::createObject(XMLInputStream& stream)
+bool
+ListOfCSGNodes::forEachElement(bool (*action)(SBase*, void*),
+                               void* userData,
+                               ElementFilter* filter)
 {
-  const std::string& name = stream.peek().getName();
-  SBase* object = NULL;
-  SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
-
-  if (name == "csgNode")
+  for (unsigned int i = 0; i < size(); i++)
   {
-    object = new CSGNode(spatialns);
-    appendAndOwn(object);
-  }
+    CSGNode* item = get(i);
 
-  if (name == "csgPrimitive")
-  {
-    object = new CSGPrimitive(spatialns);
-    appendAndOwn(object);
-  }
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
 
-  if (name == "csgTranslation")
-  {
-    object = new CSGTranslation(spatialns);
-    appendAndOwn(object);
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
   }
 
-  if (name == "csgRotation")
+  if (getNumPlugins() > 0)
   {
-    object = new CSGRotation(spatialns);
-    appendAndOwn(object);
-  }
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  if (name == "csgScale")
-  {
-    object = new CSGScale(spatialns);
-    appendAndOwn(object);
-  }
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  if (name == "csgHomogeneousTransformation")
-  {
-    object = new CSGHomogeneousTransformation(spatialns);
-    appendAndOwn(object);
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
   }
 
-  if (name == "csgSetOperator")
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates a new CSGNode in this ListOfCSGNodes
+ */
+SBase*
+ListOfCSGNodes::createObject(XMLInputStream& stream)
+{
+  const std::string& name = stream.peek().getName();
+  SBase* object = NULL;
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
   {
-    object = new CSGSetOperator(spatialns);
-    appendAndOwn(object);
+    delete mChildNamespaces;
+    SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+    mChildNamespaces = spatialns;
+  }
+
+  switch (name.size())
+  {
+  case 7:
+    if (name == "csgNode")
+    {
+      object = new CSGNode(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 8:
+    if (name == "csgScale")
+    {
+      object = new CSGScale(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 11:
+    if (name == "csgRotation")
+    {
+      object = new CSGRotation(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 12:
+    if (name == "csgPrimitive")
+    {
+      object = new CSGPrimitive(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 14:
+    if (name == "csgTranslation")
+    {
+      object = new CSGTranslation(mChildNamespaces);
+      appendAndOwn(object);
+    }
+    else if (name == "csgSetOperator")
+    {
+      object = new CSGSetOperator(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 28:
+    if (name == "csgHomogeneousTransformation")
+    {
+      object = new CSGHomogeneousTransformation(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  default:
+    break;
   }
 
-  delete spatialns;
   return object;
 }
 
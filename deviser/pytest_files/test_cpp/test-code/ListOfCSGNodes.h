@@ -52,6 +52,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sbml/ListOf.h>
@@ -76,6 +77,7 @@ protected:
   /** @cond doxygenLibsbmlInternal */
 
   std::string mElementName;
+  SpatialPkgNamespaces* mChildNamespaces;
 
   /** @endcond */
 
@@ -420,6 +422,30 @@ public:
   CSGSetOperator* createCSGSetOperator();
 
 
+  /**
+   * The attributes of the CSGNode objects in a ListOfCSGNodes, with one column
+   * for each attribute and one saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<std::string> id;
+    std::vector<bool> isSetId;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every CSGNode in this
+   * ListOfCSGNodes.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of CSGNode objects and row i describes the CSGNode at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
   /**
    * Returns the XML element name of this ListOfCSGNodes object.
    *
@@ -482,6 +508,28 @@ public:
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
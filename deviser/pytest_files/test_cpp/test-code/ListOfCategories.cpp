@@ -58,6 +58,7 @@ ListOfCategories::ListOfCategories(unsigned int level,
                                    unsigned int version,
                                    unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new DistribPkgNamespaces(level, version,
     pkgVersion));
@@ -69,6 +70,7 @@ ListOfCategories::ListOfCategories(unsigned int level,
  */
 ListOfCategories::ListOfCategories(DistribPkgNamespaces *distribns)
   : ListOf(distribns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(distribns->getURI());
 }
@@ -79,6 +81,7 @@ ListOfCategories::ListOfCategories(DistribPkgNamespaces *distribns)
  */
 ListOfCategories::ListOfCategories(const ListOfCategories& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -92,6 +95,8 @@ ListOfCategories::operator=(const ListOfCategories& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -113,6 +118,8 @@ ListOfCategories::clone() const
  */
 ListOfCategories::~ListOfCategories()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -265,6 +272,63 @@ ListOfCategories::createCategory()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Category in this
+ * ListOfCategories.
+ */
+void
+ListOfCategories::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.rank.resize(n);
+  columns.isSetRank.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Category* item = get(i);
+    columns.rank[i] = item->getRank();
+    columns.isSetRank[i] = item->isSetRank();
+  }
+}
+
+
+/*
+ * Creates a Category in this ListOfCategories for each row of the given
+ * columns.
+ */
+int
+ListOfCategories::importColumns(const Columns& columns)
+{
+  size_t n = columns.rank.size();
+  bool sameSize = (columns.isSetRank.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Category* item = createCategory();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetRank[i] && item->setRank(columns.rank[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfCategories object.
  */
@@ -297,6 +361,52 @@ ListOfCategories::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfCategories::forEachElement(bool (*action)(SBase*, void*),
+                                 void* userData,
+                                 ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Category* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -308,15 +418,22 @@ ListOfCategories::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  DISTRIB_CREATE_NS(distribns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    DISTRIB_CREATE_NS(distribns, getSBMLNamespaces());
+    mChildNamespaces = distribns;
+  }
 
   if (name == "category")
   {
-    object = new Category(distribns);
+    object = new Category(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete distribns;
   return object;
 }
 
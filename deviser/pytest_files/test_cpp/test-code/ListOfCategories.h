@@ -52,6 +52,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sbml/ListOf.h>
@@ -64,6 +65,13 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 
 class LIBSBML_EXTERN ListOfCategories : public ListOf
 {
+protected:
+
+  /** @cond doxygenLibsbmlInternal */
+
+  DistribPkgNamespaces* mChildNamespaces;
+
+  /** @endcond */
 
 public:
 
@@ -317,6 +325,50 @@ public:
   Category* createCategory();
 
 
+  /**
+   * The attributes of the Category objects in a ListOfCategories, with one
+   * column for each attribute and one saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<unsigned int> rank;
+    std::vector<bool> isSetRank;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every Category in this
+   * ListOfCategories.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of Category objects and row i describes the Category at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
+  /**
+   * Creates a Category in this ListOfCategories for each row of the given
+   * columns.
+   *
+   * @param columns the Columns to read; every column must have the same number
+   * of rows.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @note attributes that are not set in a row are left unset on the Category
+   * created for it; a value that cannot be set does not stop the remaining
+   * rows being created.
+   */
+  int importColumns(const Columns& columns);
+
+
   /**
    * Returns the XML element name of this ListOfCategories object.
    *
@@ -369,6 +421,28 @@ public:
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
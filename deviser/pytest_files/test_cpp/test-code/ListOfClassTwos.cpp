@@ -58,6 +58,7 @@ ListOfClassTwos::ListOfClassTwos(unsigned int level,
                                  unsigned int version,
                                  unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new TestcasePkgNamespaces(level, version,
     pkgVersion));
@@ -69,6 +70,7 @@ ListOfClassTwos::ListOfClassTwos(unsigned int level,
  */
 ListOfClassTwos::ListOfClassTwos(TestcasePkgNamespaces *testcasens)
   : ListOf(testcasens)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(testcasens->getURI());
 }
@@ -79,6 +81,7 @@ ListOfClassTwos::ListOfClassTwos(TestcasePkgNamespaces *testcasens)
  */
 ListOfClassTwos::ListOfClassTwos(const ListOfClassTwos& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -92,6 +95,8 @@ ListOfClassTwos::operator=(const ListOfClassTwos& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -113,6 +118,8 @@ ListOfClassTwos::clone() const
  */
 ListOfClassTwos::~ListOfClassTwos()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -297,6 +304,52 @@ ListOfClassTwos::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfClassTwos::forEachElement(bool (*action)(SBase*, void*),
+                                void* userData,
+                                ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    ClassTwo* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -308,15 +361,22 @@ ListOfClassTwos::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  TESTCASE_CREATE_NS(testcasens, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    TESTCASE_CREATE_NS(testcasens, getSBMLNamespaces());
+    mChildNamespaces = testcasens;
+  }
 
   if (name == "classTwo")
   {
-    object = new ClassTwo(testcasens);
+    object = new ClassTwo(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete testcasens;
   return object;
 }
 
@@ -58,6 +58,7 @@ ListOfCoordinateComponents::ListOfCoordinateComponents(unsigned int level,
                                                        unsigned int version,
                                                        unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new SpatialPkgNamespaces(level, version,
     pkgVersion));
@@ -71,6 +72,7 @@ ListOfCoordinateComponents::ListOfCoordinateComponents(unsigned int level,
 ListOfCoordinateComponents::ListOfCoordinateComponents(SpatialPkgNamespaces
   *spatialns)
   : ListOf(spatialns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(spatialns->getURI());
 }
@@ -82,6 +84,7 @@ ListOfCoordinateComponents::ListOfCoordinateComponents(SpatialPkgNamespaces
 ListOfCoordinateComponents::ListOfCoordinateComponents(const
   ListOfCoordinateComponents& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -95,6 +98,8 @@ ListOfCoordinateComponents::operator=(const ListOfCoordinateComponents& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -116,6 +121,8 @@ ListOfCoordinateComponents::clone() const
  */
 ListOfCoordinateComponents::~ListOfCoordinateComponents()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -280,6 +287,87 @@ ListOfCoordinateComponents::createCoordinateComponent()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every CoordinateComponent in
+ * this ListOfCoordinateComponents.
+ */
+void
+ListOfCoordinateComponents::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.type.resize(n);
+  columns.isSetType.resize(n);
+  columns.unit.resize(n);
+  columns.isSetUnit.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const CoordinateComponent* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.type[i] = item->getType();
+    columns.isSetType[i] = item->isSetType();
+    columns.unit[i] = item->getUnit();
+    columns.isSetUnit[i] = item->isSetUnit();
+  }
+}
+
+
+/*
+ * Creates a CoordinateComponent in this ListOfCoordinateComponents for each
+ * row of the given columns.
+ */
+int
+ListOfCoordinateComponents::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.type.size() == n);
+  sameSize = sameSize && (columns.isSetType.size() == n);
+  sameSize = sameSize && (columns.unit.size() == n);
+  sameSize = sameSize && (columns.isSetUnit.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    CoordinateComponent* item = createCoordinateComponent();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetType[i] && item->setType(columns.type[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetUnit[i] && item->setUnit(columns.unit[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfCoordinateComponents object.
  */
@@ -312,6 +400,52 @@ ListOfCoordinateComponents::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfCoordinateComponents::forEachElement(bool (*action)(SBase*, void*),
+                                           void* userData,
+                                           ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    CoordinateComponent* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -323,15 +457,22 @@ ListOfCoordinateComponents::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+    mChildNamespaces = spatialns;
+  }
 
   if (name == "coordinateComponent")
   {
-    object = new CoordinateComponent(spatialns);
+    object = new CoordinateComponent(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete spatialns;
   return object;
 }
 
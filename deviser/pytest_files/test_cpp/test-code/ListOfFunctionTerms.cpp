@@ -61,6 +61,7 @@ ListOfFunctionTerms::ListOfFunctionTerms(unsigned int level,
                                          unsigned int pkgVersion)
   : ListOf(level, version)
   , mDefaultTerm (NULL)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new QualPkgNamespaces(level, version, pkgVersion));
   connectToChild();
@@ -73,6 +74,7 @@ ListOfFunctionTerms::ListOfFunctionTerms(unsigned int level,
 ListOfFunctionTerms::ListOfFunctionTerms(QualPkgNamespaces *qualns)
   : ListOf(qualns)
   , mDefaultTerm (NULL)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(qualns->getURI());
   connectToChild();
@@ -85,6 +87,7 @@ ListOfFunctionTerms::ListOfFunctionTerms(QualPkgNamespaces *qualns)
 ListOfFunctionTerms::ListOfFunctionTerms(const ListOfFunctionTerms& orig)
   : ListOf( orig )
   , mDefaultTerm ( NULL )
+  , mChildNamespaces ( NULL )
 {
   if (orig.mDefaultTerm != NULL)
   {
@@ -104,6 +107,8 @@ ListOfFunctionTerms::operator=(const ListOfFunctionTerms& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
     delete mDefaultTerm;
     if (rhs.mDefaultTerm != NULL)
     {
@@ -138,6 +143,8 @@ ListOfFunctionTerms::~ListOfFunctionTerms()
 {
   delete mDefaultTerm;
   mDefaultTerm = NULL;
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -390,6 +397,63 @@ ListOfFunctionTerms::createFunctionTerm()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every FunctionTerm in this
+ * ListOfFunctionTerms.
+ */
+void
+ListOfFunctionTerms::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.resultLevel.resize(n);
+  columns.isSetResultLevel.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const FunctionTerm* item = get(i);
+    columns.resultLevel[i] = item->getResultLevel();
+    columns.isSetResultLevel[i] = item->isSetResultLevel();
+  }
+}
+
+
+/*
+ * Creates a FunctionTerm in this ListOfFunctionTerms for each row of the given
+ * columns.
+ */
+int
+ListOfFunctionTerms::importColumns(const Columns& columns)
+{
+  size_t n = columns.resultLevel.size();
+  bool sameSize = (columns.isSetResultLevel.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    FunctionTerm* item = createFunctionTerm();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetResultLevel[i] &&
+      item->setResultLevel(columns.resultLevel[i]) != LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfFunctionTerms object.
  */
@@ -546,6 +610,17 @@ ListOfFunctionTerms::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -554,14 +629,68 @@ List*
 ListOfFunctionTerms::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = ListOf::getAllElements(filter);
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mDefaultTerm, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfFunctionTerms::forEachElement(bool (*action)(SBase*, void*),
+                                    void* userData,
+                                    ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    FunctionTerm* item = get(i);
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mDefaultTerm != NULL)
+  {
+    if ((filter == NULL || filter->filter(mDefaultTerm)) &&
+      !action(mDefaultTerm, userData))
+    {
+      return false;
+    }
+
+    if (!mDefaultTerm->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -576,22 +705,39 @@ ListOfFunctionTerms::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  QUAL_CREATE_NS(qualns, getSBMLNamespaces());
 
-  if (name == "functionTerm")
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
   {
-    object = new FunctionTerm(qualns);
-    appendAndOwn(object);
+    delete mChildNamespaces;
+    QUAL_CREATE_NS(qualns, getSBMLNamespaces());
+    mChildNamespaces = qualns;
   }
 
-  if (name == "defaultTerm")
+  switch (name.size())
   {
-    DefaultTerm newDT(qualns);
-    setDefaultTerm(&newDT);
-    object = getDefaultTerm();
+  case 11:
+    if (name == "defaultTerm")
+    {
+      DefaultTerm newDT(mChildNamespaces);
+      setDefaultTerm(&newDT);
+      object = getDefaultTerm();
+    }
+
+    break;
+  case 12:
+    if (name == "functionTerm")
+    {
+      object = new FunctionTerm(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  default:
+    break;
   }
 
-  delete qualns;
   return object;
 }
 
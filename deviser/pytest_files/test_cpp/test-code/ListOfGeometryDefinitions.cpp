@@ -65,6 +65,7 @@ ListOfGeometryDefinitions::ListOfGeometryDefinitions(unsigned int level,
                                                      unsigned int pkgVersion)
   : ListOf(level, version)
   , mElementName("listOfGeometryDefinitions")
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new SpatialPkgNamespaces(level, version,
     pkgVersion));
@@ -79,6 +80,7 @@ ListOfGeometryDefinitions::ListOfGeometryDefinitions(SpatialPkgNamespaces
   *spatialns)
   : ListOf(spatialns)
   , mElementName("listOfGeometryDefinitions")
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(spatialns->getURI());
 }
@@ -91,6 +93,7 @@ ListOfGeometryDefinitions::ListOfGeometryDefinitions(const
   ListOfGeometryDefinitions& orig)
   : ListOf( orig )
   , mElementName ( orig.mElementName )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -105,6 +108,8 @@ ListOfGeometryDefinitions::operator=(const ListOfGeometryDefinitions& rhs)
   {
     ListOf::operator=(rhs);
     mElementName = rhs.mElementName;
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -126,6 +131,8 @@ ListOfGeometryDefinitions::clone() const
  */
 ListOfGeometryDefinitions::~ListOfGeometryDefinitions()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -400,6 +407,30 @@ ListOfGeometryDefinitions::createMixedGeometry()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every GeometryDefinition in
+ * this ListOfGeometryDefinitions.
+ */
+void
+ListOfGeometryDefinitions::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.isActive.resize(n);
+  columns.isSetIsActive.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const GeometryDefinition* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.isActive[i] = item->getIsActive();
+    columns.isSetIsActive[i] = item->isSetIsActive();
+  }
+}
+
+
 /*
  * Returns the XML element name of this ListOfGeometryDefinitions object.
  */
@@ -446,56 +477,124 @@ ListOfGeometryDefinitions::getItemTypeCode() const
 }
 
 
-
-/** @cond doxygenLibsbmlInternal */
-
 /*
- * Creates a new GeometryDefinition in this ListOfGeometryDefinitions
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
  */
-SBase*
-ListOfGeometryDefinitions::createObject(XMLInputStream& stream)
+bool
+ListOfGeometryDefinitions::forEachElement(bool (*action)(SBase*, void*),
+                                          void* userData,
+                                          ElementFilter* filter)
 {
-  const std::string& name = stream.peek().getName();
-  SBase* object = NULL;
-  SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
-
-  if (name == "geometryDefinition")
+  for (unsigned int i = 0; i < size(); i++)
   {
-    object = new GeometryDefinition(spatialns);
-    appendAndOwn(object);
-  }
+    GeometryDefinition* item = get(i);
 
-  if (name == "analyticGeometry")
-  {
-    object = new AnalyticGeometry(spatialns);
-    appendAndOwn(object);
-  }
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
 
-  if (name == "sampledFieldGeometry")
-  {
-    object = new SampledFieldGeometry(spatialns);
-    appendAndOwn(object);
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
   }
 
-  if (name == "csGeometry")
+  if (getNumPlugins() > 0)
   {
-    object = new CSGeometry(spatialns);
-    appendAndOwn(object);
-  }
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  if (name == "parametricGeometry")
-  {
-    object = new ParametricGeometry(spatialns);
-    appendAndOwn(object);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
   }
 
-  if (name == "mixedGeometry")
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates a new GeometryDefinition in this ListOfGeometryDefinitions
+ */
+SBase*
+ListOfGeometryDefinitions::createObject(XMLInputStream& stream)
+{
+  const std::string& name = stream.peek().getName();
+  SBase* object = NULL;
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
   {
-    object = new MixedGeometry(spatialns);
-    appendAndOwn(object);
+    delete mChildNamespaces;
+    SPATIAL_CREATE_NS(spatialns, getSBMLNamespaces());
+    mChildNamespaces = spatialns;
+  }
+
+  switch (name.size())
+  {
+  case 10:
+    if (name == "csGeometry")
+    {
+      object = new CSGeometry(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 13:
+    if (name == "mixedGeometry")
+    {
+      object = new MixedGeometry(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 16:
+    if (name == "analyticGeometry")
+    {
+      object = new AnalyticGeometry(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 18:
+    if (name == "geometryDefinition")
+    {
+      object = new GeometryDefinition(mChildNamespaces);
+      appendAndOwn(object);
+    }
+    else if (name == "parametricGeometry")
+    {
+      object = new ParametricGeometry(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  case 20:
+    if (name == "sampledFieldGeometry")
+    {
+      object = new SampledFieldGeometry(mChildNamespaces);
+      appendAndOwn(object);
+    }
+
+    break;
+  default:
+    break;
   }
 
-  delete spatialns;
   return object;
 }
 
@@ -52,6 +52,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sbml/ListOf.h>
@@ -75,6 +76,7 @@ protected:
   /** @cond doxygenLibsbmlInternal */
 
   std::string mElementName;
+  SpatialPkgNamespaces* mChildNamespaces;
 
   /** @endcond */
 
@@ -416,6 +418,34 @@ public:
   MixedGeometry* createMixedGeometry();
 
 
+  /**
+   * The attributes of the GeometryDefinition objects in a
+   * ListOfGeometryDefinitions, with one column for each attribute and one
+   * saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<std::string> id;
+    std::vector<bool> isSetId;
+    std::vector<bool> isActive;
+    std::vector<bool> isSetIsActive;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every GeometryDefinition in
+   * this ListOfGeometryDefinitions.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of GeometryDefinition objects and row i describes the GeometryDefinition
+   * at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
   /**
    * Returns the XML element name of this ListOfGeometryDefinitions object.
    *
@@ -479,6 +509,28 @@ public:
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
@@ -58,6 +58,7 @@ ListOfGroups::ListOfGroups(unsigned int level,
                            unsigned int version,
                            unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new GroupsPkgNamespaces(level, version, pkgVersion));
 }
@@ -68,6 +69,7 @@ ListOfGroups::ListOfGroups(unsigned int level,
  */
 ListOfGroups::ListOfGroups(GroupsPkgNamespaces *groupsns)
   : ListOf(groupsns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(groupsns->getURI());
 }
@@ -78,6 +80,7 @@ ListOfGroups::ListOfGroups(GroupsPkgNamespaces *groupsns)
  */
 ListOfGroups::ListOfGroups(const ListOfGroups& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -91,6 +94,8 @@ ListOfGroups::operator=(const ListOfGroups& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -112,6 +117,8 @@ ListOfGroups::clone() const
  */
 ListOfGroups::~ListOfGroups()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -261,6 +268,86 @@ ListOfGroups::createGroup()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Group in this
+ * ListOfGroups.
+ */
+void
+ListOfGroups::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+  columns.kind.resize(n);
+  columns.isSetKind.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Group* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+    columns.kind[i] = item->getKind();
+    columns.isSetKind[i] = item->isSetKind();
+  }
+}
+
+
+/*
+ * Creates a Group in this ListOfGroups for each row of the given columns.
+ */
+int
+ListOfGroups::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+  sameSize = sameSize && (columns.kind.size() == n);
+  sameSize = sameSize && (columns.isSetKind.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Group* item = createGroup();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetKind[i] && item->setKind(columns.kind[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfGroups object.
  */
@@ -293,6 +380,52 @@ ListOfGroups::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfGroups::forEachElement(bool (*action)(SBase*, void*),
+                             void* userData,
+                             ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Group* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -304,15 +437,22 @@ ListOfGroups::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  GROUPS_CREATE_NS(groupsns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    GROUPS_CREATE_NS(groupsns, getSBMLNamespaces());
+    mChildNamespaces = groupsns;
+  }
 
   if (name == "group")
   {
-    object = new Group(groupsns);
+    object = new Group(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete groupsns;
   return object;
 }
 
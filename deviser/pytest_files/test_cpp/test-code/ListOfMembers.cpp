@@ -58,6 +58,7 @@ ListOfMembers::ListOfMembers(unsigned int level,
                              unsigned int version,
                              unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new GroupsPkgNamespaces(level, version, pkgVersion));
 }
@@ -68,6 +69,7 @@ ListOfMembers::ListOfMembers(unsigned int level,
  */
 ListOfMembers::ListOfMembers(GroupsPkgNamespaces *groupsns)
   : ListOf(groupsns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(groupsns->getURI());
 }
@@ -78,6 +80,7 @@ ListOfMembers::ListOfMembers(GroupsPkgNamespaces *groupsns)
  */
 ListOfMembers::ListOfMembers(const ListOfMembers& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -91,6 +94,8 @@ ListOfMembers::operator=(const ListOfMembers& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -112,6 +117,8 @@ ListOfMembers::clone() const
  */
 ListOfMembers::~ListOfMembers()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -399,6 +406,98 @@ ListOfMembers::getByIdRef(const std::string& sid)
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Member in this
+ * ListOfMembers.
+ */
+void
+ListOfMembers::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+  columns.idRef.resize(n);
+  columns.isSetIdRef.resize(n);
+  columns.metaIdRef.resize(n);
+  columns.isSetMetaIdRef.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Member* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+    columns.idRef[i] = item->getIdRef();
+    columns.isSetIdRef[i] = item->isSetIdRef();
+    columns.metaIdRef[i] = item->getMetaIdRef();
+    columns.isSetMetaIdRef[i] = item->isSetMetaIdRef();
+  }
+}
+
+
+/*
+ * Creates a Member in this ListOfMembers for each row of the given columns.
+ */
+int
+ListOfMembers::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+  sameSize = sameSize && (columns.idRef.size() == n);
+  sameSize = sameSize && (columns.isSetIdRef.size() == n);
+  sameSize = sameSize && (columns.metaIdRef.size() == n);
+  sameSize = sameSize && (columns.isSetMetaIdRef.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Member* item = createMember();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetIdRef[i] && item->setIdRef(columns.idRef[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetMetaIdRef[i] && item->setMetaIdRef(columns.metaIdRef[i])
+      != LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfMembers object.
  */
@@ -444,6 +543,52 @@ ListOfMembers::hasRequiredAttributes() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfMembers::forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Member* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -455,15 +600,22 @@ ListOfMembers::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  GROUPS_CREATE_NS(groupsns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    GROUPS_CREATE_NS(groupsns, getSBMLNamespaces());
+    mChildNamespaces = groupsns;
+  }
 
   if (name == "member")
   {
-    object = new Member(groupsns);
+    object = new Member(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete groupsns;
   return object;
 }
 
@@ -506,28 +658,30 @@ ListOfMembers::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   ListOf::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("groups", GroupsGroupLOMembersAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(GroupsGroupLOMembersAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "groups", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("groups",
-          GroupsGroupLOMembersAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(GroupsGroupLOMembersAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "groups", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -58,6 +58,7 @@ ListOfMyLoTests::ListOfMyLoTests(unsigned int level,
                                  unsigned int version,
                                  unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new TestPkgNamespaces(level, version, pkgVersion));
 }
@@ -68,6 +69,7 @@ ListOfMyLoTests::ListOfMyLoTests(unsigned int level,
  */
 ListOfMyLoTests::ListOfMyLoTests(TestPkgNamespaces *testns)
   : ListOf(testns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(testns->getURI());
 }
@@ -78,6 +80,7 @@ ListOfMyLoTests::ListOfMyLoTests(TestPkgNamespaces *testns)
  */
 ListOfMyLoTests::ListOfMyLoTests(const ListOfMyLoTests& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -91,6 +94,8 @@ ListOfMyLoTests::operator=(const ListOfMyLoTests& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -112,6 +117,8 @@ ListOfMyLoTests::clone() const
  */
 ListOfMyLoTests::~ListOfMyLoTests()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -313,6 +320,63 @@ ListOfMyLoTests::createMyLoTest()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every MyLoTest in this
+ * ListOfMyLoTests.
+ */
+void
+ListOfMyLoTests::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const MyLoTest* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+  }
+}
+
+
+/*
+ * Creates a MyLoTest in this ListOfMyLoTests for each row of the given
+ * columns.
+ */
+int
+ListOfMyLoTests::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    MyLoTest* item = createMyLoTest();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfMyLoTests object.
  */
@@ -358,6 +422,52 @@ ListOfMyLoTests::hasRequiredAttributes() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfMyLoTests::forEachElement(bool (*action)(SBase*, void*),
+                                void* userData,
+                                ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    MyLoTest* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -369,15 +479,22 @@ ListOfMyLoTests::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  TEST_CREATE_NS(testns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    TEST_CREATE_NS(testns, getSBMLNamespaces());
+    mChildNamespaces = testns;
+  }
 
   if (name == "myLoTest")
   {
-    object = new MyLoTest(testns);
+    object = new MyLoTest(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete testns;
   return object;
 }
 
@@ -418,28 +535,30 @@ ListOfMyLoTests::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   ListOf::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("test", TestContainerLOMyLoTestsAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestContainerLOMyLoTestsAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("test",
-          TestContainerLOMyLoTestsAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(TestContainerLOMyLoTestsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
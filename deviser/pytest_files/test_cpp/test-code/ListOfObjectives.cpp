@@ -59,6 +59,7 @@ ListOfObjectives::ListOfObjectives(unsigned int level,
                                    unsigned int pkgVersion)
   : ListOf(level, version)
   , mActiveObjective ("")
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new FbcPkgNamespaces(level, version, pkgVersion));
 }
@@ -70,6 +71,7 @@ ListOfObjectives::ListOfObjectives(unsigned int level,
 ListOfObjectives::ListOfObjectives(FbcPkgNamespaces *fbcns)
   : ListOf(fbcns)
   , mActiveObjective ("")
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(fbcns->getURI());
 }
@@ -81,6 +83,7 @@ ListOfObjectives::ListOfObjectives(FbcPkgNamespaces *fbcns)
 ListOfObjectives::ListOfObjectives(const ListOfObjectives& orig)
   : ListOf( orig )
   , mActiveObjective ( orig.mActiveObjective )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -95,6 +98,8 @@ ListOfObjectives::operator=(const ListOfObjectives& rhs)
   {
     ListOf::operator=(rhs);
     mActiveObjective = rhs.mActiveObjective;
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -116,6 +121,8 @@ ListOfObjectives::clone() const
  */
 ListOfObjectives::~ListOfObjectives()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -329,6 +336,87 @@ ListOfObjectives::createObjective()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Objective in this
+ * ListOfObjectives.
+ */
+void
+ListOfObjectives::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+  columns.type.resize(n);
+  columns.isSetType.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Objective* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+    columns.type[i] = item->getType();
+    columns.isSetType[i] = item->isSetType();
+  }
+}
+
+
+/*
+ * Creates a Objective in this ListOfObjectives for each row of the given
+ * columns.
+ */
+int
+ListOfObjectives::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+  sameSize = sameSize && (columns.type.size() == n);
+  sameSize = sameSize && (columns.isSetType.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Objective* item = createObjective();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetType[i] && item->setType(columns.type[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfObjectives object.
  */
@@ -374,6 +462,52 @@ ListOfObjectives::hasRequiredAttributes() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfObjectives::forEachElement(bool (*action)(SBase*, void*),
+                                 void* userData,
+                                 ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Objective* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -385,15 +519,22 @@ ListOfObjectives::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  FBC_CREATE_NS(fbcns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    FBC_CREATE_NS(fbcns, getSBMLNamespaces());
+    mChildNamespaces = fbcns;
+  }
 
   if (name == "objective")
   {
-    object = new Objective(fbcns);
+    object = new Objective(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete fbcns;
   return object;
 }
 
@@ -446,27 +587,30 @@ ListOfObjectives::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   ListOf::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("fbc", FbcModelLOObjectivesAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcModelLOObjectivesAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "fbc", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("fbc", FbcModelLOObjectivesAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcModelLOObjectivesAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "fbc", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
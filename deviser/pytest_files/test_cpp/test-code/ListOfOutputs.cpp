@@ -58,6 +58,7 @@ ListOfOutputs::ListOfOutputs(unsigned int level,
                              unsigned int version,
                              unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new QualPkgNamespaces(level, version, pkgVersion));
 }
@@ -68,6 +69,7 @@ ListOfOutputs::ListOfOutputs(unsigned int level,
  */
 ListOfOutputs::ListOfOutputs(QualPkgNamespaces *qualns)
   : ListOf(qualns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(qualns->getURI());
 }
@@ -78,6 +80,7 @@ ListOfOutputs::ListOfOutputs(QualPkgNamespaces *qualns)
  */
 ListOfOutputs::ListOfOutputs(const ListOfOutputs& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -91,6 +94,8 @@ ListOfOutputs::operator=(const ListOfOutputs& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -112,6 +117,8 @@ ListOfOutputs::clone() const
  */
 ListOfOutputs::~ListOfOutputs()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -303,6 +310,112 @@ ListOfOutputs::getByQualitativeSpecies(const std::string& sid)
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Output in this
+ * ListOfOutputs.
+ */
+void
+ListOfOutputs::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.qualitativeSpecies.resize(n);
+  columns.isSetQualitativeSpecies.resize(n);
+  columns.transitionEffect.resize(n);
+  columns.isSetTransitionEffect.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+  columns.outputLevel.resize(n);
+  columns.isSetOutputLevel.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Output* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.qualitativeSpecies[i] = item->getQualitativeSpecies();
+    columns.isSetQualitativeSpecies[i] = item->isSetQualitativeSpecies();
+    columns.transitionEffect[i] = item->getTransitionEffect();
+    columns.isSetTransitionEffect[i] = item->isSetTransitionEffect();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+    columns.outputLevel[i] = item->getOutputLevel();
+    columns.isSetOutputLevel[i] = item->isSetOutputLevel();
+  }
+}
+
+
+/*
+ * Creates a Output in this ListOfOutputs for each row of the given columns.
+ */
+int
+ListOfOutputs::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.qualitativeSpecies.size() == n);
+  sameSize = sameSize && (columns.isSetQualitativeSpecies.size() == n);
+  sameSize = sameSize && (columns.transitionEffect.size() == n);
+  sameSize = sameSize && (columns.isSetTransitionEffect.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+  sameSize = sameSize && (columns.outputLevel.size() == n);
+  sameSize = sameSize && (columns.isSetOutputLevel.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Output* item = createOutput();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetQualitativeSpecies[i] &&
+      item->setQualitativeSpecies(columns.qualitativeSpecies[i]) !=
+        LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetTransitionEffect[i] &&
+      item->setTransitionEffect(columns.transitionEffect[i]) !=
+        LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetOutputLevel[i] &&
+      item->setOutputLevel(columns.outputLevel[i]) != LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfOutputs object.
  */
@@ -335,6 +448,52 @@ ListOfOutputs::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfOutputs::forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Output* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -346,15 +505,22 @@ ListOfOutputs::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  QUAL_CREATE_NS(qualns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    QUAL_CREATE_NS(qualns, getSBMLNamespaces());
+    mChildNamespaces = qualns;
+  }
 
   if (name == "output")
   {
-    object = new Output(qualns);
+    object = new Output(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete qualns;
   return object;
 }
 
@@ -0,0 +1,614 @@
+/**
+ * @file ListOfThings.cpp
+ * @brief Implementation of the ListOfThings class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sbml/packages/index/sbml/ListOfThings.h>
+#include <sbml/packages/index/validator/IndexSBMLError.h>
+
+
+using namespace std;
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new ListOfThings using the given SBML Level, Version and
+ * &ldquo;index&rdquo; package version.
+ */
+ListOfThings::ListOfThings(unsigned int level,
+                           unsigned int version,
+                           unsigned int pkgVersion)
+  : ListOf(level, version)
+  , mChildNamespaces (NULL)
+  , mIdIndex ()
+  , mIdIndexSize (0)
+  , mIdIndexValid (false)
+{
+  setSBMLNamespacesAndOwn(new IndexPkgNamespaces(level, version, pkgVersion));
+}
+
+
+/*
+ * Creates a new ListOfThings using the given IndexPkgNamespaces object.
+ */
+ListOfThings::ListOfThings(IndexPkgNamespaces *indexns)
+  : ListOf(indexns)
+  , mChildNamespaces (NULL)
+  , mIdIndex ()
+  , mIdIndexSize (0)
+  , mIdIndexValid (false)
+{
+  setElementNamespace(indexns->getURI());
+}
+
+
+/*
+ * Copy constructor for ListOfThings.
+ */
+ListOfThings::ListOfThings(const ListOfThings& orig)
+  : ListOf( orig )
+  , mChildNamespaces ( NULL )
+  , mIdIndex ()
+  , mIdIndexSize (0)
+  , mIdIndexValid (false)
+{
+}
+
+
+/*
+ * Assignment operator for ListOfThings.
+ */
+ListOfThings&
+ListOfThings::operator=(const ListOfThings& rhs)
+{
+  if (&rhs != this)
+  {
+    ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
+    invalidateIdIndex();
+  }
+
+  return *this;
+}
+
+
+/*
+ * Creates and returns a deep copy of this ListOfThings object.
+ */
+ListOfThings*
+ListOfThings::clone() const
+{
+  return new ListOfThings(*this);
+}
+
+
+/*
+ * Destructor for ListOfThings.
+ */
+ListOfThings::~ListOfThings()
+{
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
+}
+
+
+/*
+ * Get a Thing from the ListOfThings.
+ */
+Thing*
+ListOfThings::get(unsigned int n)
+{
+  return static_cast<Thing*>(ListOf::get(n));
+}
+
+
+/*
+ * Get a Thing from the ListOfThings.
+ */
+const Thing*
+ListOfThings::get(unsigned int n) const
+{
+  return static_cast<const Thing*>(ListOf::get(n));
+}
+
+
+/*
+ * Get a Thing from the ListOfThings based on its identifier.
+ */
+Thing*
+ListOfThings::get(const std::string& sid)
+{
+  return const_cast<Thing*>(static_cast<const ListOfThings&>(*this).get(sid));
+}
+
+
+/*
+ * Get a Thing from the ListOfThings based on its identifier.
+ */
+const Thing*
+ListOfThings::get(const std::string& sid) const
+{
+  int n = findIndexById(sid);
+  return (n < 0) ? 0 : static_cast <const Thing*> (mItems[n]);
+}
+
+
+/*
+ * Removes the nth Thing from this ListOfThings and returns a pointer to it.
+ */
+Thing*
+ListOfThings::remove(unsigned int n)
+{
+  invalidateIdIndex();
+  return static_cast<Thing*>(ListOf::remove(n));
+}
+
+
+/*
+ * Removes the Thing from this ListOfThings based on its identifier and returns
+ * a pointer to it.
+ */
+Thing*
+ListOfThings::remove(const std::string& sid)
+{
+  int n = findIndexById(sid);
+  return (n < 0) ? NULL : remove(static_cast<unsigned int>(n));
+}
+
+
+/*
+ * Marks the identifier index of this ListOfThings as out of date.
+ */
+void
+ListOfThings::invalidateIdIndex()
+{
+  mIdIndexValid = false;
+}
+
+
+/*
+ * Adds a copy of the given Thing to this ListOfThings.
+ */
+int
+ListOfThings::addThing(const Thing* t)
+{
+  if (t == NULL)
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+  else if (t->hasRequiredAttributes() == false)
+  {
+    return LIBSBML_INVALID_OBJECT;
+  }
+  else if (getLevel() != t->getLevel())
+  {
+    return LIBSBML_LEVEL_MISMATCH;
+  }
+  else if (getVersion() != t->getVersion())
+  {
+    return LIBSBML_VERSION_MISMATCH;
+  }
+  else if (matchesRequiredSBMLNamespacesForAddition(static_cast<const
+    SBase*>(t)) == false)
+  {
+    return LIBSBML_NAMESPACES_MISMATCH;
+  }
+  else
+  {
+    return append(t);
+  }
+}
+
+
+/*
+ * Get the number of Thing objects in this ListOfThings.
+ */
+unsigned int
+ListOfThings::getNumThings() const
+{
+  return size();
+}
+
+
+/*
+ * Creates a new Thing object, adds it to this ListOfThings object and returns
+ * the Thing object created.
+ */
+Thing*
+ListOfThings::createThing()
+{
+  Thing* t = NULL;
+
+  try
+  {
+    INDEX_CREATE_NS(indexns, getSBMLNamespaces());
+    t = new Thing(indexns);
+    delete indexns;
+  }
+  catch (...)
+  {
+  }
+
+  if (t != NULL)
+  {
+    appendAndOwn(t);
+  }
+
+  return t;
+}
+
+
+/*
+ * Fills the given columns with the attributes of every Thing in this
+ * ListOfThings.
+ */
+void
+ListOfThings::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+  columns.value.resize(n);
+  columns.isSetValue.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Thing* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+    columns.value[i] = item->getValue();
+    columns.isSetValue[i] = item->isSetValue();
+  }
+}
+
+
+/*
+ * Creates a Thing in this ListOfThings for each row of the given columns.
+ */
+int
+ListOfThings::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+  sameSize = sameSize && (columns.value.size() == n);
+  sameSize = sameSize && (columns.isSetValue.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Thing* item = createThing();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetValue[i] && item->setValue(columns.value[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
+/*
+ * Returns the XML element name of this ListOfThings object.
+ */
+const std::string&
+ListOfThings::getElementName() const
+{
+  static const string name = "listOfThings";
+  return name;
+}
+
+
+/*
+ * Returns the libSBML type code for this ListOfThings object.
+ */
+int
+ListOfThings::getTypeCode() const
+{
+  return SBML_LIST_OF;
+}
+
+
+/*
+ * Returns the libSBML type code for the SBML objects contained in this
+ * ListOfThings object.
+ */
+int
+ListOfThings::getItemTypeCode() const
+{
+  return SBML_INDEX_THING;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfThings::forEachElement(bool (*action)(SBase*, void*),
+                             void* userData,
+                             ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Thing* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates a new Thing in this ListOfThings
+ */
+SBase*
+ListOfThings::createObject(XMLInputStream& stream)
+{
+  const std::string& name = stream.peek().getName();
+  SBase* object = NULL;
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    INDEX_CREATE_NS(indexns, getSBMLNamespaces());
+    mChildNamespaces = indexns;
+  }
+
+  if (name == "thing")
+  {
+    object = new Thing(mChildNamespaces);
+    appendAndOwn(object);
+  }
+
+  return object;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the index of the Thing with the given identifier or -1 if no such
+ * Thing exists, rebuilding the identifier index if necessary.
+ */
+int
+ListOfThings::findIndexById(const std::string& sid) const
+{
+  if (!mIdIndexValid || mIdIndexSize != mItems.size())
+  {
+    rebuildIdIndex();
+  }
+
+  map<string, unsigned int>::const_iterator result = mIdIndex.find(sid);
+
+  if (result != mIdIndex.end() && static_cast<const
+    Thing*>(mItems[result->second])->getId() != sid)
+  {
+    rebuildIdIndex();
+    result = mIdIndex.find(sid);
+  }
+  else if (result == mIdIndex.end())
+  {
+    for (unsigned int i = 0; i < mItems.size(); i++)
+    {
+      if (static_cast<const Thing*>(mItems[i])->getId() == sid)
+      {
+        rebuildIdIndex();
+        return static_cast<int>(i);
+      }
+    }
+  }
+
+  return (result == mIdIndex.end()) ? -1 : static_cast<int>(result->second);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Rebuilds the identifier index of this ListOfThings.
+ */
+void
+ListOfThings::rebuildIdIndex() const
+{
+  mIdIndex.clear();
+
+  for (unsigned int i = 0; i < mItems.size(); i++)
+  {
+    const Thing* t = static_cast<const Thing*>(mItems[i]);
+    if (t->isSetId())
+    {
+      mIdIndex.insert(make_pair(t->getId(), i));
+    }
+  }
+
+  mIdIndexSize = static_cast<unsigned int>(mItems.size());
+  mIdIndexValid = true;
+}
+
+/** @endcond */
+
+
+
+
+#endif /* __cplusplus */
+
+
+/*
+ * Get a Thing_t from the ListOf_t.
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_getThing(ListOf_t* lo, unsigned int n)
+{
+  if (lo == NULL)
+  {
+    return NULL;
+  }
+
+  return static_cast <ListOfThings*>(lo)->get(n);
+}
+
+
+/*
+ * Get a Thing_t from the ListOf_t based on its identifier.
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_getById(ListOf_t* lo, const char *sid)
+{
+  if (lo == NULL)
+  {
+    return NULL;
+  }
+
+  return (sid != NULL) ? static_cast <ListOfThings*>(lo)->get(sid) : NULL;
+}
+
+
+/*
+ * Removes the nth Thing_t from this ListOf_t and returns a pointer to it.
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_remove(ListOf_t* lo, unsigned int n)
+{
+  if (lo == NULL)
+  {
+    return NULL;
+  }
+
+  return static_cast <ListOfThings*>(lo)->remove(n);
+}
+
+
+/*
+ * Removes the Thing_t from this ListOf_t based on its identifier and returns a
+ * pointer to it.
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_removeById(ListOf_t* lo, const char* sid)
+{
+  if (lo == NULL)
+  {
+    return NULL;
+  }
+
+  return (sid != NULL) ? static_cast <ListOfThings*>(lo)->remove(sid) : NULL;
+}
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
@@ -0,0 +1,617 @@
+/**
+ * @file ListOfThings.h
+ * @brief Definition of the ListOfThings class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ *
+ * @class ListOfThings
+ * @sbmlbrief{index} TODO:Definition of the ListOfThings class.
+ */
+
+
+#ifndef ListOfThings_H__
+#define ListOfThings_H__
+
+
+#include <sbml/common/extern.h>
+#include <sbml/common/sbmlfwd.h>
+#include <sbml/packages/index/common/indexfwd.h>
+
+
+#ifdef __cplusplus
+
+
+#include <string>
+#include <vector>
+#include <map>
+
+
+#include <sbml/ListOf.h>
+#include <sbml/packages/index/extension/IndexExtension.h>
+#include <sbml/packages/index/sbml/Thing.h>
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+class LIBSBML_EXTERN ListOfThings : public ListOf
+{
+protected:
+
+  /** @cond doxygenLibsbmlInternal */
+
+  IndexPkgNamespaces* mChildNamespaces;
+  mutable std::map<std::string, unsigned int> mIdIndex;
+  mutable unsigned int mIdIndexSize;
+  mutable bool mIdIndexValid;
+
+  /** @endcond */
+
+public:
+
+  /**
+   * Creates a new ListOfThings using the given SBML Level, Version and
+   * &ldquo;index&rdquo; package version.
+   *
+   * @param level an unsigned int, the SBML Level to assign to this
+   * ListOfThings.
+   *
+   * @param version an unsigned int, the SBML Version to assign to this
+   * ListOfThings.
+   *
+   * @param pkgVersion an unsigned int, the SBML Index Version to assign to
+   * this ListOfThings.
+   *
+   * @copydetails doc_note_setting_lv_pkg
+   */
+  ListOfThings(unsigned int level = IndexExtension::getDefaultLevel(),
+               unsigned int version = IndexExtension::getDefaultVersion(),
+               unsigned int pkgVersion =
+                 IndexExtension::getDefaultPackageVersion());
+
+
+  /**
+   * Creates a new ListOfThings using the given IndexPkgNamespaces object.
+   *
+   * @copydetails doc_what_are_sbml_package_namespaces
+   *
+   * @param indexns the IndexPkgNamespaces object.
+   *
+   * @copydetails doc_note_setting_lv_pkg
+   */
+  ListOfThings(IndexPkgNamespaces *indexns);
+
+
+  /**
+   * Copy constructor for ListOfThings.
+   *
+   * @param orig the ListOfThings instance to copy.
+   */
+  ListOfThings(const ListOfThings& orig);
+
+
+  /**
+   * Assignment operator for ListOfThings.
+   *
+   * @param rhs the ListOfThings object whose values are to be used as the
+   * basis of the assignment.
+   */
+  ListOfThings& operator=(const ListOfThings& rhs);
+
+
+  /**
+   * Creates and returns a deep copy of this ListOfThings object.
+   *
+   * @return a (deep) copy of this ListOfThings object.
+   */
+  virtual ListOfThings* clone() const;
+
+
+  /**
+   * Destructor for ListOfThings.
+   */
+  virtual ~ListOfThings();
+
+
+  /**
+   * Get a Thing from the ListOfThings.
+   *
+   * @param n an unsigned int representing the index of the Thing to retrieve.
+   *
+   * @return the nth Thing in this ListOfThings or @c NULL if no such object
+   * exists.
+   *
+   * @copydetails doc_returned_unowned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  virtual Thing* get(unsigned int n);
+
+
+  /**
+   * Get a Thing from the ListOfThings.
+   *
+   * @param n an unsigned int representing the index of the Thing to retrieve.
+   *
+   * @return the nth Thing in this ListOfThings or @c NULL if no such object
+   * exists.
+   *
+   * @copydetails doc_returned_unowned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  virtual const Thing* get(unsigned int n) const;
+
+
+  /**
+   * Get a Thing from the ListOfThings based on its identifier.
+   *
+   * @param sid a string representing the identifier of the Thing to retrieve.
+   *
+   * @return the Thing in this ListOfThings with the given @p sid or @c NULL if
+   * no such Thing exists.
+   *
+   * @copydetails doc_returned_unowned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  virtual Thing* get(const std::string& sid);
+
+
+  /**
+   * Get a Thing from the ListOfThings based on its identifier.
+   *
+   * @param sid a string representing the identifier of the Thing to retrieve.
+   *
+   * @return the Thing in this ListOfThings with the given @p sid or @c NULL if
+   * no such Thing exists.
+   *
+   * @copydetails doc_returned_unowned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  virtual const Thing* get(const std::string& sid) const;
+
+
+  /**
+   * Removes the nth Thing from this ListOfThings and returns a pointer to it.
+   *
+   * @param n an unsigned int representing the index of the Thing to remove.
+   *
+   * @return a pointer to the nth Thing in this ListOfThings.
+   *
+   * @copydetails doc_warning_returns_owned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   */
+  virtual Thing* remove(unsigned int n);
+
+
+  /**
+   * Removes the Thing from this ListOfThings based on its identifier and
+   * returns a pointer to it.
+   *
+   * @param sid a string representing the identifier of the Thing to remove.
+   *
+   * @return the Thing in this ListOfThings based on the identifier or NULL if
+   * no such Thing exists.
+   *
+   * @copydetails doc_warning_returns_owned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(unsigned int n)
+   */
+  virtual Thing* remove(const std::string& sid);
+
+
+  /**
+   * Marks the identifier index of this ListOfThings as out of date.
+   *
+   * The index is rebuilt the next time a Thing is retrieved or removed using
+   * its identifier. This function is called by Thing::setId() and
+   * Thing::unsetId() and need only be called directly if the identifier of a
+   * child is changed by other means.
+   */
+  void invalidateIdIndex();
+
+
+  /**
+   * Adds a copy of the given Thing to this ListOfThings.
+   *
+   * @param t the Thing object to add.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_OBJECT, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_LEVEL_MISMATCH, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_PKG_VERSION_MISMATCH, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_DUPLICATE_OBJECT_ID, OperationReturnValues_t}
+   *
+   * @copydetails doc_note_object_is_copied
+   *
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  int addThing(const Thing* t);
+
+
+  /**
+   * Get the number of Thing objects in this ListOfThings.
+   *
+   * @return the number of Thing objects in this ListOfThings.
+   *
+   * @see addThing(const Thing* object)
+   * @see createThing()
+   * @see get(const std::string& sid)
+   * @see get(unsigned int n)
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  unsigned int getNumThings() const;
+
+
+  /**
+   * Creates a new Thing object, adds it to this ListOfThings object and
+   * returns the Thing object created.
+   *
+   * @return a new Thing object instance.
+   *
+   * @copydetails doc_returned_unowned_pointer
+   *
+   * @see addThing(const Thing* object)
+   * @see get(const std::string& sid)
+   * @see get(unsigned int n)
+   * @see getNumThings()
+   * @see remove(const std::string& sid)
+   * @see remove(unsigned int n)
+   */
+  Thing* createThing();
+
+
+  /**
+   * The attributes of the Thing objects in a ListOfThings, with one column for
+   * each attribute and one saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<std::string> id;
+    std::vector<bool> isSetId;
+    std::vector<std::string> name;
+    std::vector<bool> isSetName;
+    std::vector<double> value;
+    std::vector<bool> isSetValue;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every Thing in this
+   * ListOfThings.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of Thing objects and row i describes the Thing at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
+  /**
+   * Creates a Thing in this ListOfThings for each row of the given columns.
+   *
+   * @param columns the Columns to read; every column must have the same number
+   * of rows.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @note attributes that are not set in a row are left unset on the Thing
+   * created for it; a value that cannot be set does not stop the remaining
+   * rows being created.
+   */
+  int importColumns(const Columns& columns);
+
+
+  /**
+   * Returns the XML element name of this ListOfThings object.
+   *
+   * For ListOfThings, the XML element name is always @c "listOfThings".
+   *
+   * @return the name of this element, i.e. @c "listOfThings".
+   */
+  virtual const std::string& getElementName() const;
+
+
+  /**
+   * Returns the libSBML type code for this ListOfThings object.
+   *
+   * @copydetails doc_what_are_typecodes
+   *
+   * @return the SBML type code for this object:
+   * @sbmlconstant{SBML_LIST_OF, SBMLTypeCode_t}.
+   *
+   * @copydetails doc_warning_typecodes_not_unique
+   */
+  virtual int getTypeCode() const;
+
+
+  /**
+   * Returns the libSBML type code for the SBML objects contained in this
+   * ListOfThings object.
+   *
+   * @copydetails doc_what_are_typecodes
+   *
+   * @return the SBML typecode for the objects contained in this ListOfThings:
+   * @sbmlconstant{SBML_INDEX_THING, SBMLIndexTypeCode_t}.
+   *
+   * @copydetails doc_warning_typecodes_not_unique
+   *
+   * @see getElementName()
+   * @see getPackageName()
+   */
+  virtual int getItemTypeCode() const;
+
+
+
+
+  #ifndef SWIG
+
+
+
+
+  #endif /* !SWIG */
+
+
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
+protected:
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Creates a new Thing in this ListOfThings
+   */
+  virtual SBase* createObject(XMLInputStream& stream);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the index of the Thing with the given identifier or -1 if no such
+   * Thing exists, rebuilding the identifier index if necessary.
+   *
+   * @param sid a string representing the identifier of the Thing to find.
+   *
+   * @return the index of the Thing with the given @p sid or -1.
+   */
+  int findIndexById(const std::string& sid) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Rebuilds the identifier index of this ListOfThings.
+   */
+  void rebuildIdIndex() const;
+
+  /** @endcond */
+
+
+};
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
+
+
+#endif /* __cplusplus */
+
+
+
+
+#ifndef SWIG
+
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+BEGIN_C_DECLS
+
+
+/**
+ * Get a Thing_t from the ListOf_t.
+ *
+ * @param lo the ListOf_t structure to search.
+ *
+ * @param n an unsigned int representing the index of the Thing_t to retrieve.
+ *
+ * @return the nth Thing_t in this ListOf_t or @c NULL if no such object
+ * exists.
+ *
+ * @copydetails doc_returned_unowned_pointer
+ *
+ * @memberof ListOfThings_t
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_getThing(ListOf_t* lo, unsigned int n);
+
+
+/**
+ * Get a Thing_t from the ListOf_t based on its identifier.
+ *
+ * @param lo the ListOf_t structure to search.
+ *
+ * @param sid a string representing the identifier of the Thing_t to retrieve.
+ *
+ * @return the Thing_t in this ListOf_t with the given @p sid or @c NULL if no
+ * such Thing_t exists.
+ *
+ * @copydetails doc_returned_unowned_pointer
+ *
+ * @memberof ListOfThings_t
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_getById(ListOf_t* lo, const char *sid);
+
+
+/**
+ * Removes the nth Thing_t from this ListOf_t and returns a pointer to it.
+ *
+ * @param lo the ListOf_t structure to search.
+ *
+ * @param n an unsigned int representing the index of the Thing_t to remove.
+ *
+ * @return a pointer to the nth Thing_t in this ListOf_t.
+ *
+ * @copydetails doc_warning_returns_owned_pointer
+ *
+ * @memberof ListOfThings_t
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_remove(ListOf_t* lo, unsigned int n);
+
+
+/**
+ * Removes the Thing_t from this ListOf_t based on its identifier and returns a
+ * pointer to it.
+ *
+ * @param lo the ListOf_t structure to search.
+ *
+ * @param sid a string representing the identifier of the Thing_t to remove.
+ *
+ * @return the Thing_t in this ListOf_t based on the identifier or NULL if no
+ * such Thing_t exists.
+ *
+ * @copydetails doc_warning_returns_owned_pointer
+ *
+ * @memberof ListOfThings_t
+ */
+LIBSBML_EXTERN
+Thing_t*
+ListOfThings_removeById(ListOf_t* lo, const char* sid);
+
+
+
+
+END_C_DECLS
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
+
+
+#endif /* !SWIG */
+
+
+
+
+#endif /* !ListOfThings_H__ */
+
+
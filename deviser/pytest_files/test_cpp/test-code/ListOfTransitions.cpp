@@ -58,6 +58,7 @@ ListOfTransitions::ListOfTransitions(unsigned int level,
                                      unsigned int version,
                                      unsigned int pkgVersion)
   : ListOf(level, version)
+  , mChildNamespaces (NULL)
 {
   setSBMLNamespacesAndOwn(new QualPkgNamespaces(level, version, pkgVersion));
 }
@@ -68,6 +69,7 @@ ListOfTransitions::ListOfTransitions(unsigned int level,
  */
 ListOfTransitions::ListOfTransitions(QualPkgNamespaces *qualns)
   : ListOf(qualns)
+  , mChildNamespaces (NULL)
 {
   setElementNamespace(qualns->getURI());
 }
@@ -78,6 +80,7 @@ ListOfTransitions::ListOfTransitions(QualPkgNamespaces *qualns)
  */
 ListOfTransitions::ListOfTransitions(const ListOfTransitions& orig)
   : ListOf( orig )
+  , mChildNamespaces ( NULL )
 {
 }
 
@@ -91,6 +94,8 @@ ListOfTransitions::operator=(const ListOfTransitions& rhs)
   if (&rhs != this)
   {
     ListOf::operator=(rhs);
+    delete mChildNamespaces;
+    mChildNamespaces = NULL;
   }
 
   return *this;
@@ -112,6 +117,8 @@ ListOfTransitions::clone() const
  */
 ListOfTransitions::~ListOfTransitions()
 {
+  delete mChildNamespaces;
+  mChildNamespaces = NULL;
 }
 
 
@@ -268,6 +275,75 @@ ListOfTransitions::createTransition()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Transition in this
+ * ListOfTransitions.
+ */
+void
+ListOfTransitions::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.id.resize(n);
+  columns.isSetId.resize(n);
+  columns.name.resize(n);
+  columns.isSetName.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Transition* item = get(i);
+    columns.id[i] = item->getId();
+    columns.isSetId[i] = item->isSetId();
+    columns.name[i] = item->getName();
+    columns.isSetName[i] = item->isSetName();
+  }
+}
+
+
+/*
+ * Creates a Transition in this ListOfTransitions for each row of the given
+ * columns.
+ */
+int
+ListOfTransitions::importColumns(const Columns& columns)
+{
+  size_t n = columns.id.size();
+  bool sameSize = (columns.isSetId.size() == n);
+  sameSize = sameSize && (columns.name.size() == n);
+  sameSize = sameSize && (columns.isSetName.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBML_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Transition* item = createTransition();
+
+    if (item == NULL)
+    {
+      return LIBSBML_OPERATION_FAILED;
+    }
+
+    if (columns.isSetId[i] && item->setId(columns.id[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetName[i] && item->setName(columns.name[i]) !=
+      LIBSBML_OPERATION_SUCCESS)
+    {
+      result = LIBSBML_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this ListOfTransitions object.
  */
@@ -300,6 +376,52 @@ ListOfTransitions::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ListOfTransitions::forEachElement(bool (*action)(SBase*, void*),
+                                  void* userData,
+                                  ElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Transition* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -311,15 +433,22 @@ ListOfTransitions::createObject(XMLInputStream& stream)
 {
   const std::string& name = stream.peek().getName();
   SBase* object = NULL;
-  QUAL_CREATE_NS(qualns, getSBMLNamespaces());
+
+  if (mChildNamespaces == NULL || mChildNamespaces->getLevel() != getLevel() ||
+    mChildNamespaces->getVersion() != getVersion() ||
+      mChildNamespaces->getPackageVersion() != getPackageVersion())
+  {
+    delete mChildNamespaces;
+    QUAL_CREATE_NS(qualns, getSBMLNamespaces());
+    mChildNamespaces = qualns;
+  }
 
   if (name == "transition")
   {
-    object = new Transition(qualns);
+    object = new Transition(mChildNamespaces);
     appendAndOwn(object);
   }
 
-  delete qualns;
   return object;
 }
 
@@ -61,7 +61,6 @@ Map::Map(unsigned int level, unsigned int version)
   , mArcs (level, version)
   , mArcGroups (level, version)
 {
-  setSbgnNamespacesAndOwn(new SbgnNamespaces(level, version));
   connectToChild();
 }
 
@@ -215,6 +214,7 @@ Map::setId(const std::string& id)
   }
   else
   {
+    updateDocumentSIdIndex(mId, id);
     mId = id;
     return LIBSBGN_OPERATION_SUCCESS;
   }
@@ -246,7 +246,7 @@ Map::setLanguage(const Language_t language)
 int
 Map::setLanguage(const std::string& language)
 {
-  mLanguage = Language_fromString(language.c_str());
+  mLanguage = Language_fromStringWithLength(language.c_str(), language.size());
 
   if (mLanguage == SBGNML_LANGUAGE_INVALID)
   {
@@ -263,6 +263,7 @@ Map::setLanguage(const std::string& language)
 int
 Map::unsetId()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -329,12 +330,14 @@ Map::setBBox(const BBox* bbox)
   }
   else if (bbox == NULL)
   {
+    invalidateDocumentIdIndex();
     delete mBBox;
     mBBox = NULL;
     return LIBSBGN_OPERATION_SUCCESS;
   }
   else
   {
+    invalidateDocumentIdIndex();
     delete mBBox;
     mBBox = (bbox != NULL) ? bbox->clone() : NULL;
     if (mBBox != NULL)
@@ -373,6 +376,7 @@ Map::createBBox()
 int
 Map::unsetBBox()
 {
+  invalidateDocumentIdIndex();
   delete mBBox;
   mBBox = NULL;
   return LIBSBGN_OPERATION_SUCCESS;
@@ -1047,15 +1051,11 @@ Map::getAttribute(const std::string& attributeName, std::string& value) const
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "language")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getLanguageAsString();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1075,13 +1075,11 @@ Map::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "language")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetLanguage();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1169,13 +1167,11 @@ Map::setAttribute(const std::string& attributeName, const std::string& value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "language")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setLanguage(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1195,16 +1191,262 @@ Map::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "language")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Map.
+ */
+int
+Map::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "language" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetLanguage();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_LANGUAGE:
+    value = getLanguageAsString();
+    return LIBSBGN_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Map is set.
+ */
+bool
+Map::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_LANGUAGE:
+    return isSetLanguage();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::setAttribute(int attributeId, bool value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::setAttribute(int attributeId, int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::setAttribute(int attributeId, double value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_LANGUAGE:
+    return setLanguage(value);
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Map.
+ */
+int
+Map::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_LANGUAGE:
+    return unsetLanguage();
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1452,6 +1694,17 @@ Map::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SbgnBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SbgnBase objects, including those nested to an
  * arbitrary depth.
@@ -1460,15 +1713,76 @@ List*
 Map::getAllElements(SbgnElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SbgnBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Map::forEachElement(bool (*action)(SbgnBase*, void*),
+                    void* userData,
+                    SbgnElementFilter* filter)
+{
+  if (mBBox != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBBox)) && !action(mBBox, userData))
+    {
+      return false;
+    }
+
+    if (!mBBox->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_SBGN_FILTERED_POINTER(ret, sublist, mBBox, filter);
+  if (mGlyphs.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mGlyphs)) && !action(&mGlyphs,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mGlyphs, filter);
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mArcs, filter);
-  ADD_SBGN_FILTERED_LIST(ret, sublist, mArcGroups, filter);
+    if (!mGlyphs.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mArcs.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mArcs)) && !action(&mArcs,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mArcs.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mArcGroups.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mArcGroups)) && !action(&mArcGroups,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mArcGroups.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1553,20 +1867,20 @@ Map::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SbgnErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlMapAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, SbgnmlMapAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
@@ -1605,7 +1919,8 @@ Map::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mLanguage = Language_fromString(language.c_str());
+      mLanguage = Language_fromStringWithLength(language.c_str(),
+        language.size());
 
       if (log && Language_isValid(mLanguage) == 0)
       {
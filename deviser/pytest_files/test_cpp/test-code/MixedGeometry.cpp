@@ -941,6 +941,214 @@ MixedGeometry::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::lookupAttribute(const std::string& attributeName)
+{
+  return GeometryDefinition::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::getAttribute(int attributeId, bool& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::getAttribute(int attributeId, int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::getAttribute(int attributeId, double& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::getAttribute(int attributeId, std::string& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this MixedGeometry is set.
+ */
+bool
+MixedGeometry::isSetAttribute(int attributeId) const
+{
+  return GeometryDefinition::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::setAttribute(int attributeId, bool value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::setAttribute(int attributeId, int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::setAttribute(int attributeId, double value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::setAttribute(int attributeId, unsigned int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::setAttribute(int attributeId, const std::string& value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * MixedGeometry.
+ */
+int
+MixedGeometry::unsetAttribute(int attributeId)
+{
+  return GeometryDefinition::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1203,6 +1411,17 @@ MixedGeometry::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1211,15 +1430,67 @@ List*
 MixedGeometry::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mGeometryDefinitions, filter);
-  ADD_FILTERED_LIST(ret, sublist, mOrdinalMappings, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+MixedGeometry::forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter* filter)
+{
+  if (mGeometryDefinitions.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mGeometryDefinitions)) &&
+      !action(&mGeometryDefinitions, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mGeometryDefinitions.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mOrdinalMappings.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mOrdinalMappings)) &&
+      !action(&mOrdinalMappings, userData))
+    {
+      return false;
+    }
+
+    if (!mOrdinalMappings.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1299,28 +1570,30 @@ MixedGeometry::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GeometryDefinition::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialMixedGeometryAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialMixedGeometryAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialMixedGeometryAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialMixedGeometryAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
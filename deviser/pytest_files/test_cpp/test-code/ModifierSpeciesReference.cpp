@@ -60,7 +60,6 @@ ModifierSpeciesReference::ModifierSpeciesReference(unsigned int level,
   : SimpleSpeciesReference(level, version)
   , mElementName("modifierSpeciesReference")
 {
-  setSBMLNamespacesAndOwn(new SBMLNamespaces(level, version));
 }
 
 
@@ -452,6 +451,217 @@ ModifierSpeciesReference::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::lookupAttribute(const std::string& attributeName)
+{
+  return SimpleSpeciesReference::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::getAttribute(int attributeId, bool& value) const
+{
+  return SimpleSpeciesReference::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::getAttribute(int attributeId, int& value) const
+{
+  return SimpleSpeciesReference::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::getAttribute(int attributeId, double& value) const
+{
+  return SimpleSpeciesReference::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::getAttribute(int attributeId,
+                                       unsigned int& value) const
+{
+  return SimpleSpeciesReference::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::getAttribute(int attributeId,
+                                       std::string& value) const
+{
+  return SimpleSpeciesReference::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ModifierSpeciesReference is set.
+ */
+bool
+ModifierSpeciesReference::isSetAttribute(int attributeId) const
+{
+  return SimpleSpeciesReference::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::setAttribute(int attributeId, bool value)
+{
+  return SimpleSpeciesReference::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::setAttribute(int attributeId, int value)
+{
+  return SimpleSpeciesReference::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::setAttribute(int attributeId, double value)
+{
+  return SimpleSpeciesReference::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::setAttribute(int attributeId, unsigned int value)
+{
+  return SimpleSpeciesReference::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::setAttribute(int attributeId,
+                                       const std::string& value)
+{
+  return SimpleSpeciesReference::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ModifierSpeciesReference.
+ */
+int
+ModifierSpeciesReference::unsetAttribute(int attributeId)
+{
+  return SimpleSpeciesReference::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -511,27 +721,28 @@ ModifierSpeciesReference::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreReactionLOModifierSpeciesReferencesAllowedCoreAttributes,
+        SBMLError rewritten(CoreReactionLOModifierSpeciesReferencesAllowedCoreAttributes,
           level, version, details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SimpleSpeciesReference::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SBMLUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SBMLUnknownCoreAttribute);
-        log->logError(CoreModifierSpeciesReferenceAllowedAttributes, level,
-          version, details, getLine(), getColumn());
+        SBMLError rewritten(CoreModifierSpeciesReferenceAllowedAttributes,
+          level, version, details, getLine(), getColumn());
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
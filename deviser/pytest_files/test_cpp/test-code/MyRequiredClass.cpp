@@ -36,6 +36,13 @@
  */
 #include <sbml/packages/test/sbml/MyRequiredClass.h>
 #include <sbml/packages/test/validator/TestSBMLError.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 
 using namespace std;
@@ -92,7 +99,9 @@ MyRequiredClass::MyRequiredClass(unsigned int level,
   , mVectorInt ()
   , mVectorInt1 ()
   , mArrayD (NULL)
+  , mArrayDCount (0)
   , mArrayInt (NULL)
+  , mArrayIntCount (0)
 {
   setSBMLNamespacesAndOwn(new TestPkgNamespaces(level, version, pkgVersion));
 }
@@ -137,7 +146,9 @@ MyRequiredClass::MyRequiredClass(TestPkgNamespaces *testns)
   , mVectorInt ()
   , mVectorInt1 ()
   , mArrayD (NULL)
+  , mArrayDCount (0)
   , mArrayInt (NULL)
+  , mArrayIntCount (0)
 {
   setElementNamespace(testns->getURI());
   loadPlugins(testns);
@@ -183,11 +194,17 @@ MyRequiredClass::MyRequiredClass(const MyRequiredClass& orig)
   , mVectorInt ( orig.mVectorInt )
   , mVectorInt1 ( orig.mVectorInt1 )
   , mArrayD ( NULL )
+  , mArrayDCount ( 0 )
   , mArrayInt ( NULL )
+  , mArrayIntCount ( 0 )
 {
-  setArrayD(orig.mArrayD, orig.mArrayDLength);
+  setArrayD(orig.mArrayD, orig.mArrayDCount);
+  mArrayDLength = orig.mArrayDLength;
+  mIsSetArrayDLength = orig.mIsSetArrayDLength;
 
-  setArrayInt(orig.mArrayInt, orig.mArrayIntLength);
+  setArrayInt(orig.mArrayInt, orig.mArrayIntCount);
+  mArrayIntLength = orig.mArrayIntLength;
+  mIsSetArrayIntLength = orig.mIsSetArrayIntLength;
 
 }
 
@@ -234,10 +251,10 @@ MyRequiredClass::operator=(const MyRequiredClass& rhs)
     mVectorDouble1 = rhs.mVectorDouble1;
     mVectorInt = rhs.mVectorInt;
     mVectorInt1 = rhs.mVectorInt1;
-    mArrayD = NULL;
-    setArrayD(rhs.mArrayD, rhs.mArrayDLength);
-    mArrayInt = NULL;
-    setArrayInt(rhs.mArrayInt, rhs.mArrayIntLength);
+    unsetArrayD();
+    setArrayD(rhs.mArrayD, rhs.mArrayDCount);
+    unsetArrayInt();
+    setArrayInt(rhs.mArrayInt, rhs.mArrayIntCount);
   }
 
   return *this;
@@ -536,7 +553,39 @@ MyRequiredClass::getArrayD(double* outArray) const
     return;
   }
 
-  memcpy(outArray, mArrayD, sizeof(double)*mArrayDLength);
+  int count = mArrayDCount;
+
+  if (mArrayDLength < count)
+  {
+    count = mArrayDLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mArrayD, sizeof(double)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "arrayD" attribute of this
+ * MyRequiredClass.
+ */
+const double*
+MyRequiredClass::getArrayDPointer() const
+{
+  return mArrayD;
+}
+
+
+/*
+ * Returns the number of values held by the "arrayD" attribute of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getArrayDCount() const
+{
+  return mArrayDCount;
 }
 
 
@@ -551,7 +600,39 @@ MyRequiredClass::getArrayInt(int* outArray) const
     return;
   }
 
-  memcpy(outArray, mArrayInt, sizeof(int)*mArrayIntLength);
+  int count = mArrayIntCount;
+
+  if (mArrayIntLength < count)
+  {
+    count = mArrayIntLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mArrayInt, sizeof(int)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "arrayInt" attribute of this
+ * MyRequiredClass.
+ */
+const int*
+MyRequiredClass::getArrayIntPointer() const
+{
+  return mArrayInt;
+}
+
+
+/*
+ * Returns the number of values held by the "arrayInt" attribute of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getArrayIntCount() const
+{
+  return mArrayIntCount;
 }
 
 
@@ -1296,6 +1377,33 @@ MyRequiredClass::setArrayD(double* inArray, int arrayLength)
 
   mArrayD = new double[arrayLength];
   memcpy(mArrayD, inArray, sizeof(double)*arrayLength);
+  mArrayDCount = arrayLength;
+  mIsSetArrayDLength = true;
+  mArrayDLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "arrayD" attribute of this MyRequiredClass by taking
+ * ownership of the given array.
+ */
+int
+MyRequiredClass::adoptArrayD(double* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (mArrayD != NULL && mArrayD != inArray)
+  {
+    delete[] mArrayD;
+  }
+
+  mArrayD = inArray;
+  mArrayDCount = arrayLength;
   mIsSetArrayDLength = true;
   mArrayDLength = arrayLength;
 
@@ -1303,6 +1411,21 @@ MyRequiredClass::setArrayD(double* inArray, int arrayLength)
 }
 
 
+/*
+ * Releases the value of the "arrayD" attribute of this MyRequiredClass to the
+ * caller.
+ */
+double*
+MyRequiredClass::releaseArrayD()
+{
+  double* array = mArrayD;
+  mArrayD = NULL;
+  mArrayDCount = 0;
+  unsetArrayDLength();
+  return array;
+}
+
+
 /*
  * Sets the value of the "arrayInt" attribute of this MyRequiredClass.
  */
@@ -1321,6 +1444,33 @@ MyRequiredClass::setArrayInt(int* inArray, int arrayLength)
 
   mArrayInt = new int[arrayLength];
   memcpy(mArrayInt, inArray, sizeof(int)*arrayLength);
+  mArrayIntCount = arrayLength;
+  mIsSetArrayIntLength = true;
+  mArrayIntLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "arrayInt" attribute of this MyRequiredClass by taking
+ * ownership of the given array.
+ */
+int
+MyRequiredClass::adoptArrayInt(int* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (mArrayInt != NULL && mArrayInt != inArray)
+  {
+    delete[] mArrayInt;
+  }
+
+  mArrayInt = inArray;
+  mArrayIntCount = arrayLength;
   mIsSetArrayIntLength = true;
   mArrayIntLength = arrayLength;
 
@@ -1328,6 +1478,21 @@ MyRequiredClass::setArrayInt(int* inArray, int arrayLength)
 }
 
 
+/*
+ * Releases the value of the "arrayInt" attribute of this MyRequiredClass to
+ * the caller.
+ */
+int*
+MyRequiredClass::releaseArrayInt()
+{
+  int* array = mArrayInt;
+  mArrayInt = NULL;
+  mArrayIntCount = 0;
+  unsetArrayIntLength();
+  return array;
+}
+
+
 /*
  * Unsets the value of the "id" attribute of this MyRequiredClass.
  */
@@ -1793,6 +1958,7 @@ MyRequiredClass::unsetArrayD()
   }
 
   mArrayD = NULL;
+  mArrayDCount = 0;
 
   return unsetArrayDLength();
 }
@@ -1810,6 +1976,7 @@ MyRequiredClass::unsetArrayInt()
   }
 
   mArrayInt = NULL;
+  mArrayIntCount = 0;
 
   return unsetArrayIntLength();
 }
@@ -2091,10 +2258,46 @@ MyRequiredClass::write(XMLOutputStream& stream) const
 
   if (isSetArrayInt())
   {
-    for (int i = 0; i < mArrayIntLength; ++i)
+    // values are formatted straight into a chunk that is written
+    // when full, without a stream for each value
+
+    char chunk[65536 + 32];
+    size_t used = 0;
+
+    for (int i = 0; i < mArrayIntCount; ++i)
     {
-      stream << (long)mArrayInt[i] << " ";
+      long val = (long)mArrayInt[i];
+      unsigned long magnitude = (unsigned long)(val);
+      char digits[24];
+      int n = 0;
+
+      if (val < 0)
+      {
+        chunk[used++] = '-';
+        magnitude = 0UL - magnitude;
+      }
+
+      while (n == 0 || magnitude != 0)
+      {
+        digits[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+      }
+
+      while (n > 0)
+      {
+        chunk[used++] = digits[--n];
+      }
+
+      chunk[used++] = ' ';
+
+      if (used >= 65536)
+      {
+        stream << std::string(chunk, used);
+        used = 0;
+      }
     }
+
+    stream << std::string(chunk, used);
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -2137,15 +2340,11 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "true")
-  {
-    value = getTrue();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "false")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getFalse();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2171,15 +2370,11 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num3")
-  {
-    value = getNum3();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "num4")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum4();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2205,10 +2400,11 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2234,30 +2430,11 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num")
-  {
-    value = getNum();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "num2")
-  {
-    value = getNum2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint")
-  {
-    value = getPosint();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint2")
-  {
-    value = getPosint2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "posint1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getPosint1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2283,60 +2460,11 @@ MyRequiredClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "unit")
-  {
-    value = getUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref1")
-  {
-    value = getRef1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref2")
-  {
-    value = getRef2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = getRefUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "correctId")
-  {
-    value = getCorrectId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaid2")
-  {
-    value = getMetaid2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaid1")
-  {
-    value = getMetaid1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "metaidref1")
-  {
-    value = getMetaidref1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "notmetaid")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNotmetaid();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2357,113 +2485,11 @@ MyRequiredClass::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = isSetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = isSetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = isSetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = isSetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = isSetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = isSetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = isSetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = isSetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = isSetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = isSetCorrectId();
-  }
-  else if (attributeName == "posint")
-  {
-    value = isSetPosint();
-  }
-  else if (attributeName == "posint2")
-  {
-    value = isSetPosint2();
-  }
-  else if (attributeName == "posint1")
-  {
-    value = isSetPosint1();
-  }
-  else if (attributeName == "metaid2")
-  {
-    value = isSetMetaid2();
-  }
-  else if (attributeName == "metaid1")
-  {
-    value = isSetMetaid1();
-  }
-  else if (attributeName == "num4")
-  {
-    value = isSetNum4();
-  }
-  else if (attributeName == "metaidref1")
-  {
-    value = isSetMetaidref1();
-  }
-  else if (attributeName == "notmetaid")
-  {
-    value = isSetNotmetaid();
-  }
-  else if (attributeName == "vectorDouble")
-  {
-    value = hasVectorDoubles();
-  }
-  else if (attributeName == "vectorDouble1")
-  {
-    value = hasVectorDouble1s();
-  }
-  else if (attributeName == "vectorInt")
-  {
-    value = hasVectorInts();
-  }
-  else if (attributeName == "vectorInt1")
-  {
-    value = hasVectorInt1s();
-  }
-  else if (attributeName == "arrayD")
-  {
-    value = isSetArrayD();
-  }
-  else if (attributeName == "arrayInt")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetArrayInt();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -2483,13 +2509,11 @@ MyRequiredClass::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "true")
-  {
-    return_value = setTrue(value);
-  }
-  else if (attributeName == "false")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setFalse(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2509,13 +2533,11 @@ MyRequiredClass::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num3")
-  {
-    return_value = setNum3(value);
-  }
-  else if (attributeName == "num4")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum4(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2535,9 +2557,11 @@ MyRequiredClass::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum1(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2558,25 +2582,11 @@ MyRequiredClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num")
-  {
-    return_value = setNum(value);
-  }
-  else if (attributeName == "num2")
-  {
-    return_value = setNum2(value);
-  }
-  else if (attributeName == "posint")
-  {
-    return_value = setPosint(value);
-  }
-  else if (attributeName == "posint2")
-  {
-    return_value = setPosint2(value);
-  }
-  else if (attributeName == "posint1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setPosint1(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2597,49 +2607,11 @@ MyRequiredClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "unit")
-  {
-    return_value = setUnit(value);
-  }
-  else if (attributeName == "ref1")
-  {
-    return_value = setRef1(value);
-  }
-  else if (attributeName == "ref2")
-  {
-    return_value = setRef2(value);
-  }
-  else if (attributeName == "refUnit")
-  {
-    return_value = setRefUnit(value);
-  }
-  else if (attributeName == "correctId")
-  {
-    return_value = setCorrectId(value);
-  }
-  else if (attributeName == "metaid2")
-  {
-    return_value = setMetaid2(value);
-  }
-  else if (attributeName == "metaid1")
-  {
-    return_value = setMetaid1(value);
-  }
-  else if (attributeName == "metaidref1")
-  {
-    return_value = setMetaidref1(value);
-  }
-  else if (attributeName == "notmetaid")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNotmetaid(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -2659,122 +2631,558 @@ MyRequiredClass::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = unsetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = unsetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = unsetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = unsetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = unsetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = unsetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = unsetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = unsetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = unsetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = unsetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = unsetCorrectId();
-  }
-  else if (attributeName == "posint")
-  {
-    value = unsetPosint();
-  }
-  else if (attributeName == "posint2")
-  {
-    value = unsetPosint2();
-  }
-  else if (attributeName == "posint1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetPosint1();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "metaid2")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "name", "num", "num2", "num3",
+    "num1", "true", "false", "unit", "ref1", "ref2", "refUnit", "correctId",
+      "posint", "posint2", "posint1", "metaid2", "metaid1", "num4", "metaidref1",
+        "notmetaid", "vectorDouble", "vectorDouble1", "vectorInt", "vectorInt1",
+          "arrayD", "arrayInt" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetMetaid2();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "metaid1")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
   {
-    value = unsetMetaid1();
+  case ATTR_TRUE:
+    value = getTrue();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FALSE:
+    value = getFalse();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "num4")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetNum4();
+  case ATTR_NUM3:
+    value = getNum3();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NUM4:
+    value = getNum4();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "metaidref1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
   {
-    value = unsetMetaidref1();
+  case ATTR_NUM1:
+    value = getNum1();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "notmetaid")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getAttribute(int attributeId, unsigned int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetNotmetaid();
+  case ATTR_NUM:
+    value = getNum();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NUM2:
+    value = getNum2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_POSINT:
+    value = getPosint();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_POSINT2:
+    value = getPosint2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_POSINT1:
+    value = getPosint1();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "vectorDouble")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = clearVectorDoubles();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getName();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_UNIT:
+    value = getUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF1:
+    value = getRef1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF2:
+    value = getRef2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF_UNIT:
+    value = getRefUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_CORRECT_ID:
+    value = getCorrectId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_METAID2:
+    value = getMetaid2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_METAID1:
+    value = getMetaid1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_METAIDREF1:
+    value = getMetaidref1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NOTMETAID:
+    value = getNotmetaid();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "vectorDouble1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this MyRequiredClass is set.
+ */
+bool
+MyRequiredClass::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_NUM:
+    return isSetNum();
+  case ATTR_NUM2:
+    return isSetNum2();
+  case ATTR_NUM3:
+    return isSetNum3();
+  case ATTR_NUM1:
+    return isSetNum1();
+  case ATTR_TRUE:
+    return isSetTrue();
+  case ATTR_FALSE:
+    return isSetFalse();
+  case ATTR_UNIT:
+    return isSetUnit();
+  case ATTR_REF1:
+    return isSetRef1();
+  case ATTR_REF2:
+    return isSetRef2();
+  case ATTR_REF_UNIT:
+    return isSetRefUnit();
+  case ATTR_CORRECT_ID:
+    return isSetCorrectId();
+  case ATTR_POSINT:
+    return isSetPosint();
+  case ATTR_POSINT2:
+    return isSetPosint2();
+  case ATTR_POSINT1:
+    return isSetPosint1();
+  case ATTR_METAID2:
+    return isSetMetaid2();
+  case ATTR_METAID1:
+    return isSetMetaid1();
+  case ATTR_NUM4:
+    return isSetNum4();
+  case ATTR_METAIDREF1:
+    return isSetMetaidref1();
+  case ATTR_NOTMETAID:
+    return isSetNotmetaid();
+  case ATTR_VECTOR_DOUBLE:
+    return hasVectorDoubles();
+  case ATTR_VECTOR_DOUBLE1:
+    return hasVectorDouble1s();
+  case ATTR_VECTOR_INT:
+    return hasVectorInts();
+  case ATTR_VECTOR_INT1:
+    return hasVectorInt1s();
+  case ATTR_ARRAY_D:
+    return isSetArrayD();
+  case ATTR_ARRAY_INT:
+    return isSetArrayInt();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
   {
-    value = clearVectorDouble1s();
+  case ATTR_TRUE:
+    return setTrue(value);
+  case ATTR_FALSE:
+    return setFalse(value);
+  default:
+    break;
   }
-  else if (attributeName == "vectorInt")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
   {
-    value = clearVectorInts();
+  case ATTR_NUM3:
+    return setNum3(value);
+  case ATTR_NUM4:
+    return setNum4(value);
+  default:
+    break;
   }
-  else if (attributeName == "vectorInt1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
   {
-    value = clearVectorInt1s();
+  case ATTR_NUM1:
+    return setNum1(value);
+  default:
+    break;
   }
-  else if (attributeName == "arrayD")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
   {
-    value = unsetArrayD();
+  case ATTR_NUM:
+    return setNum(value);
+  case ATTR_NUM2:
+    return setNum2(value);
+  case ATTR_POSINT:
+    return setPosint(value);
+  case ATTR_POSINT2:
+    return setPosint2(value);
+  case ATTR_POSINT1:
+    return setPosint1(value);
+  default:
+    break;
   }
-  else if (attributeName == "arrayInt")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetArrayInt();
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_NAME:
+    return setName(value);
+  case ATTR_UNIT:
+    return setUnit(value);
+  case ATTR_REF1:
+    return setRef1(value);
+  case ATTR_REF2:
+    return setRef2(value);
+  case ATTR_REF_UNIT:
+    return setRefUnit(value);
+  case ATTR_CORRECT_ID:
+    return setCorrectId(value);
+  case ATTR_METAID2:
+    return setMetaid2(value);
+  case ATTR_METAID1:
+    return setMetaid1(value);
+  case ATTR_METAIDREF1:
+    return setMetaidref1(value);
+  case ATTR_NOTMETAID:
+    return setNotmetaid(value);
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * MyRequiredClass.
+ */
+int
+MyRequiredClass::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_NUM:
+    return unsetNum();
+  case ATTR_NUM2:
+    return unsetNum2();
+  case ATTR_NUM3:
+    return unsetNum3();
+  case ATTR_NUM1:
+    return unsetNum1();
+  case ATTR_TRUE:
+    return unsetTrue();
+  case ATTR_FALSE:
+    return unsetFalse();
+  case ATTR_UNIT:
+    return unsetUnit();
+  case ATTR_REF1:
+    return unsetRef1();
+  case ATTR_REF2:
+    return unsetRef2();
+  case ATTR_REF_UNIT:
+    return unsetRefUnit();
+  case ATTR_CORRECT_ID:
+    return unsetCorrectId();
+  case ATTR_POSINT:
+    return unsetPosint();
+  case ATTR_POSINT2:
+    return unsetPosint2();
+  case ATTR_POSINT1:
+    return unsetPosint1();
+  case ATTR_METAID2:
+    return unsetMetaid2();
+  case ATTR_METAID1:
+    return unsetMetaid1();
+  case ATTR_NUM4:
+    return unsetNum4();
+  case ATTR_METAIDREF1:
+    return unsetMetaidref1();
+  case ATTR_NOTMETAID:
+    return unsetNotmetaid();
+  case ATTR_VECTOR_DOUBLE:
+    return clearVectorDoubles();
+  case ATTR_VECTOR_DOUBLE1:
+    return clearVectorDouble1s();
+  case ATTR_VECTOR_INT:
+    return clearVectorInts();
+  case ATTR_VECTOR_INT1:
+    return clearVectorInt1s();
+  case ATTR_ARRAY_D:
+    return unsetArrayD();
+  case ATTR_ARRAY_INT:
+    return unsetArrayInt();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+MyRequiredClass::forEachElement(bool (*action)(SBase*, void*),
+                                void* userData,
+                                ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -2856,27 +3264,30 @@ MyRequiredClass::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("test", TestMyRequiredClassAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestMyRequiredClassAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("test", TestMyRequiredClassAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestMyRequiredClassAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -3740,28 +4151,72 @@ MyRequiredClass::writeAttributes(XMLOutputStream& stream) const
 void
 MyRequiredClass::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  int val;
-  vector<int> valuesVector;
+  unsigned int capacity = 0;
+  unsigned int length = 0;
+  bool inValue = false;
+
+  // count the values so the array is only allocated once
 
-  while (strStream >> val)
+  for (const char* c = text.c_str(); *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
+    if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+    {
+      inValue = false;
+    }
+    else if (inValue == false)
+    {
+      inValue = true;
+      capacity++;
+    }
   }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+  if (capacity == 0)
+  {
+    return;
+  }
+
+  // the classic locale reads the same numbers whatever the global locale is
+
+  std::istringstream parser(text);
+  std::istringstream number;
+  parser.imbue(std::locale::classic());
+  number.imbue(std::locale::classic());
+  std::string word;
+  int* data = new int[capacity];
 
-  if (length > 0)
+  while (length < capacity && parser >> word)
   {
-    int* data = new int[length];
-    for (unsigned int i = 0; i < length; ++i)
+    long val = 0;
+    number.clear();
+    number.str(word);
+    number >> val;
+
+    // the value must be the whole word and fit the array type
+
+    if (number.fail() || number.peek() != EOF)
+    {
+      break;
+    }
+    else if (val < std::numeric_limits<int>::min())
     {
-      data[i] = valuesVector.at(i);
+      break;
     }
+    else if (val > std::numeric_limits<int>::max())
+    {
+      break;
+    }
+
+    data[length++] = (int)(val);
+  }
 
-    setArrayInt(data, length);
+  if (length == 0)
+  {
     delete[] data;
   }
+  else
+  {
+    adoptArrayInt(data, length);
+  }
 }
 
 /** @endcond */
@@ -102,7 +102,9 @@ protected:
   std::vector<int> mVectorInt;
   std::vector<int> mVectorInt1;
   double* mArrayD;
+  int mArrayDCount;
   int* mArrayInt;
+  int mArrayIntCount;
 
   /** @endcond */
 
@@ -405,11 +407,38 @@ public:
    * "arrayD" attribute of this MyRequiredClass.
    *
    * @note the value of the "arrayD" attribute of this MyRequiredClass is
-   * returned in the argument array.
+   * returned in the argument array; no more than getArrayDLength() values are
+   * copied.
    */
   void getArrayD(double* outArray) const;
 
 
+  /**
+   * Returns a pointer to the value of the "arrayD" attribute of this
+   * MyRequiredClass.
+   *
+   * @return a pointer to the array held by this MyRequiredClass, or @c NULL if
+   * it is not set.
+   *
+   * @note the array is not copied; it has getArrayDCount() entries and remains
+   * owned by this MyRequiredClass.
+   */
+  const double* getArrayDPointer() const;
+
+
+  /**
+   * Returns the number of values held by the "arrayD" attribute of this
+   * MyRequiredClass.
+   *
+   * @return the number of values in the array returned by getArrayDPointer(),
+   * or @c 0 if it is not set.
+   *
+   * @note this is the size of the array itself, which the "arrayDLength"
+   * attribute need not match.
+   */
+  int getArrayDCount() const;
+
+
   /**
    * Returns the value of the "arrayInt" attribute of this MyRequiredClass.
    *
@@ -417,11 +446,38 @@ public:
    * "arrayInt" attribute of this MyRequiredClass.
    *
    * @note the value of the "arrayInt" attribute of this MyRequiredClass is
-   * returned in the argument array.
+   * returned in the argument array; no more than getArrayIntLength() values
+   * are copied.
    */
   void getArrayInt(int* outArray) const;
 
 
+  /**
+   * Returns a pointer to the value of the "arrayInt" attribute of this
+   * MyRequiredClass.
+   *
+   * @return a pointer to the array held by this MyRequiredClass, or @c NULL if
+   * it is not set.
+   *
+   * @note the array is not copied; it has getArrayIntCount() entries and
+   * remains owned by this MyRequiredClass.
+   */
+  const int* getArrayIntPointer() const;
+
+
+  /**
+   * Returns the number of values held by the "arrayInt" attribute of this
+   * MyRequiredClass.
+   *
+   * @return the number of values in the array returned by
+   * getArrayIntPointer(), or @c 0 if it is not set.
+   *
+   * @note this is the size of the array itself, which the "arrayIntLength"
+   * attribute need not match.
+   */
+  int getArrayIntCount() const;
+
+
   /**
    * Predicate returning @c true if this MyRequiredClass's "id" attribute is
    * set.
@@ -1125,6 +1181,39 @@ public:
   int setArrayD(double* inArray, int arrayLength);
 
 
+  /**
+   * Sets the value of the "arrayD" attribute of this MyRequiredClass by taking
+   * ownership of the given array.
+   *
+   * @param inArray double* array allocated with new[].
+   *
+   * @param arrayLength int value for the length of the "arrayD" attribute to
+   * be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * @note the array is not copied; this MyRequiredClass deletes it when it is
+   * no longer needed.
+   */
+  int adoptArrayD(double* inArray, int arrayLength);
+
+
+  /**
+   * Releases the value of the "arrayD" attribute of this MyRequiredClass to
+   * the caller.
+   *
+   * @return the array held by this MyRequiredClass, or @c NULL if it is not
+   * set.
+   *
+   * @note the caller owns the returned array and must delete[] it; the
+   * attribute is unset.
+   */
+  double* releaseArrayD();
+
+
   /**
    * Sets the value of the "arrayInt" attribute of this MyRequiredClass.
    *
@@ -1141,6 +1230,39 @@ public:
   int setArrayInt(int* inArray, int arrayLength);
 
 
+  /**
+   * Sets the value of the "arrayInt" attribute of this MyRequiredClass by
+   * taking ownership of the given array.
+   *
+   * @param inArray int* array allocated with new[].
+   *
+   * @param arrayLength int value for the length of the "arrayInt" attribute to
+   * be set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   *
+   * @note the array is not copied; this MyRequiredClass deletes it when it is
+   * no longer needed.
+   */
+  int adoptArrayInt(int* inArray, int arrayLength);
+
+
+  /**
+   * Releases the value of the "arrayInt" attribute of this MyRequiredClass to
+   * the caller.
+   *
+   * @return the array held by this MyRequiredClass, or @c NULL if it is not
+   * set.
+   *
+   * @note the caller owns the returned array and must delete[] it; the
+   * attribute is unset.
+   */
+  int* releaseArrayInt();
+
+
   /**
    * Unsets the value of the "id" attribute of this MyRequiredClass.
    *
@@ -1541,6 +1663,47 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Identifiers for the attributes of this MyRequiredClass, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_ID = 0,
+    ATTR_NAME,
+    ATTR_NUM,
+    ATTR_NUM2,
+    ATTR_NUM3,
+    ATTR_NUM1,
+    ATTR_TRUE,
+    ATTR_FALSE,
+    ATTR_UNIT,
+    ATTR_REF1,
+    ATTR_REF2,
+    ATTR_REF_UNIT,
+    ATTR_CORRECT_ID,
+    ATTR_POSINT,
+    ATTR_POSINT2,
+    ATTR_POSINT1,
+    ATTR_METAID2,
+    ATTR_METAID1,
+    ATTR_NUM4,
+    ATTR_METAIDREF1,
+    ATTR_NOTMETAID,
+    ATTR_VECTOR_DOUBLE,
+    ATTR_VECTOR_DOUBLE1,
+    ATTR_VECTOR_INT,
+    ATTR_VECTOR_INT1,
+    ATTR_ARRAY_D,
+    ATTR_ARRAY_INT,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
   /** @cond doxygenLibsbmlInternal */
 
   /**
@@ -1771,10 +1934,297 @@ public:
 
 
 
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this
+   * MyRequiredClass.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this MyRequiredClass is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this
+   * MyRequiredClass.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbmlconstant{LIBSBML_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbmlconstant{LIBSBML_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
 
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory unless an element has plugins, whose
+   * children are listed with getAllElementsFromPlugins().
+   */
+  virtual bool forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter * filter = NULL);
+
+
 protected:
 
 
@@ -40,7 +40,6 @@ LIBSEDML_CPP_NAMESPACE_BEGIN
 MySEDClass::MySEDClass(unsigned int level, unsigned int version)
   : SedBase(level, version)
 {
-  setSedNamespacesAndOwn(new SedNamespaces(level, version));
 }
 
 
@@ -122,6 +121,7 @@ MySEDClass::isSetId() const
 int
 MySEDClass::setId(const std::string& id)
 {
+  updateDocumentSIdIndex(mId, id);
   mId = id;
   return LIBSEDML_OPERATION_SUCCESS;
 }
@@ -133,6 +133,7 @@ MySEDClass::setId(const std::string& id)
 int
 MySEDClass::unsetId()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty() == true)
@@ -312,10 +313,11 @@ MySEDClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getId();
-    return_value = LIBSEDML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -336,9 +338,11 @@ MySEDClass::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SedBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetId();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -427,9 +431,11 @@ MySEDClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SedBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -449,9 +455,11 @@ MySEDClass::unsetAttribute(const std::string& attributeName)
 {
   int value = SedBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
 
   return value;
@@ -461,6 +469,269 @@ MySEDClass::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this MySEDClass.
+ */
+int
+MySEDClass::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::getAttribute(int attributeId, int& value) const
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::getAttribute(int attributeId, double& value) const
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSEDML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this MySEDClass is set.
+ */
+bool
+MySEDClass::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::setAttribute(int attributeId, bool value)
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::setAttribute(int attributeId, int value)
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::setAttribute(int attributeId, double value)
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  default:
+    break;
+  }
+
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibSEDMLInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * MySEDClass.
+ */
+int
+MySEDClass::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  default:
+    break;
+  }
+
+  return LIBSEDML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SedBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+MySEDClass::forEachElement(bool (*action)(SedBase*, void*),
+                           void* userData,
+                           SedElementFilter* filter)
+{
+  return true;
+}
+
+
+
 /** @cond doxygenLibSEDMLInternal */
 
 /*
@@ -493,20 +764,20 @@ MySEDClass::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SedErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SedBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SedUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SedUnknownCoreAttribute);
-        log->logError(TestMySEDClassAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, TestMySEDClassAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
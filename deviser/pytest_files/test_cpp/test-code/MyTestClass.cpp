@@ -1194,15 +1194,11 @@ MyTestClass::getAttribute(const std::string& attributeName, bool& value) const
     return return_value;
   }
 
-  if (attributeName == "true")
-  {
-    value = getTrue();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "false")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getFalse();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1227,10 +1223,11 @@ MyTestClass::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "num3")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum3();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1256,10 +1253,11 @@ MyTestClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1285,15 +1283,11 @@ MyTestClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "num")
-  {
-    value = getNum();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "num2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNum2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1319,55 +1313,11 @@ MyTestClass::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "unit")
-  {
-    value = getUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref1")
-  {
-    value = getRef1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "ref2")
-  {
-    value = getRef2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = getRefUnit();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "correctId")
-  {
-    value = getCorrectId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idRef")
-  {
-    value = getIdRef();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idref1")
-  {
-    value = getIdref1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "idref2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getIdref2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1388,69 +1338,11 @@ MyTestClass::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = isSetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = isSetNum2();
-  }
-  else if (attributeName == "num3")
-  {
-    value = isSetNum3();
-  }
-  else if (attributeName == "num1")
-  {
-    value = isSetNum1();
-  }
-  else if (attributeName == "true")
-  {
-    value = isSetTrue();
-  }
-  else if (attributeName == "false")
-  {
-    value = isSetFalse();
-  }
-  else if (attributeName == "unit")
-  {
-    value = isSetUnit();
-  }
-  else if (attributeName == "ref1")
-  {
-    value = isSetRef1();
-  }
-  else if (attributeName == "ref2")
-  {
-    value = isSetRef2();
-  }
-  else if (attributeName == "refUnit")
-  {
-    value = isSetRefUnit();
-  }
-  else if (attributeName == "correctId")
-  {
-    value = isSetCorrectId();
-  }
-  else if (attributeName == "idRef")
-  {
-    value = isSetIdRef();
-  }
-  else if (attributeName == "idref1")
-  {
-    value = isSetIdref1();
-  }
-  else if (attributeName == "idref2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetIdref2();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1470,13 +1362,11 @@ MyTestClass::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "true")
-  {
-    return_value = setTrue(value);
-  }
-  else if (attributeName == "false")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setFalse(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1496,9 +1386,11 @@ MyTestClass::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num3")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum3(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1518,9 +1410,11 @@ MyTestClass::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum1(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1541,13 +1435,11 @@ MyTestClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "num")
-  {
-    return_value = setNum(value);
-  }
-  else if (attributeName == "num2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNum2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1568,45 +1460,11 @@ MyTestClass::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "name")
-  {
-    return_value = setName(value);
-  }
-  else if (attributeName == "unit")
-  {
-    return_value = setUnit(value);
-  }
-  else if (attributeName == "ref1")
-  {
-    return_value = setRef1(value);
-  }
-  else if (attributeName == "ref2")
-  {
-    return_value = setRef2(value);
-  }
-  else if (attributeName == "refUnit")
-  {
-    return_value = setRefUnit(value);
-  }
-  else if (attributeName == "correctId")
-  {
-    return_value = setCorrectId(value);
-  }
-  else if (attributeName == "idRef")
-  {
-    return_value = setIdRef(value);
-  }
-  else if (attributeName == "idref1")
-  {
-    return_value = setIdref1(value);
-  }
-  else if (attributeName == "idref2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setIdref2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1626,77 +1484,485 @@ MyTestClass::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "name")
-  {
-    value = unsetName();
-  }
-  else if (attributeName == "num")
-  {
-    value = unsetNum();
-  }
-  else if (attributeName == "num2")
-  {
-    value = unsetNum2();
-  }
-  else if (attributeName == "num3")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetNum3();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "num1")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this MyTestClass.
+ */
+int
+MyTestClass::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "name", "num", "num2", "num3",
+    "num1", "true", "false", "unit", "ref1", "ref2", "refUnit", "correctId",
+      "idRef", "idref1", "idref2" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetNum1();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "true")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
   {
-    value = unsetTrue();
+  case ATTR_TRUE:
+    value = getTrue();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FALSE:
+    value = getFalse();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "false")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetFalse();
+  case ATTR_NUM3:
+    value = getNum3();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "unit")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
   {
-    value = unsetUnit();
+  case ATTR_NUM1:
+    value = getNum1();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "ref1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::getAttribute(int attributeId, unsigned int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetRef1();
+  case ATTR_NUM:
+    value = getNum();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NUM2:
+    value = getNum2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "ref2")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetRef2();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getName();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_UNIT:
+    value = getUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF1:
+    value = getRef1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF2:
+    value = getRef2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_REF_UNIT:
+    value = getRefUnit();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_CORRECT_ID:
+    value = getCorrectId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ID_REF:
+    value = getIdRef();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_IDREF1:
+    value = getIdref1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_IDREF2:
+    value = getIdref2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "refUnit")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this MyTestClass is set.
+ */
+bool
+MyTestClass::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_NUM:
+    return isSetNum();
+  case ATTR_NUM2:
+    return isSetNum2();
+  case ATTR_NUM3:
+    return isSetNum3();
+  case ATTR_NUM1:
+    return isSetNum1();
+  case ATTR_TRUE:
+    return isSetTrue();
+  case ATTR_FALSE:
+    return isSetFalse();
+  case ATTR_UNIT:
+    return isSetUnit();
+  case ATTR_REF1:
+    return isSetRef1();
+  case ATTR_REF2:
+    return isSetRef2();
+  case ATTR_REF_UNIT:
+    return isSetRefUnit();
+  case ATTR_CORRECT_ID:
+    return isSetCorrectId();
+  case ATTR_ID_REF:
+    return isSetIdRef();
+  case ATTR_IDREF1:
+    return isSetIdref1();
+  case ATTR_IDREF2:
+    return isSetIdref2();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
   {
-    value = unsetRefUnit();
+  case ATTR_TRUE:
+    return setTrue(value);
+  case ATTR_FALSE:
+    return setFalse(value);
+  default:
+    break;
   }
-  else if (attributeName == "correctId")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
   {
-    value = unsetCorrectId();
+  case ATTR_NUM3:
+    return setNum3(value);
+  default:
+    break;
   }
-  else if (attributeName == "idRef")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
   {
-    value = unsetIdRef();
+  case ATTR_NUM1:
+    return setNum1(value);
+  default:
+    break;
   }
-  else if (attributeName == "idref1")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
   {
-    value = unsetIdref1();
+  case ATTR_NUM:
+    return setNum(value);
+  case ATTR_NUM2:
+    return setNum2(value);
+  default:
+    break;
   }
-  else if (attributeName == "idref2")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetIdref2();
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_NAME:
+    return setName(value);
+  case ATTR_UNIT:
+    return setUnit(value);
+  case ATTR_REF1:
+    return setRef1(value);
+  case ATTR_REF2:
+    return setRef2(value);
+  case ATTR_REF_UNIT:
+    return setRefUnit(value);
+  case ATTR_CORRECT_ID:
+    return setCorrectId(value);
+  case ATTR_ID_REF:
+    return setIdRef(value);
+  case ATTR_IDREF1:
+    return setIdref1(value);
+  case ATTR_IDREF2:
+    return setIdref2(value);
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * MyTestClass.
+ */
+int
+MyTestClass::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_NUM:
+    return unsetNum();
+  case ATTR_NUM2:
+    return unsetNum2();
+  case ATTR_NUM3:
+    return unsetNum3();
+  case ATTR_NUM1:
+    return unsetNum1();
+  case ATTR_TRUE:
+    return unsetTrue();
+  case ATTR_FALSE:
+    return unsetFalse();
+  case ATTR_UNIT:
+    return unsetUnit();
+  case ATTR_REF1:
+    return unsetRef1();
+  case ATTR_REF2:
+    return unsetRef2();
+  case ATTR_REF_UNIT:
+    return unsetRefUnit();
+  case ATTR_CORRECT_ID:
+    return unsetCorrectId();
+  case ATTR_ID_REF:
+    return unsetIdRef();
+  case ATTR_IDREF1:
+    return unsetIdref1();
+  case ATTR_IDREF2:
+    return unsetIdref2();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+MyTestClass::forEachElement(bool (*action)(SBase*, void*),
+                            void* userData,
+                            ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -1761,27 +2027,30 @@ MyTestClass::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("test", TestMyTestClassAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestMyTestClassAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("test", TestMyTestClassAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(TestMyTestClassAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "test", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -300,7 +300,8 @@ int
 Output::setTransitionEffect(const std::string& transitionEffect)
 {
   mTransitionEffect =
-    TransitionOutputEffect_fromString(transitionEffect.c_str());
+    TransitionOutputEffect_fromStringWithLength(transitionEffect.c_str(),
+      transitionEffect.size());
 
   if (mTransitionEffect == OUTPUT_TRANSITION_INVALID)
   {
@@ -576,10 +577,11 @@ Output::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "outputLevel")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getOutputLevel();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -640,25 +642,11 @@ Output::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "qualitativeSpecies")
-  {
-    value = getQualitativeSpecies();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "transitionEffect")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getTransitionEffectAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "name")
-  {
-    value = getName();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -679,25 +667,11 @@ Output::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "qualitativeSpecies")
-  {
-    value = isSetQualitativeSpecies();
-  }
-  else if (attributeName == "transitionEffect")
-  {
-    value = isSetTransitionEffect();
-  }
-  else if (attributeName == "name")
-  {
-    value = isSetName();
-  }
-  else if (attributeName == "outputLevel")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetOutputLevel();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -734,9 +708,11 @@ Output::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "outputLevel")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setOutputLevel(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -791,24 +767,103 @@ Output::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setId(value);
+    return_value = setAttribute(attributeId, value);
   }
-  else if (attributeName == "qualitativeSpecies")
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this Output.
+ */
+int
+Output::unsetAttribute(const std::string& attributeName)
+{
+  int value = SBase::unsetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setQualitativeSpecies(value);
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "transitionEffect")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Output.
+ */
+int
+Output::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "qualitativeSpecies",
+    "transitionEffect", "name", "outputLevel" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    return_value = setTransitionEffect(value);
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "name")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    return_value = setName(value);
+  case ATTR_OUTPUT_LEVEL:
+    value = getOutputLevel();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return return_value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -818,40 +873,256 @@ Output::setAttribute(const std::string& attributeName,
 /** @cond doxygenLibsbmlInternal */
 
 /*
- * Unsets the value of the "attributeName" attribute of this Output.
+ * Gets the value of the attribute with the given identifier of this Output.
  */
 int
-Output::unsetAttribute(const std::string& attributeName)
+Output::getAttribute(int attributeId, double& value) const
 {
-  int value = SBase::unsetAttribute(attributeName);
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
 
-  if (attributeName == "id")
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetId();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_QUALITATIVE_SPECIES:
+    value = getQualitativeSpecies();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_TRANSITION_EFFECT:
+    value = getTransitionEffectAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getName();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "qualitativeSpecies")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Output is set.
+ */
+bool
+Output::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetQualitativeSpecies();
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_QUALITATIVE_SPECIES:
+    return isSetQualitativeSpecies();
+  case ATTR_TRANSITION_EFFECT:
+    return isSetTransitionEffect();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_OUTPUT_LEVEL:
+    return isSetOutputLevel();
+  default:
+    break;
   }
-  else if (attributeName == "transitionEffect")
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
   {
-    value = unsetTransitionEffect();
+  case ATTR_OUTPUT_LEVEL:
+    return setOutputLevel(value);
+  default:
+    break;
   }
-  else if (attributeName == "name")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetName();
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_QUALITATIVE_SPECIES:
+    return setQualitativeSpecies(value);
+  case ATTR_TRANSITION_EFFECT:
+    return setTransitionEffect(value);
+  case ATTR_NAME:
+    return setName(value);
+  default:
+    break;
   }
-  else if (attributeName == "outputLevel")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Output.
+ */
+int
+Output::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetOutputLevel();
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_QUALITATIVE_SPECIES:
+    return unsetQualitativeSpecies();
+  case ATTR_TRANSITION_EFFECT:
+    return unsetTransitionEffect();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_OUTPUT_LEVEL:
+    return unsetOutputLevel();
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Output::forEachElement(bool (*action)(SBase*, void*),
+                       void* userData,
+                       ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -903,42 +1174,46 @@ Output::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("qual", QualTransitionLOOutputsAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(QualTransitionLOOutputsAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "qual", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("qual",
-          QualTransitionLOOutputsAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(QualTransitionLOOutputsAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "qual", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("qual", QualOutputAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(QualOutputAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "qual", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("qual", QualOutputAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(QualOutputAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "qual", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1017,8 +1292,8 @@ Output::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mTransitionEffect =
-        TransitionOutputEffect_fromString(transitionEffect.c_str());
+      mTransitionEffect = TransitionOutputEffect_fromStringWithLength(transitionEffect.c_str(),
+        transitionEffect.size());
 
       if (log && TransitionOutputEffect_isValid(mTransitionEffect) == 0)
       {
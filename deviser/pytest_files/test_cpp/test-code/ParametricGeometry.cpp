@@ -830,6 +830,214 @@ ParametricGeometry::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::lookupAttribute(const std::string& attributeName)
+{
+  return GeometryDefinition::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::getAttribute(int attributeId, bool& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::getAttribute(int attributeId, int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::getAttribute(int attributeId, double& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::getAttribute(int attributeId, std::string& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this ParametricGeometry is set.
+ */
+bool
+ParametricGeometry::isSetAttribute(int attributeId) const
+{
+  return GeometryDefinition::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::setAttribute(int attributeId, bool value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::setAttribute(int attributeId, int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::setAttribute(int attributeId, double value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::setAttribute(int attributeId, unsigned int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::setAttribute(int attributeId, const std::string& value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * ParametricGeometry.
+ */
+int
+ParametricGeometry::unsetAttribute(int attributeId)
+{
+  return GeometryDefinition::unsetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1048,6 +1256,17 @@ ParametricGeometry::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1056,15 +1275,67 @@ List*
 ParametricGeometry::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+ParametricGeometry::forEachElement(bool (*action)(SBase*, void*),
+                                   void* userData,
+                                   ElementFilter* filter)
+{
+  if (mSpatialPoints != NULL)
+  {
+    if ((filter == NULL || filter->filter(mSpatialPoints)) &&
+      !action(mSpatialPoints, userData))
+    {
+      return false;
+    }
+
+    if (!mSpatialPoints->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mParametricObjects.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mParametricObjects)) &&
+      !action(&mParametricObjects, userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_POINTER(ret, sublist, mSpatialPoints, filter);
+    if (!mParametricObjects.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  ADD_FILTERED_LIST(ret, sublist, mParametricObjects, filter);
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  return ret;
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1151,29 +1422,30 @@ ParametricGeometry::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GeometryDefinition::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialParametricGeometryAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialParametricGeometryAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialParametricGeometryAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialParametricGeometryAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -63,7 +63,6 @@ Point::Point(unsigned int level, unsigned int version)
   , mPoints (new SbgnListOfPoints (level, version))
   , mElementName("point")
 {
-  setSbgnNamespacesAndOwn(new SbgnNamespaces(level, version));
   connectToChild();
 }
 
@@ -571,15 +570,11 @@ Point::getAttribute(const std::string& attributeName, double& value) const
     return return_value;
   }
 
-  if (attributeName == "x")
-  {
-    value = getX();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "y")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getY();
-    return_value = LIBSBGN_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -636,13 +631,11 @@ Point::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "x")
-  {
-    value = isSetX();
-  }
-  else if (attributeName == "y")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetY();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -696,13 +689,11 @@ Point::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "x")
-  {
-    return_value = setX(value);
-  }
-  else if (attributeName == "y")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setY(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -757,16 +748,262 @@ Point::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "x")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetX();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "y")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Point.
+ */
+int
+Point::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "x", "y" };
+
+  for (int i = ATTR_X; i < ATTR_COUNT; i++)
   {
-    value = unsetY();
+    if (attributeName == names[i - ATTR_X])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_X:
+    value = getX();
+    return LIBSBGN_OPERATION_SUCCESS;
+  case ATTR_Y:
+    value = getY();
+    return LIBSBGN_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Point is set.
+ */
+bool
+Point::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_X:
+    return isSetX();
+  case ATTR_Y:
+    return isSetY();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::setAttribute(int attributeId, bool value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::setAttribute(int attributeId, int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_X:
+    return setX(value);
+  case ATTR_Y:
+    return setY(value);
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBGN_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibSBGNInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Point.
+ */
+int
+Point::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_X:
+    return unsetX();
+  case ATTR_Y:
+    return unsetY();
+  default:
+    break;
+  }
+
+  return LIBSBGN_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -916,6 +1153,17 @@ Point::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SbgnBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SbgnBase objects, including those nested to an
  * arbitrary depth.
@@ -924,12 +1172,35 @@ List*
 Point::getAllElements(SbgnElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
 
+/*
+ * Calls @p action on each child SbgnBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Point::forEachElement(bool (*action)(SbgnBase*, void*),
+                      void* userData,
+                      SbgnElementFilter* filter)
+{
+  if (mPoints != NULL)
+  {
+    if ((filter == NULL || filter->filter(mPoints)) && !action(mPoints,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_SBGN_FILTERED_POINTER(ret, sublist, mPoints, filter);
+    if (!mPoints->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  return true;
 }
 
 
@@ -1003,27 +1274,26 @@ Point::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlArcLOPointsAllowedCoreAttributes, level, version,
-          details, getLine(), getColumn());
+        log->replaceError(n, SbgnmlArcLOPointsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn());
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == SbgnUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(SbgnUnknownCoreAttribute);
-        log->logError(SbgnmlPointAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, SbgnmlPointAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
@@ -449,7 +449,8 @@ RenderGroup::setFontWeight(const FontWeight_t fontWeight)
 int
 RenderGroup::setFontWeight(const std::string& fontWeight)
 {
-  mFontWeight = FontWeight_fromString(fontWeight.c_str());
+  mFontWeight = FontWeight_fromStringWithLength(fontWeight.c_str(),
+    fontWeight.size());
 
   if (mFontWeight == FONT_WEIGHT_NORMAL_INVALID)
   {
@@ -485,7 +486,8 @@ RenderGroup::setFontStyle(const FontStyle_t fontStyle)
 int
 RenderGroup::setFontStyle(const std::string& fontStyle)
 {
-  mFontStyle = FontStyle_fromString(fontStyle.c_str());
+  mFontStyle = FontStyle_fromStringWithLength(fontStyle.c_str(),
+    fontStyle.size());
 
   if (mFontStyle == FONT_STYLE_NORMAL_INVALID)
   {
@@ -521,7 +523,8 @@ RenderGroup::setTextAnchor(const HTextAnchor_t textAnchor)
 int
 RenderGroup::setTextAnchor(const std::string& textAnchor)
 {
-  mTextAnchor = HTextAnchor_fromString(textAnchor.c_str());
+  mTextAnchor = HTextAnchor_fromStringWithLength(textAnchor.c_str(),
+    textAnchor.size());
 
   if (mTextAnchor == H_END_INVALID)
   {
@@ -557,7 +560,8 @@ RenderGroup::setVtextAnchor(const VTextAnchor_t vtextAnchor)
 int
 RenderGroup::setVtextAnchor(const std::string& vtextAnchor)
 {
-  mVtextAnchor = VTextAnchor_fromString(vtextAnchor.c_str());
+  mVtextAnchor = VTextAnchor_fromStringWithLength(vtextAnchor.c_str(),
+    vtextAnchor.size());
 
   if (mVtextAnchor == V_ANCHOR_BASELINE_INVALID)
   {
@@ -1362,50 +1366,14 @@ int
 RenderGroup::getAttribute(const std::string& attributeName,
                           std::string& value) const
 {
-  int return_value = GraphicalPrimitive2D::getAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
-  {
-    return return_value;
-  }
-
-  if (attributeName == "startHead")
-  {
-    value = getStartHead();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "endHead")
-  {
-    value = getEndHead();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-family")
-  {
-    value = getFontFamily();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-weight")
-  {
-    value = getFontWeightAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "font-style")
-  {
-    value = getFontStyleAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "text-anchor")
+  if (attributeId != -1)
   {
-    value = getTextAnchorAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    value = getVtextAnchorAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return getAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive2D::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -1421,38 +1389,14 @@ RenderGroup::getAttribute(const std::string& attributeName,
 bool
 RenderGroup::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = GraphicalPrimitive2D::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "startHead")
-  {
-    value = isSetStartHead();
-  }
-  else if (attributeName == "endHead")
-  {
-    value = isSetEndHead();
-  }
-  else if (attributeName == "font-family")
-  {
-    value = isSetFontFamily();
-  }
-  else if (attributeName == "font-weight")
-  {
-    value = isSetFontWeight();
-  }
-  else if (attributeName == "font-style")
-  {
-    value = isSetFontStyle();
-  }
-  else if (attributeName == "text-anchor")
-  {
-    value = isSetTextAnchor();
-  }
-  else if (attributeName == "vtext-anchor")
+  if (attributeId != -1)
   {
-    value = isSetVtextAnchor();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return GraphicalPrimitive2D::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -1537,38 +1481,14 @@ int
 RenderGroup::setAttribute(const std::string& attributeName,
                           const std::string& value)
 {
-  int return_value = GraphicalPrimitive2D::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "startHead")
-  {
-    return_value = setStartHead(value);
-  }
-  else if (attributeName == "endHead")
-  {
-    return_value = setEndHead(value);
-  }
-  else if (attributeName == "font-family")
-  {
-    return_value = setFontFamily(value);
-  }
-  else if (attributeName == "font-weight")
-  {
-    return_value = setFontWeight(value);
-  }
-  else if (attributeName == "font-style")
+  if (attributeId != -1)
   {
-    return_value = setFontStyle(value);
-  }
-  else if (attributeName == "text-anchor")
-  {
-    return_value = setTextAnchor(value);
-  }
-  else if (attributeName == "vtext-anchor")
-  {
-    return_value = setVtextAnchor(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GraphicalPrimitive2D::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -1583,38 +1503,319 @@ RenderGroup::setAttribute(const std::string& attributeName,
 int
 RenderGroup::unsetAttribute(const std::string& attributeName)
 {
-  int value = GraphicalPrimitive2D::unsetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "startHead")
+  if (attributeId != -1)
   {
-    value = unsetStartHead();
+    return unsetAttribute(attributeId);
   }
-  else if (attributeName == "endHead")
-  {
-    value = unsetEndHead();
-  }
-  else if (attributeName == "font-family")
+
+  return GraphicalPrimitive2D::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this RenderGroup.
+ */
+int
+RenderGroup::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "startHead", "endHead", "font-family",
+    "font-weight", "font-style", "text-anchor", "vtext-anchor" };
+
+  for (int i = ATTR_START_HEAD; i < ATTR_COUNT; i++)
   {
-    value = unsetFontFamily();
+    if (attributeName == names[i - ATTR_START_HEAD])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "font-weight")
+
+  return GraphicalPrimitive2D::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::getAttribute(int attributeId, bool& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::getAttribute(int attributeId, int& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::getAttribute(int attributeId, double& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetFontWeight();
+  case ATTR_START_HEAD:
+    value = getStartHead();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_END_HEAD:
+    value = getEndHead();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FONT_FAMILY:
+    value = getFontFamily();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FONT_WEIGHT:
+    value = getFontWeightAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_FONT_STYLE:
+    value = getFontStyleAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_TEXT_ANCHOR:
+    value = getTextAnchorAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_VTEXT_ANCHOR:
+    value = getVtextAnchorAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "font-style")
+
+  return GraphicalPrimitive2D::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this RenderGroup is set.
+ */
+bool
+RenderGroup::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetFontStyle();
+  case ATTR_START_HEAD:
+    return isSetStartHead();
+  case ATTR_END_HEAD:
+    return isSetEndHead();
+  case ATTR_FONT_FAMILY:
+    return isSetFontFamily();
+  case ATTR_FONT_WEIGHT:
+    return isSetFontWeight();
+  case ATTR_FONT_STYLE:
+    return isSetFontStyle();
+  case ATTR_TEXT_ANCHOR:
+    return isSetTextAnchor();
+  case ATTR_VTEXT_ANCHOR:
+    return isSetVtextAnchor();
+  default:
+    break;
   }
-  else if (attributeName == "text-anchor")
+
+  return GraphicalPrimitive2D::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::setAttribute(int attributeId, bool value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::setAttribute(int attributeId, int value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::setAttribute(int attributeId, double value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::setAttribute(int attributeId, unsigned int value)
+{
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetTextAnchor();
+  case ATTR_START_HEAD:
+    return setStartHead(value);
+  case ATTR_END_HEAD:
+    return setEndHead(value);
+  case ATTR_FONT_FAMILY:
+    return setFontFamily(value);
+  case ATTR_FONT_WEIGHT:
+    return setFontWeight(value);
+  case ATTR_FONT_STYLE:
+    return setFontStyle(value);
+  case ATTR_TEXT_ANCHOR:
+    return setTextAnchor(value);
+  case ATTR_VTEXT_ANCHOR:
+    return setVtextAnchor(value);
+  default:
+    break;
   }
-  else if (attributeName == "vtext-anchor")
+
+  return GraphicalPrimitive2D::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * RenderGroup.
+ */
+int
+RenderGroup::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
   {
-    value = unsetVtextAnchor();
+  case ATTR_START_HEAD:
+    return unsetStartHead();
+  case ATTR_END_HEAD:
+    return unsetEndHead();
+  case ATTR_FONT_FAMILY:
+    return unsetFontFamily();
+  case ATTR_FONT_WEIGHT:
+    return unsetFontWeight();
+  case ATTR_FONT_STYLE:
+    return unsetFontStyle();
+  case ATTR_TEXT_ANCHOR:
+    return unsetTextAnchor();
+  case ATTR_VTEXT_ANCHOR:
+    return unsetVtextAnchor();
+  default:
+    break;
   }
 
-  return value;
+  return GraphicalPrimitive2D::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -1956,6 +2157,17 @@ RenderGroup::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1964,15 +2176,67 @@ List*
 RenderGroup::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mFontSize, filter);
 
-  ADD_FILTERED_LIST(ret, sublist, mTransformation2Ds, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+RenderGroup::forEachElement(bool (*action)(SBase*, void*),
+                            void* userData,
+                            ElementFilter* filter)
+{
+  if (mFontSize != NULL)
+  {
+    if ((filter == NULL || filter->filter(mFontSize)) && !action(mFontSize,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (!mFontSize->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mTransformation2Ds.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mTransformation2Ds)) &&
+      !action(&mTransformation2Ds, userData))
+    {
+      return false;
+    }
+
+    if (!mTransformation2Ds.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -2066,27 +2330,30 @@ RenderGroup::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GraphicalPrimitive2D::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("render", RenderRenderGroupAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderRenderGroupAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("render", RenderRenderGroupAllowedCoreAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(RenderRenderGroupAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "render", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -2175,7 +2442,8 @@ RenderGroup::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mFontWeight = FontWeight_fromString(fontWeight.c_str());
+      mFontWeight = FontWeight_fromStringWithLength(fontWeight.c_str(),
+        fontWeight.size());
 
       if (log && FontWeight_isValid(mFontWeight) == 0)
       {
@@ -2210,7 +2478,8 @@ RenderGroup::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mFontStyle = FontStyle_fromString(fontStyle.c_str());
+      mFontStyle = FontStyle_fromStringWithLength(fontStyle.c_str(),
+        fontStyle.size());
 
       if (log && FontStyle_isValid(mFontStyle) == 0)
       {
@@ -2245,7 +2514,8 @@ RenderGroup::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mTextAnchor = HTextAnchor_fromString(textAnchor.c_str());
+      mTextAnchor = HTextAnchor_fromStringWithLength(textAnchor.c_str(),
+        textAnchor.size());
 
       if (log && HTextAnchor_isValid(mTextAnchor) == 0)
       {
@@ -2280,7 +2550,8 @@ RenderGroup::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mVtextAnchor = VTextAnchor_fromString(vtextAnchor.c_str());
+      mVtextAnchor = VTextAnchor_fromStringWithLength(vtextAnchor.c_str(),
+        vtextAnchor.size());
 
       if (log && VTextAnchor_isValid(mVtextAnchor) == 0)
       {
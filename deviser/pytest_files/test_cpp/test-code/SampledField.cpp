@@ -37,6 +37,13 @@
 #include <sbml/packages/spatial/sbml/SampledField.h>
 #include <sbml/packages/spatial/sbml/ListOfSampledFields.h>
 #include <sbml/packages/spatial/validator/SpatialSBMLError.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 
 using namespace std;
@@ -69,6 +76,7 @@ SampledField::SampledField(unsigned int level,
   , mInterpolationType (SPATIAL_INTERPOLATIONKIND_INVALID)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mSamples (NULL)
+  , mSamplesCount (0)
   , mSamplesLength (SBML_INT_MAX)
   , mIsSetSamplesLength (false)
 {
@@ -92,6 +100,7 @@ SampledField::SampledField(SpatialPkgNamespaces *spatialns)
   , mInterpolationType (SPATIAL_INTERPOLATIONKIND_INVALID)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mSamples (NULL)
+  , mSamplesCount (0)
   , mSamplesLength (SBML_INT_MAX)
   , mIsSetSamplesLength (false)
 {
@@ -115,10 +124,13 @@ SampledField::SampledField(const SampledField& orig)
   , mInterpolationType ( orig.mInterpolationType )
   , mCompression ( orig.mCompression )
   , mSamples ( NULL )
+  , mSamplesCount ( 0 )
   , mSamplesLength ( orig.mSamplesLength )
   , mIsSetSamplesLength ( orig.mIsSetSamplesLength )
 {
-  setSamples(orig.mSamples, orig.mSamplesLength);
+  setSamples(orig.mSamples, orig.mSamplesCount);
+  mSamplesLength = orig.mSamplesLength;
+  mIsSetSamplesLength = orig.mIsSetSamplesLength;
 
 }
 
@@ -141,8 +153,8 @@ SampledField::operator=(const SampledField& rhs)
     mIsSetNumSamples3 = rhs.mIsSetNumSamples3;
     mInterpolationType = rhs.mInterpolationType;
     mCompression = rhs.mCompression;
-    mSamples = NULL;
-    setSamples(rhs.mSamples, rhs.mSamplesLength);
+    unsetSamples();
+    setSamples(rhs.mSamples, rhs.mSamplesCount);
     mSamplesLength = rhs.mSamplesLength;
     mIsSetSamplesLength = rhs.mIsSetSamplesLength;
   }
@@ -289,7 +301,39 @@ SampledField::getSamples(int* outArray) const
     return;
   }
 
-  memcpy(outArray, mSamples, sizeof(int)*mSamplesLength);
+  int count = mSamplesCount;
+
+  if (mSamplesLength < count)
+  {
+    count = mSamplesLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mSamples, sizeof(int)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "samples" attribute of this
+ * SampledField.
+ */
+const int*
+SampledField::getSamplesPointer() const
+{
+  return mSamples;
+}
+
+
+/*
+ * Returns the number of values held by the "samples" attribute of this
+ * SampledField.
+ */
+int
+SampledField::getSamplesCount() const
+{
+  return mSamplesCount;
 }
 
 
@@ -436,7 +480,7 @@ SampledField::setDataType(const DataKind_t dataType)
 int
 SampledField::setDataType(const std::string& dataType)
 {
-  mDataType = DataKind_fromString(dataType.c_str());
+  mDataType = DataKind_fromStringWithLength(dataType.c_str(), dataType.size());
 
   if (mDataType == SPATIAL_DATAKIND_INVALID)
   {
@@ -508,7 +552,9 @@ SampledField::setInterpolationType(const InterpolationKind_t interpolationType)
 int
 SampledField::setInterpolationType(const std::string& interpolationType)
 {
-  mInterpolationType = InterpolationKind_fromString(interpolationType.c_str());
+  mInterpolationType =
+    InterpolationKind_fromStringWithLength(interpolationType.c_str(),
+      interpolationType.size());
 
   if (mInterpolationType == SPATIAL_INTERPOLATIONKIND_INVALID)
   {
@@ -544,7 +590,8 @@ SampledField::setCompression(const CompressionKind_t compression)
 int
 SampledField::setCompression(const std::string& compression)
 {
-  mCompression = CompressionKind_fromString(compression.c_str());
+  mCompression = CompressionKind_fromStringWithLength(compression.c_str(),
+    compression.size());
 
   if (mCompression == SPATIAL_COMPRESSIONKIND_INVALID)
   {
@@ -573,6 +620,7 @@ SampledField::setSamples(int* inArray, int arrayLength)
 
   mSamples = new int[arrayLength];
   memcpy(mSamples, inArray, sizeof(int)*arrayLength);
+  mSamplesCount = arrayLength;
   mIsSetSamplesLength = true;
   mSamplesLength = arrayLength;
 
@@ -580,6 +628,47 @@ SampledField::setSamples(int* inArray, int arrayLength)
 }
 
 
+/*
+ * Sets the value of the "samples" attribute of this SampledField by taking
+ * ownership of the given array.
+ */
+int
+SampledField::adoptSamples(int* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (mSamples != NULL && mSamples != inArray)
+  {
+    delete[] mSamples;
+  }
+
+  mSamples = inArray;
+  mSamplesCount = arrayLength;
+  mIsSetSamplesLength = true;
+  mSamplesLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Releases the value of the "samples" attribute of this SampledField to the
+ * caller.
+ */
+int*
+SampledField::releaseSamples()
+{
+  int* array = mSamples;
+  mSamples = NULL;
+  mSamplesCount = 0;
+  unsetSamplesLength();
+  return array;
+}
+
+
 /*
  * Sets the value of the "samplesLength" attribute of this SampledField.
  */
@@ -716,6 +805,7 @@ SampledField::unsetSamples()
   }
 
   mSamples = NULL;
+  mSamplesCount = 0;
 
   return unsetSamplesLength();
 }
@@ -871,10 +961,46 @@ SampledField::write(XMLOutputStream& stream) const
 
   if (isSetSamples())
   {
-    for (int i = 0; i < mSamplesLength; ++i)
+    // values are formatted straight into a chunk that is written
+    // when full, without a stream for each value
+
+    char chunk[65536 + 32];
+    size_t used = 0;
+
+    for (int i = 0; i < mSamplesCount; ++i)
     {
-      stream << (long)mSamples[i] << " ";
+      long val = (long)mSamples[i];
+      unsigned long magnitude = (unsigned long)(val);
+      char digits[24];
+      int n = 0;
+
+      if (val < 0)
+      {
+        chunk[used++] = '-';
+        magnitude = 0UL - magnitude;
+      }
+
+      while (n == 0 || magnitude != 0)
+      {
+        digits[n++] = (char)('0' + magnitude % 10);
+        magnitude /= 10;
+      }
+
+      while (n > 0)
+      {
+        chunk[used++] = digits[--n];
+      }
+
+      chunk[used++] = ' ';
+
+      if (used >= 65536)
+      {
+        stream << std::string(chunk, used);
+        used = 0;
+      }
     }
+
+    stream << std::string(chunk, used);
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -934,25 +1060,11 @@ SampledField::getAttribute(const std::string& attributeName, int& value) const
     return return_value;
   }
 
-  if (attributeName == "numSamples1")
-  {
-    value = getNumSamples1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "numSamples2")
-  {
-    value = getNumSamples2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "numSamples3")
-  {
-    value = getNumSamples3();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "samplesLength")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getSamplesLength();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1014,25 +1126,11 @@ SampledField::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "dataType")
-  {
-    value = getDataTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "interpolationType")
-  {
-    value = getInterpolationTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "compression")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getCompressionAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1053,41 +1151,11 @@ SampledField::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "dataType")
-  {
-    value = isSetDataType();
-  }
-  else if (attributeName == "numSamples1")
-  {
-    value = isSetNumSamples1();
-  }
-  else if (attributeName == "numSamples2")
-  {
-    value = isSetNumSamples2();
-  }
-  else if (attributeName == "numSamples3")
-  {
-    value = isSetNumSamples3();
-  }
-  else if (attributeName == "interpolationType")
-  {
-    value = isSetInterpolationType();
-  }
-  else if (attributeName == "compression")
-  {
-    value = isSetCompression();
-  }
-  else if (attributeName == "samples")
-  {
-    value = isSetSamples();
-  }
-  else if (attributeName == "samplesLength")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetSamplesLength();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1124,21 +1192,11 @@ SampledField::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "numSamples1")
-  {
-    return_value = setNumSamples1(value);
-  }
-  else if (attributeName == "numSamples2")
-  {
-    return_value = setNumSamples2(value);
-  }
-  else if (attributeName == "numSamples3")
-  {
-    return_value = setNumSamples3(value);
-  }
-  else if (attributeName == "samplesLength")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setSamplesLength(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1194,21 +1252,11 @@ SampledField::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "dataType")
-  {
-    return_value = setDataType(value);
-  }
-  else if (attributeName == "interpolationType")
-  {
-    return_value = setInterpolationType(value);
-  }
-  else if (attributeName == "compression")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setCompression(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1228,49 +1276,382 @@ SampledField::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = unsetId();
-  }
-  else if (attributeName == "dataType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetDataType();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "numSamples1")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * SampledField.
+ */
+int
+SampledField::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "dataType", "numSamples1",
+    "numSamples2", "numSamples3", "interpolationType", "compression", "samples",
+      "samplesLength" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetNumSamples1();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "numSamples2")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetNumSamples2();
+  case ATTR_NUM_SAMPLES1:
+    value = getNumSamples1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NUM_SAMPLES2:
+    value = getNumSamples2();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NUM_SAMPLES3:
+    value = getNumSamples3();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_SAMPLES_LENGTH:
+    value = getSamplesLength();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "numSamples3")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetNumSamples3();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_DATA_TYPE:
+    value = getDataTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_INTERPOLATION_TYPE:
+    value = getInterpolationTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COMPRESSION:
+    value = getCompressionAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "interpolationType")
-  {
-    value = unsetInterpolationType();
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this SampledField is set.
+ */
+bool
+SampledField::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_DATA_TYPE:
+    return isSetDataType();
+  case ATTR_NUM_SAMPLES1:
+    return isSetNumSamples1();
+  case ATTR_NUM_SAMPLES2:
+    return isSetNumSamples2();
+  case ATTR_NUM_SAMPLES3:
+    return isSetNumSamples3();
+  case ATTR_INTERPOLATION_TYPE:
+    return isSetInterpolationType();
+  case ATTR_COMPRESSION:
+    return isSetCompression();
+  case ATTR_SAMPLES:
+    return isSetSamples();
+  case ATTR_SAMPLES_LENGTH:
+    return isSetSamplesLength();
+  default:
+    break;
   }
-  else if (attributeName == "compression")
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
   {
-    value = unsetCompression();
+  case ATTR_NUM_SAMPLES1:
+    return setNumSamples1(value);
+  case ATTR_NUM_SAMPLES2:
+    return setNumSamples2(value);
+  case ATTR_NUM_SAMPLES3:
+    return setNumSamples3(value);
+  case ATTR_SAMPLES_LENGTH:
+    return setSamplesLength(value);
+  default:
+    break;
   }
-  else if (attributeName == "samples")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
   {
-    value = unsetSamples();
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_DATA_TYPE:
+    return setDataType(value);
+  case ATTR_INTERPOLATION_TYPE:
+    return setInterpolationType(value);
+  case ATTR_COMPRESSION:
+    return setCompression(value);
+  default:
+    break;
   }
-  else if (attributeName == "samplesLength")
-  {
-    value = unsetSamplesLength();
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * SampledField.
+ */
+int
+SampledField::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_DATA_TYPE:
+    return unsetDataType();
+  case ATTR_NUM_SAMPLES1:
+    return unsetNumSamples1();
+  case ATTR_NUM_SAMPLES2:
+    return unsetNumSamples2();
+  case ATTR_NUM_SAMPLES3:
+    return unsetNumSamples3();
+  case ATTR_INTERPOLATION_TYPE:
+    return unsetInterpolationType();
+  case ATTR_COMPRESSION:
+    return unsetCompression();
+  case ATTR_SAMPLES:
+    return unsetSamples();
+  case ATTR_SAMPLES_LENGTH:
+    return unsetSamplesLength();
+  default:
+    break;
   }
 
-  return value;
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+SampledField::forEachElement(bool (*action)(SBase*, void*),
+                             void* userData,
+                             ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenLibsbmlInternal */
 
@@ -1328,44 +1709,47 @@ SampledField::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialGeometryLOSampledFieldsAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialGeometryLOSampledFieldsAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialGeometryLOSampledFieldsAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError
+          rewritten(SpatialGeometryLOSampledFieldsAllowedCoreAttributes, level,
+            version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+              LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialSampledFieldAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSampledFieldAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialSampledFieldAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSampledFieldAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1415,7 +1799,8 @@ SampledField::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mDataType = DataKind_fromString(dataType.c_str());
+      mDataType = DataKind_fromStringWithLength(dataType.c_str(),
+        dataType.size());
 
       if (log && DataKind_isValid(mDataType) == 0)
       {
@@ -1530,7 +1915,8 @@ SampledField::readAttributes(const XMLAttributes& attributes,
     else
     {
       mInterpolationType =
-        InterpolationKind_fromString(interpolationType.c_str());
+        InterpolationKind_fromStringWithLength(interpolationType.c_str(),
+          interpolationType.size());
 
       if (log && InterpolationKind_isValid(mInterpolationType) == 0)
       {
@@ -1575,7 +1961,8 @@ SampledField::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mCompression = CompressionKind_fromString(compression.c_str());
+      mCompression = CompressionKind_fromStringWithLength(compression.c_str(),
+        compression.size());
 
       if (log && CompressionKind_isValid(mCompression) == 0)
       {
@@ -1705,33 +2092,78 @@ SampledField::writeAttributes(XMLOutputStream& stream) const
 void
 SampledField::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  int val;
-  vector<int> valuesVector;
+  unsigned int capacity = 0;
+  unsigned int length = 0;
+  bool inValue = false;
+
+  // count the values so the array is only allocated once
 
-  while (strStream >> val)
+  for (const char* c = text.c_str(); *c != '\0'; ++c)
   {
-    valuesVector.push_back(val);
+    if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+    {
+      inValue = false;
+    }
+    else if (inValue == false)
+    {
+      inValue = true;
+      capacity++;
+    }
   }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+  if (capacity == 0)
+  {
+    return;
+  }
 
-  if (length > 0)
+  // the classic locale reads the same numbers whatever the global locale is
+
+  std::istringstream parser(text);
+  std::istringstream number;
+  parser.imbue(std::locale::classic());
+  number.imbue(std::locale::classic());
+  std::string word;
+  int* data = new int[capacity];
+
+  while (length < capacity && parser >> word)
   {
-    int* data = new int[length];
-    for (unsigned int i = 0; i < length; ++i)
+    long val = 0;
+    number.clear();
+    number.str(word);
+    number >> val;
+
+    // the value must be the whole word and fit the array type
+
+    if (number.fail() || number.peek() != EOF)
+    {
+      break;
+    }
+    else if (val < std::numeric_limits<int>::min())
     {
-      data[i] = valuesVector.at(i);
+      break;
+    }
+    else if (val > std::numeric_limits<int>::max())
+    {
+      break;
     }
 
-    setSamples(data, length);
+    data[length++] = (int)(val);
+  }
+
+  if (length == 0)
+  {
     delete[] data;
   }
+  else
+  {
+    adoptSamples(data, length);
+  }
 }
 
 /** @endcond */
 
 
+#include <climits>
 #include <sbml/compress/CompressCommon.h>
 
 #ifdef USE_ZLIB
@@ -1765,22 +2197,66 @@ SampledField::uncompress()
   freeUncompressed();
   if (mCompression == SPATIAL_COMPRESSIONKIND_DEFLATED)
   {
-    char* csamples = (char*)malloc(sizeof(char)*mSamplesLength);
-    for (int i = 0 ; i < mSamplesLength; ++i)
-      csamples[i] = mSamples[i];
-    SampledField::uncompress_data(csamples, mSamplesLength, mUncompressedSamples, mUncompressedLength);
-    free(csamples);
+    SampledField::uncompress_data(mSamples, mSamplesCount, getExpectedUncompressedLength(), 
+                                  mUncompressedSamples, mUncompressedLength);
 
     if (mUncompressedSamples == 0)
-      copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesLength);
+      copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesCount);
   }
   else
   {
-    copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesLength);
+    copySampleArrays(mUncompressedSamples, mUncompressedLength, mSamples, mSamplesCount);
   }
 
 }
 
+int 
+SampledField::compress(int level)
+{
+#ifndef USE_ZLIB
+  return LIBSBML_OPERATION_FAILED;
+#else
+  if (mCompression == SPATIAL_COMPRESSIONKIND_DEFLATED)
+    return LIBSBML_OPERATION_SUCCESS;
+  if (mSamples == NULL)
+    return LIBSBML_OPERATION_FAILED;
+
+  // zlib works on bytes so only samples that fit in one can be deflated
+  for (int i = 0; i < mSamplesCount; ++i)
+  {
+    if (mSamples[i] < 0 || mSamples[i] > 255)
+      return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int* compressed = NULL;
+  int compressedLength = 0;
+  SampledField::compress_data(mSamples, mSamplesCount, level, compressed, compressedLength);
+  if (compressed == NULL)
+    return LIBSBML_OPERATION_FAILED;
+
+  freeUncompressed();
+  adoptSamples(compressed, compressedLength);
+  return setCompression(SPATIAL_COMPRESSIONKIND_DEFLATED);
+#endif
+}
+
+int 
+SampledField::getExpectedUncompressedLength() const
+{
+  if (!isSetNumSamples1() || mNumSamples1 <= 0)
+    return 0;
+
+  double length = mNumSamples1;
+  if (isSetNumSamples2())
+    length *= mNumSamples2;
+  if (isSetNumSamples3())
+    length *= mNumSamples3;
+
+  if (length <= 0 || length > INT_MAX)
+    return 0;
+  return (int)length;
+}
+
 unsigned int 
 SampledField::getUncompressedLength()
 {
@@ -1809,70 +2285,148 @@ SampledField::freeUncompressed()
 
 
 void 
-SampledField::uncompress_data(void *data, size_t length, int*& result, int& outLength)
+SampledField::uncompress_data(const int* data, int length, int expectedLength, 
+                              int*& result, int& outLength)
 {
-#ifndef USE_ZLIB
   // throwing an exception won't help our users, better set the result array and length to NULL. 
-  // throw ZlibNotLinked();
   outLength = 0;
-  result = NULL;  
-#else
-  std::vector<char> buffer;
+  result = NULL;
+#ifdef USE_ZLIB
+  // the input is narrowed and the output widened a chunk at a time so that
+  // the only full size buffer is the result itself
+  const int BUFSIZE = 64 * 1024;
+  Bytef in_buffer[BUFSIZE];
+  Bytef out_buffer[BUFSIZE];
+
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+  if (data == NULL || inflateInit(&strm) != Z_OK)
+    return;
+
+  int capacity = (expectedLength > 0) ? expectedLength : 4 * length + BUFSIZE;
+  result = (int*) malloc(sizeof(int)*capacity);
 
- const size_t BUFSIZE = 128 * 1024;
- Bytef temp_buffer[BUFSIZE];
+  int consumed = 0;
+  int res = Z_OK;
+  while (result != NULL && res != Z_STREAM_END)
+  {
+    if (strm.avail_in == 0)
+    {
+      if (consumed == length)
+        break;
+      int chunk = (length - consumed < BUFSIZE) ? length - consumed : BUFSIZE;
+      for (int i = 0; i < chunk; ++i)
+        in_buffer[i] = (Bytef)data[consumed + i];
+      consumed += chunk;
+      strm.next_in = in_buffer;
+      strm.avail_in = chunk;
+    }
 
- z_stream strm;
- strm.zalloc = 0;
- strm.zfree = 0;
- strm.next_in = reinterpret_cast<Bytef *>(data);
- strm.avail_in = length;
- strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
- strm.avail_out = BUFSIZE;
+    strm.next_out = out_buffer;
+    strm.avail_out = BUFSIZE;
+    res = inflate(&strm, Z_NO_FLUSH);
+    if (res != Z_OK && res != Z_STREAM_END)
+      break;
+
+    int produced = BUFSIZE - (int)strm.avail_out;
+    if (outLength + produced > capacity)
+    {
+      // the dimensions were not given or do not match the data
+      capacity = (2 * capacity > outLength + produced) ? 2 * capacity : outLength + produced;
+      int* grown = (int*) realloc(result, sizeof(int)*capacity);
+      if (grown == NULL)
+        free(result);
+      result = grown;
+      if (result == NULL)
+        break;
+    }
+    // the bytes are widened unsigned so values above 127 read back as written
+    for (int i = 0; i < produced; ++i)
+      result[outLength++] = (int)(unsigned char)out_buffer[i];
+  }
 
- int res = inflateInit(&strm);
+  inflateEnd(&strm);
 
- while (strm.avail_in != 0)
- {
-  res = inflate(&strm, Z_NO_FLUSH);
-  if (res < 0)
+  if (res != Z_STREAM_END)
   {
+    free(result);
     outLength = 0;
     result = NULL;
-    break;
   }
-  if (strm.avail_out == 0)
+#endif
+}
+
+void 
+SampledField::compress_data(const int* data, int length, int level, 
+                            int*& result, int& outLength)
+{
+  outLength = 0;
+  result = NULL;
+#ifdef USE_ZLIB
+  const int BUFSIZE = 64 * 1024;
+  Bytef in_buffer[BUFSIZE];
+  Bytef out_buffer[BUFSIZE];
+
+  if (data == NULL)
+    return;
+
+  // the values are narrowed to bytes so any that do not fit are rejected
+  for (int i = 0; i < length; ++i)
   {
-   buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE);
-   strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
-   strm.avail_out = BUFSIZE;
+    if (data[i] < 0 || data[i] > 255)
+      return;
   }
- }
 
- res = Z_OK;
- while (res == Z_OK)
- {
-  if (strm.avail_out == 0)
+  z_stream strm;
+  memset(&strm, 0, sizeof(strm));
+  if (deflateInit(&strm, level) != Z_OK)
+    return;
+
+  // the result is handed to adoptSamples so is allocated with new[]
+  int capacity = (int)deflateBound(&strm, length);
+  result = new int[capacity];
+
+  int consumed = 0;
+  int res = Z_OK;
+  while (res != Z_STREAM_END)
   {
-   buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE);
-   strm.next_out = reinterpret_cast<Bytef *>(temp_buffer);
-   strm.avail_out = BUFSIZE;
+    if (strm.avail_in == 0 && consumed < length)
+    {
+      int chunk = (length - consumed < BUFSIZE) ? length - consumed : BUFSIZE;
+      for (int i = 0; i < chunk; ++i)
+        in_buffer[i] = (Bytef)data[consumed + i];
+      consumed += chunk;
+      strm.next_in = in_buffer;
+      strm.avail_in = chunk;
+    }
+
+    strm.next_out = out_buffer;
+    strm.avail_out = BUFSIZE;
+    res = deflate(&strm, (consumed == length) ? Z_FINISH : Z_NO_FLUSH);
+    if (res == Z_STREAM_ERROR)
+      break;
+
+    int produced = BUFSIZE - (int)strm.avail_out;
+    if (outLength + produced > capacity)
+    {
+      capacity = 2 * (outLength + produced);
+      int* grown = new int[capacity];
+      memcpy(grown, result, sizeof(int)*outLength);
+      delete[] result;
+      result = grown;
+    }
+    for (int i = 0; i < produced; ++i)
+      result[outLength++] = out_buffer[i];
   }
-  res = inflate(&strm, Z_FINISH);
-  if (res < 0)
+
+  deflateEnd(&strm);
+
+  if (res != Z_STREAM_END)
   {
+    delete[] result;
     outLength = 0;
     result = NULL;
   }
- }
-
- buffer.insert(buffer.end(), temp_buffer, temp_buffer + BUFSIZE - strm.avail_out);
- deflateEnd(&strm);
-
- outLength = buffer.size();
- result = (int*) malloc(sizeof(int)*outLength);
- for (int i = 0; i < outLength; i++)
-   result[i] = buffer[i];
 #endif
 }
 
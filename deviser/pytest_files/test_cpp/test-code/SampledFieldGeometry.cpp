@@ -639,20 +639,14 @@ int
 SampledFieldGeometry::getAttribute(const std::string& attributeName,
                                    std::string& value) const
 {
-  int return_value = GeometryDefinition::getAttribute(attributeName, value);
-
-  if (return_value == LIBSBML_OPERATION_SUCCESS)
-  {
-    return return_value;
-  }
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "sampledField")
+  if (attributeId != -1)
   {
-    value = getSampledField();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return getAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GeometryDefinition::getAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -668,14 +662,14 @@ SampledFieldGeometry::getAttribute(const std::string& attributeName,
 bool
 SampledFieldGeometry::isSetAttribute(const std::string& attributeName) const
 {
-  bool value = GeometryDefinition::isSetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "sampledField")
+  if (attributeId != -1)
   {
-    value = isSetSampledField();
+    return isSetAttribute(attributeId);
   }
 
-  return value;
+  return GeometryDefinition::isSetAttribute(attributeName);
 }
 
 /** @endcond */
@@ -768,14 +762,14 @@ int
 SampledFieldGeometry::setAttribute(const std::string& attributeName,
                                    const std::string& value)
 {
-  int return_value = GeometryDefinition::setAttribute(attributeName, value);
+  int attributeId = lookupAttribute(attributeName);
 
-  if (attributeName == "sampledField")
+  if (attributeId != -1)
   {
-    return_value = setSampledField(value);
+    return setAttribute(attributeId, value);
   }
 
-  return return_value;
+  return GeometryDefinition::setAttribute(attributeName, value);
 }
 
 /** @endcond */
@@ -791,14 +785,265 @@ SampledFieldGeometry::setAttribute(const std::string& attributeName,
 int
 SampledFieldGeometry::unsetAttribute(const std::string& attributeName)
 {
-  int value = GeometryDefinition::unsetAttribute(attributeName);
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return unsetAttribute(attributeId);
+  }
+
+  return GeometryDefinition::unsetAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "sampledField" };
+
+  for (int i = ATTR_SAMPLED_FIELD; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_SAMPLED_FIELD])
+    {
+      return i;
+    }
+  }
+
+  return GeometryDefinition::lookupAttribute(attributeName);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::getAttribute(int attributeId, bool& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::getAttribute(int attributeId, int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::getAttribute(int attributeId, double& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::getAttribute(int attributeId, unsigned int& value) const
+{
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
 
-  if (attributeName == "sampledField")
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_SAMPLED_FIELD:
+    value = getSampledField();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return GeometryDefinition::getAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this SampledFieldGeometry is set.
+ */
+bool
+SampledFieldGeometry::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetSampledField();
+  case ATTR_SAMPLED_FIELD:
+    return isSetSampledField();
+  default:
+    break;
   }
 
-  return value;
+  return GeometryDefinition::isSetAttribute(attributeId);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::setAttribute(int attributeId, bool value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::setAttribute(int attributeId, int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::setAttribute(int attributeId, double value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::setAttribute(int attributeId, unsigned int value)
+{
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_SAMPLED_FIELD:
+    return setSampledField(value);
+  default:
+    break;
+  }
+
+  return GeometryDefinition::setAttribute(attributeId, value);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * SampledFieldGeometry.
+ */
+int
+SampledFieldGeometry::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_SAMPLED_FIELD:
+    return unsetSampledField();
+  default:
+    break;
+  }
+
+  return GeometryDefinition::unsetAttribute(attributeId);
 }
 
 /** @endcond */
@@ -971,6 +1216,17 @@ SampledFieldGeometry::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -979,14 +1235,53 @@ List*
 SampledFieldGeometry::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+SampledFieldGeometry::forEachElement(bool (*action)(SBase*, void*),
+                                     void* userData,
+                                     ElementFilter* filter)
+{
+  if (mSampledVolumes.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mSampledVolumes)) &&
+      !action(&mSampledVolumes, userData))
+    {
+      return false;
+    }
+
+    if (!mSampledVolumes.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
 
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
 
-  ADD_FILTERED_LIST(ret, sublist, mSampledVolumes, filter);
+    delete sublist;
 
-  ADD_FILTERED_FROM_PLUGIN(ret, sublist, filter);
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  return true;
 }
 
 
@@ -1058,29 +1353,30 @@ SampledFieldGeometry::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   GeometryDefinition::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial",
-          SpatialSampledFieldGeometryAllowedAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSampledFieldGeometryAllowedAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialSampledFieldGeometryAllowedCoreAttributes, pkgVersion, level,
-            version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSampledFieldGeometryAllowedCoreAttributes,
+          level, version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
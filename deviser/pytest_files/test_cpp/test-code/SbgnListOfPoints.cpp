@@ -58,7 +58,6 @@ SbgnListOfPoints::SbgnListOfPoints(unsigned int level, unsigned int version)
   : SbgnListOf(level, version)
   , mElementName("point")
 {
-  setSbgnNamespacesAndOwn(new SbgnNamespaces(level, version));
 }
 
 
@@ -188,6 +187,8 @@ SbgnListOfPoints::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateDocumentIdIndex();
+    item->setSbgnDocument(NULL);
   }
 
   return static_cast <Point*> (item);
@@ -264,6 +265,74 @@ SbgnListOfPoints::createPoint()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every Point in this
+ * SbgnListOfPoints.
+ */
+void
+SbgnListOfPoints::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.x.resize(n);
+  columns.isSetX.resize(n);
+  columns.y.resize(n);
+  columns.isSetY.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const Point* item = get(i);
+    columns.x[i] = item->getX();
+    columns.isSetX[i] = item->isSetX();
+    columns.y[i] = item->getY();
+    columns.isSetY[i] = item->isSetY();
+  }
+}
+
+
+/*
+ * Creates a Point in this SbgnListOfPoints for each row of the given columns.
+ */
+int
+SbgnListOfPoints::importColumns(const Columns& columns)
+{
+  size_t n = columns.x.size();
+  bool sameSize = (columns.isSetX.size() == n);
+  sameSize = sameSize && (columns.y.size() == n);
+  sameSize = sameSize && (columns.isSetY.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBSBGN_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBSBGN_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    Point* item = createPoint();
+
+    if (item == NULL)
+    {
+      return LIBSBGN_OPERATION_FAILED;
+    }
+
+    if (columns.isSetX[i] && item->setX(columns.x[i]) !=
+      LIBSBGN_OPERATION_SUCCESS)
+    {
+      result = LIBSBGN_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetY[i] && item->setY(columns.y[i]) !=
+      LIBSBGN_OPERATION_SUCCESS)
+    {
+      result = LIBSBGN_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this SbgnListOfPoints object.
  */
@@ -310,6 +379,34 @@ SbgnListOfPoints::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child SbgnBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+SbgnListOfPoints::forEachElement(bool (*action)(SbgnBase*, void*),
+                                 void* userData,
+                                 SbgnElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    Point* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenlibSBGNInternal */
 
@@ -51,6 +51,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <sbgn/SbgnListOf.h>
@@ -310,6 +311,52 @@ public:
   Point* createPoint();
 
 
+  /**
+   * The attributes of the Point objects in a SbgnListOfPoints, with one column
+   * for each attribute and one saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<double> x;
+    std::vector<bool> isSetX;
+    std::vector<double> y;
+    std::vector<bool> isSetY;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every Point in this
+   * SbgnListOfPoints.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of Point objects and row i describes the Point at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
+  /**
+   * Creates a Point in this SbgnListOfPoints for each row of the given
+   * columns.
+   *
+   * @param columns the Columns to read; every column must have the same number
+   * of rows.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @sbgnconstant{LIBSBGN_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_INVALID_ATTRIBUTE_VALUE,
+   * OperationReturnValues_t}
+   * @li @sbgnconstant{LIBSBGN_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @note attributes that are not set in a row are left unset on the Point
+   * created for it; a value that cannot be set does not stop the remaining
+   * rows being created.
+   */
+  int importColumns(const Columns& columns);
+
+
   /**
    * Returns the XML element name of this SbgnListOfPoints object.
    *
@@ -371,6 +418,27 @@ public:
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child SbgnBase object, including those nested to
+   * an arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory.
+   */
+  virtual bool forEachElement(bool (*action)(SbgnBase*, void*),
+                              void* userData,
+                              SbgnElementFilter * filter = NULL);
+
+
 protected:
 
 
@@ -36,6 +36,13 @@
  */
 #include <sbml/packages/spatial/sbml/SpatialPoints.h>
 #include <sbml/packages/spatial/validator/SpatialSBMLError.h>
+#include <clocale>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <locale>
+#include <sstream>
 
 
 using namespace std;
@@ -60,6 +67,7 @@ SpatialPoints::SpatialPoints(unsigned int level,
   : SBase(level, version)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mArrayData (NULL)
+  , mArrayDataCount (0)
   , mArrayDataLength (SBML_INT_MAX)
   , mIsSetArrayDataLength (false)
   , mDataType (SPATIAL_DATAKIND_INVALID)
@@ -76,6 +84,7 @@ SpatialPoints::SpatialPoints(SpatialPkgNamespaces *spatialns)
   : SBase(spatialns)
   , mCompression (SPATIAL_COMPRESSIONKIND_INVALID)
   , mArrayData (NULL)
+  , mArrayDataCount (0)
   , mArrayDataLength (SBML_INT_MAX)
   , mIsSetArrayDataLength (false)
   , mDataType (SPATIAL_DATAKIND_INVALID)
@@ -92,11 +101,14 @@ SpatialPoints::SpatialPoints(const SpatialPoints& orig)
   : SBase( orig )
   , mCompression ( orig.mCompression )
   , mArrayData ( NULL )
+  , mArrayDataCount ( 0 )
   , mArrayDataLength ( orig.mArrayDataLength )
   , mIsSetArrayDataLength ( orig.mIsSetArrayDataLength )
   , mDataType ( orig.mDataType )
 {
-  setArrayData(orig.mArrayData, orig.mArrayDataLength);
+  setArrayData(orig.mArrayData, orig.mArrayDataCount);
+  mArrayDataLength = orig.mArrayDataLength;
+  mIsSetArrayDataLength = orig.mIsSetArrayDataLength;
 
 }
 
@@ -111,8 +123,8 @@ SpatialPoints::operator=(const SpatialPoints& rhs)
   {
     SBase::operator=(rhs);
     mCompression = rhs.mCompression;
-    mArrayData = NULL;
-    setArrayData(rhs.mArrayData, rhs.mArrayDataLength);
+    unsetArrayData();
+    setArrayData(rhs.mArrayData, rhs.mArrayDataCount);
     mArrayDataLength = rhs.mArrayDataLength;
     mIsSetArrayDataLength = rhs.mIsSetArrayDataLength;
     mDataType = rhs.mDataType;
@@ -188,7 +200,39 @@ SpatialPoints::getArrayData(double* outArray) const
     return;
   }
 
-  memcpy(outArray, mArrayData, sizeof(double)*mArrayDataLength);
+  int count = mArrayDataCount;
+
+  if (mArrayDataLength < count)
+  {
+    count = mArrayDataLength;
+  }
+
+  if (count > 0)
+  {
+    memcpy(outArray, mArrayData, sizeof(double)*count);
+  }
+}
+
+
+/*
+ * Returns a pointer to the value of the "arrayData" attribute of this
+ * SpatialPoints.
+ */
+const double*
+SpatialPoints::getArrayDataPointer() const
+{
+  return mArrayData;
+}
+
+
+/*
+ * Returns the number of values held by the "arrayData" attribute of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getArrayDataCount() const
+{
+  return mArrayDataCount;
 }
 
 
@@ -312,7 +356,8 @@ SpatialPoints::setCompression(const CompressionKind_t compression)
 int
 SpatialPoints::setCompression(const std::string& compression)
 {
-  mCompression = CompressionKind_fromString(compression.c_str());
+  mCompression = CompressionKind_fromStringWithLength(compression.c_str(),
+    compression.size());
 
   if (mCompression == SPATIAL_COMPRESSIONKIND_INVALID)
   {
@@ -341,6 +386,7 @@ SpatialPoints::setArrayData(double* inArray, int arrayLength)
 
   mArrayData = new double[arrayLength];
   memcpy(mArrayData, inArray, sizeof(double)*arrayLength);
+  mArrayDataCount = arrayLength;
   mIsSetArrayDataLength = true;
   mArrayDataLength = arrayLength;
 
@@ -348,6 +394,47 @@ SpatialPoints::setArrayData(double* inArray, int arrayLength)
 }
 
 
+/*
+ * Sets the value of the "arrayData" attribute of this SpatialPoints by taking
+ * ownership of the given array.
+ */
+int
+SpatialPoints::adoptArrayData(double* inArray, int arrayLength)
+{
+  if (inArray == NULL)
+  {
+    return LIBSBML_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  if (mArrayData != NULL && mArrayData != inArray)
+  {
+    delete[] mArrayData;
+  }
+
+  mArrayData = inArray;
+  mArrayDataCount = arrayLength;
+  mIsSetArrayDataLength = true;
+  mArrayDataLength = arrayLength;
+
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Releases the value of the "arrayData" attribute of this SpatialPoints to the
+ * caller.
+ */
+double*
+SpatialPoints::releaseArrayData()
+{
+  double* array = mArrayData;
+  mArrayData = NULL;
+  mArrayDataCount = 0;
+  unsetArrayDataLength();
+  return array;
+}
+
+
 /*
  * Sets the value of the "arrayDataLength" attribute of this SpatialPoints.
  */
@@ -385,7 +472,7 @@ SpatialPoints::setDataType(const DataKind_t dataType)
 int
 SpatialPoints::setDataType(const std::string& dataType)
 {
-  mDataType = DataKind_fromString(dataType.c_str());
+  mDataType = DataKind_fromStringWithLength(dataType.c_str(), dataType.size());
 
   if (mDataType == SPATIAL_DATAKIND_INVALID)
   {
@@ -438,6 +525,7 @@ SpatialPoints::unsetArrayData()
   }
 
   mArrayData = NULL;
+  mArrayDataCount = 0;
 
   return unsetArrayDataLength();
 }
@@ -589,10 +677,64 @@ SpatialPoints::write(XMLOutputStream& stream) const
 
   if (isSetArrayData())
   {
-    for (int i = 0; i < mArrayDataLength; ++i)
+    // values are formatted straight into a chunk that is written
+    // when full, without a stream for each value
+
+    char chunk[65536 + 32];
+    size_t used = 0;
+    char point = *localeconv()->decimal_point;
+
+    for (int i = 0; i < mArrayDataCount; ++i)
     {
-      stream << (double)mArrayData[i] << " ";
+      double val = (double)mArrayData[i];
+
+      if (val != val)
+      {
+        memcpy(chunk + used, "NaN ", 4);
+        used += 4;
+      }
+      else if (val - val != 0 && val > 0)
+      {
+        memcpy(chunk + used, "INF ", 4);
+        used += 4;
+      }
+      else if (val - val != 0)
+      {
+        memcpy(chunk + used, "-INF ", 5);
+        used += 5;
+      }
+      else
+      {
+        int n = sprintf(chunk + used, "%.15g", val);
+
+        if (strtod(chunk + used, NULL) != val)
+        {
+          n = sprintf(chunk + used, "%.17g", val);
+        }
+
+        if (point != '.')
+        {
+          for (int j = 0; j < n; ++j)
+          {
+            if (chunk[used + j] == point)
+            {
+              chunk[used + j] = '.';
+            }
+          }
+        }
+
+        used += n;
+        chunk[used++] = ' ';
+      }
+
+      if (used >= 65536)
+      {
+        stream << std::string(chunk, used);
+        used = 0;
+      }
     }
+
+    stream << std::string(chunk, used);
   }
 
   stream.endElement(getElementName(), getPrefix());
@@ -653,10 +795,11 @@ SpatialPoints::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "arrayDataLength")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getArrayDataLength();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -718,20 +861,11 @@ SpatialPoints::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "id")
-  {
-    value = getId();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "compression")
-  {
-    value = getCompressionAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "dataType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getDataTypeAsString();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -752,25 +886,11 @@ SpatialPoints::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBase::isSetAttribute(attributeName);
 
-  if (attributeName == "id")
-  {
-    value = isSetId();
-  }
-  else if (attributeName == "compression")
-  {
-    value = isSetCompression();
-  }
-  else if (attributeName == "arrayData")
-  {
-    value = isSetArrayData();
-  }
-  else if (attributeName == "arrayDataLength")
-  {
-    value = isSetArrayDataLength();
-  }
-  else if (attributeName == "dataType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetDataType();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -807,9 +927,11 @@ SpatialPoints::setAttribute(const std::string& attributeName, int value)
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "arrayDataLength")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setArrayDataLength(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -865,17 +987,11 @@ SpatialPoints::setAttribute(const std::string& attributeName,
 {
   int return_value = SBase::setAttribute(attributeName, value);
 
-  if (attributeName == "id")
-  {
-    return_value = setId(value);
-  }
-  else if (attributeName == "compression")
-  {
-    return_value = setCompression(value);
-  }
-  else if (attributeName == "dataType")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setDataType(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -895,34 +1011,346 @@ SpatialPoints::unsetAttribute(const std::string& attributeName)
 {
   int value = SBase::unsetAttribute(attributeName);
 
-  if (attributeName == "id")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetId();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "compression")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "compression", "arrayData",
+    "arrayDataLength", "dataType" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
   {
-    value = unsetCompression();
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "arrayData")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getAttribute(int attributeId, int& value) const
+{
+  switch (attributeId)
   {
-    value = unsetArrayData();
+  case ATTR_ARRAY_DATA_LENGTH:
+    value = getArrayDataLength();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "arrayDataLength")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetArrayDataLength();
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_COMPRESSION:
+    value = getCompressionAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_DATA_TYPE:
+    value = getDataTypeAsString();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "dataType")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this SpatialPoints is set.
+ */
+bool
+SpatialPoints::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetDataType();
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_COMPRESSION:
+    return isSetCompression();
+  case ATTR_ARRAY_DATA:
+    return isSetArrayData();
+  case ATTR_ARRAY_DATA_LENGTH:
+    return isSetArrayDataLength();
+  case ATTR_DATA_TYPE:
+    return isSetDataType();
+  default:
+    break;
   }
 
-  return value;
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::setAttribute(int attributeId, int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ARRAY_DATA_LENGTH:
+    return setArrayDataLength(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_COMPRESSION:
+    return setCompression(value);
+  case ATTR_DATA_TYPE:
+    return setDataType(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * SpatialPoints.
+ */
+int
+SpatialPoints::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_COMPRESSION:
+    return unsetCompression();
+  case ATTR_ARRAY_DATA:
+    return unsetArrayData();
+  case ATTR_ARRAY_DATA_LENGTH:
+    return unsetArrayDataLength();
+  case ATTR_DATA_TYPE:
+    return unsetDataType();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+SpatialPoints::forEachElement(bool (*action)(SBase*, void*),
+                              void* userData,
+                              ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -962,28 +1390,30 @@ SpatialPoints::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("spatial", SpatialSpatialPointsAllowedAttributes,
-          pkgVersion, level, version, details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSpatialPointsAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("spatial",
-          SpatialSpatialPointsAllowedCoreAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(SpatialSpatialPointsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "spatial", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1033,7 +1463,8 @@ SpatialPoints::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mCompression = CompressionKind_fromString(compression.c_str());
+      mCompression = CompressionKind_fromStringWithLength(compression.c_str(),
+        compression.size());
 
       if (log && CompressionKind_isValid(mCompression) == 0)
       {
@@ -1106,7 +1537,8 @@ SpatialPoints::readAttributes(const XMLAttributes& attributes,
     }
     else
     {
-      mDataType = DataKind_fromString(dataType.c_str());
+      mDataType = DataKind_fromStringWithLength(dataType.c_str(),
+        dataType.size());
 
       if (log && DataKind_isValid(mDataType) == 0)
       {
@@ -1178,28 +1610,78 @@ SpatialPoints::writeAttributes(XMLOutputStream& stream) const
 void
 SpatialPoints::setElementText(const std::string& text)
 {
-  stringstream strStream(text);
-  double val;
-  vector<double> valuesVector;
+  unsigned int capacity = 0;
+  unsigned int length = 0;
+  bool inValue = false;
+
+  // count the values so the array is only allocated once
+
+  for (const char* c = text.c_str(); *c != '\0'; ++c)
+  {
+    if (*c == ' ' || *c == '\t' || *c == '\n' || *c == '\r')
+    {
+      inValue = false;
+    }
+    else if (inValue == false)
+    {
+      inValue = true;
+      capacity++;
+    }
+  }
 
-  while (strStream >> val)
+  if (capacity == 0)
   {
-    valuesVector.push_back(val);
+    return;
   }
 
-  unsigned int length = (unsigned int)valuesVector.size();
+  // the classic locale reads the same numbers whatever the global locale is
+
+  std::istringstream parser(text);
+  std::istringstream number;
+  parser.imbue(std::locale::classic());
+  number.imbue(std::locale::classic());
+  std::string word;
+  double* data = new double[capacity];
 
-  if (length > 0)
+  while (length < capacity && parser >> word)
   {
-    double* data = new double[length];
-    for (unsigned int i = 0; i < length; ++i)
+    double val = 0;
+
+    if (word == "NaN")
+    {
+      val = std::numeric_limits<double>::quiet_NaN();
+    }
+    else if (word == "INF")
+    {
+      val = std::numeric_limits<double>::infinity();
+    }
+    else if (word == "-INF")
+    {
+      val = -std::numeric_limits<double>::infinity();
+    }
+    else
     {
-      data[i] = valuesVector.at(i);
+      number.clear();
+      number.str(word);
+      number >> val;
+
+      if (number.fail() || number.peek() != EOF)
+      {
+        break;
+      }
     }
 
-    setArrayData(data, length);
+    data[length++] = (double)(val);
+  }
+
+  if (length == 0)
+  {
     delete[] data;
   }
+  else
+  {
+    adoptArrayData(data, length);
+  }
 }
 
 /** @endcond */
@@ -0,0 +1,1358 @@
+/**
+ * @file Thing.cpp
+ * @brief Implementation of the Thing class.
+ * @author SBMLTeam
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+#include <sbml/packages/index/sbml/Thing.h>
+#include <sbml/packages/index/sbml/ListOfThings.h>
+#include <sbml/packages/index/validator/IndexSBMLError.h>
+
+
+using namespace std;
+
+
+
+LIBSBML_CPP_NAMESPACE_BEGIN
+
+
+
+
+#ifdef __cplusplus
+
+
+/*
+ * Creates a new Thing using the given SBML Level, Version and
+ * &ldquo;index&rdquo; package version.
+ */
+Thing::Thing(unsigned int level,
+             unsigned int version,
+             unsigned int pkgVersion)
+  : SBase(level, version)
+  , mValue (util_NaN())
+  , mIsSetValue (false)
+{
+  setSBMLNamespacesAndOwn(new IndexPkgNamespaces(level, version, pkgVersion));
+}
+
+
+/*
+ * Creates a new Thing using the given IndexPkgNamespaces object.
+ */
+Thing::Thing(IndexPkgNamespaces *indexns)
+  : SBase(indexns)
+  , mValue (util_NaN())
+  , mIsSetValue (false)
+{
+  setElementNamespace(indexns->getURI());
+  loadPlugins(indexns);
+}
+
+
+/*
+ * Copy constructor for Thing.
+ */
+Thing::Thing(const Thing& orig)
+  : SBase( orig )
+  , mValue ( orig.mValue )
+  , mIsSetValue ( orig.mIsSetValue )
+{
+}
+
+
+/*
+ * Assignment operator for Thing.
+ */
+Thing&
+Thing::operator=(const Thing& rhs)
+{
+  if (&rhs != this)
+  {
+    SBase::operator=(rhs);
+    mValue = rhs.mValue;
+    mIsSetValue = rhs.mIsSetValue;
+  }
+
+  return *this;
+}
+
+
+/*
+ * Creates and returns a deep copy of this Thing object.
+ */
+Thing*
+Thing::clone() const
+{
+  return new Thing(*this);
+}
+
+
+/*
+ * Destructor for Thing.
+ */
+Thing::~Thing()
+{
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Thing.
+ */
+const std::string&
+Thing::getId() const
+{
+  return mId;
+}
+
+
+/*
+ * Returns the value of the "name" attribute of this Thing.
+ */
+const std::string&
+Thing::getName() const
+{
+  return mName;
+}
+
+
+/*
+ * Returns the value of the "value" attribute of this Thing.
+ */
+double
+Thing::getValue() const
+{
+  return mValue;
+}
+
+
+/*
+ * Predicate returning @c true if this Thing's "id" attribute is set.
+ */
+bool
+Thing::isSetId() const
+{
+  return (mId.empty() == false);
+}
+
+
+/*
+ * Predicate returning @c true if this Thing's "name" attribute is set.
+ */
+bool
+Thing::isSetName() const
+{
+  return (mName.empty() == false);
+}
+
+
+/*
+ * Predicate returning @c true if this Thing's "value" attribute is set.
+ */
+bool
+Thing::isSetValue() const
+{
+  return mIsSetValue;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Thing.
+ */
+int
+Thing::setId(const std::string& id)
+{
+  int success = SyntaxChecker::checkAndSetSId(id, mId);
+
+  ListOfThings* parent = dynamic_cast<ListOfThings*>(getParentSBMLObject());
+
+  if (parent != NULL)
+  {
+    parent->invalidateIdIndex();
+  }
+
+  return success;
+}
+
+
+/*
+ * Sets the value of the "name" attribute of this Thing.
+ */
+int
+Thing::setName(const std::string& name)
+{
+  mName = name;
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Sets the value of the "value" attribute of this Thing.
+ */
+int
+Thing::setValue(double value)
+{
+  mValue = value;
+  mIsSetValue = true;
+  return LIBSBML_OPERATION_SUCCESS;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Thing.
+ */
+int
+Thing::unsetId()
+{
+  mId.erase();
+
+  ListOfThings* parent = dynamic_cast<ListOfThings*>(getParentSBMLObject());
+
+  if (parent != NULL)
+  {
+    parent->invalidateIdIndex();
+  }
+
+  if (mId.empty() == true)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Unsets the value of the "name" attribute of this Thing.
+ */
+int
+Thing::unsetName()
+{
+  mName.erase();
+
+  if (mName.empty() == true)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Unsets the value of the "value" attribute of this Thing.
+ */
+int
+Thing::unsetValue()
+{
+  mValue = util_NaN();
+  mIsSetValue = false;
+
+  if (isSetValue() == false)
+  {
+    return LIBSBML_OPERATION_SUCCESS;
+  }
+  else
+  {
+    return LIBSBML_OPERATION_FAILED;
+  }
+}
+
+
+/*
+ * Returns the XML element name of this Thing object.
+ */
+const std::string&
+Thing::getElementName() const
+{
+  static const string name = "thing";
+  return name;
+}
+
+
+/*
+ * Returns the libSBML type code for this Thing object.
+ */
+int
+Thing::getTypeCode() const
+{
+  return SBML_INDEX_THING;
+}
+
+
+/*
+ * Predicate returning @c true if all the required attributes for this Thing
+ * object have been set.
+ */
+bool
+Thing::hasRequiredAttributes() const
+{
+  bool allPresent = true;
+
+  if (isSetId() == false)
+  {
+    allPresent = false;
+  }
+
+  return allPresent;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Write any contained elements
+ */
+void
+Thing::writeElements(XMLOutputStream& stream) const
+{
+  SBase::writeElements(stream);
+
+  SBase::writeExtensionElements(stream);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Accepts the given SBMLVisitor
+ */
+bool
+Thing::accept(SBMLVisitor& v) const
+{
+  return v.visit(*this);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the parent SBMLDocument
+ */
+void
+Thing::setSBMLDocument(SBMLDocument* d)
+{
+  SBase::setSBMLDocument(d);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Enables/disables the given package with this element
+ */
+void
+Thing::enablePackageInternal(const std::string& pkgURI,
+                             const std::string& pkgPrefix,
+                             bool flag)
+{
+  SBase::enablePackageInternal(pkgURI, pkgPrefix, flag);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::getAttribute(const std::string& attributeName, bool& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::getAttribute(const std::string& attributeName, int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::getAttribute(const std::string& attributeName, double& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::getAttribute(const std::string& attributeName,
+                    unsigned int& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::getAttribute(const std::string& attributeName,
+                    std::string& value) const
+{
+  int return_value = SBase::getAttribute(attributeName, value);
+
+  if (return_value == LIBSBML_OPERATION_SUCCESS)
+  {
+    return return_value;
+  }
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = getAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if this Thing's attribute "attributeName" is
+ * set.
+ */
+bool
+Thing::isSetAttribute(const std::string& attributeName) const
+{
+  bool value = SBase::isSetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = isSetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::setAttribute(const std::string& attributeName, bool value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::setAttribute(const std::string& attributeName, int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::setAttribute(const std::string& attributeName, double value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::setAttribute(const std::string& attributeName, unsigned int value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::setAttribute(const std::string& attributeName,
+                    const std::string& value)
+{
+  int return_value = SBase::setAttribute(attributeName, value);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    return_value = setAttribute(attributeId, value);
+  }
+
+  return return_value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::unsetAttribute(const std::string& attributeName)
+{
+  int value = SBase::unsetAttribute(attributeName);
+
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
+  {
+    value = unsetAttribute(attributeId);
+  }
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this Thing.
+ */
+int
+Thing::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "id", "name", "value" };
+
+  for (int i = ATTR_ID; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_ID])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    value = getValue();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    value = getId();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_NAME:
+    value = getName();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this Thing is set.
+ */
+bool
+Thing::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return isSetId();
+  case ATTR_NAME:
+    return isSetName();
+  case ATTR_VALUE:
+    return isSetValue();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_VALUE:
+    return setValue(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return setId(value);
+  case ATTR_NAME:
+    return setName(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this Thing.
+ */
+int
+Thing::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ID:
+    return unsetId();
+  case ATTR_NAME:
+    return unsetName();
+  case ATTR_VALUE:
+    return unsetValue();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+Thing::forEachElement(bool (*action)(SBase*, void*),
+                      void* userData,
+                      ElementFilter* filter)
+{
+  if (getNumPlugins() > 0)
+  {
+    List* sublist = getAllElementsFromPlugins(filter);
+    bool visiting = true;
+
+    while (visiting == true && sublist->getSize() > 0)
+    {
+      visiting = action(static_cast<SBase*>(sublist->remove(0)), userData);
+    }
+
+    delete sublist;
+
+    if (visiting == false)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the expected attributes for this element
+ */
+void
+Thing::addExpectedAttributes(ExpectedAttributes& attributes)
+{
+  SBase::addExpectedAttributes(attributes);
+
+  attributes.add("id");
+
+  attributes.add("name");
+
+  attributes.add("value");
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Reads the expected attributes into the member data variables
+ */
+void
+Thing::readAttributes(const XMLAttributes& attributes,
+                      const ExpectedAttributes& expectedAttributes)
+{
+  unsigned int level = getLevel();
+  unsigned int version = getVersion();
+  unsigned int pkgVersion = getPackageVersion();
+  unsigned int numErrs;
+  bool assigned = false;
+  SBMLErrorLog* log = getErrorLog();
+
+  if (log && getParentSBMLObject() &&
+    static_cast<ListOfThings*>(getParentSBMLObject())->size() < 2)
+  {
+    numErrs = log->getNumErrors();
+    for (int n = numErrs-1; n >= 0; n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(IndexModelLOThingsAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "index", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(IndexModelLOThingsAllowedCoreAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "index", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  unsigned int errMark = log ? log->getNumErrors() : 0;
+  SBase::readAttributes(attributes, expectedAttributes);
+
+  if (log)
+  {
+    numErrs = log->getNumErrors();
+
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
+    {
+      if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(IndexThingAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "index", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+      else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
+      {
+        const std::string details = log->getError(n)->getMessage();
+        SBMLError rewritten(IndexThingAllowedCoreAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "index", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
+      }
+    }
+  }
+
+  // 
+  // id SId (use = "required" )
+  // 
+
+  assigned = attributes.readInto("id", mId);
+
+  if (assigned == true)
+  {
+    if (mId.empty() == true)
+    {
+      logEmptyString(mId, level, version, "<Thing>");
+    }
+    else if (SyntaxChecker::isValidSBMLSId(mId) == false)
+    {
+      log->logPackageError("index", IndexIdSyntaxRule, pkgVersion, level,
+        version, "The id on the <" + getElementName() + "> is '" + mId + "', "
+          "which does not conform to the syntax.", getLine(), getColumn());
+    }
+  }
+  else
+  {
+    if (log)
+    {
+      std::string message = "Index attribute 'id' is missing from the <Thing> "
+        "element.";
+      log->logPackageError("index", IndexThingAllowedAttributes, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+
+  // 
+  // name string (use = "optional" )
+  // 
+
+  assigned = attributes.readInto("name", mName);
+
+  if (assigned == true)
+  {
+    if (mName.empty() == true)
+    {
+      logEmptyString(mName, level, version, "<Thing>");
+    }
+  }
+
+  // 
+  // value double (use = "optional" )
+  // 
+
+  numErrs = log ? log->getNumErrors() : 0;
+  mIsSetValue = attributes.readInto("value", mValue);
+
+  if ( mIsSetValue == false && log)
+  {
+    if (log && log->getNumErrors() == numErrs + 1 &&
+      log->contains(XMLAttributeTypeMismatch))
+    {
+      log->remove(XMLAttributeTypeMismatch);
+      std::string message = "Index attribute 'value' from the <Thing> element "
+        "must be an integer.";
+      log->logPackageError("index", IndexThingValueMustBeDouble, pkgVersion,
+        level, version, message, getLine(), getColumn());
+    }
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Writes the attributes to the stream
+ */
+void
+Thing::writeAttributes(XMLOutputStream& stream) const
+{
+  SBase::writeAttributes(stream);
+
+  if (isSetId() == true)
+  {
+    stream.writeAttribute("id", getPrefix(), mId);
+  }
+
+  if (isSetName() == true)
+  {
+    stream.writeAttribute("name", getPrefix(), mName);
+  }
+
+  if (isSetValue() == true)
+  {
+    stream.writeAttribute("value", getPrefix(), mValue);
+  }
+
+  SBase::writeExtensionAttributes(stream);
+}
+
+/** @endcond */
+
+
+
+
+#endif /* __cplusplus */
+
+
+/*
+ * Creates a new Thing_t using the given SBML Level, Version and
+ * &ldquo;index&rdquo; package version.
+ */
+LIBSBML_EXTERN
+Thing_t *
+Thing_create(unsigned int level,
+             unsigned int version,
+             unsigned int pkgVersion)
+{
+  return new Thing(level, version, pkgVersion);
+}
+
+
+/*
+ * Creates and returns a deep copy of this Thing_t object.
+ */
+LIBSBML_EXTERN
+Thing_t*
+Thing_clone(const Thing_t* t)
+{
+  if (t != NULL)
+  {
+    return static_cast<Thing_t*>(t->clone());
+  }
+  else
+  {
+    return NULL;
+  }
+}
+
+
+/*
+ * Frees this Thing_t object.
+ */
+LIBSBML_EXTERN
+void
+Thing_free(Thing_t* t)
+{
+  if (t != NULL)
+  {
+    delete t;
+  }
+}
+
+
+/*
+ * Returns the value of the "id" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+char *
+Thing_getId(const Thing_t * t)
+{
+  if (t == NULL)
+  {
+    return NULL;
+  }
+
+  return t->getId().empty() ? NULL : safe_strdup(t->getId().c_str());
+}
+
+
+/*
+ * Returns the value of the "name" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+char *
+Thing_getName(const Thing_t * t)
+{
+  if (t == NULL)
+  {
+    return NULL;
+  }
+
+  return t->getName().empty() ? NULL : safe_strdup(t->getName().c_str());
+}
+
+
+/*
+ * Returns the value of the "value" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+double
+Thing_getValue(const Thing_t * t)
+{
+  return (t != NULL) ? t->getValue() : util_NaN();
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Thing_t's "id" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Thing_isSetId(const Thing_t * t)
+{
+  return (t != NULL) ? static_cast<int>(t->isSetId()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Thing_t's "name" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Thing_isSetName(const Thing_t * t)
+{
+  return (t != NULL) ? static_cast<int>(t->isSetName()) : 0;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if this Thing_t's "value" attribute is set.
+ */
+LIBSBML_EXTERN
+int
+Thing_isSetValue(const Thing_t * t)
+{
+  return (t != NULL) ? static_cast<int>(t->isSetValue()) : 0;
+}
+
+
+/*
+ * Sets the value of the "id" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_setId(Thing_t * t, const char * id)
+{
+  return (t != NULL) ? t->setId(id) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "name" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_setName(Thing_t * t, const char * name)
+{
+  return (t != NULL) ? t->setName(name) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Sets the value of the "value" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_setValue(Thing_t * t, double value)
+{
+  return (t != NULL) ? t->setValue(value) : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "id" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_unsetId(Thing_t * t)
+{
+  return (t != NULL) ? t->unsetId() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "name" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_unsetName(Thing_t * t)
+{
+  return (t != NULL) ? t->unsetName() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Unsets the value of the "value" attribute of this Thing_t.
+ */
+LIBSBML_EXTERN
+int
+Thing_unsetValue(Thing_t * t)
+{
+  return (t != NULL) ? t->unsetValue() : LIBSBML_INVALID_OBJECT;
+}
+
+
+/*
+ * Predicate returning @c 1 (true) if all the required attributes for this
+ * Thing_t object have been set.
+ */
+LIBSBML_EXTERN
+int
+Thing_hasRequiredAttributes(const Thing_t * t)
+{
+  return (t != NULL) ? static_cast<int>(t->hasRequiredAttributes()) : 0;
+}
+
+
+
+
+LIBSBML_CPP_NAMESPACE_END
+
+
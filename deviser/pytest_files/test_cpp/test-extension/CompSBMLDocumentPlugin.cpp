@@ -610,9 +610,18 @@ CompSBMLDocumentPlugin::checkConsistency()
   CompIdentifierConsistencyValidator id_validator;
   CompConsistencyValidator core_validator;
 
+  // the validators that resolve references share one index of the model
+
+  std::map<std::string, const SBase*> idIndex;
+
   if (id)
   {
     id_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      id_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = id_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -628,6 +637,11 @@ CompSBMLDocumentPlugin::checkConsistency()
   if (core)
   {
     core_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      core_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = core_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -926,6 +940,217 @@ CompSBMLDocumentPlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::getAttribute(int attributeId,
+                                     unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::getAttribute(int attributeId,
+                                     std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CompSBMLDocumentPlugin is set.
+ */
+bool
+CompSBMLDocumentPlugin::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::setAttribute(int attributeId,
+                                     const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CompSBMLDocumentPlugin.
+ */
+int
+CompSBMLDocumentPlugin::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1139,6 +1364,17 @@ CompSBMLDocumentPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBMLDocumentPlugin* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1147,13 +1383,49 @@ List*
 CompSBMLDocumentPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mExternalModelDefinitions, filter);
-  ADD_FILTERED_LIST(ret, sublist, mModelDefinitions, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CompSBMLDocumentPlugin::forEachElement(bool (*action)(SBase*, void*),
+                                       void* userData,
+                                       ElementFilter* filter)
+{
+  if (mExternalModelDefinitions.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mExternalModelDefinitions)) &&
+      !action(&mExternalModelDefinitions, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mExternalModelDefinitions.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mModelDefinitions.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mModelDefinitions)) &&
+      !action(&mModelDefinitions, userData))
+    {
+      return false;
+    }
+
+    if (!mModelDefinitions.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -214,7 +214,7 @@ CoreversExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -327,18 +327,31 @@ CoreversExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(coreversErrorTable)/sizeof(coreversErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == coreversErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (coreversErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && coreversErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -290,7 +291,7 @@ CoreversmultipkgExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -463,18 +464,31 @@ unsigned int
 CoreversmultipkgExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(coreversmultipkgErrorTable)/sizeof(coreversmultipkgErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == coreversmultipkgErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (coreversmultipkgErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && coreversmultipkgErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -598,16 +612,45 @@ LIBSBML_EXTERN
 AbcType_t
 AbcType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_ABC_TYPE_STRINGS)/sizeof(SBML_ABC_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return OBJECTIVE_TYPE_INVALID;
+  }
+
+  return AbcType_fromStringWithLength(code, strlen(code));
+}
+
 
-  for (int i = 0; i < size; i++)
+/*
+ * Returns the #AbcType_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{OBJECTIVE_TYPE_INVALID,
+ * AbcType_t} if there is no such match.
+ */
+LIBSBML_EXTERN
+AbcType_t
+AbcType_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return OBJECTIVE_TYPE_INVALID;
+  }
+
+  switch (length)
   {
-    if (type == SBML_ABC_TYPE_STRINGS[i])
+  case 8:
+    if (memcmp(code, "maximize", 8) == 0)
+    {
+      return OBJECTIVE_TYPE_MAXIMIZE;
+    }
+
+    if (memcmp(code, "minimize", 8) == 0)
     {
-      return (AbcType_t)(i);
+      return OBJECTIVE_TYPE_MINIMIZE;
     }
+
+    break;
+  default:
+    break;
   }
 
   return OBJECTIVE_TYPE_INVALID;
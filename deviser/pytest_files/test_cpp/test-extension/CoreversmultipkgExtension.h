@@ -522,6 +522,31 @@ AbcType_t
 AbcType_fromString(const char* code);
 
 
+/**
+ * Returns the #AbcType_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{OBJECTIVE_TYPE_INVALID,
+ * AbcType_t} if there is no such match.
+ *
+ * @param code the string to convert to a #AbcType_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #AbcType_t or
+ * @sbmlconstant{OBJECTIVE_TYPE_INVALID, AbcType_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Objective_t
+ * @endif
+ */
+LIBSBML_EXTERN
+AbcType_t
+AbcType_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #AbcType_t is valid.
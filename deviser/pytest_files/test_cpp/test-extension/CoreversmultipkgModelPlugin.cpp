@@ -791,15 +791,11 @@ CoreversmultipkgModelPlugin::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "attPlug")
-  {
-    value = getAttPlug();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "attPlug2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getAttPlug2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -840,13 +836,11 @@ CoreversmultipkgModelPlugin::isSetAttribute(const std::string& attributeName)
 {
   bool value = SBasePlugin::isSetAttribute(attributeName);
 
-  if (attributeName == "attPlug")
-  {
-    value = isSetAttPlug();
-  }
-  else if (attributeName == "attPlug2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetAttPlug2();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -925,13 +919,11 @@ CoreversmultipkgModelPlugin::setAttribute(const std::string& attributeName,
 {
   int return_value = SBasePlugin::setAttribute(attributeName, value);
 
-  if (attributeName == "attPlug")
-  {
-    return_value = setAttPlug(value);
-  }
-  else if (attributeName == "attPlug2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setAttPlug2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -971,16 +963,278 @@ CoreversmultipkgModelPlugin::unsetAttribute(const std::string& attributeName)
 {
   int value = SBasePlugin::unsetAttribute(attributeName);
 
-  if (attributeName == "attPlug")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetAttPlug();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "attPlug2")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "attPlug", "attPlug2" };
+
+  for (int i = ATTR_ATT_PLUG; i < ATTR_COUNT; i++)
   {
-    value = unsetAttPlug2();
+    if (attributeName == names[i - ATTR_ATT_PLUG])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::getAttribute(int attributeId,
+                                          double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::getAttribute(int attributeId,
+                                          unsigned int& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ATT_PLUG:
+    value = getAttPlug();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_ATT_PLUG2:
+    value = getAttPlug2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::getAttribute(int attributeId,
+                                          std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this CoreversmultipkgModelPlugin is set.
+ */
+bool
+CoreversmultipkgModelPlugin::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_ATT_PLUG:
+    return isSetAttPlug();
+  case ATTR_ATT_PLUG2:
+    return isSetAttPlug2();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_ATT_PLUG:
+    return setAttPlug(value);
+  case ATTR_ATT_PLUG2:
+    return setAttPlug2(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::setAttribute(int attributeId,
+                                          const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * CoreversmultipkgModelPlugin.
+ */
+int
+CoreversmultipkgModelPlugin::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_ATT_PLUG:
+    return unsetAttPlug();
+  case ATTR_ATT_PLUG2:
+    return unsetAttPlug2();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1219,6 +1473,17 @@ CoreversmultipkgModelPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1227,13 +1492,49 @@ List*
 CoreversmultipkgModelPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mClassOneTwo, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mClassMult, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+CoreversmultipkgModelPlugin::forEachElement(bool (*action)(SBase*, void*),
+                                            void* userData,
+                                            ElementFilter* filter)
+{
+  if (mClassOneTwo != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassOneTwo)) &&
+      !action(mClassOneTwo, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mClassOneTwo->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mClassMult != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassMult)) && !action(mClassMult,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mClassMult->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1392,37 +1693,38 @@ CoreversmultipkgModelPlugin::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBasePlugin::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("coreversmultipkg",
-          CoreversmultipkgModelAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(CoreversmultipkgModelAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "coreversmultipkg", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("coreversmultipkg",
-          CoreversmultipkgModelAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(CoreversmultipkgModelAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "coreversmultipkg", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == NotSchemaConformant)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(NotSchemaConformant);
-        log->logPackageError("coreversmultipkg",
-          CoreversmultipkgModelAllowedAttributes, pkgVersion, level, version,
-            details, getLine(), getColumn());
+        SBMLError rewritten(CoreversmultipkgModelAllowedAttributes, level,
+          version, details, getLine(), getColumn(), LIBSBML_SEV_ERROR,
+            LIBSBML_CAT_SBML, "coreversmultipkg", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
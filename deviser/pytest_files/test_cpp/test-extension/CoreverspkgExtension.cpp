@@ -215,7 +215,7 @@ CoreverspkgExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -328,18 +328,31 @@ CoreverspkgExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(coreverspkgErrorTable)/sizeof(coreverspkgErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == coreverspkgErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (coreverspkgErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && coreverspkgErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
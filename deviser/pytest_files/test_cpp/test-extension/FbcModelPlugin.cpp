@@ -901,10 +901,11 @@ FbcModelPlugin::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "strict")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getStrict();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -997,9 +998,11 @@ FbcModelPlugin::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBasePlugin::isSetAttribute(attributeName);
 
-  if (attributeName == "strict")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetStrict();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1019,9 +1022,11 @@ FbcModelPlugin::setAttribute(const std::string& attributeName, bool value)
 {
   int return_value = SBasePlugin::setAttribute(attributeName, value);
 
-  if (attributeName == "strict")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setStrict(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1111,9 +1116,11 @@ FbcModelPlugin::unsetAttribute(const std::string& attributeName)
 {
   int value = SBasePlugin::unsetAttribute(attributeName);
 
-  if (attributeName == "strict")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetStrict();
+    value = unsetAttribute(attributeId);
   }
 
   return value;
@@ -1123,6 +1130,257 @@ FbcModelPlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "strict" };
+
+  for (int i = ATTR_STRICT; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_STRICT])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::getAttribute(int attributeId, bool& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_STRICT:
+    value = getStrict();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this FbcModelPlugin is set.
+ */
+bool
+FbcModelPlugin::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_STRICT:
+    return isSetStrict();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::setAttribute(int attributeId, bool value)
+{
+  switch (attributeId)
+  {
+  case ATTR_STRICT:
+    return setStrict(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * FbcModelPlugin.
+ */
+int
+FbcModelPlugin::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_STRICT:
+    return unsetStrict();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1367,6 +1625,17 @@ FbcModelPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1375,14 +1644,63 @@ List*
 FbcModelPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_FILTERED_LIST(ret, sublist, mObjectives, filter);
-  ADD_FILTERED_LIST(ret, sublist, mFluxBounds, filter);
-  ADD_FILTERED_LIST(ret, sublist, mGeneProducts, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+FbcModelPlugin::forEachElement(bool (*action)(SBase*, void*),
+                               void* userData,
+                               ElementFilter* filter)
+{
+  if (mObjectives.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mObjectives)) &&
+      !action(&mObjectives, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mObjectives.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mFluxBounds.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mFluxBounds)) &&
+      !action(&mFluxBounds, userData))
+    {
+      return false;
+    }
+
+    if (!mFluxBounds.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mGeneProducts.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mGeneProducts)) &&
+      !action(&mGeneProducts, userData))
+    {
+      return false;
+    }
+
+    if (!mGeneProducts.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1560,34 +1878,38 @@ FbcModelPlugin::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBasePlugin::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("fbc", FbcModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcModelAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "fbc",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("fbc", FbcModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcModelAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "fbc",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == NotSchemaConformant)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(NotSchemaConformant);
-        log->logPackageError("fbc", FbcModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(FbcModelAllowedAttributes, level, version, details,
+          getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML, "fbc",
+            pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
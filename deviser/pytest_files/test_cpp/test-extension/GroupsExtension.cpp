@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -215,7 +216,7 @@ GroupsExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -328,18 +329,31 @@ GroupsExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(groupsErrorTable)/sizeof(groupsErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == groupsErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (groupsErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && groupsErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -442,16 +456,54 @@ LIBSBML_EXTERN
 GroupKind_t
 GroupKind_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_GROUP_KIND_STRINGS)/sizeof(SBML_GROUP_KIND_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return GROUP_KIND_INVALID;
+  }
+
+  return GroupKind_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #GroupKind_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{GROUP_KIND_INVALID,
+ * GroupKind_t} if there is no such match.
+ */
+LIBSBML_EXTERN
+GroupKind_t
+GroupKind_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return GROUP_KIND_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_GROUP_KIND_STRINGS[i])
+  case 9:
+    if (memcmp(code, "partonomy", 9) == 0)
     {
-      return (GroupKind_t)(i);
+      return GROUP_KIND_PARTONOMY;
     }
+
+    break;
+  case 10:
+    if (memcmp(code, "collection", 10) == 0)
+    {
+      return GROUP_KIND_COLLECTION;
+    }
+
+    break;
+  case 14:
+    if (memcmp(code, "classification", 14) == 0)
+    {
+      return GROUP_KIND_CLASSIFICATION;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return GROUP_KIND_INVALID;
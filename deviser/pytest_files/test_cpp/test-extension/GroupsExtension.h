@@ -450,6 +450,31 @@ GroupKind_t
 GroupKind_fromString(const char* code);
 
 
+/**
+ * Returns the #GroupKind_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{GROUP_KIND_INVALID,
+ * GroupKind_t} if there is no such match.
+ *
+ * @param code the string to convert to a #GroupKind_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #GroupKind_t or @sbmlconstant{GROUP_KIND_INVALID,
+ * GroupKind_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Group_t
+ * @endif
+ */
+LIBSBML_EXTERN
+GroupKind_t
+GroupKind_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #GroupKind_t is valid.
@@ -166,9 +166,18 @@ GroupsSBMLDocumentPlugin::checkConsistency()
   GroupsIdentifierConsistencyValidator id_validator;
   GroupsConsistencyValidator core_validator;
 
+  // the validators that resolve references share one index of the model
+
+  std::map<std::string, const SBase*> idIndex;
+
   if (id)
   {
     id_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      id_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = id_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -184,6 +193,11 @@ GroupsSBMLDocumentPlugin::checkConsistency()
   if (core)
   {
     core_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      core_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = core_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -483,6 +497,217 @@ GroupsSBMLDocumentPlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::getAttribute(int attributeId,
+                                       unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::getAttribute(int attributeId,
+                                       std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this GroupsSBMLDocumentPlugin is set.
+ */
+bool
+GroupsSBMLDocumentPlugin::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::setAttribute(int attributeId,
+                                       const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * GroupsSBMLDocumentPlugin.
+ */
+int
+GroupsSBMLDocumentPlugin::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -231,7 +232,7 @@ MultiExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -343,18 +344,31 @@ unsigned int
 MultiExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(multiErrorTable)/sizeof(multiErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == multiErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (multiErrorTable[mid].code < errorId)
     {
-      index = i;
-      break;
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && multiErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -476,15 +490,55 @@ LIBSBML_EXTERN
 BindingStatus_t
 BindingStatus_fromString(const char* code)
 {
-  static int size = sizeof(SBML_BINDING_STATUS_STRINGS)/sizeof(SBML_BINDING_STATUS_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_BINDING_INVALID;
+  }
+
+  return BindingStatus_fromStringWithLength(code, strlen(code));
+}
+
 
-  for (int i = 0; i < size; i++)
+/*
+ * Returns the #BindingStatus_t enumeration corresponding to the first @p
+ * length characters of the given string or
+ * @sbmlconstant{MULTI_BINDING_INVALID, BindingStatus_t} if there is no such
+ * match.
+ */
+LIBSBML_EXTERN
+BindingStatus_t
+BindingStatus_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return MULTI_BINDING_INVALID;
+  }
+
+  switch (length)
   {
-    if (type == SBML_BINDING_STATUS_STRINGS[i])
+  case 5:
+    if (memcmp(code, "bound", 5) == 0)
+    {
+      return MULTI_BINDING_STATUS_BOUND;
+    }
+
+    break;
+  case 6:
+    if (memcmp(code, "either", 6) == 0)
     {
-      return (BindingStatus_t)(i);
+      return MULTI_BINDING_STATUS_EITHER;
     }
+
+    break;
+  case 7:
+    if (memcmp(code, "unbound", 7) == 0)
+    {
+      return MULTI_BINDING_STATUS_UNBOUND;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_BINDING_INVALID;
@@ -562,16 +616,52 @@ LIBSBML_EXTERN
 Relation_t
 Relation_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_RELATION_STRINGS)/sizeof(SBML_RELATION_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_RELATION_INVALID;
+  }
+
+  return Relation_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #Relation_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{MULTI_RELATION_INVALID,
+ * Relation_t} if there is no such match.
+ */
+LIBSBML_EXTERN
+Relation_t
+Relation_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return MULTI_RELATION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_RELATION_STRINGS[i])
+  case 2:
+    if (memcmp(code, "or", 2) == 0)
     {
-      return (Relation_t)(i);
+      return MULTI_RELATION_OR;
     }
+
+    break;
+  case 3:
+    if (memcmp(code, "and", 3) == 0)
+    {
+      return MULTI_RELATION_AND;
+    }
+
+    if (memcmp(code, "not", 3) == 0)
+    {
+      return MULTI_RELATION_NOT;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_RELATION_INVALID;
@@ -650,15 +740,48 @@ LIBSBML_EXTERN
 RepresentationType_t
 RepresentationType_fromString(const char* code)
 {
-  static int size = sizeof(SBML_REPRESENTATION_TYPE_STRINGS)/sizeof(SBML_REPRESENTATION_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return MULTI_REPRESENTATIONTYPE_INVALID;
+  }
+
+  return RepresentationType_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #RepresentationType_t enumeration corresponding to the first @p
+ * length characters of the given string or
+ * @sbmlconstant{MULTI_REPRESENTATIONTYPE_INVALID, RepresentationType_t} if
+ * there is no such match.
+ */
+LIBSBML_EXTERN
+RepresentationType_t
+RepresentationType_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return MULTI_REPRESENTATIONTYPE_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_REPRESENTATION_TYPE_STRINGS[i])
+  case 3:
+    if (memcmp(code, "sum", 3) == 0)
     {
-      return (RepresentationType_t)(i);
+      return MULTI_REPRESENTATIONTYPE_SUM;
     }
+
+    break;
+  case 12:
+    if (memcmp(code, "numericValue", 12) == 0)
+    {
+      return MULTI_REPRESENTATIONTYPE_NUMERICVALUE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return MULTI_REPRESENTATIONTYPE_INVALID;
@@ -463,6 +463,32 @@ BindingStatus_t
 BindingStatus_fromString(const char* code);
 
 
+/**
+ * Returns the #BindingStatus_t enumeration corresponding to the first @p
+ * length characters of the given string or
+ * @sbmlconstant{MULTI_BINDING_INVALID, BindingStatus_t} if there is no such
+ * match.
+ *
+ * @param code the string to convert to a #BindingStatus_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #BindingStatus_t or
+ * @sbmlconstant{MULTI_BINDING_INVALID, BindingStatus_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Multi_t
+ * @endif
+ */
+LIBSBML_EXTERN
+BindingStatus_t
+BindingStatus_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #BindingStatus_t is valid.
@@ -581,6 +607,31 @@ Relation_t
 Relation_fromString(const char* code);
 
 
+/**
+ * Returns the #Relation_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{MULTI_RELATION_INVALID,
+ * Relation_t} if there is no such match.
+ *
+ * @param code the string to convert to a #Relation_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #Relation_t or
+ * @sbmlconstant{MULTI_RELATION_INVALID, Relation_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Multi_t
+ * @endif
+ */
+LIBSBML_EXTERN
+Relation_t
+Relation_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #Relation_t is valid.
@@ -701,6 +752,33 @@ RepresentationType_t
 RepresentationType_fromString(const char* code);
 
 
+/**
+ * Returns the #RepresentationType_t enumeration corresponding to the first @p
+ * length characters of the given string or
+ * @sbmlconstant{MULTI_REPRESENTATIONTYPE_INVALID, RepresentationType_t} if
+ * there is no such match.
+ *
+ * @param code the string to convert to a #RepresentationType_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #RepresentationType_t or
+ * @sbmlconstant{MULTI_REPRESENTATIONTYPE_INVALID, RepresentationType_t} if no
+ * match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Multi_t
+ * @endif
+ */
+LIBSBML_EXTERN
+RepresentationType_t
+RepresentationType_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #RepresentationType_t is valid.
@@ -63,6 +63,24 @@ QualConsistencyValidator::init()
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates an initialised QualConsistencyValidator to validate part of a
+ * document on another thread.
+ */
+QualValidator*
+QualConsistencyValidator::createWorker() const
+{
+  QualConsistencyValidator* worker = new QualConsistencyValidator();
+  worker->init();
+  return worker;
+}
+
+/** @endcond */
+
+
+
 
 LIBSBML_CPP_NAMESPACE_END
 
@@ -75,6 +75,23 @@ public:
   virtual void init();
 
 
+protected:
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Creates an initialised QualConsistencyValidator to validate part of a
+   * document on another thread.
+   *
+   * @return the new validator, owned by the caller, or @c NULL if this
+   * validator cannot be copied; the document is then validated serially.
+   */
+  virtual QualValidator* createWorker() const;
+
+
+
+  /** @endcond */
+
 };
 
 
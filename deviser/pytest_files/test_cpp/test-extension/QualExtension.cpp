@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -219,7 +220,7 @@ QualExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -331,18 +332,31 @@ unsigned int
 QualExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(qualErrorTable)/sizeof(qualErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == qualErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (qualErrorTable[mid].code < errorId)
     {
-      index = i;
-      break;
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && qualErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -446,15 +460,59 @@ LIBSBML_EXTERN
 Sign_t
 Sign_fromString(const char* code)
 {
-  static int size = sizeof(SBML_SIGN_STRINGS)/sizeof(SBML_SIGN_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return INPUT_SIGN_INVALID;
+  }
+
+  return Sign_fromStringWithLength(code, strlen(code));
+}
+
 
-  for (int i = 0; i < size; i++)
+/*
+ * Returns the #Sign_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{INPUT_SIGN_INVALID, Sign_t}
+ * if there is no such match.
+ */
+LIBSBML_EXTERN
+Sign_t
+Sign_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return INPUT_SIGN_INVALID;
+  }
+
+  switch (length)
   {
-    if (type == SBML_SIGN_STRINGS[i])
+  case 4:
+    if (memcmp(code, "dual", 4) == 0)
+    {
+      return INPUT_SIGN_DUAL;
+    }
+
+    break;
+  case 7:
+    if (memcmp(code, "unknown", 7) == 0)
     {
-      return (Sign_t)(i);
+      return INPUT_SIGN_UNKNOWN;
     }
+
+    break;
+  case 8:
+    if (memcmp(code, "positive", 8) == 0)
+    {
+      return INPUT_SIGN_POSITIVE;
+    }
+
+    if (memcmp(code, "negative", 8) == 0)
+    {
+      return INPUT_SIGN_NEGATIVE;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return INPUT_SIGN_INVALID;
@@ -533,15 +591,48 @@ LIBSBML_EXTERN
 TransitionOutputEffect_t
 TransitionOutputEffect_fromString(const char* code)
 {
-  static int size = sizeof(SBML_TRANSITION_OUTPUT_EFFECT_STRINGS)/sizeof(SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return OUTPUT_TRANSITION_INVALID;
+  }
+
+  return TransitionOutputEffect_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #TransitionOutputEffect_t enumeration corresponding to the first
+ * @p length characters of the given string or
+ * @sbmlconstant{OUTPUT_TRANSITION_INVALID, TransitionOutputEffect_t} if there
+ * is no such match.
+ */
+LIBSBML_EXTERN
+TransitionOutputEffect_t
+TransitionOutputEffect_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return OUTPUT_TRANSITION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_TRANSITION_OUTPUT_EFFECT_STRINGS[i])
+  case 10:
+    if (memcmp(code, "production", 10) == 0)
+    {
+      return OUTPUT_TRANSITION_EFFECT_PRODUCTION;
+    }
+
+    break;
+  case 16:
+    if (memcmp(code, "assignment level", 16) == 0)
     {
-      return (TransitionOutputEffect_t)(i);
+      return OUTPUT_TRANSITION_EFFECT_ASSIGNMENT_LEVEL;
     }
+
+    break;
+  default:
+    break;
   }
 
   return OUTPUT_TRANSITION_INVALID;
@@ -621,15 +712,48 @@ LIBSBML_EXTERN
 TransitionInputEffect_t
 TransitionInputEffect_fromString(const char* code)
 {
-  static int size = sizeof(SBML_TRANSITION_INPUT_EFFECT_STRINGS)/sizeof(SBML_TRANSITION_INPUT_EFFECT_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return INPUT_TRANSITION_INVALID;
+  }
+
+  return TransitionInputEffect_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #TransitionInputEffect_t enumeration corresponding to the first
+ * @p length characters of the given string or
+ * @sbmlconstant{INPUT_TRANSITION_INVALID, TransitionInputEffect_t} if there is
+ * no such match.
+ */
+LIBSBML_EXTERN
+TransitionInputEffect_t
+TransitionInputEffect_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return INPUT_TRANSITION_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_TRANSITION_INPUT_EFFECT_STRINGS[i])
+  case 4:
+    if (memcmp(code, "none", 4) == 0)
     {
-      return (TransitionInputEffect_t)(i);
+      return INPUT_TRANSITION_EFFECT_NONE;
     }
+
+    break;
+  case 11:
+    if (memcmp(code, "consumption", 11) == 0)
+    {
+      return INPUT_TRANSITION_EFFECT_CONSUMPTION;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return INPUT_TRANSITION_INVALID;
@@ -454,6 +454,31 @@ Sign_t
 Sign_fromString(const char* code);
 
 
+/**
+ * Returns the #Sign_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{INPUT_SIGN_INVALID, Sign_t}
+ * if there is no such match.
+ *
+ * @param code the string to convert to a #Sign_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #Sign_t or @sbmlconstant{INPUT_SIGN_INVALID,
+ * Sign_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Input_t
+ * @endif
+ */
+LIBSBML_EXTERN
+Sign_t
+Sign_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #Sign_t is valid.
@@ -576,6 +601,33 @@ TransitionOutputEffect_t
 TransitionOutputEffect_fromString(const char* code);
 
 
+/**
+ * Returns the #TransitionOutputEffect_t enumeration corresponding to the first
+ * @p length characters of the given string or
+ * @sbmlconstant{OUTPUT_TRANSITION_INVALID, TransitionOutputEffect_t} if there
+ * is no such match.
+ *
+ * @param code the string to convert to a #TransitionOutputEffect_t; it need
+ * not be null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #TransitionOutputEffect_t or
+ * @sbmlconstant{OUTPUT_TRANSITION_INVALID, TransitionOutputEffect_t} if no
+ * match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Output_t
+ * @endif
+ */
+LIBSBML_EXTERN
+TransitionOutputEffect_t
+TransitionOutputEffect_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #TransitionOutputEffect_t is valid.
@@ -696,6 +748,33 @@ TransitionInputEffect_t
 TransitionInputEffect_fromString(const char* code);
 
 
+/**
+ * Returns the #TransitionInputEffect_t enumeration corresponding to the first
+ * @p length characters of the given string or
+ * @sbmlconstant{INPUT_TRANSITION_INVALID, TransitionInputEffect_t} if there is
+ * no such match.
+ *
+ * @param code the string to convert to a #TransitionInputEffect_t; it need not
+ * be null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #TransitionInputEffect_t or
+ * @sbmlconstant{INPUT_TRANSITION_INVALID, TransitionInputEffect_t} if no match
+ * is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Input_t
+ * @endif
+ */
+LIBSBML_EXTERN
+TransitionInputEffect_t
+TransitionInputEffect_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #TransitionInputEffect_t is valid.
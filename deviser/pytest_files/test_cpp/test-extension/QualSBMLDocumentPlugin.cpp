@@ -165,9 +165,18 @@ QualSBMLDocumentPlugin::checkConsistency()
   QualIdentifierConsistencyValidator id_validator;
   QualConsistencyValidator core_validator;
 
+  // the validators that resolve references share one index of the model
+
+  std::map<std::string, const SBase*> idIndex;
+
   if (id)
   {
     id_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      id_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = id_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -183,6 +192,11 @@ QualSBMLDocumentPlugin::checkConsistency()
   if (core)
   {
     core_validator.init();
+    if (doc->getModel() != NULL)
+    {
+      core_validator.shareIdIndex(idIndex, *doc->getModel());
+    }
+
     nerrors = core_validator.validate(*doc);
     total_errors += nerrors;
     if (nerrors > 0)
@@ -481,6 +495,217 @@ QualSBMLDocumentPlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::getAttribute(int attributeId,
+                                     unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::getAttribute(int attributeId,
+                                     std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this QualSBMLDocumentPlugin is set.
+ */
+bool
+QualSBMLDocumentPlugin::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::setAttribute(int attributeId,
+                                     const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * QualSBMLDocumentPlugin.
+ */
+int
+QualSBMLDocumentPlugin::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
@@ -155,6 +155,15 @@ struct QualValidatorConstraints
 
   void add(VConstraint* c);
 
+  template <typename T>
+  void add(ConstraintSet<T>& set, TConstraint<T>* c)
+  {
+    if (c == NULL) return;
+
+    ptrMap.insert(pair<VConstraint*, bool>(c, true));
+    set.add(c);
+  }
+
 };
 
 
@@ -258,48 +267,78 @@ public:
   bool
   visit(const QualitativeSpecies& x)
   {
+    if (v.mQualConstraints->mQualitativeSpecies.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mQualitativeSpecies.applyTo(m, x);
-    return !v.mQualConstraints->mQualitativeSpecies.empty();
+    return true;
   }
 
 
   bool
   visit(const Transition& x)
   {
+    if (v.mQualConstraints->mTransition.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mTransition.applyTo(m, x);
-    return !v.mQualConstraints->mTransition.empty();
+    return true;
   }
 
 
   bool
   visit(const Input& x)
   {
+    if (v.mQualConstraints->mInput.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mInput.applyTo(m, x);
-    return !v.mQualConstraints->mInput.empty();
+    return true;
   }
 
 
   bool
   visit(const Output& x)
   {
+    if (v.mQualConstraints->mOutput.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mOutput.applyTo(m, x);
-    return !v.mQualConstraints->mOutput.empty();
+    return true;
   }
 
 
   bool
   visit(const DefaultTerm& x)
   {
+    if (v.mQualConstraints->mDefaultTerm.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mDefaultTerm.applyTo(m, x);
-    return !v.mQualConstraints->mDefaultTerm.empty();
+    return true;
   }
 
 
   bool
   visit(const FunctionTerm& x)
   {
+    if (v.mQualConstraints->mFunctionTerm.empty())
+    {
+      return false;
+    }
+
     v.mQualConstraints->mFunctionTerm.applyTo(m, x);
-    return !v.mQualConstraints->mFunctionTerm.empty();
+    return true;
   }
 
 
@@ -311,45 +350,23 @@ public:
       return SBMLVisitor::visit(x);
     }
 
-    int code = x.getTypeCode();
-
-    const ListOf* list = dynamic_cast<const ListOf*>(&x);
-
-    if (list != NULL)
+    switch (x.getTypeCode())
     {
+    case SBML_QUAL_QUALITATIVE_SPECIES:
+      return visit((const QualitativeSpecies&)x);
+    case SBML_QUAL_TRANSITION:
+      return visit((const Transition&)x);
+    case SBML_QUAL_INPUT:
+      return visit((const Input&)x);
+    case SBML_QUAL_OUTPUT:
+      return visit((const Output&)x);
+    case SBML_QUAL_DEFAULT_TERM:
+      return visit((const DefaultTerm&)x);
+    case SBML_QUAL_FUNCTION_TERM:
+      return visit((const FunctionTerm&)x);
+    default:
       return SBMLVisitor::visit(x);
     }
-    else
-    {
-      if (code == SBML_QUAL_QUALITATIVE_SPECIES)
-      {
-        return visit((const QualitativeSpecies&)x);
-      }
-      else if (code == SBML_QUAL_TRANSITION)
-      {
-        return visit((const Transition&)x);
-      }
-      else if (code == SBML_QUAL_INPUT)
-      {
-        return visit((const Input&)x);
-      }
-      else if (code == SBML_QUAL_OUTPUT)
-      {
-        return visit((const Output&)x);
-      }
-      else if (code == SBML_QUAL_DEFAULT_TERM)
-      {
-        return visit((const DefaultTerm&)x);
-      }
-      else if (code == SBML_QUAL_FUNCTION_TERM)
-      {
-        return visit((const FunctionTerm&)x);
-      }
-      else
-      {
-        return SBMLVisitor::visit(x);
-      }
-    }
   }
 
 
@@ -360,6 +377,36 @@ protected:
 };
 
 
+// -------------------------------------------
+// ElementCollector
+// -------------------------------------------
+/**
+ * Lists the qual elements of a document in the order the ValidatingVisitor
+ * would visit them.
+ */
+
+class QualElementCollector: public SBMLVisitor
+{
+public:
+
+  using SBMLVisitor::visit;
+
+  virtual bool
+  visit(const SBase& x)
+  {
+    if (x.getPackageName() == "qual" && x.getTypeCode() != SBML_LIST_OF)
+    {
+      elements.push_back(&x);
+    }
+
+    return true;
+  }
+
+
+  std::vector<const SBase*> elements;
+};
+
+
 // -------------------------------------------
 // QualValidator
 // -------------------------------------------
@@ -369,6 +416,9 @@ protected:
  */
 QualValidator::QualValidator(SBMLErrorCategory_t category)
   : Validator(category)
+  , mNumThreads(1)
+  , mUsesIdIndex(false)
+  , mIdIndex(NULL)
 {
   mQualConstraints = new QualValidatorConstraints();
 }
@@ -393,6 +443,134 @@ QualValidator::addConstraint(VConstraint* c)
 }
 
 
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SBMLDocument objects straight to the
+ * ConstraintSet for SBMLDocument.
+ */
+void
+QualValidator::addConstraint(TConstraint<SBMLDocument>* c)
+{
+  mQualConstraints->add(mQualConstraints->mSBMLDocument, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Model objects straight to the ConstraintSet for
+ * Model.
+ */
+void
+QualValidator::addConstraint(TConstraint<Model>* c)
+{
+  mQualConstraints->add(mQualConstraints->mModel, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on QualitativeSpecies objects straight to the
+ * ConstraintSet for QualitativeSpecies.
+ */
+void
+QualValidator::addConstraint(TConstraint<QualitativeSpecies>* c)
+{
+  mQualConstraints->add(mQualConstraints->mQualitativeSpecies, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Transition objects straight to the
+ * ConstraintSet for Transition.
+ */
+void
+QualValidator::addConstraint(TConstraint<Transition>* c)
+{
+  mQualConstraints->add(mQualConstraints->mTransition, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Input objects straight to the ConstraintSet for
+ * Input.
+ */
+void
+QualValidator::addConstraint(TConstraint<Input>* c)
+{
+  mQualConstraints->add(mQualConstraints->mInput, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Output objects straight to the ConstraintSet
+ * for Output.
+ */
+void
+QualValidator::addConstraint(TConstraint<Output>* c)
+{
+  mQualConstraints->add(mQualConstraints->mOutput, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on DefaultTerm objects straight to the
+ * ConstraintSet for DefaultTerm.
+ */
+void
+QualValidator::addConstraint(TConstraint<DefaultTerm>* c)
+{
+  mQualConstraints->add(mQualConstraints->mDefaultTerm, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on FunctionTerm objects straight to the
+ * ConstraintSet for FunctionTerm.
+ */
+void
+QualValidator::addConstraint(TConstraint<FunctionTerm>* c)
+{
+  mQualConstraints->add(mQualConstraints->mFunctionTerm, c);
+}
+
+/** @endcond */
+
+
 /*
  * Validates the given SBMLDocument
  */
@@ -403,17 +581,34 @@ QualValidator::validate(const SBMLDocument& d)
 
   if (m != NULL)
   {
-    QualValidatingVisitor vv(*this, *m);
+    // an index shared by the caller is used as it is
+
+    map<string, const SBase*> index;
+
+    if (mIdIndex == NULL)
+    {
+      shareIdIndex(index, *m);
+    }
+
     const QualSBMLDocumentPlugin* plugin = static_cast<const
       QualSBMLDocumentPlugin*>(d.getPlugin("qual"));
-    if (plugin != NULL)
+
+    if (plugin != NULL && mNumThreads > 1)
+    {
+      QualElementCollector collector;
+      plugin->accept(collector);
+      validateElements(*m, collector.elements);
+    }
+    else if (plugin != NULL)
     {
+      QualValidatingVisitor vv(*this, *m);
       plugin->accept(vv);
     }
   }
 
   // ADD ANY OTHER OBJECTS THAT HAS PLUGINS
 
+  mIdIndex = NULL;
   return (unsigned int)(mFailures.size());
 }
 
@@ -442,6 +637,206 @@ QualValidator::validate(const std::string& filename)
 }
 
 
+/*
+ * Sets the number of threads used to validate the elements of a document.
+ */
+void
+QualValidator::setNumThreads(unsigned int numThreads)
+{
+  mNumThreads = (numThreads > 0) ? numThreads : 1;
+}
+
+
+/*
+ * Returns the number of threads used to validate the elements of a document.
+ */
+unsigned int
+QualValidator::getNumThreads() const
+{
+  return mNumThreads;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the element of the Model being validated with the given identifier.
+ */
+const SBase*
+QualValidator::getIndexedElement(const std::string& id) const
+{
+  if (mIdIndex == NULL)
+  {
+    return NULL;
+  }
+
+  map<string, const SBase*>::const_iterator it = mIdIndex->find(id);
+  return (it != mIdIndex->end()) ? it->second : NULL;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Makes the next validation use the given index of the elements of the Model
+ * by identifier.
+ */
+void
+QualValidator::shareIdIndex(std::map<std::string, const SBase*>& index,
+                            const Model& m)
+{
+  if (mUsesIdIndex == false)
+  {
+    return;
+  }
+
+  if (index.empty())
+  {
+    indexIds(m, index);
+  }
+
+  mIdIndex = &index;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates a validator with the same constraints as this one to validate part
+ * of a document on another thread.
+ */
+QualValidator*
+QualValidator::createWorker() const
+{
+  return NULL;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Validates the given elements, in document order, using up to getNumThreads()
+ * workers.
+ */
+void
+QualValidator::validateElements(const Model& m,
+                                const std::vector<const SBase*>& elements)
+{
+  unsigned int numElements = (unsigned int)(elements.size());
+  unsigned int numWorkers = (mNumThreads < numElements) ? mNumThreads :
+    numElements;
+  std::vector<QualValidator*> workers;
+
+  for (unsigned int k = 0; k < numWorkers; k++)
+  {
+    QualValidator* worker = createWorker();
+    if (worker == NULL) break;
+    worker->mIdIndex = mIdIndex;
+    workers.push_back(worker);
+  }
+
+  // without a full set of workers validate here in turn
+  if (workers.size() < numWorkers || numWorkers < 2)
+  {
+    for (unsigned int k = 0; k < workers.size(); k++)
+    {
+      delete workers[k];
+    }
+
+    QualValidatingVisitor vv(*this, m);
+    for (unsigned int i = 0; i < numElements; i++)
+    {
+      vv.visit(*elements[i]);
+    }
+    return;
+  }
+
+  // each worker takes a contiguous run of elements
+  int count = (int)(numWorkers);
+  #ifdef _OPENMP
+  #pragma omp parallel for num_threads(count) schedule(static, 1)
+  #endif
+  for (int k = 0; k < count; k++)
+  {
+    size_t first = (size_t)(numElements) * k / count;
+    size_t last = (size_t)(numElements) * (k + 1) / count;
+    QualValidatingVisitor vv(*workers[k], m);
+    for (size_t i = first; i < last; i++)
+    {
+      vv.visit(*elements[i]);
+    }
+  }
+
+  // the runs are merged in order so the failures match a serial run
+  for (int k = 0; k < count; k++)
+  {
+    const std::list<SBMLError>& failures = workers[k]->getFailures();
+    std::list<SBMLError>::const_iterator it;
+    for (it = failures.begin(); it != failures.end(); ++it)
+    {
+      logFailure(*it);
+    }
+    delete workers[k];
+  }
+}
+
+
+/** @endcond */
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Indexes the elements of the given Model by identifier.
+ */
+void
+QualValidator::indexIds(const Model& m,
+                        std::map<std::string, const SBase*>& index) const
+{
+  index.clear();
+  List* elements = const_cast<Model&>(m).getAllElements();
+
+  while (elements->getSize() > 0)
+  {
+    const SBase* element = static_cast<const SBase*>(elements->remove(0));
+    int type = element->getTypeCode();
+    bool core = element->getPackageName() == "core";
+    // unit definitions and the parameters of a kinetic law
+    // are not in the global SId namespace
+
+    if (core && (type == SBML_UNIT_DEFINITION || type == SBML_LOCAL_PARAMETER))
+    {
+      continue;
+    }
+
+    if (element->getAncestorOfType(SBML_KINETIC_LAW) != NULL)
+    {
+      continue;
+    }
+
+    if (element->isSetIdAttribute())
+    {
+      index.insert(pair<string, const SBase*>(element->getIdAttribute(),
+        element));
+    }
+  }
+
+  delete elements;
+}
+
+/** @endcond */
+
+
 
 
 #endif /* __cplusplus */
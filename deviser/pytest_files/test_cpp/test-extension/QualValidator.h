@@ -65,7 +65,9 @@
 /** @cond doxygenLibsbmlInternal */
 
 #include <list>
+#include <map>
 #include <string>
+#include <vector>
 
 /** @endcond */
 
@@ -80,6 +82,16 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 class VConstraint;
 struct QualValidatorConstraints;
 class SBMLDocument;
+class SBase;
+class Model;
+class QualitativeSpecies;
+class Transition;
+class Input;
+class Output;
+class DefaultTerm;
+class FunctionTerm;
+
+template <typename T> class TConstraint;
 
 
 class QualValidator : public Validator
@@ -118,6 +130,118 @@ public:
   virtual void addConstraint(VConstraint* c);
 
 
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SBMLDocument objects straight to the
+   * ConstraintSet for SBMLDocument.
+   *
+   * @param c the TConstraint<SBMLDocument> object to add.
+   */
+  void addConstraint(TConstraint<SBMLDocument>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Model objects straight to the ConstraintSet
+   * for Model.
+   *
+   * @param c the TConstraint<Model> object to add.
+   */
+  void addConstraint(TConstraint<Model>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on QualitativeSpecies objects straight to the
+   * ConstraintSet for QualitativeSpecies.
+   *
+   * @param c the TConstraint<QualitativeSpecies> object to add.
+   */
+  void addConstraint(TConstraint<QualitativeSpecies>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Transition objects straight to the
+   * ConstraintSet for Transition.
+   *
+   * @param c the TConstraint<Transition> object to add.
+   */
+  void addConstraint(TConstraint<Transition>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Input objects straight to the ConstraintSet
+   * for Input.
+   *
+   * @param c the TConstraint<Input> object to add.
+   */
+  void addConstraint(TConstraint<Input>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Output objects straight to the ConstraintSet
+   * for Output.
+   *
+   * @param c the TConstraint<Output> object to add.
+   */
+  void addConstraint(TConstraint<Output>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on DefaultTerm objects straight to the
+   * ConstraintSet for DefaultTerm.
+   *
+   * @param c the TConstraint<DefaultTerm> object to add.
+   */
+  void addConstraint(TConstraint<DefaultTerm>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on FunctionTerm objects straight to the
+   * ConstraintSet for FunctionTerm.
+   *
+   * @param c the TConstraint<FunctionTerm> object to add.
+   */
+  void addConstraint(TConstraint<FunctionTerm>* c);
+
+  /** @endcond */
+
+
   /**
    * Validates the given SBMLDocument
    *
@@ -140,11 +264,118 @@ public:
   virtual unsigned int validate(const std::string& filename);
 
 
+  /**
+   * Sets the number of threads used to validate the elements of a document.
+   *
+   * @param numThreads the number of threads to use; values less than 2
+   * validate the document serially, which is the default.
+   *
+   * The elements are split into contiguous runs, one for each thread, and the
+   * failures are reported in document order just as they would be by a serial
+   * validation. Threads are only used when the library is built with OpenMP.
+   * The threads only read the document, which must not be changed while it is
+   * validated; array text kept to be parsed on first use is parsed by one
+   * thread at a time.
+   */
+  void setNumThreads(unsigned int numThreads);
+
+
+  /**
+   * Returns the number of threads used to validate the elements of a document.
+   *
+   * @return the number of threads.
+   */
+  unsigned int getNumThreads() const;
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the element of the Model being validated with the given
+   * identifier.
+   *
+   * @param id the identifier of the element to return.
+   *
+   * @return the element with the given identifier, or @c NULL if there is no
+   * such element.
+   *
+   * Constraints use this to resolve references; the index is built once at the
+   * start of each validation rather than the Model being searched for each
+   * reference, and only if a constraint of this validator resolves references.
+   */
+  const SBase* getIndexedElement(const std::string& id) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Makes the next validation use the given index of the elements of the Model
+   * by identifier.
+   *
+   * @param index the index, which is filled from @p m first if it is empty;
+   * the caller keeps it.
+   *
+   * @param m the Model to be validated.
+   *
+   * Nothing is done if no constraint of this validator resolves references.
+   * Validators of the same document may share one index, so that the Model is
+   * only indexed once however many of them need it.
+   */
+  void shareIdIndex(std::map<std::string, const SBase*>& index, const Model&
+    m);
+
+  /** @endcond */
+
+
 protected:
 
   /** @cond doxygenLibsbmlInternal */
 
+  /**
+   * Creates a validator with the same constraints as this one to validate part
+   * of a document on another thread.
+   *
+   * @return the new validator, owned by the caller, or @c NULL if this
+   * validator cannot be copied; the document is then validated serially.
+   */
+  virtual QualValidator* createWorker() const;
+
+
+  /**
+   * Validates the given elements, in document order, using up to
+   * getNumThreads() workers.
+   *
+   * @param m the Model containing the elements.
+   *
+   * @param elements the elements to validate.
+   */
+  void validateElements(const Model& m,
+                        const std::vector<const SBase*>& elements);
+
+
+  /**
+   * Indexes the elements of the given Model by identifier.
+   *
+   * @param m the Model to index.
+   *
+   * @param index the index to fill.
+   *
+   * Only elements whose identifiers are in the global SId namespace are
+   * indexed, so that a UnitDefinition or a LocalParameter never hides the
+   * element a reference resolves to.
+   */
+  void indexIds(const Model& m,
+                std::map<std::string, const SBase*>& index) const;
+
+
   QualValidatorConstraints* mQualConstraints;
+  unsigned int mNumThreads;
+  bool mUsesIdIndex;
+  const std::map<std::string, const SBase*>* mIdIndex;
 
   friend class QualValidatingVisitor;
 
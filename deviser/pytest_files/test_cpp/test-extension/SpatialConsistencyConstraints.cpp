@@ -42,6 +42,8 @@
 #include <sbml/validator/VConstraint.h>
 
 #include <sbml/packages/spatial/validator/SpatialSBMLError.h>
+#include <sbml/packages/spatial/common/SpatialExtensionTypes.h>
+#include <sbml/packages/spatial/validator/SpatialValidator.h>
 
 #endif /* AddingConstraintsToValidator */
 
@@ -49,9 +51,508 @@
 
 using namespace std;
 
-/**
- * PUT CONSTRAINTS HERE
- */
+// 1220805
+START_CONSTRAINT (SpatialDomainDomainTypeMustBeDomainType, Domain, d)
+{
+  pre (d.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(d.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += d.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221104
+START_CONSTRAINT (SpatialAdjacentDomainsDomain1MustBeDomain, AdjacentDomains, ad)
+{
+  pre (ad.isSetDomain1());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(ad.getDomain1());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAIN);
+  }
+
+  msg = "The attribute 'domain1' is set to '";
+  msg += ad.getDomain1();
+  msg += "', which is not the id of ";
+  msg += "a Domain in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221105
+START_CONSTRAINT (SpatialAdjacentDomainsDomain2MustBeDomain, AdjacentDomains, ad)
+{
+  pre (ad.isSetDomain2());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(ad.getDomain2());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAIN);
+  }
+
+  msg = "The attribute 'domain2' is set to '";
+  msg += ad.getDomain2();
+  msg += "', which is not the id of ";
+  msg += "a Domain in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221304
+START_CONSTRAINT (SpatialCompartmentMappingDomainTypeMustBeDomainType, CompartmentMapping, cm)
+{
+  pre (cm.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(cm.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += cm.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221505
+START_CONSTRAINT (SpatialSampledFieldGeometrySampledFieldMustBeSampledField, SampledFieldGeometry, sfg)
+{
+  pre (sfg.isSetSampledField());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(sfg.getSampledField());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_SAMPLEDFIELD);
+  }
+
+  msg = "The attribute 'sampledField' is set to '";
+  msg += sfg.getSampledField();
+  msg += "', which is not the id of ";
+  msg += "a SampledField in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221704
+START_CONSTRAINT (SpatialSampledVolumeDomainTypeMustBeDomainType, SampledVolume, sv)
+{
+  pre (sv.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(sv.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += sv.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1221906
+START_CONSTRAINT (SpatialAnalyticVolumeDomainTypeMustBeDomainType, AnalyticVolume, av)
+{
+  pre (av.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(av.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += av.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1222105
+START_CONSTRAINT (SpatialParametricObjectDomainTypeMustBeDomainType, ParametricObject, po)
+{
+  pre (po.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(po.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += po.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1222305
+START_CONSTRAINT (SpatialCSGObjectDomainTypeMustBeDomainType, CSGObject, csgo)
+{
+  pre (csgo.isSetDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(csgo.getDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'domainType' is set to '";
+  msg += csgo.getDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223206
+START_CONSTRAINT (SpatialCSGSetOperatorComplementAMustBeCSGNode, CSGSetOperator, csgso)
+{
+  pre (csgso.isSetComplementA());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(csgso.getComplementA());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    switch (ref->getTypeCode())
+    {
+    case SBML_SPATIAL_CSGTRANSLATION:
+    case SBML_SPATIAL_CSGROTATION:
+    case SBML_SPATIAL_CSGSCALE:
+    case SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION:
+    case SBML_SPATIAL_CSGPRIMITIVE:
+    case SBML_SPATIAL_CSGSETOPERATOR:
+      fail = false;
+      break;
+    default:
+      break;
+    }
+  }
+
+  msg = "The attribute 'complementA' is set to '";
+  msg += csgso.getComplementA();
+  msg += "', which is not the id of ";
+  msg += "a CSGNode in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223207
+START_CONSTRAINT (SpatialCSGSetOperatorComplementBMustBeCSGNode, CSGSetOperator, csgso)
+{
+  pre (csgso.isSetComplementB());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(csgso.getComplementB());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    switch (ref->getTypeCode())
+    {
+    case SBML_SPATIAL_CSGTRANSLATION:
+    case SBML_SPATIAL_CSGROTATION:
+    case SBML_SPATIAL_CSGSCALE:
+    case SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION:
+    case SBML_SPATIAL_CSGPRIMITIVE:
+    case SBML_SPATIAL_CSGSETOPERATOR:
+      fail = false;
+      break;
+    default:
+      break;
+    }
+  }
+
+  msg = "The attribute 'complementB' is set to '";
+  msg += csgso.getComplementB();
+  msg += "', which is not the id of ";
+  msg += "a CSGNode in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223304
+START_CONSTRAINT (SpatialSpatialSymbolReferenceSpatialRefMustBeGeometry, SpatialSymbolReference, ssr)
+{
+  pre (ssr.isSetSpatialRef());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(ssr.getSpatialRef());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_GEOMETRY);
+  }
+
+  msg = "The attribute 'spatialRef' is set to '";
+  msg += ssr.getSpatialRef();
+  msg += "', which is not the id of ";
+  msg += "a Geometry in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223404
+START_CONSTRAINT (SpatialDiffusionCoefficientVariableMustBeSpecies, DiffusionCoefficient, dc)
+{
+  pre (dc.isSetVariable());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(dc.getVariable());
+
+  bool fail = true;
+
+  if (fail && ref != NULL)
+  {
+    fail = (ref->getElementName() != "species");
+  }
+
+  msg = "The attribute 'variable' is set to '";
+  msg += dc.getVariable();
+  msg += "', which is not the id of ";
+  msg += "a Species in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223504
+START_CONSTRAINT (SpatialAdvectionCoefficientVariableMustBeSpecies, AdvectionCoefficient, ac)
+{
+  pre (ac.isSetVariable());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(ac.getVariable());
+
+  bool fail = true;
+
+  if (fail && ref != NULL)
+  {
+    fail = (ref->getElementName() != "species");
+  }
+
+  msg = "The attribute 'variable' is set to '";
+  msg += ac.getVariable();
+  msg += "', which is not the id of ";
+  msg += "a Species in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223604
+START_CONSTRAINT (SpatialBoundaryConditionVariableMustBeSpecies, BoundaryCondition, bc)
+{
+  pre (bc.isSetVariable());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(bc.getVariable());
+
+  bool fail = true;
+
+  if (fail && ref != NULL)
+  {
+    fail = (ref->getElementName() != "species");
+  }
+
+  msg = "The attribute 'variable' is set to '";
+  msg += bc.getVariable();
+  msg += "', which is not the id of ";
+  msg += "a Species in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223606
+START_CONSTRAINT (SpatialBoundaryConditionCoordinateBoundaryMustBeBoundary, BoundaryCondition, bc)
+{
+  pre (bc.isSetCoordinateBoundary());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(bc.getCoordinateBoundary());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_BOUNDARY);
+  }
+
+  msg = "The attribute 'coordinateBoundary' is set to '";
+  msg += bc.getCoordinateBoundary();
+  msg += "', which is not the id of ";
+  msg += "a Boundary in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223607
+START_CONSTRAINT (SpatialBoundaryConditionBoundaryDomainTypeMustBeDomainType, BoundaryCondition, bc)
+{
+  pre (bc.isSetBoundaryDomainType());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(bc.getBoundaryDomainType());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    fail = (ref->getTypeCode() != SBML_SPATIAL_DOMAINTYPE);
+  }
+
+  msg = "The attribute 'boundaryDomainType' is set to '";
+  msg += bc.getBoundaryDomainType();
+  msg += "', which is not the id of ";
+  msg += "a DomainType in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
+
+// 1223904
+START_CONSTRAINT (SpatialOrdinalMappingGeometryDefinitionMustBeGeometryDefinition, OrdinalMapping, om)
+{
+  pre (om.isSetGeometryDefinition());
+
+  const SpatialValidator& validator =
+    static_cast<const SpatialValidator&>(mValidator);
+  const SBase* ref = validator.getIndexedElement(om.getGeometryDefinition());
+
+  bool fail = true;
+
+  if (ref != NULL && ref->getPackageName() == "spatial")
+  {
+    switch (ref->getTypeCode())
+    {
+    case SBML_SPATIAL_SAMPLEDFIELDGEOMETRY:
+    case SBML_SPATIAL_ANALYTICGEOMETRY:
+    case SBML_SPATIAL_PARAMETRICGEOMETRY:
+    case SBML_SPATIAL_CSGEOMETRY:
+    case SBML_SPATIAL_MIXEDGEOMETRY:
+      fail = false;
+      break;
+    default:
+      break;
+    }
+  }
+
+  msg = "The attribute 'geometryDefinition' is set to '";
+  msg += om.getGeometryDefinition();
+  msg += "', which is not the id of ";
+  msg += "a GeometryDefinition in the model.";
+
+  inv (fail == false);
+}
+END_CONSTRAINT
+
 
 
 /** @endcond */
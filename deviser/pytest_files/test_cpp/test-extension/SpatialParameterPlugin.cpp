@@ -1087,6 +1087,217 @@ SpatialParameterPlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::getAttribute(int attributeId,
+                                     unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::getAttribute(int attributeId,
+                                     std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this SpatialParameterPlugin is set.
+ */
+bool
+SpatialParameterPlugin::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::setAttribute(int attributeId,
+                                     const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * SpatialParameterPlugin.
+ */
+int
+SpatialParameterPlugin::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1425,6 +1636,17 @@ SpatialParameterPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1433,15 +1655,77 @@ List*
 SpatialParameterPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mSpatialSymbolReference, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mAdvectionCoefficient, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mBoundaryCondition, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mDiffusionCoefficient, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+SpatialParameterPlugin::forEachElement(bool (*action)(SBase*, void*),
+                                       void* userData,
+                                       ElementFilter* filter)
+{
+  if (mSpatialSymbolReference != NULL)
+  {
+    if ((filter == NULL || filter->filter(mSpatialSymbolReference)) &&
+      !action(mSpatialSymbolReference, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mSpatialSymbolReference->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mAdvectionCoefficient != NULL)
+  {
+    if ((filter == NULL || filter->filter(mAdvectionCoefficient)) &&
+      !action(mAdvectionCoefficient, userData))
+    {
+      return false;
+    }
+
+    if (!mAdvectionCoefficient->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mBoundaryCondition != NULL)
+  {
+    if ((filter == NULL || filter->filter(mBoundaryCondition)) &&
+      !action(mBoundaryCondition, userData))
+    {
+      return false;
+    }
+
+    if (!mBoundaryCondition->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mDiffusionCoefficient != NULL)
+  {
+    if ((filter == NULL || filter->filter(mDiffusionCoefficient)) &&
+      !action(mDiffusionCoefficient, userData))
+    {
+      return false;
+    }
+
+    if (!mDiffusionCoefficient->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -183,6 +183,15 @@ struct SpatialValidatorConstraints
 
   void add(VConstraint* c);
 
+  template <typename T>
+  void add(ConstraintSet<T>& set, TConstraint<T>* c)
+  {
+    if (c == NULL) return;
+
+    ptrMap.insert(pair<VConstraint*, bool>(c, true));
+    set.add(c);
+  }
+
 };
 
 
@@ -463,272 +472,442 @@ public:
   bool
   visit(const DomainType& x)
   {
+    if (v.mSpatialConstraints->mDomainType.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mDomainType.applyTo(m, x);
-    return !v.mSpatialConstraints->mDomainType.empty();
+    return true;
   }
 
 
   bool
   visit(const Domain& x)
   {
+    if (v.mSpatialConstraints->mDomain.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mDomain.applyTo(m, x);
-    return !v.mSpatialConstraints->mDomain.empty();
+    return true;
   }
 
 
   bool
   visit(const InteriorPoint& x)
   {
+    if (v.mSpatialConstraints->mInteriorPoint.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mInteriorPoint.applyTo(m, x);
-    return !v.mSpatialConstraints->mInteriorPoint.empty();
+    return true;
   }
 
 
   bool
   visit(const Boundary& x)
   {
+    if (v.mSpatialConstraints->mBoundary.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mBoundary.applyTo(m, x);
-    return !v.mSpatialConstraints->mBoundary.empty();
+    return true;
   }
 
 
   bool
   visit(const AdjacentDomains& x)
   {
+    if (v.mSpatialConstraints->mAdjacentDomains.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mAdjacentDomains.applyTo(m, x);
-    return !v.mSpatialConstraints->mAdjacentDomains.empty();
+    return true;
   }
 
 
   bool
   visit(const GeometryDefinition& x)
   {
+    if (v.mSpatialConstraints->mGeometryDefinition.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mGeometryDefinition.applyTo(m, x);
-    return !v.mSpatialConstraints->mGeometryDefinition.empty();
+    return true;
   }
 
 
   bool
   visit(const CompartmentMapping& x)
   {
+    if (v.mSpatialConstraints->mCompartmentMapping.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCompartmentMapping.applyTo(m, x);
-    return !v.mSpatialConstraints->mCompartmentMapping.empty();
+    return true;
   }
 
 
   bool
   visit(const CoordinateComponent& x)
   {
+    if (v.mSpatialConstraints->mCoordinateComponent.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCoordinateComponent.applyTo(m, x);
-    return !v.mSpatialConstraints->mCoordinateComponent.empty();
+    return true;
   }
 
 
   bool
   visit(const SampledFieldGeometry& x)
   {
+    if (v.mSpatialConstraints->mSampledFieldGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mSampledFieldGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mSampledFieldGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const SampledField& x)
   {
+    if (v.mSpatialConstraints->mSampledField.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mSampledField.applyTo(m, x);
-    return !v.mSpatialConstraints->mSampledField.empty();
+    return true;
   }
 
 
   bool
   visit(const SampledVolume& x)
   {
+    if (v.mSpatialConstraints->mSampledVolume.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mSampledVolume.applyTo(m, x);
-    return !v.mSpatialConstraints->mSampledVolume.empty();
+    return true;
   }
 
 
   bool
   visit(const AnalyticGeometry& x)
   {
+    if (v.mSpatialConstraints->mAnalyticGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mAnalyticGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mAnalyticGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const AnalyticVolume& x)
   {
+    if (v.mSpatialConstraints->mAnalyticVolume.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mAnalyticVolume.applyTo(m, x);
-    return !v.mSpatialConstraints->mAnalyticVolume.empty();
+    return true;
   }
 
 
   bool
   visit(const ParametricGeometry& x)
   {
+    if (v.mSpatialConstraints->mParametricGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mParametricGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mParametricGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const ParametricObject& x)
   {
+    if (v.mSpatialConstraints->mParametricObject.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mParametricObject.applyTo(m, x);
-    return !v.mSpatialConstraints->mParametricObject.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGeometry& x)
   {
+    if (v.mSpatialConstraints->mCSGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGObject& x)
   {
+    if (v.mSpatialConstraints->mCSGObject.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGObject.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGObject.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGNode& x)
   {
+    if (v.mSpatialConstraints->mCSGNode.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGNode.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGNode.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGTransformation& x)
   {
+    if (v.mSpatialConstraints->mCSGTransformation.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGTransformation.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGTransformation.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGTranslation& x)
   {
+    if (v.mSpatialConstraints->mCSGTranslation.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGTranslation.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGTranslation.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGRotation& x)
   {
+    if (v.mSpatialConstraints->mCSGRotation.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGRotation.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGRotation.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGScale& x)
   {
+    if (v.mSpatialConstraints->mCSGScale.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGScale.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGScale.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGHomogeneousTransformation& x)
   {
+    if (v.mSpatialConstraints->mCSGHomogeneousTransformation.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGHomogeneousTransformation.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGHomogeneousTransformation.empty();
+    return true;
   }
 
 
   bool
   visit(const TransformationComponent& x)
   {
+    if (v.mSpatialConstraints->mTransformationComponent.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mTransformationComponent.applyTo(m, x);
-    return !v.mSpatialConstraints->mTransformationComponent.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGPrimitive& x)
   {
+    if (v.mSpatialConstraints->mCSGPrimitive.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGPrimitive.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGPrimitive.empty();
+    return true;
   }
 
 
   bool
   visit(const CSGSetOperator& x)
   {
+    if (v.mSpatialConstraints->mCSGSetOperator.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mCSGSetOperator.applyTo(m, x);
-    return !v.mSpatialConstraints->mCSGSetOperator.empty();
+    return true;
   }
 
 
   bool
   visit(const SpatialSymbolReference& x)
   {
+    if (v.mSpatialConstraints->mSpatialSymbolReference.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mSpatialSymbolReference.applyTo(m, x);
-    return !v.mSpatialConstraints->mSpatialSymbolReference.empty();
+    return true;
   }
 
 
   bool
   visit(const DiffusionCoefficient& x)
   {
+    if (v.mSpatialConstraints->mDiffusionCoefficient.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mDiffusionCoefficient.applyTo(m, x);
-    return !v.mSpatialConstraints->mDiffusionCoefficient.empty();
+    return true;
   }
 
 
   bool
   visit(const AdvectionCoefficient& x)
   {
+    if (v.mSpatialConstraints->mAdvectionCoefficient.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mAdvectionCoefficient.applyTo(m, x);
-    return !v.mSpatialConstraints->mAdvectionCoefficient.empty();
+    return true;
   }
 
 
   bool
   visit(const BoundaryCondition& x)
   {
+    if (v.mSpatialConstraints->mBoundaryCondition.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mBoundaryCondition.applyTo(m, x);
-    return !v.mSpatialConstraints->mBoundaryCondition.empty();
+    return true;
   }
 
 
   bool
   visit(const Geometry& x)
   {
+    if (v.mSpatialConstraints->mGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const MixedGeometry& x)
   {
+    if (v.mSpatialConstraints->mMixedGeometry.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mMixedGeometry.applyTo(m, x);
-    return !v.mSpatialConstraints->mMixedGeometry.empty();
+    return true;
   }
 
 
   bool
   visit(const OrdinalMapping& x)
   {
+    if (v.mSpatialConstraints->mOrdinalMapping.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mOrdinalMapping.applyTo(m, x);
-    return !v.mSpatialConstraints->mOrdinalMapping.empty();
+    return true;
   }
 
 
   bool
   visit(const SpatialPoints& x)
   {
+    if (v.mSpatialConstraints->mSpatialPoints.empty())
+    {
+      return false;
+    }
+
     v.mSpatialConstraints->mSpatialPoints.applyTo(m, x);
-    return !v.mSpatialConstraints->mSpatialPoints.empty();
+    return true;
   }
 
 
@@ -740,157 +919,79 @@ public:
       return SBMLVisitor::visit(x);
     }
 
-    int code = x.getTypeCode();
-
-    const ListOf* list = dynamic_cast<const ListOf*>(&x);
-
-    if (list != NULL)
+    switch (x.getTypeCode())
     {
+    case SBML_SPATIAL_DOMAINTYPE:
+      return visit((const DomainType&)x);
+    case SBML_SPATIAL_DOMAIN:
+      return visit((const Domain&)x);
+    case SBML_SPATIAL_INTERIORPOINT:
+      return visit((const InteriorPoint&)x);
+    case SBML_SPATIAL_BOUNDARY:
+      return visit((const Boundary&)x);
+    case SBML_SPATIAL_ADJACENTDOMAINS:
+      return visit((const AdjacentDomains&)x);
+    case SBML_SPATIAL_GEOMETRYDEFINITION:
+      return visit((const GeometryDefinition&)x);
+    case SBML_SPATIAL_COMPARTMENTMAPPING:
+      return visit((const CompartmentMapping&)x);
+    case SBML_SPATIAL_COORDINATECOMPONENT:
+      return visit((const CoordinateComponent&)x);
+    case SBML_SPATIAL_SAMPLEDFIELDGEOMETRY:
+      return visit((const SampledFieldGeometry&)x);
+    case SBML_SPATIAL_SAMPLEDFIELD:
+      return visit((const SampledField&)x);
+    case SBML_SPATIAL_SAMPLEDVOLUME:
+      return visit((const SampledVolume&)x);
+    case SBML_SPATIAL_ANALYTICGEOMETRY:
+      return visit((const AnalyticGeometry&)x);
+    case SBML_SPATIAL_ANALYTICVOLUME:
+      return visit((const AnalyticVolume&)x);
+    case SBML_SPATIAL_PARAMETRICGEOMETRY:
+      return visit((const ParametricGeometry&)x);
+    case SBML_SPATIAL_PARAMETRICOBJECT:
+      return visit((const ParametricObject&)x);
+    case SBML_SPATIAL_CSGEOMETRY:
+      return visit((const CSGeometry&)x);
+    case SBML_SPATIAL_CSGOBJECT:
+      return visit((const CSGObject&)x);
+    case SBML_SPATIAL_CSGNODE:
+      return visit((const CSGNode&)x);
+    case SBML_SPATIAL_CSGTRANSFORMATION:
+      return visit((const CSGTransformation&)x);
+    case SBML_SPATIAL_CSGTRANSLATION:
+      return visit((const CSGTranslation&)x);
+    case SBML_SPATIAL_CSGROTATION:
+      return visit((const CSGRotation&)x);
+    case SBML_SPATIAL_CSGSCALE:
+      return visit((const CSGScale&)x);
+    case SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION:
+      return visit((const CSGHomogeneousTransformation&)x);
+    case SBML_SPATIAL_TRANSFORMATIONCOMPONENT:
+      return visit((const TransformationComponent&)x);
+    case SBML_SPATIAL_CSGPRIMITIVE:
+      return visit((const CSGPrimitive&)x);
+    case SBML_SPATIAL_CSGSETOPERATOR:
+      return visit((const CSGSetOperator&)x);
+    case SBML_SPATIAL_SPATIALSYMBOLREFERENCE:
+      return visit((const SpatialSymbolReference&)x);
+    case SBML_SPATIAL_DIFFUSIONCOEFFICIENT:
+      return visit((const DiffusionCoefficient&)x);
+    case SBML_SPATIAL_ADVECTIONCOEFFICIENT:
+      return visit((const AdvectionCoefficient&)x);
+    case SBML_SPATIAL_BOUNDARYCONDITION:
+      return visit((const BoundaryCondition&)x);
+    case SBML_SPATIAL_GEOMETRY:
+      return visit((const Geometry&)x);
+    case SBML_SPATIAL_MIXEDGEOMETRY:
+      return visit((const MixedGeometry&)x);
+    case SBML_SPATIAL_ORDINALMAPPING:
+      return visit((const OrdinalMapping&)x);
+    case SBML_SPATIAL_SPATIALPOINTS:
+      return visit((const SpatialPoints&)x);
+    default:
       return SBMLVisitor::visit(x);
     }
-    else
-    {
-      if (code == SBML_SPATIAL_DOMAINTYPE)
-      {
-        return visit((const DomainType&)x);
-      }
-      else if (code == SBML_SPATIAL_DOMAIN)
-      {
-        return visit((const Domain&)x);
-      }
-      else if (code == SBML_SPATIAL_INTERIORPOINT)
-      {
-        return visit((const InteriorPoint&)x);
-      }
-      else if (code == SBML_SPATIAL_BOUNDARY)
-      {
-        return visit((const Boundary&)x);
-      }
-      else if (code == SBML_SPATIAL_ADJACENTDOMAINS)
-      {
-        return visit((const AdjacentDomains&)x);
-      }
-      else if (code == SBML_SPATIAL_GEOMETRYDEFINITION)
-      {
-        return visit((const GeometryDefinition&)x);
-      }
-      else if (code == SBML_SPATIAL_COMPARTMENTMAPPING)
-      {
-        return visit((const CompartmentMapping&)x);
-      }
-      else if (code == SBML_SPATIAL_COORDINATECOMPONENT)
-      {
-        return visit((const CoordinateComponent&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDFIELDGEOMETRY)
-      {
-        return visit((const SampledFieldGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDFIELD)
-      {
-        return visit((const SampledField&)x);
-      }
-      else if (code == SBML_SPATIAL_SAMPLEDVOLUME)
-      {
-        return visit((const SampledVolume&)x);
-      }
-      else if (code == SBML_SPATIAL_ANALYTICGEOMETRY)
-      {
-        return visit((const AnalyticGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_ANALYTICVOLUME)
-      {
-        return visit((const AnalyticVolume&)x);
-      }
-      else if (code == SBML_SPATIAL_PARAMETRICGEOMETRY)
-      {
-        return visit((const ParametricGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_PARAMETRICOBJECT)
-      {
-        return visit((const ParametricObject&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGEOMETRY)
-      {
-        return visit((const CSGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGOBJECT)
-      {
-        return visit((const CSGObject&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGNODE)
-      {
-        return visit((const CSGNode&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGTRANSFORMATION)
-      {
-        return visit((const CSGTransformation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGTRANSLATION)
-      {
-        return visit((const CSGTranslation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGROTATION)
-      {
-        return visit((const CSGRotation&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGSCALE)
-      {
-        return visit((const CSGScale&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGHOMOGENEOUSTRANSFORMATION)
-      {
-        return visit((const CSGHomogeneousTransformation&)x);
-      }
-      else if (code == SBML_SPATIAL_TRANSFORMATIONCOMPONENT)
-      {
-        return visit((const TransformationComponent&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGPRIMITIVE)
-      {
-        return visit((const CSGPrimitive&)x);
-      }
-      else if (code == SBML_SPATIAL_CSGSETOPERATOR)
-      {
-        return visit((const CSGSetOperator&)x);
-      }
-      else if (code == SBML_SPATIAL_SPATIALSYMBOLREFERENCE)
-      {
-        return visit((const SpatialSymbolReference&)x);
-      }
-      else if (code == SBML_SPATIAL_DIFFUSIONCOEFFICIENT)
-      {
-        return visit((const DiffusionCoefficient&)x);
-      }
-      else if (code == SBML_SPATIAL_ADVECTIONCOEFFICIENT)
-      {
-        return visit((const AdvectionCoefficient&)x);
-      }
-      else if (code == SBML_SPATIAL_BOUNDARYCONDITION)
-      {
-        return visit((const BoundaryCondition&)x);
-      }
-      else if (code == SBML_SPATIAL_GEOMETRY)
-      {
-        return visit((const Geometry&)x);
-      }
-      else if (code == SBML_SPATIAL_MIXEDGEOMETRY)
-      {
-        return visit((const MixedGeometry&)x);
-      }
-      else if (code == SBML_SPATIAL_ORDINALMAPPING)
-      {
-        return visit((const OrdinalMapping&)x);
-      }
-      else if (code == SBML_SPATIAL_SPATIALPOINTS)
-      {
-        return visit((const SpatialPoints&)x);
-      }
-      else
-      {
-        return SBMLVisitor::visit(x);
-      }
-    }
   }
 
 
@@ -901,6 +1002,36 @@ protected:
 };
 
 
+// -------------------------------------------
+// ElementCollector
+// -------------------------------------------
+/**
+ * Lists the spatial elements of a document in the order the ValidatingVisitor
+ * would visit them.
+ */
+
+class SpatialElementCollector: public SBMLVisitor
+{
+public:
+
+  using SBMLVisitor::visit;
+
+  virtual bool
+  visit(const SBase& x)
+  {
+    if (x.getPackageName() == "spatial" && x.getTypeCode() != SBML_LIST_OF)
+    {
+      elements.push_back(&x);
+    }
+
+    return true;
+  }
+
+
+  std::vector<const SBase*> elements;
+};
+
+
 // -------------------------------------------
 // SpatialValidator
 // -------------------------------------------
@@ -910,6 +1041,9 @@ protected:
  */
 SpatialValidator::SpatialValidator(SBMLErrorCategory_t category)
   : Validator(category)
+  , mNumThreads(1)
+  , mUsesIdIndex(false)
+  , mIdIndex(NULL)
 {
   mSpatialConstraints = new SpatialValidatorConstraints();
 }
@@ -934,54 +1068,848 @@ SpatialValidator::addConstraint(VConstraint* c)
 }
 
 
+
+/** @cond doxygenLibsbmlInternal */
+
 /*
- * Validates the given SBMLDocument
+ * Adds the given constraint on SBMLDocument objects straight to the
+ * ConstraintSet for SBMLDocument.
  */
-unsigned int
-SpatialValidator::validate(const SBMLDocument& d)
+void
+SpatialValidator::addConstraint(TConstraint<SBMLDocument>* c)
 {
-  const Model* m = d.getModel();
+  mSpatialConstraints->add(mSpatialConstraints->mSBMLDocument, c);
+}
 
-  if (m != NULL)
-  {
-    SpatialValidatingVisitor vv(*this, *m);
-    const SpatialSBMLDocumentPlugin* plugin = static_cast<const
-      SpatialSBMLDocumentPlugin*>(d.getPlugin("spatial"));
-    if (plugin != NULL)
-    {
-      plugin->accept(vv);
-    }
-  }
+/** @endcond */
 
-  // ADD ANY OTHER OBJECTS THAT HAS PLUGINS
 
-  return (unsigned int)(mFailures.size());
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Model objects straight to the ConstraintSet for
+ * Model.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Model>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mModel, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on DomainType objects straight to the
+ * ConstraintSet for DomainType.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<DomainType>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mDomainType, c);
 }
 
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
 
 /*
- * Validates the SBMLDocument located at the given filename
+ * Adds the given constraint on Domain objects straight to the ConstraintSet
+ * for Domain.
  */
-unsigned int
-SpatialValidator::validate(const std::string& filename)
+void
+SpatialValidator::addConstraint(TConstraint<Domain>* c)
 {
-  SBMLReader reader;
-  SBMLDocument* d = reader.readSBML(filename);
+  mSpatialConstraints->add(mSpatialConstraints->mDomain, c);
+}
 
+/** @endcond */
 
-  unsigned int numErrors = d->getNumErrors();
 
 
-  for (unsigned int n=0; n < numErrors; ++n)
-  {
-    logFailure(*d->getError(n));
-  }
+/** @cond doxygenLibsbmlInternal */
 
-  numErrors = validate(*d);
-  delete d;
-  return numErrors;
+/*
+ * Adds the given constraint on InteriorPoint objects straight to the
+ * ConstraintSet for InteriorPoint.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<InteriorPoint>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mInteriorPoint, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Boundary objects straight to the ConstraintSet
+ * for Boundary.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Boundary>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mBoundary, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on AdjacentDomains objects straight to the
+ * ConstraintSet for AdjacentDomains.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AdjacentDomains>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mAdjacentDomains, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on GeometryDefinition objects straight to the
+ * ConstraintSet for GeometryDefinition.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<GeometryDefinition>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mGeometryDefinition, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CompartmentMapping objects straight to the
+ * ConstraintSet for CompartmentMapping.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CompartmentMapping>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCompartmentMapping, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CoordinateComponent objects straight to the
+ * ConstraintSet for CoordinateComponent.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CoordinateComponent>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCoordinateComponent, c);
 }
 
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SampledFieldGeometry objects straight to the
+ * ConstraintSet for SampledFieldGeometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledFieldGeometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mSampledFieldGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SampledField objects straight to the
+ * ConstraintSet for SampledField.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledField>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mSampledField, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SampledVolume objects straight to the
+ * ConstraintSet for SampledVolume.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SampledVolume>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mSampledVolume, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on AnalyticGeometry objects straight to the
+ * ConstraintSet for AnalyticGeometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AnalyticGeometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mAnalyticGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on AnalyticVolume objects straight to the
+ * ConstraintSet for AnalyticVolume.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AnalyticVolume>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mAnalyticVolume, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on ParametricGeometry objects straight to the
+ * ConstraintSet for ParametricGeometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<ParametricGeometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mParametricGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on ParametricObject objects straight to the
+ * ConstraintSet for ParametricObject.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<ParametricObject>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mParametricObject, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGeometry objects straight to the
+ * ConstraintSet for CSGeometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGeometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGObject objects straight to the ConstraintSet
+ * for CSGObject.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGObject>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGObject, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGNode objects straight to the ConstraintSet
+ * for CSGNode.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGNode>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGNode, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGTransformation objects straight to the
+ * ConstraintSet for CSGTransformation.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGTransformation>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGTransformation, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGTranslation objects straight to the
+ * ConstraintSet for CSGTranslation.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGTranslation>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGTranslation, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGRotation objects straight to the
+ * ConstraintSet for CSGRotation.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGRotation>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGRotation, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGScale objects straight to the ConstraintSet
+ * for CSGScale.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGScale>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGScale, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGHomogeneousTransformation objects straight
+ * to the ConstraintSet for CSGHomogeneousTransformation.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGHomogeneousTransformation>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGHomogeneousTransformation,
+    c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on TransformationComponent objects straight to the
+ * ConstraintSet for TransformationComponent.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<TransformationComponent>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mTransformationComponent, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGPrimitive objects straight to the
+ * ConstraintSet for CSGPrimitive.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGPrimitive>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGPrimitive, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on CSGSetOperator objects straight to the
+ * ConstraintSet for CSGSetOperator.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<CSGSetOperator>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mCSGSetOperator, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SpatialSymbolReference objects straight to the
+ * ConstraintSet for SpatialSymbolReference.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SpatialSymbolReference>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mSpatialSymbolReference, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on DiffusionCoefficient objects straight to the
+ * ConstraintSet for DiffusionCoefficient.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<DiffusionCoefficient>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mDiffusionCoefficient, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on AdvectionCoefficient objects straight to the
+ * ConstraintSet for AdvectionCoefficient.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<AdvectionCoefficient>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mAdvectionCoefficient, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on BoundaryCondition objects straight to the
+ * ConstraintSet for BoundaryCondition.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<BoundaryCondition>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mBoundaryCondition, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on Geometry objects straight to the ConstraintSet
+ * for Geometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<Geometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on MixedGeometry objects straight to the
+ * ConstraintSet for MixedGeometry.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<MixedGeometry>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mMixedGeometry, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on OrdinalMapping objects straight to the
+ * ConstraintSet for OrdinalMapping.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<OrdinalMapping>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mOrdinalMapping, c);
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Adds the given constraint on SpatialPoints objects straight to the
+ * ConstraintSet for SpatialPoints.
+ */
+void
+SpatialValidator::addConstraint(TConstraint<SpatialPoints>* c)
+{
+  mSpatialConstraints->add(mSpatialConstraints->mSpatialPoints, c);
+}
+
+/** @endcond */
+
+
+/*
+ * Validates the given SBMLDocument
+ */
+unsigned int
+SpatialValidator::validate(const SBMLDocument& d)
+{
+  const Model* m = d.getModel();
+
+  if (m != NULL)
+  {
+    // an index shared by the caller is used as it is
+
+    map<string, const SBase*> index;
+
+    if (mIdIndex == NULL)
+    {
+      shareIdIndex(index, *m);
+    }
+
+    const SpatialSBMLDocumentPlugin* plugin = static_cast<const
+      SpatialSBMLDocumentPlugin*>(d.getPlugin("spatial"));
+
+    if (plugin != NULL && mNumThreads > 1)
+    {
+      SpatialElementCollector collector;
+      plugin->accept(collector);
+      validateElements(*m, collector.elements);
+    }
+    else if (plugin != NULL)
+    {
+      SpatialValidatingVisitor vv(*this, *m);
+      plugin->accept(vv);
+    }
+  }
+
+  // ADD ANY OTHER OBJECTS THAT HAS PLUGINS
+
+  mIdIndex = NULL;
+  return (unsigned int)(mFailures.size());
+}
+
+
+/*
+ * Validates the SBMLDocument located at the given filename
+ */
+unsigned int
+SpatialValidator::validate(const std::string& filename)
+{
+  SBMLReader reader;
+  SBMLDocument* d = reader.readSBML(filename);
+
+
+  unsigned int numErrors = d->getNumErrors();
+
+
+  for (unsigned int n=0; n < numErrors; ++n)
+  {
+    logFailure(*d->getError(n));
+  }
+
+  numErrors = validate(*d);
+  delete d;
+  return numErrors;
+}
+
+
+/*
+ * Sets the number of threads used to validate the elements of a document.
+ */
+void
+SpatialValidator::setNumThreads(unsigned int numThreads)
+{
+  mNumThreads = (numThreads > 0) ? numThreads : 1;
+}
+
+
+/*
+ * Returns the number of threads used to validate the elements of a document.
+ */
+unsigned int
+SpatialValidator::getNumThreads() const
+{
+  return mNumThreads;
+}
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the element of the Model being validated with the given identifier.
+ */
+const SBase*
+SpatialValidator::getIndexedElement(const std::string& id) const
+{
+  if (mIdIndex == NULL)
+  {
+    return NULL;
+  }
+
+  map<string, const SBase*>::const_iterator it = mIdIndex->find(id);
+  return (it != mIdIndex->end()) ? it->second : NULL;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Makes the next validation use the given index of the elements of the Model
+ * by identifier.
+ */
+void
+SpatialValidator::shareIdIndex(std::map<std::string, const SBase*>& index,
+                               const Model& m)
+{
+  if (mUsesIdIndex == false)
+  {
+    return;
+  }
+
+  if (index.empty())
+  {
+    indexIds(m, index);
+  }
+
+  mIdIndex = &index;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Creates a validator with the same constraints as this one to validate part
+ * of a document on another thread.
+ */
+SpatialValidator*
+SpatialValidator::createWorker() const
+{
+  return NULL;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Validates the given elements, in document order, using up to getNumThreads()
+ * workers.
+ */
+void
+SpatialValidator::validateElements(const Model& m,
+                                   const std::vector<const SBase*>& elements)
+{
+  unsigned int numElements = (unsigned int)(elements.size());
+  unsigned int numWorkers = (mNumThreads < numElements) ? mNumThreads :
+    numElements;
+  std::vector<SpatialValidator*> workers;
+
+  for (unsigned int k = 0; k < numWorkers; k++)
+  {
+    SpatialValidator* worker = createWorker();
+    if (worker == NULL) break;
+    worker->mIdIndex = mIdIndex;
+    workers.push_back(worker);
+  }
+
+  // without a full set of workers validate here in turn
+  if (workers.size() < numWorkers || numWorkers < 2)
+  {
+    for (unsigned int k = 0; k < workers.size(); k++)
+    {
+      delete workers[k];
+    }
+
+    SpatialValidatingVisitor vv(*this, m);
+    for (unsigned int i = 0; i < numElements; i++)
+    {
+      vv.visit(*elements[i]);
+    }
+    return;
+  }
+
+  // each worker takes a contiguous run of elements
+  int count = (int)(numWorkers);
+  #ifdef _OPENMP
+  #pragma omp parallel for num_threads(count) schedule(static, 1)
+  #endif
+  for (int k = 0; k < count; k++)
+  {
+    size_t first = (size_t)(numElements) * k / count;
+    size_t last = (size_t)(numElements) * (k + 1) / count;
+    SpatialValidatingVisitor vv(*workers[k], m);
+    for (size_t i = first; i < last; i++)
+    {
+      vv.visit(*elements[i]);
+    }
+  }
+
+  // the runs are merged in order so the failures match a serial run
+  for (int k = 0; k < count; k++)
+  {
+    const std::list<SBMLError>& failures = workers[k]->getFailures();
+    std::list<SBMLError>::const_iterator it;
+    for (it = failures.begin(); it != failures.end(); ++it)
+    {
+      logFailure(*it);
+    }
+    delete workers[k];
+  }
+}
+
+
+/** @endcond */
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Indexes the elements of the given Model by identifier.
+ */
+void
+SpatialValidator::indexIds(const Model& m,
+                           std::map<std::string, const SBase*>& index) const
+{
+  index.clear();
+  List* elements = const_cast<Model&>(m).getAllElements();
+
+  while (elements->getSize() > 0)
+  {
+    const SBase* element = static_cast<const SBase*>(elements->remove(0));
+    int type = element->getTypeCode();
+    bool core = element->getPackageName() == "core";
+    // unit definitions and the parameters of a kinetic law
+    // are not in the global SId namespace
+
+    if (core && (type == SBML_UNIT_DEFINITION || type == SBML_LOCAL_PARAMETER))
+    {
+      continue;
+    }
+
+    if (element->getAncestorOfType(SBML_KINETIC_LAW) != NULL)
+    {
+      continue;
+    }
+
+    if (element->isSetIdAttribute())
+    {
+      index.insert(pair<string, const SBase*>(element->getIdAttribute(),
+        element));
+    }
+  }
+
+  delete elements;
+}
+
+/** @endcond */
+
 
 
 
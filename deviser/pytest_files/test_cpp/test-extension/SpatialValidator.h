@@ -67,7 +67,9 @@
 /** @cond doxygenLibsbmlInternal */
 
 #include <list>
+#include <map>
 #include <string>
+#include <vector>
 
 /** @endcond */
 
@@ -82,6 +84,44 @@ LIBSBML_CPP_NAMESPACE_BEGIN
 class VConstraint;
 struct SpatialValidatorConstraints;
 class SBMLDocument;
+class SBase;
+class Model;
+class DomainType;
+class Domain;
+class InteriorPoint;
+class Boundary;
+class AdjacentDomains;
+class GeometryDefinition;
+class CompartmentMapping;
+class CoordinateComponent;
+class SampledFieldGeometry;
+class SampledField;
+class SampledVolume;
+class AnalyticGeometry;
+class AnalyticVolume;
+class ParametricGeometry;
+class ParametricObject;
+class CSGeometry;
+class CSGObject;
+class CSGNode;
+class CSGTransformation;
+class CSGTranslation;
+class CSGRotation;
+class CSGScale;
+class CSGHomogeneousTransformation;
+class TransformationComponent;
+class CSGPrimitive;
+class CSGSetOperator;
+class SpatialSymbolReference;
+class DiffusionCoefficient;
+class AdvectionCoefficient;
+class BoundaryCondition;
+class Geometry;
+class MixedGeometry;
+class OrdinalMapping;
+class SpatialPoints;
+
+template <typename T> class TConstraint;
 
 
 class SpatialValidator : public Validator
@@ -121,6 +161,510 @@ public:
   virtual void addConstraint(VConstraint* c);
 
 
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SBMLDocument objects straight to the
+   * ConstraintSet for SBMLDocument.
+   *
+   * @param c the TConstraint<SBMLDocument> object to add.
+   */
+  void addConstraint(TConstraint<SBMLDocument>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Model objects straight to the ConstraintSet
+   * for Model.
+   *
+   * @param c the TConstraint<Model> object to add.
+   */
+  void addConstraint(TConstraint<Model>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on DomainType objects straight to the
+   * ConstraintSet for DomainType.
+   *
+   * @param c the TConstraint<DomainType> object to add.
+   */
+  void addConstraint(TConstraint<DomainType>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Domain objects straight to the ConstraintSet
+   * for Domain.
+   *
+   * @param c the TConstraint<Domain> object to add.
+   */
+  void addConstraint(TConstraint<Domain>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on InteriorPoint objects straight to the
+   * ConstraintSet for InteriorPoint.
+   *
+   * @param c the TConstraint<InteriorPoint> object to add.
+   */
+  void addConstraint(TConstraint<InteriorPoint>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Boundary objects straight to the
+   * ConstraintSet for Boundary.
+   *
+   * @param c the TConstraint<Boundary> object to add.
+   */
+  void addConstraint(TConstraint<Boundary>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on AdjacentDomains objects straight to the
+   * ConstraintSet for AdjacentDomains.
+   *
+   * @param c the TConstraint<AdjacentDomains> object to add.
+   */
+  void addConstraint(TConstraint<AdjacentDomains>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on GeometryDefinition objects straight to the
+   * ConstraintSet for GeometryDefinition.
+   *
+   * @param c the TConstraint<GeometryDefinition> object to add.
+   */
+  void addConstraint(TConstraint<GeometryDefinition>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CompartmentMapping objects straight to the
+   * ConstraintSet for CompartmentMapping.
+   *
+   * @param c the TConstraint<CompartmentMapping> object to add.
+   */
+  void addConstraint(TConstraint<CompartmentMapping>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CoordinateComponent objects straight to the
+   * ConstraintSet for CoordinateComponent.
+   *
+   * @param c the TConstraint<CoordinateComponent> object to add.
+   */
+  void addConstraint(TConstraint<CoordinateComponent>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SampledFieldGeometry objects straight to the
+   * ConstraintSet for SampledFieldGeometry.
+   *
+   * @param c the TConstraint<SampledFieldGeometry> object to add.
+   */
+  void addConstraint(TConstraint<SampledFieldGeometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SampledField objects straight to the
+   * ConstraintSet for SampledField.
+   *
+   * @param c the TConstraint<SampledField> object to add.
+   */
+  void addConstraint(TConstraint<SampledField>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SampledVolume objects straight to the
+   * ConstraintSet for SampledVolume.
+   *
+   * @param c the TConstraint<SampledVolume> object to add.
+   */
+  void addConstraint(TConstraint<SampledVolume>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on AnalyticGeometry objects straight to the
+   * ConstraintSet for AnalyticGeometry.
+   *
+   * @param c the TConstraint<AnalyticGeometry> object to add.
+   */
+  void addConstraint(TConstraint<AnalyticGeometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on AnalyticVolume objects straight to the
+   * ConstraintSet for AnalyticVolume.
+   *
+   * @param c the TConstraint<AnalyticVolume> object to add.
+   */
+  void addConstraint(TConstraint<AnalyticVolume>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on ParametricGeometry objects straight to the
+   * ConstraintSet for ParametricGeometry.
+   *
+   * @param c the TConstraint<ParametricGeometry> object to add.
+   */
+  void addConstraint(TConstraint<ParametricGeometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on ParametricObject objects straight to the
+   * ConstraintSet for ParametricObject.
+   *
+   * @param c the TConstraint<ParametricObject> object to add.
+   */
+  void addConstraint(TConstraint<ParametricObject>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGeometry objects straight to the
+   * ConstraintSet for CSGeometry.
+   *
+   * @param c the TConstraint<CSGeometry> object to add.
+   */
+  void addConstraint(TConstraint<CSGeometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGObject objects straight to the
+   * ConstraintSet for CSGObject.
+   *
+   * @param c the TConstraint<CSGObject> object to add.
+   */
+  void addConstraint(TConstraint<CSGObject>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGNode objects straight to the ConstraintSet
+   * for CSGNode.
+   *
+   * @param c the TConstraint<CSGNode> object to add.
+   */
+  void addConstraint(TConstraint<CSGNode>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGTransformation objects straight to the
+   * ConstraintSet for CSGTransformation.
+   *
+   * @param c the TConstraint<CSGTransformation> object to add.
+   */
+  void addConstraint(TConstraint<CSGTransformation>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGTranslation objects straight to the
+   * ConstraintSet for CSGTranslation.
+   *
+   * @param c the TConstraint<CSGTranslation> object to add.
+   */
+  void addConstraint(TConstraint<CSGTranslation>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGRotation objects straight to the
+   * ConstraintSet for CSGRotation.
+   *
+   * @param c the TConstraint<CSGRotation> object to add.
+   */
+  void addConstraint(TConstraint<CSGRotation>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGScale objects straight to the
+   * ConstraintSet for CSGScale.
+   *
+   * @param c the TConstraint<CSGScale> object to add.
+   */
+  void addConstraint(TConstraint<CSGScale>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGHomogeneousTransformation objects straight
+   * to the ConstraintSet for CSGHomogeneousTransformation.
+   *
+   * @param c the TConstraint<CSGHomogeneousTransformation> object to add.
+   */
+  void addConstraint(TConstraint<CSGHomogeneousTransformation>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on TransformationComponent objects straight to
+   * the ConstraintSet for TransformationComponent.
+   *
+   * @param c the TConstraint<TransformationComponent> object to add.
+   */
+  void addConstraint(TConstraint<TransformationComponent>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGPrimitive objects straight to the
+   * ConstraintSet for CSGPrimitive.
+   *
+   * @param c the TConstraint<CSGPrimitive> object to add.
+   */
+  void addConstraint(TConstraint<CSGPrimitive>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on CSGSetOperator objects straight to the
+   * ConstraintSet for CSGSetOperator.
+   *
+   * @param c the TConstraint<CSGSetOperator> object to add.
+   */
+  void addConstraint(TConstraint<CSGSetOperator>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SpatialSymbolReference objects straight to
+   * the ConstraintSet for SpatialSymbolReference.
+   *
+   * @param c the TConstraint<SpatialSymbolReference> object to add.
+   */
+  void addConstraint(TConstraint<SpatialSymbolReference>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on DiffusionCoefficient objects straight to the
+   * ConstraintSet for DiffusionCoefficient.
+   *
+   * @param c the TConstraint<DiffusionCoefficient> object to add.
+   */
+  void addConstraint(TConstraint<DiffusionCoefficient>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on AdvectionCoefficient objects straight to the
+   * ConstraintSet for AdvectionCoefficient.
+   *
+   * @param c the TConstraint<AdvectionCoefficient> object to add.
+   */
+  void addConstraint(TConstraint<AdvectionCoefficient>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on BoundaryCondition objects straight to the
+   * ConstraintSet for BoundaryCondition.
+   *
+   * @param c the TConstraint<BoundaryCondition> object to add.
+   */
+  void addConstraint(TConstraint<BoundaryCondition>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on Geometry objects straight to the
+   * ConstraintSet for Geometry.
+   *
+   * @param c the TConstraint<Geometry> object to add.
+   */
+  void addConstraint(TConstraint<Geometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on MixedGeometry objects straight to the
+   * ConstraintSet for MixedGeometry.
+   *
+   * @param c the TConstraint<MixedGeometry> object to add.
+   */
+  void addConstraint(TConstraint<MixedGeometry>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on OrdinalMapping objects straight to the
+   * ConstraintSet for OrdinalMapping.
+   *
+   * @param c the TConstraint<OrdinalMapping> object to add.
+   */
+  void addConstraint(TConstraint<OrdinalMapping>* c);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Adds the given constraint on SpatialPoints objects straight to the
+   * ConstraintSet for SpatialPoints.
+   *
+   * @param c the TConstraint<SpatialPoints> object to add.
+   */
+  void addConstraint(TConstraint<SpatialPoints>* c);
+
+  /** @endcond */
+
+
   /**
    * Validates the given SBMLDocument
    *
@@ -143,11 +687,118 @@ public:
   virtual unsigned int validate(const std::string& filename);
 
 
+  /**
+   * Sets the number of threads used to validate the elements of a document.
+   *
+   * @param numThreads the number of threads to use; values less than 2
+   * validate the document serially, which is the default.
+   *
+   * The elements are split into contiguous runs, one for each thread, and the
+   * failures are reported in document order just as they would be by a serial
+   * validation. Threads are only used when the library is built with OpenMP.
+   * The threads only read the document, which must not be changed while it is
+   * validated; array text kept to be parsed on first use is parsed by one
+   * thread at a time.
+   */
+  void setNumThreads(unsigned int numThreads);
+
+
+  /**
+   * Returns the number of threads used to validate the elements of a document.
+   *
+   * @return the number of threads.
+   */
+  unsigned int getNumThreads() const;
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Returns the element of the Model being validated with the given
+   * identifier.
+   *
+   * @param id the identifier of the element to return.
+   *
+   * @return the element with the given identifier, or @c NULL if there is no
+   * such element.
+   *
+   * Constraints use this to resolve references; the index is built once at the
+   * start of each validation rather than the Model being searched for each
+   * reference, and only if a constraint of this validator resolves references.
+   */
+  const SBase* getIndexedElement(const std::string& id) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenLibsbmlInternal */
+
+  /**
+   * Makes the next validation use the given index of the elements of the Model
+   * by identifier.
+   *
+   * @param index the index, which is filled from @p m first if it is empty;
+   * the caller keeps it.
+   *
+   * @param m the Model to be validated.
+   *
+   * Nothing is done if no constraint of this validator resolves references.
+   * Validators of the same document may share one index, so that the Model is
+   * only indexed once however many of them need it.
+   */
+  void shareIdIndex(std::map<std::string, const SBase*>& index, const Model&
+    m);
+
+  /** @endcond */
+
+
 protected:
 
   /** @cond doxygenLibsbmlInternal */
 
+  /**
+   * Creates a validator with the same constraints as this one to validate part
+   * of a document on another thread.
+   *
+   * @return the new validator, owned by the caller, or @c NULL if this
+   * validator cannot be copied; the document is then validated serially.
+   */
+  virtual SpatialValidator* createWorker() const;
+
+
+  /**
+   * Validates the given elements, in document order, using up to
+   * getNumThreads() workers.
+   *
+   * @param m the Model containing the elements.
+   *
+   * @param elements the elements to validate.
+   */
+  void validateElements(const Model& m,
+                        const std::vector<const SBase*>& elements);
+
+
+  /**
+   * Indexes the elements of the given Model by identifier.
+   *
+   * @param m the Model to index.
+   *
+   * @param index the index to fill.
+   *
+   * Only elements whose identifiers are in the global SId namespace are
+   * indexed, so that a UnitDefinition or a LocalParameter never hides the
+   * element a reference resolves to.
+   */
+  void indexIds(const Model& m,
+                std::map<std::string, const SBase*>& index) const;
+
+
   SpatialValidatorConstraints* mSpatialConstraints;
+  unsigned int mNumThreads;
+  bool mUsesIdIndex;
+  const std::map<std::string, const SBase*>* mIdIndex;
 
   friend class SpatialValidatingVisitor;
 
@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -216,7 +217,7 @@ TestcaseExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -329,18 +330,31 @@ TestcaseExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize =
     sizeof(testcaseErrorTable)/sizeof(testcaseErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == testcaseErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (testcaseErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && testcaseErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -442,15 +456,45 @@ LIBSBML_EXTERN
 Enum_t
 Enum_fromString(const char* code)
 {
-  static int size = sizeof(SBML_ENUM_STRINGS)/sizeof(SBML_ENUM_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_ENUM_INVALID;
+  }
+
+  return Enum_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #Enum_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_ENUM_INVALID, Enum_t}
+ * if there is no such match.
+ */
+LIBSBML_EXTERN
+Enum_t
+Enum_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return TEST_ENUM_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  switch (length)
   {
-    if (type == SBML_ENUM_STRINGS[i])
+  case 3:
+    if (memcmp(code, "One", 3) == 0)
     {
-      return (Enum_t)(i);
+      return TEST_ENUM_ONE;
     }
+
+    if (memcmp(code, "Two", 3) == 0)
+    {
+      return TEST_ENUM_TWO;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_ENUM_INVALID;
@@ -527,15 +571,47 @@ LIBSBML_EXTERN
 Fred_t
 Fred_fromString(const char* code)
 {
-  static int size = sizeof(SBML_FRED_STRINGS)/sizeof(SBML_FRED_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_FRED_INVALID;
+  }
+
+  return Fred_fromStringWithLength(code, strlen(code));
+}
+
 
-  for (int i = 0; i < size; i++)
+/*
+ * Returns the #Fred_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_FRED_INVALID, Fred_t}
+ * if there is no such match.
+ */
+LIBSBML_EXTERN
+Fred_t
+Fred_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return TEST_FRED_INVALID;
+  }
+
+  switch (length)
   {
-    if (type == SBML_FRED_STRINGS[i])
+  case 3:
+    if (memcmp(code, "tom", 3) == 0)
     {
-      return (Fred_t)(i);
+      return TEST_FRED_T_TOM;
     }
+
+    break;
+  case 4:
+    if (memcmp(code, "dick", 4) == 0)
+    {
+      return TEST_FRED_T_DICK;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_FRED_INVALID;
@@ -613,16 +689,49 @@ LIBSBML_EXTERN
 ExtraLong_t
 ExtraLong_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_EXTRA_LONG_STRINGS)/sizeof(SBML_EXTRA_LONG_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return TEST_EXTRALONG_INVALID;
+  }
 
-  for (int i = 0; i < size; i++)
+  return ExtraLong_fromStringWithLength(code, strlen(code));
+}
+
+
+/*
+ * Returns the #ExtraLong_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_EXTRALONG_INVALID,
+ * ExtraLong_t} if there is no such match.
+ */
+LIBSBML_EXTERN
+ExtraLong_t
+ExtraLong_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
   {
-    if (type == SBML_EXTRA_LONG_STRINGS[i])
+    return TEST_EXTRALONG_INVALID;
+  }
+
+  switch (length)
+  {
+  case 73:
+    if (memcmp(code, "http://identifiers.org/combine.specifications/sbgn.pd.level-1.version-1.3",
+      73) == 0)
     {
-      return (ExtraLong_t)(i);
+      return TEST_EXTRALONG_FRANK;
     }
+
+    break;
+  case 142:
+    if (memcmp(code, "sarahasdfghjklkjhgfdsasdfghjhjklqwertyqwrtyhgfdssfghkjakakalkalklpoiutytrewhhhhhhhsshshshshshhshshhshhshhsssssssssssaaevenlongerlongerlongeraZ",
+      142) == 0)
+    {
+      return TEST_EXTRALONG_SARAH;
+    }
+
+    break;
+  default:
+    break;
   }
 
   return TEST_EXTRALONG_INVALID;
@@ -465,6 +465,31 @@ Enum_t
 Enum_fromString(const char* code);
 
 
+/**
+ * Returns the #Enum_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_ENUM_INVALID, Enum_t}
+ * if there is no such match.
+ *
+ * @param code the string to convert to a #Enum_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #Enum_t or @sbmlconstant{TEST_ENUM_INVALID,
+ * Enum_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Test_t
+ * @endif
+ */
+LIBSBML_EXTERN
+Enum_t
+Enum_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #Enum_t is valid.
@@ -578,6 +603,31 @@ Fred_t
 Fred_fromString(const char* code);
 
 
+/**
+ * Returns the #Fred_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_FRED_INVALID, Fred_t}
+ * if there is no such match.
+ *
+ * @param code the string to convert to a #Fred_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #Fred_t or @sbmlconstant{TEST_FRED_INVALID,
+ * Fred_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Test_t
+ * @endif
+ */
+LIBSBML_EXTERN
+Fred_t
+Fred_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #Fred_t is valid.
@@ -692,6 +742,31 @@ ExtraLong_t
 ExtraLong_fromString(const char* code);
 
 
+/**
+ * Returns the #ExtraLong_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{TEST_EXTRALONG_INVALID,
+ * ExtraLong_t} if there is no such match.
+ *
+ * @param code the string to convert to a #ExtraLong_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #ExtraLong_t or
+ * @sbmlconstant{TEST_EXTRALONG_INVALID, ExtraLong_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Test_t
+ * @endif
+ */
+LIBSBML_EXTERN
+ExtraLong_t
+ExtraLong_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #ExtraLong_t is valid.
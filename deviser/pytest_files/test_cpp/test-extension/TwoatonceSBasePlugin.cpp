@@ -914,6 +914,214 @@ TwoatonceSBasePlugin::unsetAttribute(const std::string& attributeName)
 
 
 
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::lookupAttribute(const std::string& attributeName)
+{
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this TwoatonceSBasePlugin is set.
+ */
+bool
+TwoatonceSBasePlugin::isSetAttribute(int attributeId) const
+{
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * TwoatonceSBasePlugin.
+ */
+int
+TwoatonceSBasePlugin::unsetAttribute(int attributeId)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
 /** @cond doxygenLibsbmlInternal */
 
 /*
@@ -1199,6 +1407,17 @@ TwoatonceSBasePlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1207,14 +1426,63 @@ List*
 TwoatonceSBasePlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mNormalClass, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mClassWithRequiredID, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mMultipleChild, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+TwoatonceSBasePlugin::forEachElement(bool (*action)(SBase*, void*),
+                                     void* userData,
+                                     ElementFilter* filter)
+{
+  if (mNormalClass != NULL)
+  {
+    if ((filter == NULL || filter->filter(mNormalClass)) &&
+      !action(mNormalClass, userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mNormalClass->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mClassWithRequiredID != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassWithRequiredID)) &&
+      !action(mClassWithRequiredID, userData))
+    {
+      return false;
+    }
+
+    if (!mClassWithRequiredID->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mMultipleChild != NULL)
+  {
+    if ((filter == NULL || filter->filter(mMultipleChild)) &&
+      !action(mMultipleChild, userData))
+    {
+      return false;
+    }
+
+    if (!mMultipleChild->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
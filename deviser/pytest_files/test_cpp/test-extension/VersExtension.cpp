@@ -34,6 +34,7 @@
  * available online as http://sbml.org/software/libsbml/license.html
  * ------------------------------------------------------------------------ -->
  */
+#include <cstring>
 #include <sbml/extension/SBMLExtensionRegister.h>
 #include <sbml/extension/SBMLExtensionRegistry.h>
 #include <sbml/extension/SBasePluginCreator.h>
@@ -244,7 +245,7 @@ VersExtension::getURI(unsigned int sbmlLevel,
     }
   }
 
-  static std::string empty = "";
+  static const std::string empty = "";
   return empty;
 }
 
@@ -376,18 +377,31 @@ unsigned int
 VersExtension::getErrorTableIndex(unsigned int errorId) const
 {
   unsigned int tableSize = sizeof(versErrorTable)/sizeof(versErrorTable[0]);
-  unsigned int index = 0;
+  unsigned int low = 0;
+  unsigned int high = tableSize;
 
-  for (unsigned int i = 0; i < tableSize; i++)
+  // the table is written in order of error code
+
+  while (low < high)
   {
-    if (errorId == versErrorTable[i].code)
+    unsigned int mid = low + (high - low) / 2;
+
+    if (versErrorTable[mid].code < errorId)
+    {
+      low = mid + 1;
+    }
+    else
     {
-      index = i;
-      break;
+      high = mid;
     }
   }
 
-  return index;
+  if (low < tableSize && versErrorTable[low].code == errorId)
+  {
+    return low;
+  }
+
+  return 0;
 }
 
 /** @endcond */
@@ -514,16 +528,45 @@ LIBSBML_EXTERN
 FbcType_t
 FbcType_fromString(const char* code)
 {
-  static int size =
-    sizeof(SBML_FBC_TYPE_STRINGS)/sizeof(SBML_FBC_TYPE_STRINGS[0]);
-  std::string type(code);
+  if (code == NULL)
+  {
+    return OBJECTIVE_TYPE_INVALID;
+  }
+
+  return FbcType_fromStringWithLength(code, strlen(code));
+}
+
 
-  for (int i = 0; i < size; i++)
+/*
+ * Returns the #FbcType_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{OBJECTIVE_TYPE_INVALID,
+ * FbcType_t} if there is no such match.
+ */
+LIBSBML_EXTERN
+FbcType_t
+FbcType_fromStringWithLength(const char* code, size_t length)
+{
+  if (code == NULL)
+  {
+    return OBJECTIVE_TYPE_INVALID;
+  }
+
+  switch (length)
   {
-    if (type == SBML_FBC_TYPE_STRINGS[i])
+  case 8:
+    if (memcmp(code, "maximize", 8) == 0)
+    {
+      return OBJECTIVE_TYPE_MAXIMIZE;
+    }
+
+    if (memcmp(code, "minimize", 8) == 0)
     {
-      return (FbcType_t)(i);
+      return OBJECTIVE_TYPE_MINIMIZE;
     }
+
+    break;
+  default:
+    break;
   }
 
   return OBJECTIVE_TYPE_INVALID;
@@ -494,6 +494,31 @@ FbcType_t
 FbcType_fromString(const char* code);
 
 
+/**
+ * Returns the #FbcType_t enumeration corresponding to the first @p length
+ * characters of the given string or @sbmlconstant{OBJECTIVE_TYPE_INVALID,
+ * FbcType_t} if there is no such match.
+ *
+ * @param code the string to convert to a #FbcType_t; it need not be
+ * null-terminated.
+ *
+ * @param length the number of characters in @p code.
+ *
+ * @return the corresponding #FbcType_t or
+ * @sbmlconstant{OBJECTIVE_TYPE_INVALID, FbcType_t} if no match is found.
+ *
+ * This is the form used when reading, as it neither copies the string nor
+ * measures it.
+ *
+ * @if conly
+ * @memberof Objective_t
+ * @endif
+ */
+LIBSBML_EXTERN
+FbcType_t
+FbcType_fromStringWithLength(const char* code, size_t length);
+
+
 /**
  * Predicate returning @c 1 (true) or @c 0 (false) depending on whether the
  * given #FbcType_t is valid.
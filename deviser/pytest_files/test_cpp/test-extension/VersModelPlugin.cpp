@@ -599,15 +599,11 @@ VersModelPlugin::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "version1")
-  {
-    value = getVersion1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "version2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getVersion2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -646,13 +642,11 @@ VersModelPlugin::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBasePlugin::isSetAttribute(attributeName);
 
-  if (attributeName == "version1")
-  {
-    value = isSetVersion1();
-  }
-  else if (attributeName == "version2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetVersion2();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -724,13 +718,11 @@ VersModelPlugin::setAttribute(const std::string& attributeName,
 {
   int return_value = SBasePlugin::setAttribute(attributeName, value);
 
-  if (attributeName == "version1")
-  {
-    return_value = setVersion1(value);
-  }
-  else if (attributeName == "version2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setVersion2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -768,16 +760,274 @@ VersModelPlugin::unsetAttribute(const std::string& attributeName)
 {
   int value = SBasePlugin::unsetAttribute(attributeName);
 
-  if (attributeName == "version1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetVersion1();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "version2")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "version1", "version2" };
+
+  for (int i = ATTR_VERSION1; i < ATTR_COUNT; i++)
   {
-    value = unsetVersion2();
+    if (attributeName == names[i - ATTR_VERSION1])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::getAttribute(int attributeId, unsigned int& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_VERSION1:
+    value = getVersion1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_VERSION2:
+    value = getVersion2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this VersModelPlugin is set.
+ */
+bool
+VersModelPlugin::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_VERSION1:
+    return isSetVersion1();
+  case ATTR_VERSION2:
+    return isSetVersion2();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_VERSION1:
+    return setVersion1(value);
+  case ATTR_VERSION2:
+    return setVersion2(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * VersModelPlugin.
+ */
+int
+VersModelPlugin::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_VERSION1:
+    return unsetVersion1();
+  case ATTR_VERSION2:
+    return unsetVersion2();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -960,6 +1210,17 @@ VersModelPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -968,12 +1229,35 @@ List*
 VersModelPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
-  ADD_FILTERED_POINTER(ret, sublist, mClassOne, filter);
 
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+VersModelPlugin::forEachElement(bool (*action)(SBase*, void*),
+                                void* userData,
+                                ElementFilter* filter)
+{
+  if (mClassOne != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassOne)) && !action(mClassOne,
+      userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mClassOne->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1107,34 +1391,38 @@ VersModelPlugin::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBasePlugin::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("vers", VersModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersModelAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("vers", VersModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersModelAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == NotSchemaConformant)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(NotSchemaConformant);
-        log->logPackageError("vers", VersModelAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersModelAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -1017,20 +1017,11 @@ VersSpeciesPlugin::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "species_att_v1")
-  {
-    value = getSpecies_att_v1();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "string_plugin_att")
-  {
-    value = getString_plugin_att();
-    return_value = LIBSBML_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "species_att_v2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getSpecies_att_v2();
-    return_value = LIBSBML_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1051,17 +1042,11 @@ VersSpeciesPlugin::isSetAttribute(const std::string& attributeName) const
 {
   bool value = SBasePlugin::isSetAttribute(attributeName);
 
-  if (attributeName == "species_att_v1")
-  {
-    value = isSetSpecies_att_v1();
-  }
-  else if (attributeName == "string_plugin_att")
-  {
-    value = isSetString_plugin_att();
-  }
-  else if (attributeName == "species_att_v2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetSpecies_att_v2();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -1152,17 +1137,11 @@ VersSpeciesPlugin::setAttribute(const std::string& attributeName,
 {
   int return_value = SBasePlugin::setAttribute(attributeName, value);
 
-  if (attributeName == "species_att_v1")
-  {
-    return_value = setSpecies_att_v1(value);
-  }
-  else if (attributeName == "string_plugin_att")
-  {
-    return_value = setString_plugin_att(value);
-  }
-  else if (attributeName == "species_att_v2")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setSpecies_att_v2(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -1182,20 +1161,284 @@ VersSpeciesPlugin::unsetAttribute(const std::string& attributeName)
 {
   int value = SBasePlugin::unsetAttribute(attributeName);
 
-  if (attributeName == "species_att_v1")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetSpecies_att_v1();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "string_plugin_att")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "species_att_v1", "string_plugin_att",
+    "species_att_v2" };
+
+  for (int i = ATTR_SPECIES_ATT_V1; i < ATTR_COUNT; i++)
+  {
+    if (attributeName == names[i - ATTR_SPECIES_ATT_V1])
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::getAttribute(int attributeId, bool& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::getAttribute(int attributeId, int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::getAttribute(int attributeId, double& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
   {
-    value = unsetString_plugin_att();
+  case ATTR_SPECIES_ATT_V1:
+    value = getSpecies_att_v1();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_STRING_PLUGIN_ATT:
+    value = getString_plugin_att();
+    return LIBSBML_OPERATION_SUCCESS;
+  case ATTR_SPECIES_ATT_V2:
+    value = getSpecies_att_v2();
+    return LIBSBML_OPERATION_SUCCESS;
+  default:
+    break;
   }
-  else if (attributeName == "species_att_v2")
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this VersSpeciesPlugin is set.
+ */
+bool
+VersSpeciesPlugin::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
   {
-    value = unsetSpecies_att_v2();
+  case ATTR_SPECIES_ATT_V1:
+    return isSetSpecies_att_v1();
+  case ATTR_STRING_PLUGIN_ATT:
+    return isSetString_plugin_att();
+  case ATTR_SPECIES_ATT_V2:
+    return isSetSpecies_att_v2();
+  default:
+    break;
   }
 
-  return value;
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::setAttribute(int attributeId, bool value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::setAttribute(int attributeId, int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::setAttribute(int attributeId, double value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_SPECIES_ATT_V1:
+    return setSpecies_att_v1(value);
+  case ATTR_STRING_PLUGIN_ATT:
+    return setString_plugin_att(value);
+  case ATTR_SPECIES_ATT_V2:
+    return setSpecies_att_v2(value);
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenLibsbmlInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * VersSpeciesPlugin.
+ */
+int
+VersSpeciesPlugin::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_SPECIES_ATT_V1:
+    return unsetSpecies_att_v1();
+  case ATTR_STRING_PLUGIN_ATT:
+    return unsetString_plugin_att();
+  case ATTR_SPECIES_ATT_V2:
+    return unsetSpecies_att_v2();
+  default:
+    break;
+  }
+
+  return LIBSBML_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -1470,6 +1713,17 @@ VersSpeciesPlugin::getElementByMetaId(const std::string& metaid)
 }
 
 
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(SBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child SBase objects, including those nested to an
  * arbitrary depth.
@@ -1478,14 +1732,63 @@ List*
 VersSpeciesPlugin::getAllElements(ElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
+
 
-  ADD_FILTERED_POINTER(ret, sublist, mClassOne, filter);
-  ADD_FILTERED_POINTER(ret, sublist, mClassTwo, filter);
+/*
+ * Calls @p action on each child SBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+VersSpeciesPlugin::forEachElement(bool (*action)(SBase*, void*),
+                                  void* userData,
+                                  ElementFilter* filter)
+{
+  if (mClassOne != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassOne)) && !action(mClassOne,
+      userData))
+    {
+      return false;
+    }
 
-  ADD_FILTERED_LIST(ret, sublist, mAnothers, filter);
+    if (!mClassOne->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
 
-  return ret;
+  if (mClassTwo != NULL)
+  {
+    if ((filter == NULL || filter->filter(mClassTwo)) && !action(mClassTwo,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mClassTwo->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  if (mAnothers.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mAnothers)) && !action(&mAnothers,
+      userData))
+    {
+      return false;
+    }
+
+    if (!mAnothers.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -1655,34 +1958,38 @@ VersSpeciesPlugin::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   SBMLErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   SBasePlugin::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == UnknownPackageAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownPackageAttribute);
-        log->logPackageError("vers", VersSpeciesAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersSpeciesAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == UnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(UnknownCoreAttribute);
-        log->logPackageError("vers", VersSpeciesAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersSpeciesAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
       else if (log->getError(n)->getErrorId() == NotSchemaConformant)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(NotSchemaConformant);
-        log->logPackageError("vers", VersSpeciesAllowedAttributes, pkgVersion,
-          level, version, details, getLine(), getColumn());
+        SBMLError rewritten(VersSpeciesAllowedAttributes, level, version,
+          details, getLine(), getColumn(), LIBSBML_SEV_ERROR, LIBSBML_CAT_SBML,
+            "vers", pkgVersion);
+        *const_cast<SBMLError*>(log->getError(n)) = rewritten;
       }
     }
   }
@@ -77,6 +77,9 @@ def teardown():
      'contains list of that has abstracts that are abstract'),
     ('groups', 1, 'Member', 'ListOfMembers', 'list of with attribute'),
     ('groups', 0, 'Group', 'ListOfGroups', 'list of with attribute'),
+    ('lo_id_index', 0, 'Thing', 'ListOfThings', 'list of with id index'),
+    ('pooled', 0, 'Blob', '', 'pooled allocation'),
+    ('lazy_array', 0, 'Field', '', 'array text parsed on first use'),
     ('test_vers', 0, 'ClassOne', '', 'multiple versions'),
     ('test_vers', 2, 'BBB', '', 'multiple versions same child lo'),
     ('fbc_v2', 1, 'Objective', 'ListOfObjectives',
@@ -9,7 +9,7 @@ from xml.dom.minidom import parse
 
 
 from ...code_files import CppExampleFile
-from ...validation import ValidationXMLFiles
+from ...validation import ValidationXMLFiles, ScaledXMLFiles
 from ...parseXML import ParseXML
 
 from .. import functions
@@ -68,6 +68,23 @@ def generate_xml(filename):
     return ob['name']
 
 
+def generate_scaled_xml(filename):
+    """
+    Generate a small scaled XML document.
+
+    :param filename: XML file to parse
+    :return: package name, e.g. 'dyn'
+    """
+    ob = set_up(filename)
+    all_files = ScaledXMLFiles.ScaledXMLFiles(ob, list_size=3, depth=2,
+                                              array_size=4,
+                                              optional_fraction=0.5,
+                                              fan_out=2, seed=1)
+    all_files.write_file('scaled_xml')
+    os.chdir(os.path.normpath('../../.'))
+    return ob['name']
+
+
 def generate_xml_fails(filename):
     """
     Generate a failure example (creates an xml
@@ -148,6 +165,18 @@ def compare_xml(pkg):
     return compare_files(correct_file, temp_file)
 
 
+def compare_scaled_xml(pkg):
+    """
+    Compare a reference scaled XML file with a temporary one.
+
+    :param pkg: name of XML package, e.g. 'dyn'.
+    :return: 0 on success or file not present, 1 on failure.
+    """
+    correct_file = os.path.normpath('./test-examples/{0}/scaled_xml.xml'.format(pkg))
+    temp_file = os.path.normpath('./temp/{0}/scaled_xml.xml'.format(pkg))
+    return compare_files(correct_file, temp_file)
+
+
 def compare_xml_fails(pkg):
     """
     Compare a set of reference example XML files in a directory
@@ -200,6 +229,20 @@ def run_xml_test(name):
     return fail
 
 
+def run_scaled_xml_test(name):
+    """
+    Run a scaled XML file test.
+
+    :param name: XML package name, e.g. 'dyn'
+    :return 0 on success (or file not present), 1 on failure.
+    """
+    filename = functions.set_up_test(name, 'Examples')
+    pkg = generate_scaled_xml(filename)
+    fail = compare_scaled_xml(pkg)
+    print('')
+    return fail
+
+
 def run_xml_fail_tests(name):
     """
     Run an XML failure file test.
@@ -32,6 +32,13 @@ def test_xml(name):
     assert 0 == ret.run_xml_test(name)
 
 
+@pytest.mark.parametrize('name', [
+    ('spatial'),
+])
+def test_scaled_xml(name):
+    assert 0 == ret.run_scaled_xml_test(name)
+
+
 @pytest.mark.parametrize('name, start, stop, number', [
     ("spatial", 8, 13, -1),
     ("spatial", 15, 19, -1),
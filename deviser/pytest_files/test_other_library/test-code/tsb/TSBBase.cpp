@@ -122,7 +122,7 @@ TSBBase::TSBBase (unsigned int level, unsigned int version)
   , mEmptyString("")
  , mURI("")
 {
-  mTSBNamespaces = new TSBNamespaces(level, version);
+  mTSBNamespaces = TSBNamespaces::intern(level, version);
 
   //
   // Sets the XMLNS URI of corresponding TSB Level/Version to
@@ -158,9 +158,9 @@ TSBBase::TSBBase (TSBNamespaces *tsbns)
     std::string err("TSBBase::TSBBase(TSBNamespaces*) : TSBNamespaces is null");
     throw TSBConstructorException(err);
   }
-  mTSBNamespaces = tsbns->clone();
+  mTSBNamespaces = TSBNamespaces::share(tsbns);
 
-  setElementNamespace(static_cast<TSBNamespaces>(*mTSBNamespaces).getURI());
+  setElementNamespace(mTSBNamespaces->getURI());
 }
 /** @endcond */
 
@@ -192,11 +192,12 @@ TSBBase::TSBBase(const TSBBase& orig)
   else
     this->mTestAnnotation = NULL;
 
-  if(orig.getTSBNamespaces() != NULL)
-    this->mTSBNamespaces =
-    new TSBNamespaces(*const_cast<TSBBase&>(orig).getTSBNamespaces());
+  // share what the original uses without asking it for a copy it may change
+  const TSBBase* owner = (orig.mTSB != NULL) ? orig.mTSB : &orig;
+  if (owner->mTSBNamespaces != NULL)
+    this->mTSBNamespaces = TSBNamespaces::share(owner->mTSBNamespaces);
   else
-    this->mTSBNamespaces = NULL;
+    this->mTSBNamespaces = TSBNamespaces::share(orig.getTSBNamespaces());
 
   this->mHasBeenDeleted = false;
 }
@@ -208,9 +209,11 @@ TSBBase::TSBBase(const TSBBase& orig)
  */
 TSBBase::~TSBBase ()
 {
+  // the document index may still point at this object
+  invalidateDocumentIdIndex();
   if (mNotes != NULL)       delete mNotes;
   if (mTestAnnotation != NULL)  delete mTestAnnotation;
-  if (mTSBNamespaces != NULL)  delete mTSBNamespaces;
+  TSBNamespaces::release(mTSBNamespaces);
 }
 
 /*
@@ -243,13 +246,9 @@ TSBBase& TSBBase::operator=(const TSBBase& rhs)
     this->mParentTSBObject = rhs.mParentTSBObject;
     this->mUserData   = rhs.mUserData;
 
-    delete this->mTSBNamespaces;
-
-    if(rhs.mTSBNamespaces != NULL)
-      this->mTSBNamespaces =
-      new TSBNamespaces(*const_cast<TSBBase&>(rhs).mTSBNamespaces);
-    else
-      this->mTSBNamespaces = NULL;
+    TSBNamespaces* tsbns = TSBNamespaces::share(rhs.mTSBNamespaces);
+    TSBNamespaces::release(this->mTSBNamespaces);
+    this->mTSBNamespaces = tsbns;
 
 
     this->mURI = rhs.mURI;
@@ -363,7 +362,7 @@ TSBBase::getURI() const
   if (doc == NULL)
     return getElementNamespace();
 
-  TSBNamespaces* tsbns = doc->getTSBNamespaces();
+  const TSBNamespaces* tsbns = doc->getSharedTSBNamespaces();
 
   if (tsbns == NULL)
     return getElementNamespace();
@@ -431,20 +430,16 @@ TSBBase::unsetUserData()
 XMLNamespaces*
 TSBBase::getNamespaces()
 {
-  if (mTSB != NULL)
-    return mTSB->getTSBNamespaces()->getNamespaces();
-  else
-    return mTSBNamespaces->getNamespaces();
+  // the caller may change the namespaces returned, which getTSBNamespaces
+  // allows for
+  return getTSBNamespaces()->getNamespaces();
 }
 
 
 const XMLNamespaces*
 TSBBase::getNamespaces() const
 {
-  if (mTSB != NULL)
-    return mTSB->getTSBNamespaces()->getNamespaces();
-  else
-    return mTSBNamespaces->getNamespaces();
+  return getSharedTSBNamespaces()->getNamespaces();
 }
 
 
@@ -627,6 +622,8 @@ TSBBase::isSetTestAnnotation () const
 int
 TSBBase::setMetaId (const std::string& metaid)
 {
+  updateDocumentMetaIdIndex(mMetaId, metaid);
+
   if (metaid.empty())
   {
     mMetaId.erase();
@@ -645,6 +642,8 @@ TSBBase::setMetaId (const std::string& metaid)
 int
 TSBBase::setId (const std::string& sid)
 {
+  updateDocumentSIdIndex(mId, sid);
+
   if (sid.empty())
   {
     mId.erase();
@@ -1492,6 +1491,8 @@ TSBBase::connectToParent (TSBBase* parent)
          << " " << parent->getTSBDocument() << endl;
 #endif
     setTSBDocument(mParentTSBObject->getTSBDocument());
+    // anything below this object may now be found in the document
+    invalidateDocumentIdIndex();
   }
   else
   {
@@ -1581,11 +1582,19 @@ TSBBase::setNamespaces(XMLNamespaces* xmlns)
 {
   if (xmlns == NULL)
   {
-    mTSBNamespaces->setNamespaces(NULL);
+    // this happens for nearly every element read so rather than making
+    // a copy we switch to the variant shared by the whole document
+    if (mTSBNamespaces->getNamespaces() != NULL)
+    {
+      TSBNamespaces* tsbns = mTSBNamespaces->shareWithoutNamespaces();
+      TSBNamespaces::release(mTSBNamespaces);
+      mTSBNamespaces = tsbns;
+    }
     return LIBTSB_OPERATION_SUCCESS;
   }
   else
   {
+    unshareTSBNamespaces();
     mTSBNamespaces->setNamespaces(xmlns);
     return LIBTSB_OPERATION_SUCCESS;
   }
@@ -1599,6 +1608,7 @@ TSBBase::setNamespaces(XMLNamespaces* xmlns)
 int
 TSBBase::unsetMetaId ()
 {
+  updateDocumentMetaIdIndex(mMetaId, "");
   mMetaId.erase();
 
   if (mMetaId.empty())
@@ -1618,6 +1628,7 @@ TSBBase::unsetMetaId ()
 int
 TSBBase::unsetId ()
 {
+  updateDocumentSIdIndex(mId, "");
   mId.erase();
 
   if (mId.empty())
@@ -1755,8 +1766,8 @@ TSBBase::matchesCoreTSBNamespace(const TSBBase * sb)
 {
   bool match = false;
 
-  TSBNamespaces *tsbns = getTSBNamespaces();
-  TSBNamespaces *tsbns_rhs = sb->getTSBNamespaces();
+  const TSBNamespaces *tsbns = getSharedTSBNamespaces();
+  const TSBNamespaces *tsbns_rhs = sb->getSharedTSBNamespaces();
 
   if (tsbns->getLevel() != tsbns_rhs->getLevel())
     return match;
@@ -1782,8 +1793,8 @@ TSBBase::matchesCoreTSBNamespace(const TSBBase * sb) const
 {
   bool match = false;
 
-  TSBNamespaces *tsbns = getTSBNamespaces();
-  TSBNamespaces *tsbns_rhs = sb->getTSBNamespaces();
+  const TSBNamespaces *tsbns = getSharedTSBNamespaces();
+  const TSBNamespaces *tsbns_rhs = sb->getSharedTSBNamespaces();
 
   if (tsbns->getLevel() != tsbns_rhs->getLevel())
     return match;
@@ -1855,8 +1866,10 @@ TSBBase::setTSBNamespaces(TSBNamespaces * tsbns)
   if (tsbns == NULL)
     return LIBTSB_INVALID_OBJECT;
 
-  TSBNamespaces* tsbnsClone = (tsbns) ? tsbns->clone() : 0;
-  setTSBNamespacesAndOwn(tsbnsClone);
+  TSBNamespaces* shared = TSBNamespaces::share(tsbns);
+  TSBNamespaces::release(mTSBNamespaces);
+  mTSBNamespaces = shared;
+  setElementNamespace(shared->getURI());
 
   return LIBTSB_OPERATION_SUCCESS;
 }
@@ -1868,25 +1881,48 @@ TSBBase::setTSBNamespaces(TSBNamespaces * tsbns)
 void
 TSBBase::setTSBNamespacesAndOwn(TSBNamespaces * tsbns)
 {
-  delete mTSBNamespaces;
-  mTSBNamespaces = tsbns;
+  TSBNamespaces::release(mTSBNamespaces);
+  mTSBNamespaces = TSBNamespaces::adopt(tsbns);
 
   if(tsbns != NULL)
     setElementNamespace(tsbns->getURI());
 }
 
 
+void
+TSBBase::unshareTSBNamespaces()
+{
+  mTSBNamespaces = TSBNamespaces::unshare(mTSBNamespaces);
+}
+
+
 /* gets the TSBnamespaces - internal use only*/
 TSBNamespaces *
 TSBBase::getTSBNamespaces() const
 {
-  if (mTSB != NULL)
-    return mTSB->mTSBNamespaces;
-  
+  // the caller may change the object returned, so it must be one that is
+  // not shared with other elements
+  TSBBase* owner = (mTSB != NULL) ? mTSB : const_cast<TSBBase*>(this);
+
   // initialize TSB namespace if need be
-  if (mTSBNamespaces == NULL)
-    const_cast<TSBBase*>(this)->mTSBNamespaces = new TSBNamespaces(getLevel(), getVersion());
-  return mTSBNamespaces;  
+  if (owner->mTSBNamespaces == NULL)
+    owner->mTSBNamespaces = TSBNamespaces::adopt(
+      new TSBNamespaces(owner->getLevel(), owner->getVersion()));
+  else
+    owner->unshareTSBNamespaces();
+  return owner->mTSBNamespaces;
+}
+
+
+/* gets the TSBnamespaces to read from - internal use only*/
+const TSBNamespaces *
+TSBBase::getSharedTSBNamespaces() const
+{
+  const TSBBase* owner = (mTSB != NULL) ? mTSB : this;
+
+  if (owner->mTSBNamespaces == NULL)
+    return getTSBNamespaces();
+  return owner->mTSBNamespaces;
 }
 /** @endcond */
 
@@ -2165,8 +2201,7 @@ TSBBase::read (XMLInputStream& stream)
 
         if (error == true && errorLoggedAlready == false)
         {
-          static ostringstream errMsg;
-          errMsg.str("");
+          ostringstream errMsg;
           errMsg << "The prefix for the <tsb> element does not match "
             << "the prefix for the TSB namespace.  This means that "
             << "the <tsb> element in not in the TSBNamespace."<< endl;
@@ -2680,6 +2715,53 @@ TSBBase::getRootElement()
 }
 
 
+/*
+ * Updates the identifier index of the parent TSBDocument (if any) when
+ * the id of this object changes.
+ */
+void
+TSBBase::updateDocumentSIdIndex(const std::string& oldId,
+    const std::string& newId)
+{
+  TSBDocument* doc = getTSBDocument();
+  if (doc != NULL)
+  {
+    doc->updateSIdIndex(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Updates the identifier index of the parent TSBDocument (if any) when
+ * the metaid of this object changes.
+ */
+void
+TSBBase::updateDocumentMetaIdIndex(const std::string& oldId,
+    const std::string& newId)
+{
+  TSBDocument* doc = getTSBDocument();
+  if (doc != NULL)
+  {
+    doc->updateMetaIdIndex(this, oldId, newId);
+  }
+}
+
+
+/*
+ * Marks the identifier index of the parent TSBDocument (if any) as out
+ * of date.
+ */
+void
+TSBBase::invalidateDocumentIdIndex()
+{
+  TSBDocument* doc = getTSBDocument();
+  if (doc != NULL)
+  {
+    doc->invalidateIdIndex();
+  }
+}
+
+
 /*
  * Subclasses should override this method to write their XML attributes
  * to the XMLOutputStream.  Be sure to call your parents implementation
@@ -2831,8 +2913,7 @@ TSBBase::checkDefaultNamespace(const XMLNamespaces* xmlns,
        && (elementName == "notes" || elementName == "testAnnotation"))
     return;
 
-  static ostringstream errMsg;
-  errMsg.str("");
+  ostringstream errMsg;
   errMsg << "xmlns=\"" << defaultURI << "\" in <" << elementName
          << "> element is an invalid namespace." << endl;
 
@@ -1617,12 +1617,21 @@ public:
 
   /* sets the TSBNamaepaces and owns the given object - internal use only */
   void setTSBNamespacesAndOwn(TSBNamespaces * disownedNs);
+
+  /* the namespaces object may be shared with other elements of the
+   * document; this gives the object its own copy before it is changed */
+  void unshareTSBNamespaces();
   /** @endcond */
 
 
   /** @cond doxygenLibtsbInternal */
-  /* gets the TSBnamespaces - internal use only*/
+  /* gets the TSBnamespaces, first giving the document its own copy if
+   * they were shared, since the caller may change them - internal use only*/
   virtual TSBNamespaces * getTSBNamespaces() const;
+
+  /* gets the TSBnamespaces, which may be shared with other elements and so
+   * must not be changed - internal use only */
+  const TSBNamespaces * getSharedTSBNamespaces() const;
   /** @endcond */
 
 
@@ -2007,6 +2016,31 @@ protected:
   TSBBase* getRootElement();
 
 
+  /** @cond doxygenLibtsbInternal */
+  /**
+   * Keeps the identifier index of the parent TSBDocument (if any) in
+   * sync when the "id" of this object changes from @p oldId to @p newId.
+   */
+  void updateDocumentSIdIndex(const std::string& oldId,
+                              const std::string& newId);
+
+
+  /**
+   * Keeps the identifier index of the parent TSBDocument (if any) in
+   * sync when the "metaid" of this object changes from @p oldId to @p newId.
+   */
+  void updateDocumentMetaIdIndex(const std::string& oldId,
+                                 const std::string& newId);
+
+
+  /**
+   * Marks the identifier index of the parent TSBDocument (if any) as out
+   * of date, e.g. after elements have been added or removed.
+   */
+  void invalidateDocumentIdIndex();
+  /** @endcond */
+
+
   // ------------------------------------------------------------------
 
 
@@ -0,0 +1,163 @@
+/**
+ * @file TSBBenchmark.cpp
+ * @brief Program reporting the time and memory used to read, write and copy a
+ * document.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <ctime>
+#include <iostream>
+#include <set>
+#include <string>
+
+#if !defined(_WIN32)
+#include <sys/resource.h>
+#endif
+
+#include <tsb/TSBTypes.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBTSB_CPP_NAMESPACE_USE
+
+
+/*
+ * Returns the peak resident memory of this process in kilobytes, or 0 where
+ * it cannot be found.
+ */
+static long
+getPeakMemory()
+{
+#if defined(_WIN32)
+  return 0;
+#else
+  struct rusage usage;
+  if (getrusage(RUSAGE_SELF, &usage) != 0)
+    return 0;
+#if defined(__APPLE__)
+  return usage.ru_maxrss / 1024;
+#else
+  return usage.ru_maxrss;
+#endif
+#endif
+}
+
+
+/*
+ * The elements of a document and the namespaces objects they use.
+ */
+struct NamespacesCount
+{
+  unsigned int numElements;
+  std::set<const TSBNamespaces*> namespaces;
+};
+
+
+static bool
+countNamespaces(TSBBase* element, void* userData)
+{
+  NamespacesCount* count = static_cast<NamespacesCount*>(userData);
+  count->numElements++;
+  count->namespaces.insert(element->getSharedTSBNamespaces());
+  return true;
+}
+
+
+static void
+report(const std::string& step, TSBDocument* doc, clock_t start,
+       long memory)
+{
+  double seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+  NamespacesCount count;
+  count.numElements = 0;
+  countNamespaces(doc, &count);
+  doc->forEachElement(countNamespaces, &count);
+
+  cout << step << ": " << seconds << "s, peak memory +"
+       << getPeakMemory() - memory << "KB, " << count.numElements
+       << " elements using " << count.namespaces.size()
+       << " namespaces objects" << endl;
+}
+
+
+/*
+ * Reads a document, writes it and copies it, reporting the time and memory
+ * each step takes and how many namespaces objects the elements of the
+ * result use. Array text kept unparsed by the read is parsed by the write.
+ *
+ * usage: TSBBenchmark filename
+ */
+int
+main(int argc, char* argv[])
+{
+  if (argc != 2)
+  {
+    cout << "usage: TSBBenchmark filename" << endl;
+    return 2;
+  }
+
+  long memory = getPeakMemory();
+  clock_t start = clock();
+  TSBReader reader;
+  TSBDocument* doc = reader.readTSBFromFile(argv[1]);
+  if (doc == NULL || doc->getNumErrors(LIBTSB_SEV_FATAL) > 0)
+  {
+    cout << "could not read " << argv[1] << endl;
+    delete doc;
+    return 1;
+  }
+  report("read", doc, start, memory);
+
+  memory = getPeakMemory();
+  start = clock();
+  std::string text;
+  TSBWriter writer;
+  writer.writeTSBToStdString(doc, text);
+  report("write", doc, start, memory);
+
+  memory = getPeakMemory();
+  start = clock();
+  TSBDocument* copy = doc->clone();
+  report("copy", copy, start, memory);
+
+  delete copy;
+  delete doc;
+  return 0;
+}
@@ -61,7 +61,6 @@ TSBComment::TSBComment(unsigned int level, unsigned int version)
   , mIsSetNumber (false)
   , mPoint ("")
 {
-  setTSBNamespacesAndOwn(new TSBNamespaces(level, version));
 }
 
 
@@ -422,10 +421,11 @@ TSBComment::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "number")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getNumber();
-    return_value = LIBTSB_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -469,15 +469,11 @@ TSBComment::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "contributor")
-  {
-    value = getContributor();
-    return_value = LIBTSB_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "point")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getPoint();
-    return_value = LIBTSB_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -498,17 +494,11 @@ TSBComment::isSetAttribute(const std::string& attributeName) const
 {
   bool value = TSBBase::isSetAttribute(attributeName);
 
-  if (attributeName == "contributor")
-  {
-    value = isSetContributor();
-  }
-  else if (attributeName == "number")
-  {
-    value = isSetNumber();
-  }
-  else if (attributeName == "point")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetPoint();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -562,9 +552,11 @@ TSBComment::setAttribute(const std::string& attributeName, double value)
 {
   int return_value = TSBBase::setAttribute(attributeName, value);
 
-  if (attributeName == "number")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setNumber(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -602,13 +594,11 @@ TSBComment::setAttribute(const std::string& attributeName,
 {
   int return_value = TSBBase::setAttribute(attributeName, value);
 
-  if (attributeName == "contributor")
-  {
-    return_value = setContributor(value);
-  }
-  else if (attributeName == "point")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setPoint(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -628,26 +618,313 @@ TSBComment::unsetAttribute(const std::string& attributeName)
 {
   int value = TSBBase::unsetAttribute(attributeName);
 
-  if (attributeName == "contributor")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetContributor();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "number")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this TSBComment.
+ */
+int
+TSBComment::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "contributor", "number", "point" };
+
+  for (int i = ATTR_CONTRIBUTOR; i < ATTR_COUNT; i++)
   {
-    value = unsetNumber();
+    if (attributeName == names[i - ATTR_CONTRIBUTOR])
+    {
+      return i;
+    }
   }
-  else if (attributeName == "point")
+
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::getAttribute(int attributeId, bool& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::getAttribute(int attributeId, int& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::getAttribute(int attributeId, double& value) const
+{
+  switch (attributeId)
   {
-    value = unsetPoint();
+  case ATTR_NUMBER:
+    value = getNumber();
+    return LIBTSB_OPERATION_SUCCESS;
+  default:
+    break;
   }
 
-  return value;
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::getAttribute(int attributeId, unsigned int& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::getAttribute(int attributeId, std::string& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_CONTRIBUTOR:
+    value = getContributor();
+    return LIBTSB_OPERATION_SUCCESS;
+  case ATTR_POINT:
+    value = getPoint();
+    return LIBTSB_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
 }
 
 /** @endcond */
 
 
 
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this TSBComment is set.
+ */
+bool
+TSBComment::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_CONTRIBUTOR:
+    return isSetContributor();
+  case ATTR_NUMBER:
+    return isSetNumber();
+  case ATTR_POINT:
+    return isSetPoint();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::setAttribute(int attributeId, bool value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::setAttribute(int attributeId, int value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::setAttribute(int attributeId, double value)
+{
+  switch (attributeId)
+  {
+  case ATTR_NUMBER:
+    return setNumber(value);
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::setAttribute(int attributeId, unsigned int value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::setAttribute(int attributeId, const std::string& value)
+{
+  switch (attributeId)
+  {
+  case ATTR_CONTRIBUTOR:
+    return setContributor(value);
+  case ATTR_POINT:
+    return setPoint(value);
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * TSBComment.
+ */
+int
+TSBComment::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_CONTRIBUTOR:
+    return unsetContributor();
+  case ATTR_NUMBER:
+    return unsetNumber();
+  case ATTR_POINT:
+    return unsetPoint();
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+/*
+ * Calls @p action on each child TSBBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+TSBComment::forEachElement(bool (*action)(TSBBase*, void*),
+                           void* userData,
+                           TSBElementFilter* filter)
+{
+  return true;
+}
+
+
+
 /** @cond doxygenlibTSBInternal */
 
 /*
@@ -693,27 +970,26 @@ TSBComment::readAttributes(const XMLAttributes& attributes,
       if (log->getError(n)->getErrorId() == TSBUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(TSBUnknownCoreAttribute);
-        log->logError(TsbDocumentLOCommentsAllowedCoreAttributes, level,
+        log->replaceError(n, TsbDocumentLOCommentsAllowedCoreAttributes, level,
           version, details, getLine(), getColumn());
       }
     }
   }
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   TSBBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == TSBUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(TSBUnknownCoreAttribute);
-        log->logError(TsbCommentAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, TsbCommentAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
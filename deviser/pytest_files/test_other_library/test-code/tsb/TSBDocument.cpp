@@ -60,8 +60,11 @@ TSBDocument::TSBDocument(unsigned int level, unsigned int version)
   , mVersion (TSB_INT_MAX)
   , mIsSetVersion (false)
   , mComments (level, version)
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mIdIndexEnabled (true)
+  , mIdIndexValid (false)
 {
-  setTSBNamespacesAndOwn(new TSBNamespaces(level, version));
   setLevel(level);
   setVersion(version);
   setTSBDocument(this);
@@ -79,6 +82,10 @@ TSBDocument::TSBDocument(TSBNamespaces *tsbns)
   , mVersion (TSB_INT_MAX)
   , mIsSetVersion (false)
   , mComments (tsbns)
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mIdIndexEnabled (true)
+  , mIdIndexValid (false)
 {
   setElementNamespace(tsbns->getURI());
   setLevel(tsbns->getLevel());
@@ -98,6 +105,10 @@ TSBDocument::TSBDocument(const TSBDocument& orig)
   , mVersion ( orig.mVersion )
   , mIsSetVersion ( orig.mIsSetVersion )
   , mComments ( orig.mComments )
+  , mSIdIndex ()
+  , mMetaIdIndex ()
+  , mIdIndexEnabled (orig.mIdIndexEnabled)
+  , mIdIndexValid (false)
 {
   setTSBDocument(this);
 
@@ -119,6 +130,8 @@ TSBDocument::operator=(const TSBDocument& rhs)
     mVersion = rhs.mVersion;
     mIsSetVersion = rhs.mIsSetVersion;
     mComments = rhs.mComments;
+    mIdIndexEnabled = rhs.mIdIndexEnabled;
+    invalidateIdIndex();
     connectToChild();
     setTSBDocument(this);
   }
@@ -142,6 +155,7 @@ TSBDocument::clone() const
  */
 TSBDocument::~TSBDocument()
 {
+  mHasBeenDeleted = true;
 }
 
 
@@ -565,15 +579,11 @@ TSBDocument::getAttribute(const std::string& attributeName,
     return return_value;
   }
 
-  if (attributeName == "level")
-  {
-    value = getLevel();
-    return_value = LIBTSB_OPERATION_SUCCESS;
-  }
-  else if (attributeName == "version")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = getVersion();
-    return_value = LIBTSB_OPERATION_SUCCESS;
+    return_value = getAttribute(attributeId, value);
   }
 
   return return_value;
@@ -612,13 +622,11 @@ TSBDocument::isSetAttribute(const std::string& attributeName) const
 {
   bool value = TSBBase::isSetAttribute(attributeName);
 
-  if (attributeName == "level")
-  {
-    value = isSetLevel();
-  }
-  else if (attributeName == "version")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = isSetVersion();
+    value = isSetAttribute(attributeId);
   }
 
   return value;
@@ -690,13 +698,11 @@ TSBDocument::setAttribute(const std::string& attributeName,
 {
   int return_value = TSBBase::setAttribute(attributeName, value);
 
-  if (attributeName == "level")
-  {
-    return_value = setLevel(value);
-  }
-  else if (attributeName == "version")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    return_value = setVersion(value);
+    return_value = setAttribute(attributeId, value);
   }
 
   return return_value;
@@ -734,16 +740,273 @@ TSBDocument::unsetAttribute(const std::string& attributeName)
 {
   int value = TSBBase::unsetAttribute(attributeName);
 
-  if (attributeName == "level")
+  int attributeId = lookupAttribute(attributeName);
+
+  if (attributeId != -1)
   {
-    value = unsetLevel();
+    value = unsetAttribute(attributeId);
   }
-  else if (attributeName == "version")
+
+  return value;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Returns the identifier of the "attributeName" attribute of this TSBDocument.
+ */
+int
+TSBDocument::lookupAttribute(const std::string& attributeName)
+{
+  static const char* const names[] = { "level", "version" };
+
+  for (int i = ATTR_LEVEL; i < ATTR_COUNT; i++)
   {
-    value = unsetVersion();
+    if (attributeName == names[i - ATTR_LEVEL])
+    {
+      return i;
+    }
   }
 
-  return value;
+  return -1;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::getAttribute(int attributeId, bool& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::getAttribute(int attributeId, int& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::getAttribute(int attributeId, double& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::getAttribute(int attributeId, unsigned int& value) const
+{
+  switch (attributeId)
+  {
+  case ATTR_LEVEL:
+    value = getLevel();
+    return LIBTSB_OPERATION_SUCCESS;
+  case ATTR_VERSION:
+    value = getVersion();
+    return LIBTSB_OPERATION_SUCCESS;
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Gets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::getAttribute(int attributeId, std::string& value) const
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Predicate returning @c true if the attribute with the given identifier of
+ * this TSBDocument is set.
+ */
+bool
+TSBDocument::isSetAttribute(int attributeId) const
+{
+  switch (attributeId)
+  {
+  case ATTR_LEVEL:
+    return isSetLevel();
+  case ATTR_VERSION:
+    return isSetVersion();
+  default:
+    break;
+  }
+
+  return false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::setAttribute(int attributeId, bool value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::setAttribute(int attributeId, int value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::setAttribute(int attributeId, double value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::setAttribute(int attributeId, unsigned int value)
+{
+  switch (attributeId)
+  {
+  case ATTR_LEVEL:
+    return setLevel(value);
+  case ATTR_VERSION:
+    return setVersion(value);
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Sets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::setAttribute(int attributeId, const std::string& value)
+{
+  return LIBTSB_OPERATION_FAILED;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Unsets the value of the attribute with the given identifier of this
+ * TSBDocument.
+ */
+int
+TSBDocument::unsetAttribute(int attributeId)
+{
+  switch (attributeId)
+  {
+  case ATTR_LEVEL:
+    return unsetLevel();
+  case ATTR_VERSION:
+    return unsetVersion();
+  default:
+    break;
+  }
+
+  return LIBTSB_OPERATION_FAILED;
 }
 
 /** @endcond */
@@ -876,6 +1139,18 @@ TSBDocument::getElementBySId(const std::string& id)
     return NULL;
   }
 
+  if (mIdIndexEnabled == true)
+  {
+    if (mIdIndexValid == false)
+    {
+      rebuildIdIndex();
+    }
+
+    multimap<string, TSBBase*>::iterator it = mSIdIndex.lower_bound(id);
+    bool found = (it != mSIdIndex.end() && it->first == id);
+    return found ? it->second : NULL;
+  }
+
   TSBBase* obj = NULL;
 
   obj = mComments.getElementBySId(id);
@@ -889,6 +1164,59 @@ TSBDocument::getElementBySId(const std::string& id)
 }
 
 
+/*
+ * Returns the first child element that has the given @p metaid, or @c NULL if
+ * no such object is found.
+ */
+TSBBase*
+TSBDocument::getElementByMetaId(const std::string& metaid)
+{
+  if (metaid.empty())
+  {
+    return NULL;
+  }
+
+  if (mIdIndexEnabled == true)
+  {
+    if (mIdIndexValid == false)
+    {
+      rebuildIdIndex();
+    }
+
+    multimap<string, TSBBase*>::iterator it = mMetaIdIndex.lower_bound(metaid);
+    bool found = (it != mMetaIdIndex.end() && it->first == metaid);
+    return found ? it->second : NULL;
+  }
+
+  TSBBase* obj = NULL;
+
+  if (mComments.getMetaId() == metaid)
+  {
+    return &mComments;
+  }
+
+  obj = mComments.getElementByMetaId(metaid);
+
+  if (obj != NULL)
+  {
+    return obj;
+  }
+
+  return obj;
+}
+
+
+/*
+ * Used by getAllElements() to collect the elements it is passed.
+ */
+static bool
+addElementToList(TSBBase* element, void* userData)
+{
+  static_cast<List*>(userData)->add(element);
+  return true;
+}
+
+
 /*
  * Returns a List of all child TSBBase objects, including those nested to an
  * arbitrary depth.
@@ -897,12 +1225,35 @@ List*
 TSBDocument::getAllElements(TSBElementFilter* filter)
 {
   List* ret = new List();
-  List* sublist = NULL;
+  forEachElement(addElementToList, ret, filter);
+  return ret;
+}
 
 
-  ADD_TSB_FILTERED_LIST(ret, sublist, mComments, filter);
+/*
+ * Calls @p action on each child TSBBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+TSBDocument::forEachElement(bool (*action)(TSBBase*, void*),
+                            void* userData,
+                            TSBElementFilter* filter)
+{
+  if (mComments.size() > 0)
+  {
+    if ((filter == NULL || filter->filter(&mComments)) && !action(&mComments,
+      userData))
+    {
+      return false;
+    }
 
-  return ret;
+    if (!mComments.forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
 }
 
 
@@ -987,6 +1338,142 @@ TSBDocument::getNumErrors(unsigned int severity) const
 }
 
 
+/*
+ * Sets whether getElementBySId() and getElementByMetaId() on this TSBDocument
+ * use an identifier index.
+ */
+void
+TSBDocument::enableIdIndex(bool enable)
+{
+  mIdIndexEnabled = enable;
+  mIdIndexValid = false;
+  mSIdIndex.clear();
+  mMetaIdIndex.clear();
+}
+
+
+/*
+ * Predicate returning @c true if the identifier index of this TSBDocument is
+ * enabled.
+ */
+bool
+TSBDocument::isIdIndexEnabled() const
+{
+  return mIdIndexEnabled;
+}
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Marks the identifier index of this TSBDocument as out of date.
+ */
+void
+TSBDocument::invalidateIdIndex()
+{
+  mIdIndexValid = false;
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Updates the identifier index of this TSBDocument when the "id" of an element
+ * changes.
+ */
+void
+TSBDocument::updateSIdIndex(TSBBase* element,
+                            const std::string& oldId,
+                            const std::string& newId)
+{
+  if (mIdIndexValid == false || element == this)
+  {
+    return;
+  }
+
+  // any other element with the old value stays indexed in document order
+
+  multimap<string, TSBBase*>::iterator it = mSIdIndex.lower_bound(oldId);
+
+  for (; it != mSIdIndex.end() && it->first == oldId; ++it)
+  {
+    if (it->second == element)
+    {
+      mSIdIndex.erase(it);
+      break;
+    }
+  }
+
+  // the order among others with the new value needs a full search
+
+  if (newId.empty() == false)
+  {
+    if (mSIdIndex.find(newId) != mSIdIndex.end())
+    {
+      mIdIndexValid = false;
+    }
+    else
+    {
+      mSIdIndex.insert(make_pair(newId, element));
+    }
+  }
+}
+
+/** @endcond */
+
+
+
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Updates the identifier index of this TSBDocument when the "metaid" of an
+ * element changes.
+ */
+void
+TSBDocument::updateMetaIdIndex(TSBBase* element,
+                               const std::string& oldId,
+                               const std::string& newId)
+{
+  if (mIdIndexValid == false || element == this)
+  {
+    return;
+  }
+
+  // any other element with the old value stays indexed in document order
+
+  multimap<string, TSBBase*>::iterator it = mMetaIdIndex.lower_bound(oldId);
+
+  for (; it != mMetaIdIndex.end() && it->first == oldId; ++it)
+  {
+    if (it->second == element)
+    {
+      mMetaIdIndex.erase(it);
+      break;
+    }
+  }
+
+  // the order among others with the new value needs a full search
+
+  if (newId.empty() == false)
+  {
+    if (mMetaIdIndex.find(newId) != mMetaIdIndex.end())
+    {
+      mIdIndexValid = false;
+    }
+    else
+    {
+      mMetaIdIndex.insert(make_pair(newId, element));
+    }
+  }
+}
+
+/** @endcond */
+
+
 
 /** @cond doxygenlibTSBInternal */
 
@@ -1054,20 +1541,20 @@ TSBDocument::readAttributes(const XMLAttributes& attributes,
   bool assigned = false;
   TSBErrorLog* log = getErrorLog();
 
+  unsigned int errMark = log ? log->getNumErrors() : 0;
   TSBBase::readAttributes(attributes, expectedAttributes);
 
   if (log)
   {
     numErrs = log->getNumErrors();
 
-    for (int n = numErrs-1; n >= 0; n--)
+    for (int n = numErrs-1; n >= static_cast<int>(errMark); n--)
     {
       if (log->getError(n)->getErrorId() == TSBUnknownCoreAttribute)
       {
         const std::string details = log->getError(n)->getMessage();
-        log->remove(TSBUnknownCoreAttribute);
-        log->logError(TsbDocumentAllowedAttributes, level, version, details,
-          getLine(), getColumn());
+        log->replaceError(n, TsbDocumentAllowedAttributes, level, version,
+          details, getLine(), getColumn());
       }
     }
   }
@@ -1183,6 +1670,43 @@ TSBDocument::writeXMLNS(XMLOutputStream& stream) const
 
 
 
+/** @cond doxygenlibTSBInternal */
+
+/*
+ * Rebuilds the identifier index of this TSBDocument from all the elements it
+ * contains.
+ */
+void
+TSBDocument::rebuildIdIndex()
+{
+  mSIdIndex.clear();
+  mMetaIdIndex.clear();
+
+  List* elements = getAllElements();
+
+  while (elements->getSize() > 0)
+  {
+    TSBBase* obj = static_cast<TSBBase*>(elements->remove(0));
+    if (obj->isSetId())
+    {
+      mSIdIndex.insert(make_pair(obj->getId(), obj));
+    }
+
+    if (obj->isSetMetaId())
+    {
+      mMetaIdIndex.insert(make_pair(obj->getMetaId(), obj));
+    }
+  }
+
+  delete elements;
+
+  mIdIndexValid = true;
+}
+
+/** @endcond */
+
+
+
 
 #endif /* __cplusplus */
 
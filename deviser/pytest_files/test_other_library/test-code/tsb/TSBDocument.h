@@ -51,6 +51,7 @@
 
 
 #include <string>
+#include <map>
 
 
 #include <tsb/TSBBase.h>
@@ -73,6 +74,10 @@ protected:
   bool mIsSetVersion;
   TSBListOfComments mComments;
   TSBErrorLog mErrorLog;
+  std::multimap<std::string, TSBBase*> mSIdIndex;
+  std::multimap<std::string, TSBBase*> mMetaIdIndex;
+  bool mIdIndexEnabled;
+  bool mIdIndexValid;
 
   /** @endcond */
 
@@ -464,6 +469,22 @@ public:
 
 
 
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Identifiers for the attributes of this TSBDocument, as returned by
+   * lookupAttribute().
+   */
+  enum AttributeId
+  {
+    ATTR_LEVEL = 0,
+    ATTR_VERSION,
+    ATTR_COUNT
+  };
+
+  /** @endcond */
+
+
   /** @cond doxygenlibTSBInternal */
 
   /**
@@ -694,6 +715,271 @@ public:
 
 
 
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Returns the identifier of the "attributeName" attribute of this
+   * TSBDocument.
+   *
+   * @param attributeName, the name of the attribute.
+   *
+   * @return the identifier to use with the integer forms of getAttribute(),
+   * isSetAttribute(), setAttribute() and unsetAttribute(), or @c -1 if there
+   * is no such attribute.
+   */
+  static int lookupAttribute(const std::string& attributeName);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, bool& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, double& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, unsigned int& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Gets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the address of the value to record.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int getAttribute(int attributeId, std::string& value) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Predicate returning @c true if the attribute with the given identifier of
+   * this TSBDocument is set.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @return @c true if the attribute has been set, otherwise @c false is
+   * returned.
+   */
+  virtual bool isSetAttribute(int attributeId) const;
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, bool value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, double value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, unsigned int value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Sets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @param value, the value of the attribute to set.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int setAttribute(int attributeId, const std::string& value);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Unsets the value of the attribute with the given identifier of this
+   * TSBDocument.
+   *
+   * @param attributeId, the identifier of the attribute, as returned by
+   * lookupAttribute().
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   */
+  virtual int unsetAttribute(int attributeId);
+
+  /** @endcond */
+
+
+
   /** @cond doxygenlibTSBInternal */
 
   /**
@@ -798,6 +1084,19 @@ public:
   virtual TSBBase* getElementBySId(const std::string& id);
 
 
+  /**
+   * Returns the first child element that has the given @p metaid, or @c NULL
+   * if no such object is found.
+   *
+   * @param metaid a string representing the metaid attribute of the object to
+   * retrieve.
+   *
+   * @return a pointer to the TSBBase element with the given @p metaid. If no
+   * such object is found this method returns @c NULL.
+   */
+  virtual TSBBase* getElementByMetaId(const std::string& metaid);
+
+
   /**
    * Returns a List of all child TSBBase objects, including those nested to an
    * arbitrary depth.
@@ -811,6 +1110,27 @@ public:
   virtual List* getAllElements(TSBElementFilter * filter = NULL);
 
 
+  /**
+   * Calls @p action on each child TSBBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory.
+   */
+  virtual bool forEachElement(bool (*action)(TSBBase*, void*),
+                              void* userData,
+                              TSBElementFilter * filter = NULL);
+
+
   /**
    * Returns the value of the "Namespaces" element of this TSBDocument.
    *
@@ -902,6 +1222,84 @@ public:
   unsigned int getNumErrors(unsigned int severity) const;
 
 
+  /**
+   * Sets whether getElementBySId() and getElementByMetaId() on this
+   * TSBDocument use an identifier index.
+   *
+   * @param enable a boolean, @c true to use the index, @c false to search the
+   * whole document on every call.
+   *
+   * The index is built on first use and kept up to date as the document
+   * changes. It is enabled by default.
+   */
+  void enableIdIndex(bool enable);
+
+
+  /**
+   * Predicate returning @c true if the identifier index of this TSBDocument is
+   * enabled.
+   *
+   * @return @c true if getElementBySId() and getElementByMetaId() use the
+   * identifier index, @c false otherwise.
+   */
+  bool isIdIndexEnabled() const;
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Marks the identifier index of this TSBDocument as out of date.
+   *
+   * The index is rebuilt by the next call to getElementBySId() or
+   * getElementByMetaId(). This is called whenever elements are added to or
+   * removed from the document.
+   */
+  void invalidateIdIndex();
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Updates the identifier index of this TSBDocument when the "id" of an
+   * element changes.
+   *
+   * @param element the TSBBase whose "id" is changing.
+   *
+   * @param oldId the previous value, which may be empty.
+   *
+   * @param newId the new value, which may be empty.
+   */
+  void updateSIdIndex(TSBBase* element,
+                      const std::string& oldId,
+                      const std::string& newId);
+
+  /** @endcond */
+
+
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Updates the identifier index of this TSBDocument when the "metaid" of an
+   * element changes.
+   *
+   * @param element the TSBBase whose "metaid" is changing.
+   *
+   * @param oldId the previous value, which may be empty.
+   *
+   * @param newId the new value, which may be empty.
+   */
+  void updateMetaIdIndex(TSBBase* element,
+                         const std::string& oldId,
+                         const std::string& newId);
+
+  /** @endcond */
+
+
 protected:
 
 
@@ -960,6 +1358,18 @@ protected:
   /** @endcond */
 
 
+
+  /** @cond doxygenlibTSBInternal */
+
+  /**
+   * Rebuilds the identifier index of this TSBDocument from all the elements it
+   * contains.
+   */
+  void rebuildIdIndex();
+
+  /** @endcond */
+
+
 };
 
 
@@ -186,14 +186,22 @@ TSBError::TSBError (  const unsigned int errorId
   {
     unsigned int tableSize = sizeof(tsbErrorTable)/sizeof(tsbErrorTable[0]);
     unsigned int index = 0;
+    unsigned int low = 0;
+    unsigned int high = tableSize;
 
-    for ( unsigned int i = 0; i < tableSize; i++ )
+    // the table is written in order of error code so we can bisect it
+    while ( low < high )
     {
-      if ( mErrorId == tsbErrorTable[i].code )
-      {
-        index = i;
-        break;
-      }
+      unsigned int mid = low + (high - low) / 2;
+      if ( tsbErrorTable[mid].code < mErrorId )
+        low = mid + 1;
+      else
+        high = mid;
+    }
+
+    if ( low < tableSize && tsbErrorTable[low].code == mErrorId )
+    {
+      index = low;
     }
 
     if ( index == 0 && mErrorId != TSBUnknown )
@@ -121,6 +121,45 @@ TSBErrorLog::logError ( const unsigned int errorId
 }
 
 
+/*
+ * Replaces the error at position n with a newly created TSBError.
+ */
+void
+TSBErrorLog::replaceError ( const unsigned int n
+                           , const unsigned int errorId
+                           , const unsigned int level
+                           , const unsigned int version
+                           , const std::string& details
+                           , const unsigned int line
+                           , const unsigned int column
+                           , const unsigned int severity
+                           , const unsigned int category )
+{
+  size_t numBefore = mErrors.size();
+  add( TSBError( errorId, level, version, details, line, column,
+                  severity, category ));
+
+  if (n >= numBefore)
+  {
+    return;
+  }
+
+  delete mErrors[n];
+
+  if (mErrors.size() > numBefore)
+  {
+    // move the newly added error into the slot of the one it replaces
+    mErrors[n] = mErrors.back();
+    mErrors.pop_back();
+  }
+  else
+  {
+    // the replacement was not applicable so was not logged
+    mErrors.erase(mErrors.begin() + n);
+  }
+}
+
+
 /*
  * Adds the given TSBError to the log.
  *
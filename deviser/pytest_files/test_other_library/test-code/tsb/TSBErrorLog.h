@@ -204,6 +204,33 @@ public:
   );
 
 
+  /**
+   * Replaces the error at position @p n in the log with a newly created
+   * TSBError, keeping its position in the log.
+   *
+   * This avoids the cost of searching the log for the error to be
+   * removed and appending its replacement when an error that has just
+   * been logged needs to be reported with a more specific error code.
+   * If @p n is out of range the new error is simply logged.
+   *
+   * @param n an unsigned int, the index of the error to be replaced.
+   *
+   * The remaining arguments are as for logError().
+   */
+  void replaceError
+  (
+      const unsigned int n
+    , const unsigned int errorId  = 0
+    , const unsigned int level    = TSB_DEFAULT_LEVEL
+    , const unsigned int version  = TSB_DEFAULT_VERSION
+    , const std::string& details  = ""
+    , const unsigned int line     = 0
+    , const unsigned int column   = 0
+    , const unsigned int severity = LIBTSB_SEV_ERROR
+    , const unsigned int category = LIBTSB_CAT_TSB
+  );
+
+
   /**
    * Adds the given TSBError to the log.
    *
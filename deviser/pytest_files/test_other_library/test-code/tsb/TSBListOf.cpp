@@ -352,6 +352,7 @@ TSBListOf::clear (bool doDelete)
     for_each( mItems.begin(), mItems.end(), Delete() );
   
   mItems.clear();
+  invalidateDocumentIdIndex();
 }
 
 
@@ -374,7 +375,13 @@ TSBListOf::remove (unsigned int n)
 {
   TSBBase* item = get(n);
   
-  if (item != NULL) mItems.erase( mItems.begin() + n );
+  if (item != NULL)
+  {
+    mItems.erase( mItems.begin() + n );
+    // the removed item no longer belongs to the document
+    invalidateDocumentIdIndex();
+    item->setTSBDocument(NULL);
+  }
   
   return item;
 }
@@ -57,7 +57,6 @@ LIBTSB_CPP_NAMESPACE_BEGIN
 TSBListOfComments::TSBListOfComments(unsigned int level, unsigned int version)
   : TSBListOf(level, version)
 {
-  setTSBNamespacesAndOwn(new TSBNamespaces(level, version));
 }
 
 
@@ -185,6 +184,8 @@ TSBListOfComments::remove(const std::string& sid)
   {
     item = *result;
     mItems.erase(result);
+    invalidateDocumentIdIndex();
+    item->setTSBDocument(NULL);
   }
 
   return static_cast <TSBComment*> (item);
@@ -261,6 +262,87 @@ TSBListOfComments::createComment()
 }
 
 
+/*
+ * Fills the given columns with the attributes of every TSBComment in this
+ * TSBListOfComments.
+ */
+void
+TSBListOfComments::exportColumns(Columns& columns) const
+{
+  unsigned int n = size();
+  columns.contributor.resize(n);
+  columns.isSetContributor.resize(n);
+  columns.number.resize(n);
+  columns.isSetNumber.resize(n);
+  columns.point.resize(n);
+  columns.isSetPoint.resize(n);
+
+  for (unsigned int i = 0; i < n; i++)
+  {
+    const TSBComment* item = get(i);
+    columns.contributor[i] = item->getContributor();
+    columns.isSetContributor[i] = item->isSetContributor();
+    columns.number[i] = item->getNumber();
+    columns.isSetNumber[i] = item->isSetNumber();
+    columns.point[i] = item->getPoint();
+    columns.isSetPoint[i] = item->isSetPoint();
+  }
+}
+
+
+/*
+ * Creates a TSBComment in this TSBListOfComments for each row of the given
+ * columns.
+ */
+int
+TSBListOfComments::importColumns(const Columns& columns)
+{
+  size_t n = columns.contributor.size();
+  bool sameSize = (columns.isSetContributor.size() == n);
+  sameSize = sameSize && (columns.number.size() == n);
+  sameSize = sameSize && (columns.isSetNumber.size() == n);
+  sameSize = sameSize && (columns.point.size() == n);
+  sameSize = sameSize && (columns.isSetPoint.size() == n);
+
+  if (!sameSize)
+  {
+    return LIBTSB_INVALID_ATTRIBUTE_VALUE;
+  }
+
+  int result = LIBTSB_OPERATION_SUCCESS;
+
+  for (size_t i = 0; i < n; i++)
+  {
+    TSBComment* item = createComment();
+
+    if (item == NULL)
+    {
+      return LIBTSB_OPERATION_FAILED;
+    }
+
+    if (columns.isSetContributor[i] &&
+      item->setContributor(columns.contributor[i]) != LIBTSB_OPERATION_SUCCESS)
+    {
+      result = LIBTSB_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetNumber[i] && item->setNumber(columns.number[i]) !=
+      LIBTSB_OPERATION_SUCCESS)
+    {
+      result = LIBTSB_INVALID_ATTRIBUTE_VALUE;
+    }
+
+    if (columns.isSetPoint[i] && item->setPoint(columns.point[i]) !=
+      LIBTSB_OPERATION_SUCCESS)
+    {
+      result = LIBTSB_INVALID_ATTRIBUTE_VALUE;
+    }
+  }
+
+  return result;
+}
+
+
 /*
  * Returns the XML element name of this TSBListOfComments object.
  */
@@ -293,6 +375,34 @@ TSBListOfComments::getItemTypeCode() const
 }
 
 
+/*
+ * Calls @p action on each child TSBBase object, including those nested to an
+ * arbitrary depth, in the order getAllElements() lists them.
+ */
+bool
+TSBListOfComments::forEachElement(bool (*action)(TSBBase*, void*),
+                                  void* userData,
+                                  TSBElementFilter* filter)
+{
+  for (unsigned int i = 0; i < size(); i++)
+  {
+    TSBComment* item = get(i);
+
+    if ((filter == NULL || filter->filter(item)) && !action(item, userData))
+    {
+      return false;
+    }
+
+    if (!item->forEachElement(action, userData, filter))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
 
 /** @cond doxygenlibTSBInternal */
 
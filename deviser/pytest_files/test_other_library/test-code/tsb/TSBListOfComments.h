@@ -51,6 +51,7 @@
 
 
 #include <string>
+#include <vector>
 
 
 #include <tsb/TSBListOf.h>
@@ -309,6 +310,53 @@ public:
   TSBComment* createComment();
 
 
+  /**
+   * The attributes of the TSBComment objects in a TSBListOfComments, with one
+   * column for each attribute and one saying whether it is set.
+   */
+  struct Columns
+  {
+    std::vector<std::string> contributor;
+    std::vector<bool> isSetContributor;
+    std::vector<double> number;
+    std::vector<bool> isSetNumber;
+    std::vector<std::string> point;
+    std::vector<bool> isSetPoint;
+  };
+
+
+  /**
+   * Fills the given columns with the attributes of every TSBComment in this
+   * TSBListOfComments.
+   *
+   * @param columns the Columns to fill; each column is resized to the number
+   * of TSBComment objects and row i describes the TSBComment at index i.
+   *
+   * @note this reads every object in one pass, which is faster than calling
+   * the getters of each object in turn.
+   */
+  void exportColumns(Columns& columns) const;
+
+
+  /**
+   * Creates a TSBComment in this TSBListOfComments for each row of the given
+   * columns.
+   *
+   * @param columns the Columns to read; every column must have the same number
+   * of rows.
+   *
+   * @copydetails doc_returns_success_code
+   * @li @tsbconstant{LIBTSB_OPERATION_SUCCESS, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_INVALID_ATTRIBUTE_VALUE, OperationReturnValues_t}
+   * @li @tsbconstant{LIBTSB_OPERATION_FAILED, OperationReturnValues_t}
+   *
+   * @note attributes that are not set in a row are left unset on the
+   * TSBComment created for it; a value that cannot be set does not stop the
+   * remaining rows being created.
+   */
+  int importColumns(const Columns& columns);
+
+
   /**
    * Returns the XML element name of this TSBListOfComments object.
    *
@@ -359,6 +407,27 @@ public:
   #endif /* !SWIG */
 
 
+  /**
+   * Calls @p action on each child TSBBase object, including those nested to an
+   * arbitrary depth, in the order getAllElements() lists them.
+   *
+   * @param action the function to call with each element and @p userData;
+   * returning @c false stops the walk.
+   *
+   * @param userData a pointer passed on to @p action.
+   *
+   * @param filter an ElementFilter that may impose restrictions on the objects
+   * passed to @p action.
+   *
+   * @return @c false if @p action stopped the walk, @c true otherwise.
+   *
+   * The walk itself allocates no memory.
+   */
+  virtual bool forEachElement(bool (*action)(TSBBase*, void*),
+                              void* userData,
+                              TSBElementFilter * filter = NULL);
+
+
 protected:
 
 
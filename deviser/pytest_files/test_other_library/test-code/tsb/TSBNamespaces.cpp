@@ -47,6 +47,20 @@ using namespace std;
 
 /** @endcond */
 
+/*
+ * Frozen objects are shared between documents, which may be read, copied
+ * and deleted on different threads, so their reference counts are changed
+ * atomically. Both macros return the new count.
+ */
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define TSB_ATOMIC_INCREMENT(count) _InterlockedIncrement(&(count))
+#define TSB_ATOMIC_DECREMENT(count) _InterlockedDecrement(&(count))
+#else
+#define TSB_ATOMIC_INCREMENT(count) __sync_add_and_fetch(&(count), 1)
+#define TSB_ATOMIC_DECREMENT(count) __sync_sub_and_fetch(&(count), 1)
+#endif
+
 
 LIBTSB_CPP_NAMESPACE_BEGIN
 
@@ -86,6 +100,10 @@ TSBNamespaces::initTSBNamespace()
 TSBNamespaces::TSBNamespaces(unsigned int level, unsigned int version)
  : mLevel(level)
   ,mVersion(version)
+  ,mRefCount(0)
+  ,mFrozen(false)
+  ,mFrozenCopy(NULL)
+  ,mWithoutNamespaces(NULL)
 {
   initTSBNamespace();
 }
@@ -95,6 +113,8 @@ TSBNamespaces::~TSBNamespaces()
 {
   if (mNamespaces != NULL)
     delete mNamespaces;
+  release(mFrozenCopy);
+  release(mWithoutNamespaces);
 }
 
 
@@ -105,6 +125,10 @@ TSBNamespaces::TSBNamespaces(const TSBNamespaces& orig)
  : mLevel(orig.mLevel)
  , mVersion(orig.mVersion)
  , mNamespaces(NULL)
+ , mRefCount(0)
+ , mFrozen(false)
+ , mFrozenCopy(NULL)
+ , mWithoutNamespaces(NULL)
 {
   if(orig.mNamespaces != NULL)
     this->mNamespaces = 
@@ -148,6 +172,9 @@ TSBNamespaces::operator=(const TSBNamespaces& rhs)
             new XMLNamespaces(*const_cast<TSBNamespaces&>(rhs).mNamespaces);
     else
       this->mNamespaces = NULL;
+    // the reference count belongs to this object, not to its contents
+    release(mFrozenCopy);
+    mFrozenCopy = NULL;
   }
 
   return *this;
@@ -386,6 +413,177 @@ TSBNamespaces::setNamespaces(XMLNamespaces * xmlns)
   else
     mNamespaces = NULL;
 }
+
+
+TSBNamespaces*
+TSBNamespaces::share(TSBNamespaces* tsbns)
+{
+  if (tsbns == NULL) return NULL;
+
+  if (tsbns->mFrozen)
+  {
+    TSB_ATOMIC_INCREMENT(tsbns->mRefCount);
+    return tsbns;
+  }
+
+  // an object that can still be changed is never shared itself; its frozen
+  // copy is, and is made again if the object has changed since
+  if (tsbns->mFrozenCopy == NULL ||
+      !tsbns->mFrozenCopy->hasSameNamespaces(*tsbns))
+  {
+    release(tsbns->mFrozenCopy);
+    tsbns->mFrozenCopy = freeze(tsbns->clone());
+  }
+
+  return share(tsbns->mFrozenCopy);
+}
+
+
+TSBNamespaces*
+TSBNamespaces::adopt(TSBNamespaces* tsbns)
+{
+  if (tsbns != NULL)
+  {
+    TSB_ATOMIC_INCREMENT(tsbns->mRefCount);
+  }
+
+  return tsbns;
+}
+
+
+void
+TSBNamespaces::release(TSBNamespaces* tsbns)
+{
+  if (tsbns == NULL) return;
+
+  // an object never adopted belongs to the caller, whose release deletes it
+  if (TSB_ATOMIC_DECREMENT(tsbns->mRefCount) <= 0)
+  {
+    delete tsbns;
+  }
+}
+
+
+TSBNamespaces*
+TSBNamespaces::unshare(TSBNamespaces* tsbns)
+{
+  if (tsbns == NULL || !tsbns->mFrozen) return tsbns;
+
+  TSBNamespaces* copy = adopt(tsbns->clone());
+  copy->mFrozenCopy = tsbns;
+  return copy;
+}
+
+
+TSBNamespaces*
+TSBNamespaces::intern(unsigned int level, unsigned int version)
+{
+  // the list is NULL while the library is still being loaded
+  if (mInternedNamespaces != NULL)
+  {
+    for (unsigned int i = 0; i < mInternedNamespaces->getSize(); i++)
+    {
+      TSBNamespaces* tsbns =
+        static_cast<TSBNamespaces*>(mInternedNamespaces->get(i));
+      if (tsbns->mLevel == level && tsbns->mVersion == version)
+      {
+        return share(tsbns);
+      }
+    }
+  }
+
+  return freeze(new TSBNamespaces(level, version));
+}
+
+
+bool
+TSBNamespaces::isFrozen() const
+{
+  return mFrozen;
+}
+
+
+TSBNamespaces*
+TSBNamespaces::shareWithoutNamespaces()
+{
+  if (!mFrozen)
+  {
+    TSBNamespaces* frozen = share(this);
+    TSBNamespaces* variant = frozen->shareWithoutNamespaces();
+    release(frozen);
+    return variant;
+  }
+
+  if (mWithoutNamespaces == NULL)
+  {
+    return share(this);
+  }
+
+  return share(mWithoutNamespaces);
+}
+
+
+TSBNamespaces*
+TSBNamespaces::freeze(TSBNamespaces* tsbns)
+{
+  // the variant without XML namespaces is made now rather than on first
+  // use, so that nothing about a frozen object changes once it is shared
+  if (tsbns->mNamespaces != NULL)
+  {
+    TSBNamespaces* variant = new TSBNamespaces(*tsbns);
+    variant->setNamespaces(NULL);
+    tsbns->mWithoutNamespaces = freeze(variant);
+  }
+
+  tsbns->mFrozen = true;
+  return adopt(tsbns);
+}
+
+
+bool
+TSBNamespaces::hasSameNamespaces(const TSBNamespaces& rhs) const
+{
+  if (mLevel != rhs.mLevel || mVersion != rhs.mVersion)
+    return false;
+
+  if (mNamespaces == NULL || rhs.mNamespaces == NULL)
+    return mNamespaces == rhs.mNamespaces;
+
+  if (mNamespaces->getLength() != rhs.mNamespaces->getLength())
+    return false;
+
+  for (int i = 0; i < mNamespaces->getLength(); i++)
+  {
+    if (mNamespaces->getURI(i) != rhs.mNamespaces->getURI(i) ||
+        mNamespaces->getPrefix(i) != rhs.mNamespaces->getPrefix(i))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+
+const List*
+TSBNamespaces::internSupportedNamespaces()
+{
+  const List* supported = getSupportedNamespaces();
+  for (unsigned int i = 0; i < supported->getSize(); i++)
+  {
+    freeze(static_cast<TSBNamespaces*>(supported->get(i)));
+  }
+
+  return supported;
+}
+
+
+/*
+ * The supported namespaces are frozen when the library is loaded and kept
+ * for as long as it is.
+ */
+const List* TSBNamespaces::mInternedNamespaces =
+  TSBNamespaces::internSupportedNamespaces();
 /** @endcond */
 
 #endif /* __cplusplus */
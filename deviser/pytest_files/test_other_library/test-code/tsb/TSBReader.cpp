@@ -49,6 +49,15 @@
 #include <compress/CompressCommon.h>
 #include <compress/InputDecompressor.h>
 
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 /** @cond doxygenIgnored */
 
 using namespace std;
@@ -132,17 +141,79 @@ TSBReader::readTSBFromFile (const std::string& filename)
 TSBDocument*
 TSBReader::readTSBFromString (const std::string& xml)
 {
-  const static string dummy_xml ("<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n");  
-  
-  if (!strncmp(xml.c_str(), dummy_xml.c_str(), 14))
+  return readTSBFromBuffer(xml.c_str(), xml.size() + 1);
+}
+
+
+/*
+ * Reads an TSB document from the given buffer, which need not be
+ * null-terminated.
+ *
+ * The buffer is parsed in place if it begins with the XML declaration and
+ * its last character is the terminating null; otherwise it is copied once,
+ * prepending the declaration if it is missing.
+ */
+TSBDocument*
+TSBReader::readTSBFromBuffer (const char* data, size_t length)
+{
+  static const char dummy_xml[] =
+    "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+
+  if (data == NULL)
   {
-    return readInternal(xml.c_str(), false);
+    length = 0;
   }
-  else
+
+  const bool hasDeclaration =
+    (length >= 14 && strncmp(data, dummy_xml, 14) == 0);
+
+  if (hasDeclaration && data[length - 1] == '\0')
+  {
+    return readInternal(data, false);
+  }
+
+  std::string xml;
+  xml.reserve(sizeof(dummy_xml) + length);
+  if (!hasDeclaration)
   {
-    const std::string temp = (dummy_xml + xml);
-    return readInternal(temp.c_str(), false);
+    xml.append(dummy_xml);
   }
+  if (length > 0)
+  {
+    xml.append(data, length);
+  }
+
+  return readInternal(xml.c_str(), false);
+}
+
+
+/*
+ * Reads each of the given files into a document of its own, using one
+ * reader per file and up to numThreads OpenMP threads.
+ */
+std::vector<TSBDocument*>
+TSBReader::readBatch (const std::vector<std::string>& filenames,
+                       unsigned int numThreads)
+{
+  int count = static_cast<int>(filenames.size());
+  std::vector<TSBDocument*> documents(filenames.size(), NULL);
+
+  if (numThreads < 1)
+  {
+    numThreads = 1;
+  }
+
+  // files differ widely in size so hand them out one at a time
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1)
+#endif
+  for (int i = 0; i < count; i++)
+  {
+    TSBReader reader;
+    documents[i] = reader.readTSBFromFile(filenames[i]);
+  }
+
+  return documents;
 }
 
 
@@ -205,6 +276,98 @@ isCriticalError(const unsigned int errorId)
 /** @endcond */
 
 
+/** @cond doxygenLibtsbInternal */
+/*
+ * Maps an uncompressed file into memory for the lifetime of this object so
+ * that it can be parsed in place rather than read through a file buffer.
+ *
+ * The parser needs a null character after the content, so the mapping is
+ * only kept when the file does not end on a page boundary, as the rest of
+ * the last page is then zero-filled.  Otherwise, for compressed files and
+ * on platforms without mmap, getContent() returns NULL and the file is read
+ * as before.
+ */
+class MappedFile
+{
+public:
+  MappedFile (const char* filename)
+    : mContent (NULL)
+    , mLength (0)
+  {
+#if !defined(_WIN32)
+    if (filename == NULL || isCompressed(filename))
+    {
+      return;
+    }
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return;
+    }
+
+    struct stat info;
+    long pageSize = sysconf(_SC_PAGESIZE);
+    if (fstat(fd, &info) == 0 && S_ISREG(info.st_mode) && info.st_size > 0
+      && pageSize > 0 && (info.st_size % pageSize) != 0)
+    {
+      void* content = mmap(NULL, (size_t)info.st_size, PROT_READ,
+                           MAP_PRIVATE, fd, 0);
+      if (content != MAP_FAILED)
+      {
+        mContent = static_cast<const char*>(content);
+        mLength = (size_t)info.st_size;
+      }
+    }
+
+    close(fd);
+#else
+    (void)filename;
+#endif
+  }
+
+  ~MappedFile ()
+  {
+#if !defined(_WIN32)
+    if (mContent != NULL)
+    {
+      munmap(const_cast<char*>(mContent), mLength);
+    }
+#endif
+  }
+
+  const char* getContent () const
+  {
+    return mContent;
+  }
+
+private:
+  static bool isCompressed (const char* filename)
+  {
+    const size_t length = strlen(filename);
+    const char* suffixes[] = { ".gz", ".zip", ".bz2" };
+
+    for (size_t i = 0; i < sizeof(suffixes) / sizeof(suffixes[0]); ++i)
+    {
+      const size_t n = strlen(suffixes[i]);
+      if (length >= n && strcmp(filename + length - n, suffixes[i]) == 0)
+      {
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  MappedFile (const MappedFile&);
+  MappedFile& operator= (const MappedFile&);
+
+  const char* mContent;
+  size_t mLength;
+};
+/** @endcond */
+
+
 /** @cond doxygenLibtsbInternal */
 /*
  * Used by readTSB() and readTSBFromString().
@@ -220,6 +383,14 @@ TSBReader::readInternal (const char* content, bool isFile)
   }
   else 
   {
+    // the mapping must outlive the stream reading from it
+    MappedFile mapped(isFile ? content : NULL);
+    if (mapped.getContent() != NULL)
+    {
+      content = mapped.getContent();
+      isFile = false;
+    }
+
     XMLInputStream stream(content, isFile, "", d->getErrorLog());
 
     if (stream.peek().isStart() && stream.peek().getName() != "tsb")
@@ -338,6 +509,17 @@ TSBReader_readTSBFromString (TSBReader_t *sr, const char *xml)
 }
 
 
+LIBTSB_EXTERN
+TSBDocument_t *
+TSBReader_readTSBFromBuffer (TSBReader_t *sr, const char *data, size_t length)
+{
+  if (sr != NULL)
+    return sr->readTSBFromBuffer(data, length);
+  else
+    return NULL;
+}
+
+
 LIBTSB_EXTERN
 int
 TSBReader_hasZlib (void)
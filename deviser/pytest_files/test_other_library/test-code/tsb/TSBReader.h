@@ -46,10 +46,13 @@
 #include <tsb/common/extern.h>
 #include <tsb/common/tsbfwd.h>
 
+#include <stddef.h>
+
 #ifdef __cplusplus
 
 
 #include <string>
+#include <vector>
 
 LIBTSB_CPP_NAMESPACE_BEGIN
 
@@ -118,6 +121,52 @@ public:
   TSBDocument* readTSBFromString (const std::string& xml);
 
 
+  /**
+   * Reads an TSB document from the given buffer, for example one
+   * received from a message queue.
+   *
+   * The buffer need not be null-terminated.  It is parsed in place, without
+   * being copied, when it begins with an XML declaration and @p length
+   * includes a terminating null character; otherwise it is copied once,
+   * with the XML declaration prepended if it is missing.
+   *
+   * @param data the XML content.
+   *
+   * @param length the number of characters in @p data.
+   *
+   * @return a pointer to the TSBDocument created from the TSB content.
+   *
+   * @see TSBReader::readTSBFromString(@if java String@endif)
+   */
+  TSBDocument* readTSBFromBuffer (const char* data, size_t length);
+
+
+#ifndef SWIG
+  /**
+   * Reads each of the given files into a document of its own, using up to
+   * @p numThreads threads.
+   *
+   * Documents share no mutable state, so each file is read independently
+   * and each document has its own error log.  A file that cannot be read
+   * gives a document reporting the error, as readTSBFromFile() does.
+   * Threads are only used when the library is built with OpenMP; otherwise
+   * the files are read in turn.
+   *
+   * @param filenames the names or full pathnames of the files to be read.
+   *
+   * @param numThreads the maximum number of threads to use.
+   *
+   * @return the documents in the order of @p filenames.  The caller owns
+   * them and should delete each one when it is no longer needed.
+   *
+   * @see TSBReader::readTSBFromFile(@if java String@endif)
+   */
+  static std::vector<TSBDocument*>
+  readBatch (const std::vector<std::string>& filenames,
+             unsigned int numThreads = 1);
+#endif
+
+
   /**
    * Static method; returns @c true if this copy of libTSB supports
    * <i>gzip</I> and <i>zip</i> format compression.
@@ -246,6 +295,24 @@ TSBDocument_t *
 TSBReader_readTSBFromString (TSBReader_t *sr, const char *xml);
 
 
+/**
+ * @param sr the TSBReader_t structure to use
+ *
+ * @param data the input xml, which need not be null-terminated.
+ *
+ * @param length the number of characters in @p data.
+ *
+ * @return a pointer to the TSBDocument read.
+ *
+ * @if conly
+ * @memberof TSBReader_t
+ * @endif
+ */
+LIBTSB_EXTERN
+TSBDocument_t *
+TSBReader_readTSBFromBuffer (TSBReader_t *sr, const char *data, size_t length);
+
+
 /**
  * Returns @c true if the underlying libTSB supports @em gzip and @em zlib
  * format compression.
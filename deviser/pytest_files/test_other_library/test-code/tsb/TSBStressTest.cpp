@@ -0,0 +1,307 @@
+/**
+ * @file TSBStressTest.cpp
+ * @brief Program reading, copying and deleting documents on many threads at
+ * once.
+ * @author DEVISER
+ *
+ * <!--------------------------------------------------------------------------
+ * This file is part of libSBML. Please visit http://sbml.org for more
+ * information about SBML, and the latest version of libSBML.
+ *
+ * Copyright (C) 2019 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2013-2018 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ * 3. University of Heidelberg, Heidelberg, Germany
+ *
+ * Copyright (C) 2009-2013 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. EMBL European Bioinformatics Institute (EMBL-EBI), Hinxton, UK
+ *
+ * Copyright (C) 2006-2008 by the California Institute of Technology,
+ * Pasadena, CA, USA
+ *
+ * Copyright (C) 2002-2005 jointly by the following organizations:
+ * 1. California Institute of Technology, Pasadena, CA, USA
+ * 2. Japan Science and Technology Agency, Japan
+ *
+ * This library is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU Lesser General Public License as published by the
+ * Free Software Foundation. A copy of the license agreement is provided in the
+ * file named "LICENSE.txt" included with this software distribution and also
+ * available online as http://sbml.org/software/libsbml/license.html
+ * ------------------------------------------------------------------------ -->
+ */
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+
+#include <tsb/TSBTypes.h>
+
+/** @cond doxygenIgnored */
+
+using namespace std;
+
+/** @endcond */
+
+LIBTSB_CPP_NAMESPACE_USE
+
+
+static bool
+countElement(TSBBase*, void* userData)
+{
+  ++*static_cast<unsigned int*>(userData);
+  return true;
+}
+
+
+static unsigned int
+countElements(TSBDocument* doc)
+{
+  unsigned int count = 1;
+  doc->forEachElement(countElement, &count);
+  return count;
+}
+
+
+/*
+ * Adds the given file to the list or, for a directory, the .xml files in
+ * it and in the directories below it, in name order.
+ */
+static void
+addDocuments(const std::string& path, std::vector<std::string>& filenames,
+             bool named)
+{
+  std::vector<std::string> found;
+
+#if defined(_WIN32)
+  WIN32_FIND_DATAA entry;
+  HANDLE dir = FindFirstFileA((path + "\\*").c_str(), &entry);
+  if (dir == INVALID_HANDLE_VALUE)
+  {
+    dir = NULL;
+  }
+  else
+  {
+    do
+    {
+      if (strcmp(entry.cFileName, ".") != 0
+        && strcmp(entry.cFileName, "..") != 0)
+      {
+        found.push_back(path + "\\" + entry.cFileName);
+      }
+    }
+    while (FindNextFileA(dir, &entry));
+    FindClose(dir);
+  }
+#else
+  DIR* dir = opendir(path.c_str());
+  if (dir != NULL)
+  {
+    struct dirent* entry;
+    while ((entry = readdir(dir)) != NULL)
+    {
+      if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, "..") != 0)
+      {
+        found.push_back(path + "/" + entry->d_name);
+      }
+    }
+    closedir(dir);
+  }
+#endif
+
+  if (dir == NULL)
+  {
+    size_t length = path.size();
+    if (named || (length > 4 && path.compare(length - 4, 4, ".xml") == 0))
+    {
+      filenames.push_back(path);
+    }
+    return;
+  }
+
+  std::sort(found.begin(), found.end());
+  for (size_t i = 0; i < found.size(); i++)
+  {
+    addDocuments(found[i], filenames, false);
+  }
+}
+
+
+/*
+ * What a document read on its own comes out as.
+ */
+struct Expected
+{
+  unsigned int level;
+  unsigned int version;
+  unsigned int numElements;
+  unsigned int numErrors;
+};
+
+
+static bool
+matches(TSBDocument* doc, const Expected& expected)
+{
+  return doc != NULL && doc->getLevel() == expected.level
+    && doc->getVersion() == expected.version
+    && countElements(doc) == expected.numElements;
+}
+
+
+/*
+ * Reads the documents named, or the .xml files in and below the
+ * directories named, such as the test-examples tree of the deviser test
+ * suite, on many threads at once; then copies and deletes the copies on
+ * many threads at once, so that different packages and error paths run
+ * concurrently and the namespaces objects the documents share are
+ * referenced and released concurrently. Every document must come out the
+ * same as when its file is read on its own.
+ *
+ * usage: TSBStressTest [-t numThreads] [-n numRounds] path [path ...]
+ */
+int
+main(int argc, char* argv[])
+{
+  unsigned int numThreads = 8;
+  unsigned int numRounds = 10;
+  int first = 1;
+  while (first + 1 < argc && argv[first][0] == '-')
+  {
+    if (strcmp(argv[first], "-t") == 0)
+    {
+      numThreads = atoi(argv[first + 1]);
+    }
+    else if (strcmp(argv[first], "-n") == 0)
+    {
+      numRounds = atoi(argv[first + 1]);
+    }
+    else
+    {
+      break;
+    }
+    first += 2;
+  }
+
+  if (first >= argc || argv[first][0] == '-')
+  {
+    cout << "usage: TSBStressTest [-t numThreads] [-n numRounds] "
+         << "path [path ...]" << endl;
+    return 2;
+  }
+  if (numThreads < 1) numThreads = 1;
+
+  std::vector<std::string> files;
+  for (int i = first; i < argc; i++)
+  {
+    addDocuments(argv[i], files, true);
+  }
+
+  // each file is first read on its own; files that cannot be read are
+  // kept, so that error paths run concurrently too
+  TSBReader reader;
+  std::vector<Expected> expected(files.size());
+  unsigned int level = 0;
+  unsigned int version = 0;
+  for (size_t i = 0; i < files.size(); i++)
+  {
+    TSBDocument* doc = reader.readTSBFromFile(files[i]);
+    expected[i].level = doc->getLevel();
+    expected[i].version = doc->getVersion();
+    expected[i].numElements = countElements(doc);
+    expected[i].numErrors = doc->getNumErrors();
+    if (level == 0 && doc->getNumErrors(LIBTSB_SEV_FATAL) == 0)
+    {
+      level = doc->getLevel();
+      version = doc->getVersion();
+    }
+    delete doc;
+  }
+
+  if (level == 0)
+  {
+    cout << "none of the " << files.size() << " files could be read"
+         << endl;
+    return 1;
+  }
+
+  // every thread gets several documents each round
+  std::vector<std::string> filenames;
+  while (filenames.size() < numThreads * 4)
+  {
+    filenames.insert(filenames.end(), files.begin(), files.end());
+  }
+  int count = static_cast<int>(filenames.size());
+  int numFiles = static_cast<int>(files.size());
+  int failures = 0;
+
+  for (unsigned int round = 0; round < numRounds; round++)
+  {
+    std::vector<TSBDocument*> docs =
+      TSBReader::readBatch(filenames, numThreads);
+    std::vector<TSBDocument*> copies(docs.size(), NULL);
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1) reduction(+:failures)
+#endif
+    for (int i = 0; i < count; i++)
+    {
+      // new elements share the interned namespaces for their level and
+      // version, as do the elements read from the files
+      TSBDocument created(level, version);
+      if (created.getSharedTSBNamespaces()->getLevel() != level)
+      {
+        failures++;
+      }
+
+      if (!matches(docs[i], expected[i % numFiles])
+        || docs[i]->getNumErrors() != expected[i % numFiles].numErrors)
+      {
+        failures++;
+      }
+      if (docs[i] != NULL)
+      {
+        copies[i] = docs[i]->clone();
+      }
+      delete docs[i];
+    }
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(numThreads) schedule(dynamic, 1) reduction(+:failures)
+#endif
+    for (int i = 0; i < count; i++)
+    {
+      if (!matches(copies[i], expected[i % numFiles]))
+      {
+        failures++;
+      }
+      delete copies[i];
+    }
+  }
+
+  // the interned namespaces must have outlived every document
+  TSBDocument created(level, version);
+  if (created.getSharedTSBNamespaces()->getVersion() != version)
+  {
+    failures++;
+  }
+
+  cout << numRounds << " rounds of " << count << " documents from "
+       << numFiles << " files on " << numThreads << " threads: "
+       << failures << " failures" << endl;
+  return (failures == 0) ? 0 : 1;
+}
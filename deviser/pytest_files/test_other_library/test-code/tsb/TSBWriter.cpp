@@ -40,6 +40,9 @@
 #include <iostream>
 #include <fstream>
 #include <sstream>
+#include <streambuf>
+#include <cstdlib>
+#include <cstring>
 
 #include <tsb/common/common.h>
 #include <xml/XMLOutputStream.h>
@@ -62,6 +65,129 @@ LIBTSB_CPP_NAMESPACE_BEGIN
 
 #ifdef __cplusplus
 
+/** @cond doxygenLibtsbInternal */
+/*
+ * Stream buffer handing its contents to an TSBWriterSink_t in chunks of
+ * at most BUFFER_SIZE bytes.
+ */
+class SinkStreamBuf : public std::streambuf
+{
+public:
+
+  SinkStreamBuf (TSBWriterSink_t sink, void* userData)
+    : mSink (sink)
+    , mUserData (userData)
+  {
+    setp(mBuffer, mBuffer + BUFFER_SIZE);
+  }
+
+protected:
+
+  int overflow (int c)
+  {
+    if (!flushBuffer())
+    {
+      return traits_type::eof();
+    }
+
+    if (!traits_type::eq_int_type(c, traits_type::eof()))
+    {
+      *pptr() = traits_type::to_char_type(c);
+      pbump(1);
+    }
+
+    return traits_type::not_eof(c);
+  }
+
+  int sync ()
+  {
+    return flushBuffer() ? 0 : -1;
+  }
+
+private:
+
+  enum { BUFFER_SIZE = 8192 };
+
+  bool flushBuffer ()
+  {
+    size_t length = static_cast<size_t>(pptr() - pbase());
+
+    if (length > 0 && mSink(pbase(), length, mUserData) == 0)
+    {
+      return false;
+    }
+
+    setp(mBuffer, mBuffer + BUFFER_SIZE);
+    return true;
+  }
+
+  SinkStreamBuf (const SinkStreamBuf&);
+  SinkStreamBuf& operator= (const SinkStreamBuf&);
+
+  TSBWriterSink_t mSink;
+  void* mUserData;
+  char mBuffer[BUFFER_SIZE];
+};
+
+
+/*
+ * malloc'd buffer grown geometrically by appendToBuffer.
+ */
+struct GrowableBuffer
+{
+  char* data;
+  size_t length;
+  size_t capacity;
+};
+
+
+static int
+appendToBuffer (const char* data, size_t length, void* userData)
+{
+  GrowableBuffer* buffer = static_cast<GrowableBuffer*>(userData);
+  size_t required = buffer->length + length + 1;
+
+  if (required > buffer->capacity)
+  {
+    size_t capacity = buffer->capacity > 0 ? buffer->capacity * 2 : 16384;
+    while (capacity < required)
+    {
+      capacity *= 2;
+    }
+
+    char* grown = static_cast<char*>(realloc(buffer->data, capacity));
+    if (grown == NULL)
+    {
+      return 0;
+    }
+
+    buffer->data = grown;
+    buffer->capacity = capacity;
+  }
+
+  memcpy(buffer->data + buffer->length, data, length);
+  buffer->length += length;
+  return 1;
+}
+
+
+static int
+appendToString (const char* data, size_t length, void* userData)
+{
+  static_cast<std::string*>(userData)->append(data, length);
+  return 1;
+}
+
+
+static int
+countBytes (const char*, size_t length, void* userData)
+{
+  *static_cast<size_t*>(userData) += length;
+  return 1;
+}
+/** @endcond */
+
+
 /*
  * Creates a new TSBWriter.
  */
@@ -255,12 +381,48 @@ TSBWriter::writeTSB (const TSBDocument* d, std::ostream& stream)
 }
 
 
+/*
+ * Writes the given TSBDocument to a sink callback.  The final chunk is
+ * delivered by the std::endl that terminates the document.
+ *
+ * @return true on success and false if the sink aborted the write or one
+ * of the underlying parser components fail (rare).
+ */
+bool
+TSBWriter::writeTSB (const TSBDocument* d, TSBWriterSink_t sink,
+                       void* userData)
+{
+  if (d == NULL || sink == NULL) return false;
+
+  SinkStreamBuf buffer(sink, userData);
+  std::ostream stream(&buffer);
+
+  return writeTSB(d, stream);
+}
+
+
+/*
+ * Returns the number of bytes the given TSBDocument occupies when written
+ * out, or 0 if it could not be written.
+ */
+size_t
+TSBWriter::getSerializedSize (const TSBDocument* d)
+{
+  size_t size = 0;
+
+  return writeTSB(d, countBytes, &size) ? size : 0;
+}
+
+
 /** @cond doxygenLibtsbInternal */
 /*
  * Writes the given TSBDocument to an in-memory string and returns a
  * pointer to it.  The string is owned by the caller and should be freed
  * (with free()) when no longer needed.
  *
+ * The output is appended directly to the returned buffer, which is
+ * trimmed to size once the document is complete.
+ *
  * @return the string on success and 0 if one of the underlying parser
  * components fail (rare).
  */
@@ -268,20 +430,32 @@ LIBTSB_EXTERN
 char*
 TSBWriter::writeToString (const TSBDocument* d)
 {
-  ostringstream stream;
-  writeTSB(d, stream);
+  GrowableBuffer buffer = { NULL, 0, 0 };
 
-  return tsb_safe_strdup( stream.str().c_str() );
+  if (!writeTSB(d, appendToBuffer, &buffer) || buffer.data == NULL)
+  {
+    free(buffer.data);
+    return NULL;
+  }
+
+  buffer.data[buffer.length] = '\0';
+
+  char* trimmed = static_cast<char*>(realloc(buffer.data, buffer.length + 1));
+  return (trimmed != NULL) ? trimmed : buffer.data;
 }
 
 std::string 
 TSBWriter::writeTSBToStdString(const TSBDocument* d)
 {
-  if (d == NULL) return "";
-  
-  ostringstream stream;
-  writeTSB(d, stream);
-  return stream.str();
+  std::string result;
+  writeTSBToStdString(d, result);
+  return result;
+}
+
+bool
+TSBWriter::writeTSBToStdString(const TSBDocument* d, std::string& buffer)
+{
+  return writeTSB(d, appendToString, &buffer);
 }
 
 LIBTSB_EXTERN
@@ -407,6 +581,31 @@ TSBWriter_writeTSBToString (TSBWriter_t *sw, const TSBDocument_t *d)
 }
 
 
+LIBTSB_EXTERN
+int
+TSBWriter_writeTSBToSink ( TSBWriter_t         *sw,
+                             const TSBDocument_t *d,
+                             TSBWriterSink_t     sink,
+                             void                 *userData )
+{
+  if (sw == NULL || d == NULL || sink == NULL)
+    return 0;
+  else
+    return static_cast<int>( sw->writeTSB(d, sink, userData) );
+}
+
+
+LIBTSB_EXTERN
+size_t
+TSBWriter_getSerializedSize (TSBWriter_t *sw, const TSBDocument_t *d)
+{
+  if (sw == NULL || d == NULL)
+    return 0;
+  else
+    return sw->getSerializedSize(d);
+}
+
+
 LIBTSB_EXTERN
 int
 TSBWriter_hasZlib ()
@@ -107,6 +107,26 @@ def test_templates(name, class_name, test_case, list_of):
     assert 0 == test_utils.compare_code_impl(list_of)
 
 
+@pytest.mark.parametrize('name, class_name, test_case', [
+    ('testsbxml', 'TSBBenchmark', 'templates'),
+    ('testsbxml', 'TSBStressTest', 'templates'),
+])
+def test_test_programs(name, class_name, test_case):
+    """
+    Compare the programs written to the test directory of the library.
+
+    :param name: name of test group e.g. 'testsbxml'.
+    :param class_name: name of the program (and thus .cpp filename),
+                 e.g. 'TSBBenchmark'
+    :param test_case: brief test description, e.g. 'templates'.
+    """
+    gv.reset()
+    xml_filename = functions.set_up_test(name, class_name, test_case)
+    assert xml_filename is not None and xml_filename != ""
+    test_utils.generate_templates(xml_filename)
+    assert 0 == test_utils.compare_code_impl(class_name)
+
+
 @pytest.mark.parametrize('name, class_name, test_case, prefix, lib', [
 #     ('test_sedml', 'SedBase', 'common', 'Sed', 'sedml'),
 #     ('combine-archive', 'CaBase', 'common', 'Ca', 'combine'),
@@ -226,6 +246,7 @@ def test_cmake(name, class_name):
     assert 0 == test_utils.compare_cmake_file('src')
     assert 0 == test_utils.compare_cmake_file('src/bindings')
     assert 0 == test_utils.compare_cmake_file('src/{0}'.format(gv.language))
+    assert 0 == test_utils.compare_cmake_file('src/{0}/test'.format(gv.language))
 
 
 @pytest.mark.parametrize('name, class_name, test_case', [
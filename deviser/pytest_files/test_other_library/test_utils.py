@@ -96,6 +96,7 @@ def generate_templates(filename):
     prefix = gv.prefix
     base_files = OtherLibraryFiles.OtherLibraryFiles(prefix, ob['baseElements'], True)
     base_files.write_files()
+    base_files.write_test_files()
     os.chdir('../../.')
 
 
@@ -195,6 +196,8 @@ def generate_cmake(filename, binding):
     os.chdir('src')
     functions.create_dir('bindings')
     functions.create_dir('{0}'.format(gv.language))
+    os.chdir('{0}'.format(gv.language))
+    functions.create_dir('test')
     os.chdir(this_dir)
     bind = CMakeFiles.CMakeFiles(ob, this_dir, True)
     bind.write_other_library_files()
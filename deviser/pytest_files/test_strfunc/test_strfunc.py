@@ -297,6 +297,11 @@ prefix_data = {"FbcType": "FbcType", "FluxObjective": "FluxObjective",
          'Fooparameter': False},
         {}, ''),
 
+    (sf.upper_snake,
+        {'numSamples1': 'NUM_SAMPLES1', 'id': 'ID', 'xml:lang': 'XML_LANG',
+         'SBOTerm': 'SBO_TERM', 'isActive': 'IS_ACTIVE'},
+        {}, ''),
+
 ])
 def test_many_things(func, test_data, kwargs, do_first):
     """
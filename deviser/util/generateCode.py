@@ -291,6 +291,8 @@ def generate_code_files(name, ob):
                                                                       language)
     constraints_dir = '{0}{1}src{1}{2}{1}packages{1}{0}{1}validator{1}' \
                       'constraints'.format(name, os.sep, language)
+    valid_test_dir = '{0}{1}src{1}{2}{1}packages{1}{0}{1}validator{1}' \
+                     'test'.format(name, os.sep, language)
     sbml_dir = '{0}{1}src{1}{2}{1}packages{1}{0}{1}{2}'.format(name, os.sep,
                                                                language)
     os.chdir(common_dir)
@@ -317,6 +319,11 @@ def generate_code_files(name, ob):
     all_files.write_constraint_files()
     os.chdir(this_dir)
 
+    os.chdir(valid_test_dir)
+    all_files = ValidationFiles.ValidationFiles(ob, True)
+    all_files.write_benchmark_file()
+    os.chdir(this_dir)
+
     # need to do this last so that the error table is populated
     os.chdir(sbml_dir)
     for working_class in ob['baseElements']:
@@ -344,6 +351,7 @@ def generate_other_library_code_files(name, ob):
     prefix = gv.prefix
     main_dir = '{0}{1}src{1}{2}'.format(name, os.sep, language)
     common_dir = '{0}{1}src{1}{2}{1}common'.format(name, os.sep, language)
+    test_dir = '{0}{1}src{1}{2}{1}test'.format(name, os.sep, language)
     # binding_dir = '{0}{1}src{1}bindings'.format(name, os.sep)
     os.chdir(main_dir)
 
@@ -362,6 +370,10 @@ def generate_other_library_code_files(name, ob):
     base_files.write_files()
     os.chdir(this_dir)
 
+    os.chdir(test_dir)
+    base_files.write_test_files()
+    os.chdir(this_dir)
+
     os.chdir(common_dir)
     base_files.write_common_files()
     ext = ExtensionFiles.ExtensionFiles(ob, 'fwd', True)
@@ -408,7 +420,9 @@ def populate_package_directories(name, lang):
                     '{0}{1}src{1}{2}{1}packages{1}{0}{1}validator'.
                     format(name, sep, lang),
                     '{0}{1}src{1}{2}{1}packages{1}{0}{1}validator{1}'
-                    'constraints'.format(name, sep, lang)]
+                    'constraints'.format(name, sep, lang),
+                    '{0}{1}src{1}{2}{1}packages{1}{0}{1}validator{1}'
+                    'test'.format(name, sep, lang)]
 
     return directories
 
@@ -437,6 +451,7 @@ def populate_other_library_directories(name, lang):
 
     directories.append('{0}{1}src{1}{2}'.format(name, sep, lang))
     directories.append('{0}{1}src{1}{2}{1}common'.format(name, sep, lang))
+    directories.append('{0}{1}src{1}{2}{1}test'.format(name, sep, lang))
 
     return directories
 
@@ -0,0 +1,143 @@
+#!/usr/bin/env python
+#
+# @file    generateScaledXML.py
+# @brief   function for generating large XML documents for benchmarking
+# @author  Frank Bergmann
+# @author  Sarah Keating
+#
+# <!--------------------------------------------------------------------------
+#
+# Copyright (c) 2013-2018 by the California Institute of Technology
+# (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+# and the University of Heidelberg (Germany), with support from the National
+# Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+# Neither the name of the California Institute of Technology (Caltech), nor
+# of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+# of Heidelberg, nor the names of any contributors, may be used to endorse
+# or promote products derived from this software without specific prior
+# written permission.
+# ------------------------------------------------------------------------ -->
+
+import argparse
+import sys
+import os
+
+from ..parseXML import ParseXML
+from ..util import global_variables as gv
+from ..validation import ScaledXMLFiles
+
+sys.path.append(os.path.dirname(os.path.abspath(__file__)) + '/..')
+
+
+def generate_scaled_xml_for(filename, options):
+    """
+    Parse XML input file, then write a scaled instance document.
+
+    :param filename: the XML input file
+    :param options: the parsed command-line options
+    :return: returns nothing
+    """
+    gv.running_tests = False
+    parser = ParseXML.ParseXML(filename)
+    ob = dict()
+    if gv.code_returned == gv.return_codes['success']:
+        # catch a problem in the parsing
+        try:
+            ob = parser.parse_deviser_xml()
+        except Exception:
+            gv.code_returned = gv.return_codes['parsing error']
+    if gv.code_returned == gv.return_codes['success']:
+        if gv.is_package:
+            generate_scaled_xml(ob, options)
+
+
+def generate_scaled_xml(ob, options):
+    """
+    Wrapper function to invoke the scaled XML constructor.
+
+    :param ob: big dictionary object structure obtained from input XML file.
+    :param options: the parsed command-line options
+    :returns: returns nothing.
+    """
+    output = options.output
+    if output == '':
+        output = '{0}_scaled'.format(ob['name'].lower())
+    ex = ScaledXMLFiles.ScaledXMLFiles(ob, options.list_size, options.depth,
+                                       options.array_size, options.optional,
+                                       options.fan_out, options.seed,
+                                       options.verbose)
+    ex.write_file(output)
+
+
+def get_parser():
+    """
+    Create the parser for the command-line options.
+
+    :returns: the argparse parser.
+    """
+    parser = argparse.ArgumentParser(
+        prog='generateScaledXML.py',
+        description='Write an instance document for a deviser package, '
+                    'scaled for loading and validating benchmarks.')
+    parser.add_argument('xmlfile', help='the deviser package description')
+    parser.add_argument('-o', '--output', default='',
+                        help='file to write, without the .xml extension')
+    parser.add_argument('-n', '--list-size', type=int, default=10,
+                        help='elements in each listOf (default 10)')
+    parser.add_argument('-d', '--depth', type=int, default=2,
+                        help='levels of nested listOfs given list-size '
+                             'elements; deeper ones get one (default 2)')
+    parser.add_argument('-a', '--array-size', type=int, default=10,
+                        help='values in each array (default 10)')
+    parser.add_argument('-p', '--optional', type=float, default=1.0,
+                        help='fraction of optional attributes set '
+                             '(default 1.0)')
+    parser.add_argument('-f', '--fan-out', type=int, default=1,
+                        help='references made to each object before the '
+                             'next is used (default 1)')
+    parser.add_argument('-s', '--seed', type=int, default=0,
+                        help='seed for the generated values (default 0)')
+    parser.add_argument('-v', '--verbose', action='store_true',
+                        help='report the number of objects written')
+    return parser
+
+
+def main(args):
+    """
+    Checks the arguments and then writes the scaled document.
+    """
+    try:
+        options = get_parser().parse_args(args[1:])
+    except SystemExit:
+        gv.code_returned = gv.return_codes['invalid function arguments']
+        return gv.code_returned
+    generate_scaled_xml_for(options.xmlfile, options)
+    if gv.code_returned == gv.return_codes['success']:
+        print('code successfully written')
+    else:
+        print('writing code failed')
+
+    return gv.code_returned
+
+
+if __name__ == '__main__':
+    main(sys.argv)
@@ -1575,6 +1575,41 @@ def is_element(att_type):
     return element
 
 
+def get_column_types(attributes):
+    """
+    Get the C++ types of the vectors a listOf uses when it moves the
+    scalar attributes of its children in columns.
+
+    :param attributes: list representing the attribute nodes of the child
+    :return: list of the distinct types in the order they first appear,
+             which is empty if the listOf has no columns.
+    """
+    column_types = []
+    for attribute in attributes:
+        att_type = attribute['type']
+        if att_type in ['SId', 'SIdRef', 'IDREF', 'ID', 'UnitSId',
+                        'UnitSIdRef', 'string']:
+            column_type = 'std::string'
+        elif att_type == 'double':
+            column_type = 'double'
+        elif att_type == 'int':
+            column_type = 'int'
+        elif att_type == 'uint':
+            column_type = 'unsigned int'
+        elif att_type in ['bool', 'boolean']:
+            column_type = 'bool'
+        elif att_type == 'enum':
+            column_type = attribute['element'] + '_t'
+        else:
+            continue
+        if column_type not in column_types:
+            column_types.append(column_type)
+    # every column has a column of bools saying whether it is set
+    if len(column_types) > 0 and 'bool' not in column_types:
+        column_types.append('bool')
+    return column_types
+
+
 def sort_attributes(all_attributes):
     """
     Create a list of attribute types and names for use with
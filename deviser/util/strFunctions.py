@@ -935,3 +935,23 @@ def is_camel_case(name):
     if lower_name != adjust_name:
         camel_case = True
     return camel_case
+
+
+def upper_snake(name):
+    """
+    Convert a camel case name to upper case words separated by underscores,
+    as used for enumerated constants.
+
+    :param name: the name to convert
+    :return: the converted name
+
+    .. code-block:: default
+
+        upper_snake('numSamples1') -> 'NUM_SAMPLES1'
+        upper_snake('id') -> 'ID'
+        upper_snake('xml:lang') -> 'XML_LANG'
+        upper_snake('SBOTerm') -> 'SBO_TERM'
+    """
+    name = re.sub('([A-Z]+)([A-Z][a-z])', r'\1_\2', name)
+    name = re.sub('([a-z0-9])([A-Z])', r'\1_\2', name)
+    return re.sub('[^A-Za-z0-9]+', '_', name).upper()
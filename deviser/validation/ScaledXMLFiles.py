@@ -0,0 +1,443 @@
+#!/usr/bin/env python
+#
+# @file    ScaledXMLFiles.py
+# @brief   class for generating large instance documents for benchmarking
+# @author  Frank Bergmann
+# @author  Sarah Keating
+#
+# <!--------------------------------------------------------------------------
+#
+# Copyright (c) 2013-2018 by the California Institute of Technology
+# (California, USA), the European Bioinformatics Institute (EMBL-EBI, UK)
+# and the University of Heidelberg (Germany), with support from the National
+# Institutes of Health (USA) under grant R01GM070923.  All rights reserved.
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included in
+# all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+# IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL
+# THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+# Neither the name of the California Institute of Technology (Caltech), nor
+# of the European Bioinformatics Institute (EMBL-EBI), nor of the University
+# of Heidelberg, nor the names of any contributors, may be used to endorse
+# or promote products derived from this software without specific prior
+# written permission.
+# ------------------------------------------------------------------------ -->
+
+
+import random
+from xml.sax.saxutils import quoteattr
+
+from ..base_files import BaseXMLFile
+from ..util import strFunctions, query
+
+
+class ScaledXMLFiles():
+    '''class to write instance documents scaled for benchmarking'''
+
+    def __init__(self, lib_object, list_size=10, depth=2, array_size=10,
+                 optional_fraction=1.0, fan_out=1, seed=0, verbose=False):
+        """
+        Constructor
+
+        :param lib_object: big dictionary structure obtained from the
+            deviser XML file.
+        :param list_size: number of elements in each listOf.
+        :param depth: number of levels of nested listOf elements that
+            receive list_size elements; deeper listOfs get a single element.
+        :param array_size: number of values in each array attribute.
+        :param optional_fraction: probability that an optional attribute
+            is written.
+        :param fan_out: number of references made to each object before
+            the next object is referenced.
+        :param seed: seed for the values, so the same parameters always
+            produce the same document.
+        :param verbose: report the number of objects written.
+        """
+        # members from object
+        self.lib_object = lib_object
+        self.verbose = verbose
+        self.package = strFunctions.lower_first(lib_object['name'])
+        self.reqd = 'false'
+        if lib_object['required']:
+            self.reqd = 'true'
+        self.sbml_classes = lib_object['baseElements']
+
+        # scaling parameters
+        self.list_size = max(1, list_size)
+        self.depth = max(0, depth)
+        self.array_size = max(0, array_size)
+        self.optional_fraction = optional_fraction
+        self.fan_out = max(1, fan_out)
+        self.seed = seed
+
+        self.tree = query.create_object_tree(lib_object, False)
+        self.classes = dict()
+        for element in self.sbml_classes:
+            self.classes[element['name']] = element
+        self.lo_names = self.get_list_of_names()
+
+        self.rng = None
+        self.xml = None
+        self.id_totals = dict()
+        self.id_numbers = dict()
+        self.ref_numbers = dict()
+        self.ref_pools = dict()
+
+    ##########################################################################
+
+    def write_file(self, filename):
+        """
+        Write a scaled instance document.
+
+        :param filename: name of the file (without extension) to write.
+        """
+        self.rng = random.Random(self.seed)
+        self.id_numbers = dict()
+        self.ref_numbers = dict()
+        self.ref_pools = dict()
+        # count the objects first so that every reference, including
+        # those to objects later in the document, resolves
+        self.id_totals = self.count_ids()
+        if self.verbose:
+            for name in sorted(self.id_totals):
+                print('{0}: {1}'.format(name, self.id_totals[name]))
+
+        self.xml = BaseXMLFile.BaseXMLFile(filename, self.package, self.reqd)
+        self.write_document()
+        self.xml.close_file()
+
+    ##########################################################################
+
+    # functions that walk the tree
+
+    def get_list_of_names(self):
+        names = []
+        for element in self.sbml_classes:
+            lo_name = strFunctions.list_of_name(element['name'])
+            if 'lo_elementName' in element \
+                    and len(element['lo_elementName']) > 0:
+                lo_name = element['lo_elementName']
+            names.append(lo_name)
+        return names
+
+    def get_model_branch(self):
+        for branch in self.tree:
+            if branch['base'] == 'Model' and branch['ext'] == 'core':
+                return branch
+        raise Exception('No Model found in the object tree')
+
+    def get_core_branches(self):
+        branches = []
+        for branch in self.tree:
+            if branch['base'] == 'Model':
+                continue
+            name = strFunctions.lower_list_of_name_no_prefix(branch['base'])
+            if name in BaseXMLFile.BaseXMLFile.unwritten_list_ofs:
+                continue
+            branches.append(branch)
+        return branches
+
+    def is_list_of(self, node):
+        return 'name' in node and node['name'] in self.lo_names
+
+    def get_num_items(self, level):
+        # lists nested deeper than the depth get a single item
+        if level < self.depth:
+            return self.list_size
+        return 1
+
+    def get_node_class(self, node):
+        name = node['name'] if 'name' in node else ''
+        if name in self.classes:
+            return name
+        # an element with its own xml name; e.g. boundaryMin is a Boundary
+        for attrib in node.get('attribs', []):
+            parent = attrib.get('parent')
+            if isinstance(parent, dict) and 'name' in parent:
+                return parent['name']
+        return name
+
+    @staticmethod
+    def has_id(node):
+        for attrib in node.get('attribs', []):
+            if attrib['type'] == 'SId':
+                return True
+        return False
+
+    def count_ids(self):
+        totals = dict()
+        self.count_node(self.get_model_branch(), 0, 1, totals)
+        for branch in self.get_core_branches():
+            number = self.get_num_items(0)
+            totals[branch['base']] = number
+            for child in branch['children']:
+                self.count_node(child, 1, number, totals)
+        return totals
+
+    def count_node(self, node, level, number, totals):
+        if self.has_id(node):
+            name = self.get_node_class(node)
+            totals[name] = totals.get(name, 0) + number
+        children = node.get('children', [])
+        if self.is_list_of(node) and len(children) > 0:
+            num_items = self.get_num_items(level)
+            for i in range(0, len(children)):
+                repeats = num_items // len(children)
+                if i < num_items % len(children):
+                    repeats += 1
+                if repeats > 0:
+                    self.count_node(children[i], level + 1, number * repeats,
+                                    totals)
+        else:
+            for child in children:
+                self.count_node(child, level, number, totals)
+
+    ##########################################################################
+
+    # functions that write the document
+
+    def write_document(self):
+        self.xml.write_line_verbatim('<?xml version="1.0" encoding="UTF-8"?>')
+        self.xml.write_line_verbatim(
+            '<sbml level="3" {0}:required="{1}" version="1" xmlns="{2}" '
+            'xmlns:{0}="{3}">'.format(self.package, self.reqd,
+                                      self.xml.corens, self.xml.pkgns))
+        model = self.get_model_branch()
+        attribs = self.get_attributes(model, 'Model')
+        self.write_start_tag(1, 'model', attribs)
+        for child in model['children']:
+            self.write_node(child, 0, 2)
+        for branch in self.get_core_branches():
+            self.write_core_list_of(branch, 2)
+        self.write_end_tag(1, 'model')
+        self.xml.write_line_verbatim('</sbml>')
+
+    def write_core_list_of(self, branch, indent):
+        lo_name = strFunctions.lower_list_of_name_no_prefix(branch['base'])
+        name = strFunctions.lower_first(branch['base'])
+        self.write_start_tag(indent, lo_name, [])
+        for i in range(0, self.get_num_items(0)):
+            attribs = self.get_core_attributes(branch['base'])
+            attribs += self.get_attributes(branch, branch['base'])
+            if len(branch['children']) == 0:
+                self.write_start_tag(indent + 1, name, attribs, True)
+                continue
+            self.write_start_tag(indent + 1, name, attribs)
+            for child in branch['children']:
+                self.write_node(child, 1, indent + 2)
+            self.write_end_tag(indent + 1, name)
+        self.write_end_tag(indent, lo_name)
+
+    def write_node(self, node, level, indent):
+        name = self.get_element_name(node)
+        if name == 'math':
+            self.write_math(indent)
+            return
+        node_class = self.get_node_class(node)
+        attribs = self.get_attributes(node, node_class)
+        text = self.get_array_text(node)
+        children = node.get('children', [])
+        if len(children) == 0 and text is None:
+            self.write_start_tag(indent, name, attribs, True)
+            return
+        if text is not None:
+            self.xml.write_line_verbatim('{0}{1}{2}</{3}>'.format(
+                self.get_indent(indent), self.get_start_tag(name, attribs),
+                text, name))
+            return
+        self.write_start_tag(indent, name, attribs)
+        if self.is_list_of(node):
+            for i in range(0, self.get_num_items(level)):
+                self.write_node(children[i % len(children)], level + 1,
+                                indent + 1)
+        else:
+            for child in children:
+                self.write_node(child, level, indent + 1)
+        self.write_end_tag(indent, name)
+
+    def write_math(self, indent):
+        self.write_start_tag(indent, 'math',
+                             [['xmlns', 'http://www.w3.org/1998/Math/MathML']])
+        self.xml.write_line_verbatim('{0}<cn> {1} </cn>'.format(
+            self.get_indent(indent + 1), self.get_double()))
+        self.write_end_tag(indent, 'math')
+
+    def write_start_tag(self, indent, name, attribs, empty=False):
+        tag = self.get_start_tag(name, attribs, empty)
+        self.xml.write_line_verbatim(self.get_indent(indent) + tag)
+
+    def write_end_tag(self, indent, name):
+        self.xml.write_line_verbatim('{0}</{1}>'.format(
+            self.get_indent(indent), name))
+
+    @staticmethod
+    def get_start_tag(name, attribs, empty=False):
+        tag = '<' + name
+        for [att_name, value] in attribs:
+            tag += ' {0}={1}'.format(att_name, quoteattr(value))
+        if empty:
+            return tag + '/>'
+        return tag + '>'
+
+    @staticmethod
+    def get_indent(indent):
+        return '    ' * indent
+
+    def get_element_name(self, node):
+        name = strFunctions.lower_first(node['name'])
+        ext = node['ext'] if 'ext' in node else self.package
+        if name == 'math' or ext == 'core':
+            return name
+        return '{0}:{1}'.format(self.package, name)
+
+    ##########################################################################
+
+    # functions that create attribute values
+
+    def get_attributes(self, node, node_class):
+        attrib_list = []
+        arrays = self.get_array_names(node)
+        for attrib in node.get('attribs', []):
+            att_type = attrib['type']
+            if query.is_element(att_type) or att_type == 'array' \
+                    or att_type == 'vector':
+                continue
+            # ids are always written so that references can resolve
+            if not attrib['reqd'] and att_type != 'SId' \
+                    and self.rng.random() >= self.optional_fraction:
+                continue
+            pkg = attrib['ext'] if 'ext' in attrib else self.package
+            if pkg == 'core':
+                name = attrib['xml_name']
+            else:
+                name = '{0}:{1}'.format(pkg, attrib['xml_name'])
+            if attrib['name'] in arrays:
+                value = str(self.array_size)
+            else:
+                value = self.get_value(attrib, node_class)
+            attrib_list.append([name, value])
+        return attrib_list
+
+    def get_core_attributes(self, name):
+        attrib_list = [['id', self.get_id(name)]]
+        if name == 'Compartment' or name == 'Parameter':
+            attrib_list.append(['constant', 'false'])
+        elif name == 'Species':
+            attrib_list.append(['compartment',
+                                self.get_id_ref(dict({'name': 'compartment',
+                                                      'element':
+                                                          'Compartment'}))])
+            attrib_list.append(['constant', 'false'])
+            attrib_list.append(['boundaryCondition', 'false'])
+            attrib_list.append(['hasOnlySubstanceUnits', 'false'])
+        return attrib_list
+
+    def get_value(self, attrib, node_class):
+        att_type = attrib['type']
+        if att_type == 'boolean' or att_type == 'bool':
+            value = 'true' if self.rng.random() < 0.5 else 'false'
+        elif att_type == 'double':
+            value = self.get_double()
+        elif query.is_number(att_type):
+            value = '0'
+        elif att_type == 'SId':
+            value = self.get_id(node_class)
+        elif att_type == 'SIdRef':
+            value = self.get_id_ref(attrib)
+        elif att_type == 'enum':
+            value = query.get_first_enum_value(attrib)
+        elif att_type == 'UnitSId' or att_type == 'UnitSIdRef':
+            value = 'dimensionless'
+        else:
+            value = 'someString'
+        return value
+
+    def get_double(self):
+        return '{0:.6g}'.format(self.rng.uniform(0, 1000))
+
+    # the names of the length attributes of the arrays on the node,
+    # e.g. samplesLength for samples
+    @staticmethod
+    def get_array_names(node):
+        names = []
+        for attrib in node.get('attribs', []):
+            if attrib['type'] == 'array':
+                names.append('{0}Length'.format(attrib['name']))
+        return names
+
+    def get_array_text(self, node):
+        for attrib in node.get('attribs', []):
+            if attrib['type'] != 'array':
+                continue
+            if attrib['element'].lower() in ['double', 'float']:
+                values = [self.get_double()
+                          for _ in range(0, self.array_size)]
+            else:
+                values = [str(self.rng.randint(0, 1000))
+                          for _ in range(0, self.array_size)]
+            return ' '.join(values)
+        return None
+
+    def get_id(self, name):
+        number = self.id_numbers.get(name, 0) + 1
+        self.id_numbers[name] = number
+        return '{0}_{1}'.format(strFunctions.lower_first(name), number)
+
+    def get_id_ref(self, attrib):
+        key = attrib['element']
+        if key not in self.ref_pools:
+            self.ref_pools[key] = self.get_ref_pool(key)
+        pool = self.ref_pools[key]
+        if len(pool) == 0:
+            # nothing of this type is written so the reference dangles
+            target = key.split(',')[0] if key else attrib['name']
+            return '{0}_1'.format(strFunctions.lower_first(target))
+        total = 0
+        for [__, number] in pool:
+            total += number
+        count = self.ref_numbers.get(key, 0)
+        self.ref_numbers[key] = count + 1
+        index = (count // self.fan_out) % total
+        for [name, number] in pool:
+            if index < number:
+                return '{0}_{1}'.format(strFunctions.lower_first(name),
+                                        index + 1)
+            index -= number
+
+    # the classes, with the number written of each, that a reference to
+    # one of the given comma-separated classes can point to
+    def get_ref_pool(self, refs):
+        pool = []
+        for ref in refs.split(','):
+            for name in self.get_ref_classes(strFunctions.upper_first(ref)):
+                number = self.id_totals.get(name, 0)
+                if number > 0 and [name, number] not in pool:
+                    pool.append([name, number])
+        return pool
+
+    def get_ref_classes(self, name):
+        if name not in self.classes:
+            return [name]
+        classes = []
+        if not self.classes[name]['abstract']:
+            classes.append(name)
+        for element in self.sbml_classes:
+            if element['baseClass'] == name and element['name'] != name:
+                for derived in self.get_ref_classes(element['name']):
+                    if derived not in classes:
+                        classes.append(derived)
+        return classes
@@ -356,7 +356,9 @@ class ValidationRulesForClass:
                      'reference': ref, 'severity': sev, 'typecode': tc,
                      'lib_sev': lib_sev, 'short': short, 'lib_ref': self.lib_ref,
                      'object': refname, 'attrib': att_name,
-                     'attrib_type': att_type})
+                     'attrib_type': att_type,
+                     'attrib_element': attribute.get('element', ''),
+                     'attrib_reqd': attribute.get('reqd', False)})
 
     @staticmethod
     # write core attribute rule